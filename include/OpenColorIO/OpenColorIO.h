@@ -135,6 +135,19 @@ public:
  */
 extern OCIOEXPORT void ClearAllCaches();
 
+/**
+ * \brief Limit the size of the file cache i.e. the cache of the LUT files loaded by the
+ * FileTransform instances.
+ *
+ * The least recently used files are evicted when one of the limits is exceeded. The memory size
+ * of a cached file is approximated by the size of its content. A zero value means no limit, which
+ * is the default.
+ */
+extern OCIOEXPORT void SetFileCacheCapacity(size_t maxNumEntries, size_t maxSizeInBytes);
+
+/// Get the hit, miss and eviction counters and the current size of the file cache.
+extern OCIOEXPORT CacheStatistics GetFileCacheStatistics();
+
 /**
  * \brief Get the version number for the library, as a dot-delimited string 
  *     (e.g., "1.0.0").
@@ -1589,6 +1602,39 @@ public:
      */
     void clearProcessorCache() noexcept;
 
+    /**
+     * \brief Limit the size of this config's cache of Processor instances.
+     *
+     * The least recently used processors are evicted when one of the limits is exceeded. The
+     * memory size of a processor is approximated by the size of its LUTs. A zero value means no
+     * limit, which is the default.
+     */
+    void setProcessorCacheCapacity(size_t maxNumEntries, size_t maxSizeInBytes) noexcept;
+
+    /// Get the hit, miss and eviction counters and the current size of the Processor cache.
+    CacheStatistics getProcessorCacheStatistics() const noexcept;
+
+    /**
+     * \brief Limit the size of the caches of optimized, CPU and GPU processors held by each
+     * Processor instance created afterwards by this config.
+     *
+     * The three caches of a processor are limited independently. The memory size of a cached
+     * processor is approximated by the size of its LUTs. A zero value means no limit, which is the
+     * default. Call clearProcessorCache() to also apply it to the processors already cached.
+     */
+    void setSubProcessorCacheCapacity(size_t maxNumEntries, size_t maxSizeInBytes) noexcept;
+
+    /// Get the optimizations explicitly enabled for the processors created by this config.
+    OptimizationOptIns getOptimizationOptIns() const noexcept;
+
+    /**
+     * \brief Enable optimizations that are never part of the OptimizationFlags presets, for the
+     * processors created afterwards by this config (i.e. the processor cache is cleared).
+     *
+     * By default, none is enabled.
+     */
+    void setOptimizationOptIns(OptimizationOptIns optIns) noexcept;
+
     /// Set the ConfigIOProxy object used to provision the config and LUTs from somewhere other
     /// than the file system.  (This is set on the config's embedded Context object.)
     void setConfigIOProxy(ConfigIOProxyRcPtr ciop);
@@ -2646,6 +2692,12 @@ public:
      */
     const char * getCacheID() const;
 
+    /**
+     * Get the hit, miss and eviction counters and the current size of the caches of optimized,
+     * CPU and GPU processors held by this processor, summed over the three caches.
+     */
+    CacheStatistics getSubProcessorCacheStatistics() const noexcept;
+
     /**
      * The ProcessorMetadata contains technical information
      * such as the number of files and looks used in the processor.
@@ -2796,6 +2848,17 @@ private:
 ///////////////////////////////////////////////////////////////////////////
 // CPUProcessor
 
+/// The processing statistics of one stage of a CPU processor (refer to CPUProcessor::enableStats).
+struct OCIOEXPORT CPUProcessorStageStats
+{
+    /// The stage name i.e. the description of a CPU op.
+    const char * m_name = "";
+    /// The accumulated processing time in seconds (summed over all the threads).
+    double m_time = 0.;
+    /// The accumulated number of processed pixels.
+    unsigned long long m_numPixels = 0;
+};
+
 class OCIOEXPORT CPUProcessor
 {
 public:
@@ -2839,6 +2902,50 @@ public:
     void apply(const ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    /**
+     * \brief Apply to an image using several threads.
+     *
+     * The image is split into tiles of scanlines which are processed concurrently by
+     * numThreads threads, the calling thread being one of them. A value of 0 uses all
+     * the hardware threads available. The result is identical to the single-threaded
+     * apply, and the method returns once the complete image is processed.
+     */
+    void apply(const ImageDesc & imgDesc, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc, unsigned numThreads) const;
+
+    /**
+     * \brief Pre-allocate the processing buffers used by the image apply methods.
+     *
+     * The image apply methods use small intermediate buffers which are pooled by the CPU
+     * processor and reused by the following apply calls. Pre-allocating the buffers for
+     * numThreads concurrent threads (i.e. the numThreads of the multithreaded apply, or the
+     * number of host threads concurrently calling apply) then avoids any heap allocation in
+     * the apply calls, which benefits hosts processing many small image tiles. A value of 0
+     * uses all the hardware threads available.
+     */
+    void reserveProcessingBuffers(unsigned numThreads) const;
+
+    /**
+     * \brief Enable the collection of the processing statistics of the image apply methods.
+     *
+     * When enabled, the image apply methods accumulate the processing time and the number of
+     * pixels of each stage of the processing i.e. the input bit-depth op, each CPU op and the
+     * output bit-depth op. The input and output bit-depth op stages include the reading of the
+     * source scanlines and the writing of the destination scanlines (e.g. the channel
+     * reordering). Disabled, the only cost is one test per apply call. The statistics are
+     * enabled by default when the OCIO_CPU_PROCESSOR_STATS env. variable is set.
+     *
+     * \note The single pixel apply methods are never accounted for.
+     */
+    void enableStats(bool enable) const;
+    bool isStatsEnabled() const noexcept;
+    /// Reset all the accumulated statistics to zero.
+    void resetStats() const;
+    /// The stages are the CPU ops in processing order, including the bit-depth ops.
+    int getNumStatsStages() const noexcept;
+    /// Throws if the index is out of range. The name remains valid for the processor lifetime.
+    CPUProcessorStageStats getStatsStage(int index) const;
+
     /**
      * Apply to a single pixel respecting that the input and output bit-depths
      * be 32-bit float and the image buffer be packed RGB/RGBA.
@@ -2945,6 +3052,16 @@ private:
 };
 
 
+/// A display / view target to bake (refer to Baker::bake).
+struct OCIOEXPORT BakerTarget
+{
+    std::string m_display;
+    std::string m_view;
+    /// The *optional* looks to apply (refer to Baker::setLooks).
+    std::string m_looks;
+    /// The stream receiving the LUT.
+    std::ostream * m_output = nullptr;
+};
 
 /**
  * In certain situations it is necessary to serialize transforms into a variety
@@ -3048,6 +3165,16 @@ public:
     /// Bake the LUT into the output stream.
     void bake(std::ostream & os) const;
 
+    /**
+     * Bake a LUT per display / view target, for example all the display / view / looks
+     * combinations of a show. All the other settings (e.g. the format, the input and shaper
+     * spaces, the sizes) are the ones of this baker.
+     *
+     * The targets share the config of the baker so the processors (and the LUT files they
+     * use) are only built once for all the targets.
+     */
+    void bake(const std::vector<BakerTarget> & targets) const;
+
     /// Get the number of LUT bakers.
     static int getNumFormats();
 
@@ -629,6 +629,20 @@ enum OptimizationFlags : unsigned long
      */
     OPTIMIZATION_NO_DYNAMIC_PROPERTIES           = 0x10000000,
 
+    /**
+     * Bake costly op chains (e.g. ACES 2 output transform, grading ops) into 1D/3D LUTs when the
+     * baking error is negligible. It applies to the CPU processors and to the optimized
+     * processors, whose baked LUTs are then written out (e.g. to CLF). It is not part of
+     * OPTIMIZATION_DEFAULT, only OPTIMIZATION_DRAFT (i.e. OPTIMIZATION_ALL) includes it.
+     */
+    OPTIMIZATION_BAKE_LUT                        = 0x20000000,
+
+    /**
+     * For CPU processor, use a four-pixel SSE2 renderer for the forward ACES 2.0 output transform
+     * (the max error is around 1e-3). Only OPTIMIZATION_DRAFT includes it.
+     */
+    OPTIMIZATION_FAST_ACES_OUTPUT_TRANSFORM_20   = 0x80000000,
+
     /// Apply all possible optimizations.
     OPTIMIZATION_ALL                             = 0xFFFFFFFF,
 
@@ -685,6 +699,32 @@ enum ProcessorCacheFlags : unsigned int
     PROCESSOR_CACHE_DEFAULT = (PROCESSOR_CACHE_ENABLED | PROCESSOR_CACHE_SHARE_DYN_PROPERTIES)
 };
 
+//!cpp:type:: Enum of the optimizations that no :cpp:enum:`OptimizationFlags` preset (not even
+// OPTIMIZATION_ALL) can enable, as they trade memory, speed or accuracy in a way the caller must
+// explicitly accept. They apply to the processors created afterwards by a :cpp:class:`Config`
+// instance i.e. see Config::setOptimizationOptIns().
+enum OptimizationOptIns : unsigned int
+{
+    OPTIMIZATION_OPT_IN_NONE                  = 0x00,
+
+    // With OPTIMIZATION_LUT_INV_FAST, bake the inverse Lut3D on a grid twice as fine as the
+    // forward LUT (up to 129 entries per dimension) rather than on a grid of the forward LUT
+    // size (and at least 48). This is more accurate but slower to build and uses more memory.
+    OPTIMIZATION_OPT_IN_LUT_INV_FAST_HIGH_RES = 0x01
+};
+
+//!cpp:type:: Statistics of an internal cache i.e. the processor cache of a :cpp:class:`Config`
+// instance or the file cache used by the :cpp:class:`FileTransform`. The counters accumulate
+// since the cache creation, clearing the cache does not reset them.
+struct OCIOEXPORT CacheStatistics
+{
+    size_t m_numEntries{ 0 };  // Number of entries in the cache.
+    size_t m_sizeInBytes{ 0 }; // Approximate memory size of the entries.
+    size_t m_hits{ 0 };        // Number of requests finding an existing entry.
+    size_t m_misses{ 0 };      // Number of requests creating a new entry.
+    size_t m_evictions{ 0 };   // Number of entries evicted to respect the cache capacity.
+};
+
 // Conversion
 
 extern OCIOEXPORT const char * BoolToString(bool val);
@@ -785,6 +825,21 @@ extern OCIOEXPORT const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR;
  */
 extern OCIOEXPORT const char * OCIO_USER_CATEGORIES_ENVVAR;
 
+/**
+ * The envvar 'OCIO_LAZY_CONFIG_LOADING' defers the creation of the color space transforms of
+ * a config file until the color space is first requested (e.g. by Config::getColorSpace() or
+ * when building a processor). The names, aliases, families and categories are still read when
+ * the config is opened. Set the value to empty or to '0' to not use it.
+ */
+extern OCIOEXPORT const char * OCIO_LAZY_CONFIG_LOADING_ENVVAR;
+
+/**
+ * The envvar 'OCIO_CPU_PROCESSOR_STATS' enables by default the collection of the processing
+ * statistics of the CPU processors (refer to CPUProcessor::enableStats()). Set the value to
+ * empty or to '0' to not use it.
+ */
+extern OCIOEXPORT const char * OCIO_CPU_PROCESSOR_STATS_ENVVAR;
+
 // TODO: Move to .rst
 /*!rst::
 Roles
@@ -948,6 +1003,15 @@ extern OCIOEXPORT const char * OCIO_DISABLE_PROCESSOR_CACHES;
 // variable to disable the fallback.
 extern OCIOEXPORT const char * OCIO_DISABLE_CACHE_FALLBACK;
 
+//!rst::
+// .. c:var:: const char * OCIO_LUT_CACHE_DIR
+//
+// Path to an existing directory where the ops built from the LUT files are persisted in a binary
+// form, so that later processes skip the parsing of the same files. The entries are invalidated
+// when the size or the modification time of the LUT file changes. The directory may be shared by
+// concurrent processes. Leave the variable unset or empty to not use it.
+extern OCIOEXPORT const char * OCIO_LUT_CACHE_DIR;
+
 
 // Archive config feature
 // Default filename (with extension) of an config.
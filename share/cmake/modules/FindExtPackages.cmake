@@ -115,6 +115,10 @@ ocio_handle_dependency(  minizip-ng REQUIRED ALLOW_INSTALL
                          RECOMMENDED_VERSION 3.0.7
                          RECOMMENDED_VERSION_REASON "Latest version tested with OCIO")
 
+# Threads
+# The multithreaded CPU processing relies on std::thread.
+find_package(Threads REQUIRED)
+
 ###############################################################################
 ##
 ## Optional dependencies
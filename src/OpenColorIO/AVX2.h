@@ -8,10 +8,13 @@
 #include "CPUInfo.h"
 #if OCIO_USE_AVX2
 
+#include <algorithm>
 #include <immintrin.h>
+#include <limits>
 
 #include <OpenColorIO/OpenColorIO.h>
 #include "BitDepthUtils.h"
+#include "WideOpCPU.h"
 
 // Macros for alignment declarations
 #define AVX2_SIMD_BYTES 32
@@ -299,6 +302,325 @@ struct AVX2RGBAPack<BIT_DEPTH_F32>
     }
 };
 
+// Load eight RGBA pixels and transpose them to one register per channel. Note that, as for
+// avx2RGBATranspose_4x4_4x4(), the pixels end up in an even/odd shuffled order which is fine
+// for per channel processing as long as avx2StoreRGBA() is used to write them back.
+inline void avx2LoadRGBA(const float * in, __m256 & r, __m256 & g, __m256 & b, __m256 & a)
+{
+    avx2RGBATranspose_4x4_4x4(_mm256_loadu_ps(in +  0), _mm256_loadu_ps(in +  8),
+                              _mm256_loadu_ps(in + 16), _mm256_loadu_ps(in + 24),
+                              r, g, b, a);
+}
+
+inline void avx2StoreRGBA(float * out, __m256 r, __m256 g, __m256 b, __m256 a)
+{
+    __m256 rgba0, rgba1, rgba2, rgba3;
+    avx2RGBATranspose_4x4_4x4(r, g, b, a, rgba0, rgba1, rgba2, rgba3);
+
+    _mm256_storeu_ps(out +  0, rgba0);
+    _mm256_storeu_ps(out +  8, rgba1);
+    _mm256_storeu_ps(out + 16, rgba2);
+    _mm256_storeu_ps(out + 24, rgba3);
+}
+
+// Apply a per channel function to RGBA pixels, eight pixels at a time. The remaining pixels
+// are processed using a zero padded buffer ('in' and 'out' could be the same buffer).
+template<typename Func>
+inline void avx2ProcessRGBA(const float * in, float * out, long numPixels, Func func)
+{
+    __m256 r, g, b, a;
+
+    long idx = 0;
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        avx2LoadRGBA(in, r, g, b, a);
+        func(r, g, b, a);
+        avx2StoreRGBA(out, r, g, b, a);
+
+        in  += 32;
+        out += 32;
+    }
+
+    if (idx < numPixels)
+    {
+        const long numValues = (numPixels - idx) * 4;
+
+        float pixels[32] = { 0.0f };
+        std::copy(in, in + numValues, pixels);
+
+        avx2LoadRGBA(pixels, r, g, b, a);
+        func(r, g, b, a);
+        avx2StoreRGBA(pixels, r, g, b, a);
+
+        std::copy(pixels, pixels + numValues, out);
+    }
+}
+
+// Load eight packed RGB pixels and transpose them to one register per channel, in the same
+// order as avx2LoadRGBA(). The alpha is zero.
+inline void avx2LoadRGB(const float * in, __m256 & r, __m256 & g, __m256 & b, __m256 & a)
+{
+    // Each pixel is loaded with the red value of the next one, except the last pixel which is
+    // loaded with the blue value of the previous one to not read past the 24 values.
+    const __m128 last = _mm_loadu_ps(in + 20);
+
+    const __m256 row0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in +  0)),
+                                             _mm_loadu_ps(in +  3), 1);
+    const __m256 row1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in +  6)),
+                                             _mm_loadu_ps(in +  9), 1);
+    const __m256 row2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 12)),
+                                             _mm_loadu_ps(in + 15), 1);
+    const __m256 row3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 18)),
+                                             _mm_shuffle_ps(last, last, _MM_SHUFFLE(3, 3, 2, 1)),
+                                             1);
+
+    avx2RGBATranspose_4x4_4x4(row0, row1, row2, row3, r, g, b, a);
+
+    a = _mm256_setzero_ps();
+}
+
+inline void avx2StoreRGB(float * out, __m256 r, __m256 g, __m256 b)
+{
+    __m256 row0, row1, row2, row3;
+    avx2RGBATranspose_4x4_4x4(r, g, b, _mm256_setzero_ps(), row0, row1, row2, row3);
+
+    // The fourth value of each store is overwritten by the next pixel, and the last pixel only
+    // writes its three values.
+    _mm_storeu_ps(out +  0, _mm256_castps256_ps128(row0));
+    _mm_storeu_ps(out +  3, _mm256_extractf128_ps(row0, 1));
+    _mm_storeu_ps(out +  6, _mm256_castps256_ps128(row1));
+    _mm_storeu_ps(out +  9, _mm256_extractf128_ps(row1, 1));
+    _mm_storeu_ps(out + 12, _mm256_castps256_ps128(row2));
+    _mm_storeu_ps(out + 15, _mm256_extractf128_ps(row2, 1));
+    _mm_storeu_ps(out + 18, _mm256_castps256_ps128(row3));
+
+    const __m128 last = _mm256_extractf128_ps(row3, 1);
+    _mm_storel_pi((__m64 *)(out + 21), last);
+    _mm_store_ss(out + 23, _mm_movehl_ps(last, last));
+}
+
+// Apply a per channel function to packed RGB pixels, eight pixels at a time. The function gets
+// a zero alpha which is then ignored. The remaining pixels are processed using a zero padded
+// buffer ('in' and 'out' could be the same buffer).
+template<typename Func>
+inline void avx2ProcessRGB(const float * in, float * out, long numPixels, Func func)
+{
+    __m256 r, g, b, a;
+
+    long idx = 0;
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        avx2LoadRGB(in, r, g, b, a);
+        func(r, g, b, a);
+        avx2StoreRGB(out, r, g, b);
+
+        in  += 24;
+        out += 24;
+    }
+
+    if (idx < numPixels)
+    {
+        const long numValues = (numPixels - idx) * 3;
+
+        float pixels[24] = { 0.0f };
+        std::copy(in, in + numValues, pixels);
+
+        avx2LoadRGB(pixels, r, g, b, a);
+        func(r, g, b, a);
+        avx2StoreRGB(pixels, r, g, b);
+
+        std::copy(pixels, pixels + numValues, out);
+    }
+}
+
+// Apply a per channel function to planar pixels, eight pixels at a time. The planes are in the
+// R, G, B, A order and a null alpha plane is processed as a zero alpha which is not written.
+// The remaining pixels are processed using zero padded buffers.
+template<typename Func>
+inline void avx2ProcessPlanar(const float * const * inPlanes,
+                              float * const * outPlanes,
+                              long numPixels,
+                              Func func)
+{
+    const bool hasAlpha = inPlanes[3] != nullptr;
+
+    __m256 r, g, b, a = _mm256_setzero_ps();
+
+    long idx = 0;
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        r = _mm256_loadu_ps(inPlanes[0] + idx);
+        g = _mm256_loadu_ps(inPlanes[1] + idx);
+        b = _mm256_loadu_ps(inPlanes[2] + idx);
+        a = hasAlpha ? _mm256_loadu_ps(inPlanes[3] + idx) : _mm256_setzero_ps();
+
+        func(r, g, b, a);
+
+        _mm256_storeu_ps(outPlanes[0] + idx, r);
+        _mm256_storeu_ps(outPlanes[1] + idx, g);
+        _mm256_storeu_ps(outPlanes[2] + idx, b);
+        if (hasAlpha)
+        {
+            _mm256_storeu_ps(outPlanes[3] + idx, a);
+        }
+    }
+
+    if (idx < numPixels)
+    {
+        const int numChannels = hasAlpha ? 4 : 3;
+        const long numValues = numPixels - idx;
+
+        float pixels[4][8] = { { 0.0f } };
+        for (int c = 0; c < numChannels; ++c)
+        {
+            std::copy(inPlanes[c] + idx, inPlanes[c] + numPixels, pixels[c]);
+        }
+
+        r = _mm256_loadu_ps(pixels[0]);
+        g = _mm256_loadu_ps(pixels[1]);
+        b = _mm256_loadu_ps(pixels[2]);
+        a = _mm256_loadu_ps(pixels[3]);
+
+        func(r, g, b, a);
+
+        _mm256_storeu_ps(pixels[0], r);
+        _mm256_storeu_ps(pixels[1], g);
+        _mm256_storeu_ps(pixels[2], b);
+        _mm256_storeu_ps(pixels[3], a);
+
+        for (int c = 0; c < numChannels; ++c)
+        {
+            std::copy(pixels[c], pixels[c] + numValues, outPlanes[c] + idx);
+        }
+    }
+}
+
+// Apply a kernel to RGBA, packed RGB or planar F32 pixels. A kernel is a per channel function
+// object built from the op parameters (refer to WideOpCPU.h) i.e.
+//     explicit Kernel(const float * params);
+//     void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & a) const;
+template<typename Kernel>
+void avx2ApplyKernel(const float * params, const float * in, float * out, long numPixels)
+{
+    avx2ProcessRGBA(in, out, numPixels, Kernel(params));
+}
+
+template<typename Kernel>
+void avx2ApplyKernelRGB(const float * params, const float * in, float * out, long numPixels)
+{
+    avx2ProcessRGB(in, out, numPixels, Kernel(params));
+}
+
+template<typename Kernel>
+void avx2ApplyKernelPlanar(const float * params,
+                           const float * const * inPlanes,
+                           float * const * outPlanes,
+                           long numPixels)
+{
+    avx2ProcessPlanar(inPlanes, outPlanes, numPixels, Kernel(params));
+}
+
+// Get the wide vector renderer of a kernel for all the pixel layouts.
+template<typename Kernel>
+WideOpCPURenderer avx2GetKernelRenderer()
+{
+    WideOpCPURenderer renderer;
+    renderer.apply       = avx2ApplyKernel<Kernel>;
+    renderer.applyRGB    = avx2ApplyKernelRGB<Kernel>;
+    renderer.applyPlanar = avx2ApplyKernelPlanar<Kernel>;
+    return renderer;
+}
+
+// log2 function processing eight values at once.
+//
+// This is the AVX2 version of sseLog2() i.e. same argument reduction and same Chebyshev
+// polynomial evaluated with separate multiplies and adds, so the results are identical to the
+// SSE2 version. Note that the translation units using it must hence not be compiled with
+// floating-point contraction (refer to src/OpenColorIO/CMakeLists.txt).
+inline __m256 avx2Log2(__m256 x)
+{
+    const __m256i emask = _mm256_set1_epi32(0x7F800000);
+
+    // y = log2( x ) = exponent + log2( mantissa )
+    const __m256 mantissa = _mm256_or_ps(_mm256_andnot_ps(_mm256_castsi256_ps(emask), x),
+                                         _mm256_set1_ps(1.0f));
+
+    // Chebyshev coefficients of sseLog2() i.e. PNLOG5 to PNLOG0 in SSE.h.
+    const __m256 pnlog5 = _mm256_set1_ps((float)+4.487361286440374006195e-2);
+    const __m256 pnlog4 = _mm256_set1_ps((float)-4.165637071209677112635e-1);
+    const __m256 pnlog3 = _mm256_set1_ps((float)+1.631148826119436277100);
+    const __m256 pnlog2 = _mm256_set1_ps((float)-3.550793018041176193407);
+    const __m256 pnlog1 = _mm256_set1_ps((float)+5.091710879305474367557);
+    const __m256 pnlog0 = _mm256_set1_ps((float)-2.800364054395965731506);
+
+    __m256 log2 = _mm256_add_ps(_mm256_mul_ps(pnlog5, mantissa), pnlog4);
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), pnlog3);
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), pnlog2);
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), pnlog1);
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), pnlog0);
+
+    const __m256i exponent
+        = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(x), emask), 23),
+                           _mm256_set1_epi32(127));
+
+    return _mm256_add_ps(log2, _mm256_cvtepi32_ps(exponent));
+}
+
+// exp2 function processing eight values at once (see sseExp2() for the details).
+inline __m256 avx2Exp2(__m256 x)
+{
+    // y = exp2( x ) = exp2( floor(x) ) * exp2( fraction )
+
+    // Truncation rounds towards zero so subtract one for negative values (and NaNs) to
+    // compute floor(x). Out of range values are handled by the checks at the bottom.
+    const __m256i floor_x
+        = _mm256_add_epi32(_mm256_cvttps_epi32(x),
+                           _mm256_castps_si256(_mm256_cmp_ps(_mm256_setzero_ps(), x,
+                                                             _CMP_NLE_UQ)));
+
+    const __m256 zf
+        = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(floor_x,
+                                                                 _mm256_set1_epi32(127)),
+                                                23));
+
+    const __m256 fraction = _mm256_sub_ps(x, _mm256_cvtepi32_ps(floor_x));
+
+    // Chebyshev coefficients of sseExp2() i.e. PNEXP4 to PNEXP0 in SSE.h.
+    const __m256 pnexp4 = _mm256_set1_ps((float)1.353416792833547468620e-2);
+    const __m256 pnexp3 = _mm256_set1_ps((float)5.201146058412685018921e-2);
+    const __m256 pnexp2 = _mm256_set1_ps((float)2.414427569091865207710e-1);
+    const __m256 pnexp1 = _mm256_set1_ps((float)6.930038344665415134202e-1);
+    const __m256 pnexp0 = _mm256_set1_ps((float)1.000002593370603213644);
+
+    __m256 mexp = _mm256_add_ps(_mm256_mul_ps(pnexp4, fraction), pnexp3);
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), pnexp2);
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), pnexp1);
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), pnexp0);
+
+    __m256 exp2 = _mm256_mul_ps(zf, mexp);
+
+    // Handle underflow.
+    exp2 = _mm256_andnot_ps(_mm256_cmp_ps(x, _mm256_set1_ps(-126.0f), _CMP_LT_OQ), exp2);
+
+    // Handle overflow.
+    exp2 = _mm256_blendv_ps(exp2,
+                            _mm256_set1_ps(std::numeric_limits<float>::infinity()),
+                            _mm256_cmp_ps(x, _mm256_set1_ps(128.0f), _CMP_GE_OQ));
+
+    return exp2;
+}
+
+// Power function processing eight values at once (see ssePower() for the details).
+//
+// Results from base values smaller than zero are mapped to zero.
+inline __m256 avx2Power(__m256 x, __m256 exp)
+{
+    __m256 values = avx2Exp2(_mm256_mul_ps(exp, avx2Log2(x)));
+
+    // Handle values where base is smaller or equal than zero.
+    return _mm256_and_ps(values, _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX2
@@ -8,10 +8,13 @@
 #include "CPUInfo.h"
 #if OCIO_USE_AVX512
 
+#include <algorithm>
 #include <immintrin.h>
+#include <limits>
 
 #include <OpenColorIO/OpenColorIO.h>
 #include "BitDepthUtils.h"
+#include "WideOpCPU.h"
 
 // Macros for alignment declarations
 #define AVX512_SIMD_BYTES 64
@@ -460,6 +463,276 @@ struct AVX512RGBAPack<BIT_DEPTH_F32>
     }
 };
 
+// Apply a per channel function to RGBA pixels, sixteen pixels at a time. The remaining pixels
+// are processed using the masked load & store ('in' and 'out' could be the same buffer).
+template<typename Func>
+inline void avx512ProcessRGBA(const float * in, float * out, long numPixels, Func func)
+{
+    __m512 r, g, b, a;
+
+    long idx = 0;
+    for (; idx + 16 <= numPixels; idx += 16)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(in, r, g, b, a);
+        func(r, g, b, a);
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(out, r, g, b, a);
+
+        in  += 64;
+        out += 64;
+    }
+
+    if (idx < numPixels)
+    {
+        const uint32_t remaining = (uint32_t)(numPixels - idx);
+
+        AVX512RGBAPack<BIT_DEPTH_F32>::LoadMasked(in, r, g, b, a, remaining);
+        func(r, g, b, a);
+        AVX512RGBAPack<BIT_DEPTH_F32>::StoreMasked(out, r, g, b, a, remaining);
+    }
+}
+
+// Load sixteen packed RGB pixels (i.e. only the first 'numValues' values of the 48 ones) and
+// permute them to one register per channel. The alpha is zero.
+inline void avx512LoadRGB(const float * in, __m512 & r, __m512 & g, __m512 & b, __m512 & a,
+                          uint32_t numValues = 48)
+{
+    const uint64_t mask = (uint64_t(1) << numValues) - 1;
+
+    const __m512 rgb0 = _mm512_maskz_loadu_ps(_mm512_int2mask((mask >>  0) & 0xFFFF), in +  0);
+    const __m512 rgb1 = _mm512_maskz_loadu_ps(_mm512_int2mask((mask >> 16) & 0xFFFF), in + 16);
+    const __m512 rgb2 = _mm512_maskz_loadu_ps(_mm512_int2mask((mask >> 32) & 0xFFFF), in + 32);
+
+    // The first permutation gathers the channel values of the first two registers and the
+    // second one adds the values of the third register.
+    const __m512i r01 = _mm512_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0);
+    const __m512i r2  = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29);
+    const __m512i g01 = _mm512_setr_epi32(1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0);
+    const __m512i g2  = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30);
+    const __m512i b01 = _mm512_setr_epi32(2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0);
+    const __m512i b2  = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31);
+
+    r = _mm512_permutex2var_ps(_mm512_permutex2var_ps(rgb0, r01, rgb1), r2, rgb2);
+    g = _mm512_permutex2var_ps(_mm512_permutex2var_ps(rgb0, g01, rgb1), g2, rgb2);
+    b = _mm512_permutex2var_ps(_mm512_permutex2var_ps(rgb0, b01, rgb1), b2, rgb2);
+    a = _mm512_setzero_ps();
+}
+
+inline void avx512StoreRGB(float * out, __m512 r, __m512 g, __m512 b, uint32_t numValues = 48)
+{
+    // The first permutation interleaves the red and green values and the second one adds the
+    // blue values.
+    const __m512i rg0 = _mm512_setr_epi32(0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5);
+    const __m512i b0  = _mm512_setr_epi32(0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15);
+    const __m512i rg1 = _mm512_setr_epi32(21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26);
+    const __m512i b1  = _mm512_setr_epi32(0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15);
+    const __m512i rg2 = _mm512_setr_epi32(0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0);
+    const __m512i b2  = _mm512_setr_epi32(26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31);
+
+    const __m512 rgb0 = _mm512_permutex2var_ps(_mm512_permutex2var_ps(r, rg0, g), b0, b);
+    const __m512 rgb1 = _mm512_permutex2var_ps(_mm512_permutex2var_ps(r, rg1, g), b1, b);
+    const __m512 rgb2 = _mm512_permutex2var_ps(_mm512_permutex2var_ps(r, rg2, g), b2, b);
+
+    const uint64_t mask = (uint64_t(1) << numValues) - 1;
+
+    _mm512_mask_storeu_ps(out +  0, _mm512_int2mask((mask >>  0) & 0xFFFF), rgb0);
+    _mm512_mask_storeu_ps(out + 16, _mm512_int2mask((mask >> 16) & 0xFFFF), rgb1);
+    _mm512_mask_storeu_ps(out + 32, _mm512_int2mask((mask >> 32) & 0xFFFF), rgb2);
+}
+
+// Apply a per channel function to packed RGB pixels, sixteen pixels at a time. The function
+// gets a zero alpha which is then ignored. The remaining pixels are processed using the masked
+// load & store ('in' and 'out' could be the same buffer).
+template<typename Func>
+inline void avx512ProcessRGB(const float * in, float * out, long numPixels, Func func)
+{
+    __m512 r, g, b, a;
+
+    long idx = 0;
+    for (; idx + 16 <= numPixels; idx += 16)
+    {
+        avx512LoadRGB(in, r, g, b, a);
+        func(r, g, b, a);
+        avx512StoreRGB(out, r, g, b);
+
+        in  += 48;
+        out += 48;
+    }
+
+    if (idx < numPixels)
+    {
+        const uint32_t numValues = (uint32_t)(numPixels - idx) * 3;
+
+        avx512LoadRGB(in, r, g, b, a, numValues);
+        func(r, g, b, a);
+        avx512StoreRGB(out, r, g, b, numValues);
+    }
+}
+
+// Apply a per channel function to planar pixels, sixteen pixels at a time. The planes are in
+// the R, G, B, A order and a null alpha plane is processed as a zero alpha which is not
+// written. The remaining pixels are processed using the masked load & store.
+template<typename Func>
+inline void avx512ProcessPlanar(const float * const * inPlanes,
+                                float * const * outPlanes,
+                                long numPixels,
+                                Func func)
+{
+    const bool hasAlpha = inPlanes[3] != nullptr;
+
+    __m512 r, g, b, a = _mm512_setzero_ps();
+
+    long idx = 0;
+    for (; idx < numPixels; idx += 16)
+    {
+        const uint32_t remaining = (uint32_t)std::min(numPixels - idx, 16L);
+        const __mmask16 k = _mm512_int2mask((1 << remaining) - 1);
+
+        r = _mm512_maskz_loadu_ps(k, inPlanes[0] + idx);
+        g = _mm512_maskz_loadu_ps(k, inPlanes[1] + idx);
+        b = _mm512_maskz_loadu_ps(k, inPlanes[2] + idx);
+        a = hasAlpha ? _mm512_maskz_loadu_ps(k, inPlanes[3] + idx) : _mm512_setzero_ps();
+
+        func(r, g, b, a);
+
+        _mm512_mask_storeu_ps(outPlanes[0] + idx, k, r);
+        _mm512_mask_storeu_ps(outPlanes[1] + idx, k, g);
+        _mm512_mask_storeu_ps(outPlanes[2] + idx, k, b);
+        if (hasAlpha)
+        {
+            _mm512_mask_storeu_ps(outPlanes[3] + idx, k, a);
+        }
+    }
+}
+
+// Apply a kernel to RGBA, packed RGB or planar F32 pixels. A kernel is a per channel function
+// object built from the op parameters (refer to WideOpCPU.h) i.e.
+//     explicit Kernel(const float * params);
+//     void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & a) const;
+template<typename Kernel>
+void avx512ApplyKernel(const float * params, const float * in, float * out, long numPixels)
+{
+    avx512ProcessRGBA(in, out, numPixels, Kernel(params));
+}
+
+template<typename Kernel>
+void avx512ApplyKernelRGB(const float * params, const float * in, float * out, long numPixels)
+{
+    avx512ProcessRGB(in, out, numPixels, Kernel(params));
+}
+
+template<typename Kernel>
+void avx512ApplyKernelPlanar(const float * params,
+                             const float * const * inPlanes,
+                             float * const * outPlanes,
+                             long numPixels)
+{
+    avx512ProcessPlanar(inPlanes, outPlanes, numPixels, Kernel(params));
+}
+
+// Get the wide vector renderer of a kernel for all the pixel layouts.
+template<typename Kernel>
+WideOpCPURenderer avx512GetKernelRenderer()
+{
+    WideOpCPURenderer renderer;
+    renderer.apply       = avx512ApplyKernel<Kernel>;
+    renderer.applyRGB    = avx512ApplyKernelRGB<Kernel>;
+    renderer.applyPlanar = avx512ApplyKernelPlanar<Kernel>;
+    return renderer;
+}
+
+// log2 function processing sixteen values at once.
+//
+// This is the AVX-512 version of sseLog2() i.e. same argument reduction and same Chebyshev
+// polynomial evaluated with separate multiplies and adds, so the results are identical to the
+// SSE2 version. Note that the translation units using it must hence not be compiled with
+// floating-point contraction (refer to src/OpenColorIO/CMakeLists.txt).
+// Note: Only AVX512F instructions are used so the bit-wise operations are done on integers.
+inline __m512 avx512Log2(__m512 x)
+{
+    const __m512i emask = _mm512_set1_epi32(0x7F800000);
+
+    // y = log2( x ) = exponent + log2( mantissa )
+    const __m512 mantissa
+        = _mm512_castsi512_ps(_mm512_or_si512(_mm512_andnot_si512(emask, _mm512_castps_si512(x)),
+                                              _mm512_castps_si512(_mm512_set1_ps(1.0f))));
+
+    // Chebyshev coefficients of sseLog2() i.e. PNLOG5 to PNLOG0 in SSE.h.
+    const __m512 pnlog5 = _mm512_set1_ps((float)+4.487361286440374006195e-2);
+    const __m512 pnlog4 = _mm512_set1_ps((float)-4.165637071209677112635e-1);
+    const __m512 pnlog3 = _mm512_set1_ps((float)+1.631148826119436277100);
+    const __m512 pnlog2 = _mm512_set1_ps((float)-3.550793018041176193407);
+    const __m512 pnlog1 = _mm512_set1_ps((float)+5.091710879305474367557);
+    const __m512 pnlog0 = _mm512_set1_ps((float)-2.800364054395965731506);
+
+    __m512 log2 = _mm512_add_ps(_mm512_mul_ps(pnlog5, mantissa), pnlog4);
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), pnlog3);
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), pnlog2);
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), pnlog1);
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), pnlog0);
+
+    const __m512i exponent
+        = _mm512_sub_epi32(_mm512_srli_epi32(_mm512_and_si512(_mm512_castps_si512(x), emask), 23),
+                           _mm512_set1_epi32(127));
+
+    return _mm512_add_ps(log2, _mm512_cvtepi32_ps(exponent));
+}
+
+// exp2 function processing sixteen values at once (see sseExp2() for the details).
+inline __m512 avx512Exp2(__m512 x)
+{
+    // y = exp2( x ) = exp2( floor(x) ) * exp2( fraction )
+
+    // Truncation rounds towards zero so subtract one for negative values (and NaNs) to
+    // compute floor(x). Out of range values are handled by the checks at the bottom.
+    const __mmask16 negative = _mm512_cmp_ps_mask(_mm512_setzero_ps(), x, _CMP_NLE_UQ);
+    const __m512i floor_x = _mm512_mask_sub_epi32(_mm512_cvttps_epi32(x), negative,
+                                                  _mm512_cvttps_epi32(x), _mm512_set1_epi32(1));
+
+    const __m512 zf
+        = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(floor_x,
+                                                                 _mm512_set1_epi32(127)),
+                                                23));
+
+    const __m512 fraction = _mm512_sub_ps(x, _mm512_cvtepi32_ps(floor_x));
+
+    // Chebyshev coefficients of sseExp2() i.e. PNEXP4 to PNEXP0 in SSE.h.
+    const __m512 pnexp4 = _mm512_set1_ps((float)1.353416792833547468620e-2);
+    const __m512 pnexp3 = _mm512_set1_ps((float)5.201146058412685018921e-2);
+    const __m512 pnexp2 = _mm512_set1_ps((float)2.414427569091865207710e-1);
+    const __m512 pnexp1 = _mm512_set1_ps((float)6.930038344665415134202e-1);
+    const __m512 pnexp0 = _mm512_set1_ps((float)1.000002593370603213644);
+
+    __m512 mexp = _mm512_add_ps(_mm512_mul_ps(pnexp4, fraction), pnexp3);
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), pnexp2);
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), pnexp1);
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), pnexp0);
+
+    __m512 exp2 = _mm512_mul_ps(zf, mexp);
+
+    // Handle underflow.
+    exp2 = _mm512_mask_mov_ps(exp2,
+                              _mm512_cmp_ps_mask(x, _mm512_set1_ps(-126.0f), _CMP_LT_OQ),
+                              _mm512_setzero_ps());
+
+    // Handle overflow.
+    exp2 = _mm512_mask_mov_ps(exp2,
+                              _mm512_cmp_ps_mask(x, _mm512_set1_ps(128.0f), _CMP_GE_OQ),
+                              _mm512_set1_ps(std::numeric_limits<float>::infinity()));
+
+    return exp2;
+}
+
+// Power function processing sixteen values at once (see ssePower() for the details).
+//
+// Results from base values smaller than zero are mapped to zero.
+inline __m512 avx512Power(__m512 x, __m512 exp)
+{
+    const __m512 values = avx512Exp2(_mm512_mul_ps(exp, avx512Log2(x)));
+
+    // Handle values where base is smaller or equal than zero.
+    return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_GT_OQ), values);
+}
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX512
@@ -413,4 +413,28 @@ void Baker::bake(std::ostream & os) const
     //
 }
 
+void Baker::bake(const std::vector<BakerTarget> & targets) const
+{
+    // Check all the targets before baking any of them.
+    for (size_t idx = 0; idx < targets.size(); ++idx)
+    {
+        if (!targets[idx].m_output)
+        {
+            std::ostringstream os;
+            os << "No output stream for the target at index " << idx << ".";
+            throw Exception(os.str().c_str());
+        }
+    }
+
+    // The copy shares the config (and so its processor cache) of this baker.
+    BakerRcPtr targetBaker = createEditableCopy();
+
+    for (const auto & target : targets)
+    {
+        targetBaker->setDisplayView(target.m_display.c_str(), target.m_view.c_str());
+        targetBaker->setLooks(target.m_looks.c_str());
+        targetBaker->bake(*target.m_output);
+    }
+}
+
 } // namespace OCIO_NAMESPACE
@@ -130,4 +130,12 @@ void GetTargetRange(const Baker & baker, float& start, float& end)
     return GetSrcRange(baker, baker.getTargetSpace(), start, end);
 }
 
+void ApplyToCube(const ConstCPUProcessorRcPtr & processor, float * cubeData, int cubeSize)
+{
+    // The cube is processed as an image of cubeSize^2 lines so that the lines are dispatched
+    // to all the available threads.
+    PackedImageDesc cubeImg(cubeData, cubeSize, cubeSize * cubeSize, 3);
+    processor->apply(cubeImg, 0);
+}
+
 } // namespace OCIO_NAMESPACE
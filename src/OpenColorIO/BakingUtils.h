@@ -23,6 +23,9 @@ void GetShaperRange(const Baker & baker, float& start, float& end);
 
 void GetTargetRange(const Baker & baker, float& start, float& end);
 
+// Apply the processor to the RGB values of a cube using all the available threads.
+void ApplyToCube(const ConstCPUProcessorRcPtr & processor, float * cubeData, int cubeSize);
+
 
 } // namespace OCIO_NAMESPACE
 
@@ -5,6 +5,10 @@
 #include "CPUInfo.h"
 #include <string.h>
 
+#if __APPLE__
+#include <sys/sysctl.h>
+#endif
+
 #if _WIN32
 #include <limits.h>
 #include <intrin.h>
@@ -17,6 +21,9 @@ typedef __int64  int64_t;
 namespace OCIO_NAMESPACE
 {
 
+// The L1 data cache size when the processor does not report it.
+static constexpr unsigned int DefaultL1DataCacheSize = 32 * 1024;
+
 #if !defined(__aarch64__) && OCIO_ARCH_X86 // Intel-based processor or Apple Rosetta x86_64.
 
 namespace {
@@ -72,6 +79,7 @@ static inline void cpuid(int index, int *data)
 CPUInfo::CPUInfo()
 {
     flags = 0, family = 0, model = 0;
+    l1DataCacheSize = DefaultL1DataCacheSize;
     memset(name, 0, sizeof(name));
     memset(vendor, 0, sizeof(vendor));
 
@@ -120,6 +128,24 @@ CPUInfo::CPUInfo()
         }
     }
 
+    if (max_std_level >= 4 && !strncmp(vendor, "GenuineIntel", 12))
+    {
+        // The first cache described by the deterministic cache parameters leaf is the L1 data
+        // cache on all the Intel processors.
+        cpuid(4, info.i);
+
+        const uint32_t type  = info.reg.eax & 0x1f;
+        const uint32_t level = (info.reg.eax >> 5) & 0x7;
+        if (type == 1 && level == 1)
+        {
+            const uint32_t ways       = (info.reg.ebx >> 22) + 1;
+            const uint32_t partitions = ((info.reg.ebx >> 12) & 0x3ff) + 1;
+            const uint32_t lineSize   = (info.reg.ebx & 0xfff) + 1;
+            const uint32_t sets       = info.reg.ecx + 1;
+            l1DataCacheSize = ways * partitions * lineSize * sets;
+        }
+    }
+
     if (max_std_level >= 7)
     {
         cpuid(7, info.i);
@@ -137,6 +163,17 @@ CPUInfo::CPUInfo()
     cpuid(0x80000000, info.i);
     max_ext_level = info.i[0];
 
+    if (max_ext_level >= 0x80000005 && !strncmp(vendor, "AuthenticAMD", 12))
+    {
+        cpuid(0x80000005, info.i);
+
+        // The L1 data cache size is in KB.
+        if (info.reg.ecx >> 24)
+        {
+            l1DataCacheSize = (info.reg.ecx >> 24) * 1024;
+        }
+    }
+
     if (max_ext_level >= 0x80000001)
     {
         cpuid(0x80000001, info.i);
@@ -188,12 +225,22 @@ CPUInfo::CPUInfo()
 CPUInfo::CPUInfo()
 {
     flags = 0;
+    l1DataCacheSize = DefaultL1DataCacheSize;
     memset(name, 0, sizeof(name));
     memset(vendor, 0, sizeof(vendor));
 
     snprintf(name, sizeof(name), "%s", "ARM");
 #if __APPLE__
     snprintf(vendor, sizeof(vendor), "%s", "Apple");
+
+    // Use the L1 data cache size of the performance cores.
+    uint64_t cacheSize = 0;
+    size_t length = sizeof(cacheSize);
+    if (sysctlbyname("hw.perflevel0.l1dcachesize", &cacheSize, &length, nullptr, 0) == 0
+        && cacheSize > 0)
+    {
+        l1DataCacheSize = (unsigned int)cacheSize;
+    }
 # else
     snprintf(vendor, sizeof(vendor), "%s", "ARM");
 #endif
@@ -215,6 +262,7 @@ CPUInfo::CPUInfo()
 CPUInfo::CPUInfo() // Unknown Processor
 {
     flags = 0;
+    l1DataCacheSize = DefaultL1DataCacheSize;
     memset(name, 0, sizeof(name));
     memset(vendor, 0, sizeof(vendor));
     snprintf(name, sizeof(name), "%s", "Unknown");
@@ -43,6 +43,8 @@ struct CPUInfo
     int model;
     char name[65];
     char vendor[13];
+    // Size in bytes of the L1 data cache of a core.
+    unsigned int l1DataCacheSize;
 
     CPUInfo();
 
@@ -50,6 +52,7 @@ struct CPUInfo
 
     const char *getName() const { return name;}
     const char *getVendor() const { return vendor; }
+    unsigned int getL1DataCacheSize() const { return l1DataCacheSize; }
 
     bool hasSSE2() const { return x86_check_flags(SSE2); }
     bool SSE2Slow() const { return (OCIO_USE_SSE2 && (flags & X86_CPU_FLAG_SSE2_SLOW)); }
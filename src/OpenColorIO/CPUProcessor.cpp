@@ -1,7 +1,11 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <chrono>
+#include <memory>
 #include <string.h>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -11,7 +15,9 @@
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/matrix/MatrixOp.h"
 #include "ops/range/RangeOpCPU.h"
+#include "Platform.h"
 #include "ScanlineHelper.h"
+#include "ThreadingUtils.h"
 
 
 namespace OCIO_NAMESPACE
@@ -63,6 +69,32 @@ public:
             memcpy(outImg, inImg, 4*numPixels*sizeof(float));
         }
     }
+
+    bool hasRGBSupport() const override { return true; }
+
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override
+    {
+        if(inImg!=outImg)
+        {
+            memcpy(outImg, inImg, 3*numPixels*sizeof(float));
+        }
+    }
+
+    bool hasPlanarSupport() const override { return true; }
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override
+    {
+        const int numChannels = inPlanes[3] ? 4 : 3;
+        for(int c=0; c<numChannels; ++c)
+        {
+            if(inPlanes[c]!=outPlanes[c])
+            {
+                memcpy(outPlanes[c], inPlanes[c], numPixels*sizeof(float));
+            }
+        }
+    }
 };
 
 ConstOpCPURcPtr CreateGenericBitDepthHelper(BitDepth in, BitDepth out)
@@ -119,6 +151,11 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+std::string GetBitDepthCastName(BitDepth in, BitDepth out)
+{
+    return std::string("<BitDepthCast ") + BitDepthToString(in) + " to " + BitDepthToString(out) + ">";
+}
+
 void CreateCPUEngine(const OpRcPtrVec & ops, 
                      BitDepth in, 
                      BitDepth out,
@@ -128,10 +165,14 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
                      // The remaining CPU Ops.
                      ConstOpCPURcPtrVec & cpuOps,
                      // The bit-depth 'cast' or the last CPU Op.
-                     ConstOpCPURcPtr & outBitDepthOp)
+                     ConstOpCPURcPtr & outBitDepthOp,
+                     // The names of all the above CPU Ops in processing order.
+                     StringUtils::StringVec & opNames)
 {
+    std::string inName, outName;
+    StringUtils::StringVec cpuOpNames;
+
     const size_t maxOps = ops.size();
-    const bool fastLogExpPow = HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW);
     for(size_t idx=0; idx<maxOps; ++idx)
     {
         ConstOpRcPtr op = ops[idx];
@@ -143,20 +184,25 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
                 inBitDepthOp = GetLut1DRenderer(lut, in, BIT_DEPTH_F32);
+                inName = op->getInfo();
             }
             else if(in==BIT_DEPTH_F32)
             {
-                inBitDepthOp = op->getCPUOp(fastLogExpPow);
+                inBitDepthOp = op->getOptimizedCPUOp(oFlags);
+                inName = op->getInfo();
             }
             else
             {
                 inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                inName = GetBitDepthCastName(in, BIT_DEPTH_F32);
+                cpuOps.push_back(op->getOptimizedCPUOp(oFlags));
+                cpuOpNames.push_back(op->getInfo());
             }
 
             if(maxOps==1)
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
+                outName = GetBitDepthCastName(BIT_DEPTH_F32, out);
             }
         }
         else if(idx==(maxOps-1))
@@ -165,22 +211,32 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
                 outBitDepthOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, out);
+                outName = op->getInfo();
             }
             else if(out==BIT_DEPTH_F32)
             {
-                outBitDepthOp = op->getCPUOp(fastLogExpPow);
+                outBitDepthOp = op->getOptimizedCPUOp(oFlags);
+                outName = op->getInfo();
             }
             else
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                outName = GetBitDepthCastName(BIT_DEPTH_F32, out);
+                cpuOps.push_back(op->getOptimizedCPUOp(oFlags));
+                cpuOpNames.push_back(op->getInfo());
             }
         }
         else
         {
-            cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+            cpuOps.push_back(op->getOptimizedCPUOp(oFlags));
+            cpuOpNames.push_back(op->getInfo());
         }
     }
+
+    opNames.clear();
+    opNames.push_back(inName);
+    opNames.insert(opNames.end(), cpuOpNames.begin(), cpuOpNames.end());
+    opNames.push_back(outName);
 }
 
 
@@ -310,7 +366,7 @@ DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType
 
 void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
                        BitDepth in, BitDepth out,
-                       OptimizationFlags oFlags)
+                       OptimizationFlags oFlags, OptimizationOptIns optIns)
 {
     ops = rawOps;
 
@@ -320,7 +376,7 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
         ops.finalize();
 
         // Optimize the ops.
-        ops.optimize(oFlags);
+        ops.optimize(oFlags, optIns);
         ops.optimizeForBitdepth(in, out, oFlags);
     }
 
@@ -338,16 +394,72 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
     }
 }
 
+CPUProcessor::Impl::~Impl()
+{
+}
+
+namespace
+{
+
+bool UseStats()
+{
+    std::string stats;
+    Platform::Getenv(OCIO_CPU_PROCESSOR_STATS_ENVVAR, stats);
+    stats = StringUtils::Trim(stats);
+    return !stats.empty() && stats != "0";
+}
+
+// The processing statistics are not collected i.e. the timer does nothing at all.
+class NullStageTimer
+{
+public:
+    void start() {}
+    void lap(size_t /* stage */, long /* numPixels */) {}
+};
+
+// Accumulates the processing time and the number of pixels of each stage.
+class StageTimer
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    explicit StageTimer(size_t numStages)
+        :   m_times(numStages, 0.)
+        ,   m_numPixels(numStages, 0)
+    {
+    }
+
+    void start() { m_last = Clock::now(); }
+
+    // Account the time elapsed since the previous lap (or the start) to the stage.
+    void lap(size_t stage, long numPixels)
+    {
+        const Clock::time_point now = Clock::now();
+        m_times[stage] += std::chrono::duration<double>(now - m_last).count();
+        m_numPixels[stage] += (unsigned long long)numPixels;
+        m_last = now;
+    }
+
+    std::vector<double> m_times;
+    std::vector<unsigned long long> m_numPixels;
+
+private:
+    Clock::time_point m_last;
+};
+
+} // anon.
+
 void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
                                   BitDepth in, BitDepth out,
-                                  OptimizationFlags oFlags)
+                                  OptimizationFlags oFlags,
+                                  OptimizationOptIns optIns)
 {
     AutoMutex lock(m_mutex);
 
     // Get the ops of the color transformation without the bit-depth adjustments.
 
     OpRcPtrVec ops;
-    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags);
+    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags, optIns);
 
     m_inBitDepth  = in;
     m_outBitDepth = out;
@@ -363,7 +475,41 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cpuOps.clear();
     m_inBitDepthOp = nullptr;
     m_outBitDepthOp = nullptr;
-    CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+
+    {
+        // The pooled scanline helpers use the previous bit-depth ops.
+        AutoMutex helpersLock(m_scanlineHelpersMutex);
+        m_scanlineHelpers.clear();
+    }
+
+    StringUtils::StringVec opNames;
+    CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp, opNames);
+
+    {
+        AutoMutex statsLock(m_statsMutex);
+
+        m_statsStageNames = opNames;
+
+        m_statsTimes.assign(m_statsStageNames.size(), 0.);
+        m_statsNumPixels.assign(m_statsStageNames.size(), 0);
+    }
+
+    m_statsEnabled = UseStats();
+
+    m_hasRGBSupport = m_inBitDepth==BIT_DEPTH_F32 && m_outBitDepth==BIT_DEPTH_F32
+                        && m_inBitDepthOp->hasRGBSupport() && m_outBitDepthOp->hasRGBSupport();
+    for (const auto & op : m_cpuOps)
+    {
+        m_hasRGBSupport = m_hasRGBSupport && op->hasRGBSupport();
+    }
+
+    m_hasPlanarSupport = m_inBitDepth==BIT_DEPTH_F32 && m_outBitDepth==BIT_DEPTH_F32
+                            && m_inBitDepthOp->hasPlanarSupport()
+                            && m_outBitDepthOp->hasPlanarSupport();
+    for (const auto & op : m_cpuOps)
+    {
+        m_hasPlanarSupport = m_hasPlanarSupport && op->hasPlanarSupport();
+    }
 
     // Compute the cache id.
 
@@ -376,60 +522,311 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cacheID = ss.str();
 }
 
-void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
-{   
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+ScanlineHelper * CPUProcessor::Impl::createScanlineHelper() const
+{
+    return CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp, m_outBitDepth, m_outBitDepthOp);
+}
 
-    // Prepare the processing.
-    scanlineBuilder->init(imgDesc);
+std::unique_ptr<ScanlineHelper> CPUProcessor::Impl::acquireScanlineHelper() const
+{
+    {
+        AutoMutex lock(m_scanlineHelpersMutex);
+
+        if (!m_scanlineHelpers.empty())
+        {
+            std::unique_ptr<ScanlineHelper> scanlineBuilder = std::move(m_scanlineHelpers.back());
+            m_scanlineHelpers.pop_back();
+            return scanlineBuilder;
+        }
+    }
+
+    return std::unique_ptr<ScanlineHelper>(createScanlineHelper());
+}
+
+void CPUProcessor::Impl::releaseScanlineHelper(std::unique_ptr<ScanlineHelper> scanlineBuilder) const
+{
+    AutoMutex lock(m_scanlineHelpersMutex);
+    m_scanlineHelpers.push_back(std::move(scanlineBuilder));
+}
+
+void CPUProcessor::Impl::reserveProcessingBuffers(unsigned numThreads) const
+{
+    numThreads = GetNumThreads(numThreads);
+
+    AutoMutex lock(m_scanlineHelpersMutex);
+
+    // Note that the helpers currently used by other threads are not accounted for.
+    m_scanlineHelpers.reserve(numThreads);
+    while (m_scanlineHelpers.size() < numThreads)
+    {
+        m_scanlineHelpers.emplace_back(createScanlineHelper());
+    }
+
+    for (auto & scanlineBuilder : m_scanlineHelpers)
+    {
+        scanlineBuilder->reserve();
+    }
+}
+
+void CPUProcessor::Impl::applyScanlines(ScanlineHelper & scanlineBuilder) const
+{
+    if (m_statsEnabled)
+    {
+        StageTimer timer(m_statsStageNames.size());
+        applyScanlines(scanlineBuilder, timer);
+        mergeStats(timer.m_times, timer.m_numPixels);
+    }
+    else
+    {
+        NullStageTimer timer;
+        applyScanlines(scanlineBuilder, timer);
+    }
+}
+
+template<typename Timer>
+void CPUProcessor::Impl::applyScanlines(ScanlineHelper & scanlineBuilder, Timer & timer) const
+{
+    // The stage indices of the processing statistics. Reading the source scanline is accounted
+    // to the input bit-depth op stage, and writing the destination scanline to the output one.
+    const size_t numOps = m_cpuOps.size();
+    const size_t inStage = 0;
+    const size_t outStage = numOps + 1;
+
+    timer.start();
+
+    if (m_hasRGBSupport && scanlineBuilder.isPackedFloatRGB())
+    {
+        // The ops directly process the image buffers i.e. the first op reads the source image
+        // and writes the destination image, and the other ones then work in place.
+
+        const float * inBuffer = nullptr;
+        float * outBuffer = nullptr;
+        long numPixels = 0;
+
+        while(true)
+        {
+            scanlineBuilder.prepRGBScanline(&inBuffer, &outBuffer, numPixels);
+            if(numPixels == 0) break;
+
+            m_inBitDepthOp->applyRGB(inBuffer, outBuffer, numPixels);
+            timer.lap(inStage, numPixels);
+
+            for(size_t i = 0; i<numOps; ++i)
+            {
+                m_cpuOps[i]->applyRGB(outBuffer, outBuffer, numPixels);
+                timer.lap(inStage + 1 + i, numPixels);
+            }
+
+            m_outBitDepthOp->applyRGB(outBuffer, outBuffer, numPixels);
+
+            scanlineBuilder.finishRGBScanline();
+            timer.lap(outStage, numPixels);
+        }
+
+        return;
+    }
+
+    if (m_hasPlanarSupport && scanlineBuilder.isPlanarFloat())
+    {
+        // Same as above but the ops directly process the image planes.
+
+        const float * inPlanes[4] = { nullptr, nullptr, nullptr, nullptr };
+        float * outPlanes[4] = { nullptr, nullptr, nullptr, nullptr };
+        long numPixels = 0;
+
+        while(true)
+        {
+            scanlineBuilder.prepPlanarScanline(inPlanes, outPlanes, numPixels);
+            if(numPixels == 0) break;
+
+            m_inBitDepthOp->applyPlanar(inPlanes, outPlanes, numPixels);
+            timer.lap(inStage, numPixels);
+
+            for(size_t i = 0; i<numOps; ++i)
+            {
+                m_cpuOps[i]->applyPlanar(outPlanes, outPlanes, numPixels);
+                timer.lap(inStage + 1 + i, numPixels);
+            }
+
+            m_outBitDepthOp->applyPlanar(outPlanes, outPlanes, numPixels);
+
+            scanlineBuilder.finishPlanarScanline();
+            timer.lap(outStage, numPixels);
+        }
+
+        return;
+    }
 
     float * rgbaBuffer = nullptr;
     long numPixels = 0;
 
     while(true)
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
+        // Note that the helper applies the in and out bit-depth ops while unpacking and packing
+        // the scanline (e.g. the bit-depth op directly reads the source image).
+        scanlineBuilder.prepRGBAScanline(&rgbaBuffer, numPixels);
         if(numPixels == 0) break;
+        timer.lap(inStage, numPixels);
 
-        const size_t numOps = m_cpuOps.size();
         for(size_t i = 0; i<numOps; ++i)
         {
             m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            timer.lap(inStage + 1 + i, numPixels);
         }
 
-        scanlineBuilder->finishRGBAScanline();
+        scanlineBuilder.finishRGBAScanline();
+        timer.lap(outStage, numPixels);
+    }
+}
+
+void CPUProcessor::Impl::mergeStats(const std::vector<double> & times,
+                                    const std::vector<unsigned long long> & numPixels) const
+{
+    AutoMutex lock(m_statsMutex);
+
+    for (size_t idx = 0; idx < m_statsTimes.size(); ++idx)
+    {
+        m_statsTimes[idx]     += times[idx];
+        m_statsNumPixels[idx] += numPixels[idx];
+    }
+}
+
+void CPUProcessor::Impl::resetStats() const
+{
+    AutoMutex lock(m_statsMutex);
+
+    std::fill(m_statsTimes.begin(), m_statsTimes.end(), 0.);
+    std::fill(m_statsNumPixels.begin(), m_statsNumPixels.end(), 0);
+}
+
+CPUProcessorStageStats CPUProcessor::Impl::getStatsStage(int index) const
+{
+    if (index < 0 || index >= getNumStatsStages())
+    {
+        std::ostringstream oss;
+        oss << "Invalid index of processing statistics stage: " << index << ".";
+        throw Exception(oss.str().c_str());
+    }
+
+    AutoMutex lock(m_statsMutex);
+
+    CPUProcessorStageStats stats;
+    stats.m_name      = m_statsStageNames[index].c_str();
+    stats.m_time      = m_statsTimes[index];
+    stats.m_numPixels = m_statsNumPixels[index];
+
+    return stats;
+}
+
+namespace
+{
+
+// The multithreaded apply processes the image by tiles of complete scanlines. The tile size
+// targets an RGBA F32 processing buffer fitting in the L2 cache of most CPUs.
+constexpr long TileSizeInBytes = 256 * 1024;
+
+// The minimum number of tiles per thread to balance the processing between threads.
+constexpr long MinTilesPerThread = 4;
+
+} // anon.
+
+void CPUProcessor::Impl::applyTiles(long width, long height, unsigned numThreads,
+                                    const std::function<void(ScanlineHelper &)> & initHelper) const
+{
+    const long rowSizeInBytes = std::max(width, 1L) * 4 * (long)sizeof(float);
+
+    long rowsPerTile = std::max(TileSizeInBytes / rowSizeInBytes, 1L);
+    rowsPerTile = std::min(rowsPerTile, std::max(height / (numThreads * MinTilesPerThread), 1L));
+
+    // Each thread has its own ScanlineHelper (i.e. its own processing buffers) which is reused
+    // for all the tiles the thread processes, and then returned to the pool.
+    std::vector<std::unique_ptr<ScanlineHelper>> scanlineBuilders(numThreads);
+
+    ParallelFor(height, rowsPerTile, numThreads,
+                [&](unsigned threadIndex, long yBegin, long yEnd)
+                {
+                    std::unique_ptr<ScanlineHelper> & scanlineBuilder
+                        = scanlineBuilders[threadIndex];
+
+                    if (!scanlineBuilder)
+                    {
+                        scanlineBuilder = acquireScanlineHelper();
+                        initHelper(*scanlineBuilder);
+                    }
+
+                    scanlineBuilder->setRowRange((int)yBegin, (int)yEnd);
+                    applyScanlines(*scanlineBuilder);
+                });
+
+    for (auto & scanlineBuilder : scanlineBuilders)
+    {
+        if (scanlineBuilder)
+        {
+            releaseScanlineHelper(std::move(scanlineBuilder));
+        }
     }
 }
 
+void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
+{   
+    // Get a ScanlineHelper for this thread from the pool.
+    std::unique_ptr<ScanlineHelper> scanlineBuilder = acquireScanlineHelper();
+
+    // Prepare the processing.
+    scanlineBuilder->init(imgDesc);
+
+    applyScanlines(*scanlineBuilder);
+
+    releaseScanlineHelper(std::move(scanlineBuilder));
+}
+
 void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
 {
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+    // Get a ScanlineHelper for this thread from the pool.
+    std::unique_ptr<ScanlineHelper> scanlineBuilder = acquireScanlineHelper();
 
     // Prepare the processing.
     scanlineBuilder->init(srcImgDesc, dstImgDesc);
 
-    float * rgbaBuffer = nullptr;
-    long numPixels = 0;
+    applyScanlines(*scanlineBuilder);
 
-    while(true)
+    releaseScanlineHelper(std::move(scanlineBuilder));
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & imgDesc, unsigned numThreads) const
+{
+    numThreads = GetNumThreads(numThreads);
+
+    if (numThreads == 1 || imgDesc.getHeight() < 2)
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
-        if(numPixels == 0) break;
+        apply(imgDesc);
+        return;
+    }
 
-        const size_t numOps = m_cpuOps.size();
-        for(size_t i = 0; i<numOps; ++i)
-        {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
-        }
+    applyTiles(imgDesc.getWidth(), imgDesc.getHeight(), numThreads,
+               [&imgDesc](ScanlineHelper & scanlineBuilder)
+               {
+                   scanlineBuilder.init(imgDesc);
+               });
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc,
+                               ImageDesc & dstImgDesc,
+                               unsigned numThreads) const
+{
+    numThreads = GetNumThreads(numThreads);
 
-        scanlineBuilder->finishRGBAScanline();
+    if (numThreads == 1 || dstImgDesc.getHeight() < 2)
+    {
+        apply(srcImgDesc, dstImgDesc);
+        return;
     }
+
+    applyTiles(dstImgDesc.getWidth(), dstImgDesc.getHeight(), numThreads,
+               [&srcImgDesc, &dstImgDesc](ScanlineHelper & scanlineBuilder)
+               {
+                   scanlineBuilder.init(srcImgDesc, dstImgDesc);
+               });
 }
 
 void CPUProcessor::Impl::applyRGB(float * pixel) const
@@ -518,6 +915,31 @@ BitDepth CPUProcessor::getOutputBitDepth() const
     return getImpl()->getOutputBitDepth();
 }
 
+void CPUProcessor::enableStats(bool enable) const
+{
+    getImpl()->enableStats(enable);
+}
+
+bool CPUProcessor::isStatsEnabled() const noexcept
+{
+    return getImpl()->isStatsEnabled();
+}
+
+void CPUProcessor::resetStats() const
+{
+    getImpl()->resetStats();
+}
+
+int CPUProcessor::getNumStatsStages() const noexcept
+{
+    return getImpl()->getNumStatsStages();
+}
+
+CPUProcessorStageStats CPUProcessor::getStatsStage(int index) const
+{
+    return getImpl()->getStatsStage(index);
+}
+
 bool CPUProcessor::isDynamic() const noexcept
 {
     return getImpl()->isDynamic();
@@ -543,6 +965,23 @@ void CPUProcessor::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) c
     getImpl()->apply(srcImgDesc, dstImgDesc);
 }
 
+void CPUProcessor::apply(const ImageDesc & imgDesc, unsigned numThreads) const
+{
+    getImpl()->apply(imgDesc, numThreads);
+}
+
+void CPUProcessor::apply(const ImageDesc & srcImgDesc,
+                         ImageDesc & dstImgDesc,
+                         unsigned numThreads) const
+{
+    getImpl()->apply(srcImgDesc, dstImgDesc, numThreads);
+}
+
+void CPUProcessor::reserveProcessingBuffers(unsigned numThreads) const
+{
+    getImpl()->reserveProcessingBuffers(numThreads);
+}
+
 void CPUProcessor::applyRGB(float * pixel) const
 {
     getImpl()->applyRGB(pixel);
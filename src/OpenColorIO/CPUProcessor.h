@@ -6,9 +6,15 @@
 #define INCLUDED_OCIO_CPUPROCESSOR_H
 
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Op.h"
+#include "utils/StringUtils.h"
 
 
 namespace OCIO_NAMESPACE
@@ -23,7 +29,7 @@ public:
     Impl(const Impl &) = delete;
     Impl& operator=(const Impl &) = delete;
 
-    ~Impl() = default;
+    ~Impl();
 
     // Note: The in and out bit-depths must be equal for isNoOp to be true.
     bool isNoOp() const noexcept { return m_isNoOp; }
@@ -46,6 +52,17 @@ public:
     void apply(const ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    void apply(const ImageDesc & imgDesc, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc, unsigned numThreads) const;
+
+    void reserveProcessingBuffers(unsigned numThreads) const;
+
+    void enableStats(bool enable) const noexcept { m_statsEnabled = enable; }
+    bool isStatsEnabled() const noexcept { return m_statsEnabled; }
+    void resetStats() const;
+    int getNumStatsStages() const noexcept { return (int)m_statsStageNames.size(); }
+    CPUProcessorStageStats getStatsStage(int index) const;
+
     // Note that the method only accepts one packed RGB and 32-bit float pixel.
     void applyRGB(float * pixel) const;
     // Note that the method only accepts one packed RGBA and 32-bit float pixel.
@@ -55,9 +72,33 @@ public:
     //
     // Functions not exposed to the OCIO public API.
 
-    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
+    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags,
+                  OptimizationOptIns optIns = OPTIMIZATION_OPT_IN_NONE);
 
 private:
+    ScanlineHelper * createScanlineHelper() const;
+
+    // The scanline helpers (i.e. with their processing buffers) are pooled and reused across
+    // the apply calls. Note that a helper is simply not returned to the pool when its
+    // processing throws.
+    std::unique_ptr<ScanlineHelper> acquireScanlineHelper() const;
+    void releaseScanlineHelper(std::unique_ptr<ScanlineHelper> scanlineBuilder) const;
+
+    // Process all the scanlines of the (already initialized) helper.
+    void applyScanlines(ScanlineHelper & scanlineBuilder) const;
+
+    // Same as above where the timer accounts for the processing time of each stage.
+    template<typename Timer>
+    void applyScanlines(ScanlineHelper & scanlineBuilder, Timer & timer) const;
+
+    void mergeStats(const std::vector<double> & times,
+                    const std::vector<unsigned long long> & numPixels) const;
+
+    // Split the image in tiles of scanlines processed by several threads, where initHelper
+    // initializes the ScanlineHelper of each thread.
+    void applyTiles(long width, long height, unsigned numThreads,
+                    const std::function<void(ScanlineHelper &)> & initHelper) const;
+
     ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
     ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
                                        // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
@@ -68,8 +109,23 @@ private:
     bool               m_isNoOp = false;
     bool               m_isIdentity = false;
     bool               m_hasChannelCrosstalk = true;
+    // Could all the CPU ops directly process packed RGB F32 images?
+    bool               m_hasRGBSupport = false;
+    // Could all the CPU ops directly process planar F32 images?
+    bool               m_hasPlanarSupport = false;
     std::string        m_cacheID;
     Mutex              m_mutex;
+
+    mutable std::vector<std::unique_ptr<ScanlineHelper>> m_scanlineHelpers;
+    mutable Mutex      m_scanlineHelpersMutex;
+
+    // The processing statistics of the stages i.e. the in bit-depth op, the CPU ops and the
+    // out bit-depth op.
+    StringUtils::StringVec m_statsStageNames;
+    mutable std::atomic<bool> m_statsEnabled{ false };
+    mutable std::vector<double> m_statsTimes;
+    mutable std::vector<unsigned long long> m_statsNumPixels;
+    mutable Mutex      m_statsMutex;
 };
 
 } // namespace OCIO_NAMESPACE
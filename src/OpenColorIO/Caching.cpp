@@ -16,6 +16,7 @@ namespace OCIO_NAMESPACE
 const char * OCIO_DISABLE_ALL_CACHES       = "OCIO_DISABLE_ALL_CACHES";
 const char * OCIO_DISABLE_PROCESSOR_CACHES = "OCIO_DISABLE_PROCESSOR_CACHES";
 const char * OCIO_DISABLE_CACHE_FALLBACK   = "OCIO_DISABLE_CACHE_FALLBACK";
+const char * OCIO_LUT_CACHE_DIR            = "OCIO_LUT_CACHE_DIR";
 
 
 // TODO: Processors which the user hangs onto have local caches.
@@ -26,4 +27,14 @@ void ClearAllCaches()
     ClearPathCaches();
     ClearFileTransformCaches();
 }
+
+void SetFileCacheCapacity(size_t maxNumEntries, size_t maxSizeInBytes)
+{
+    SetFileTransformCacheCapacity(maxNumEntries, maxSizeInBytes);
+}
+
+CacheStatistics GetFileCacheStatistics()
+{
+    return GetFileTransformCacheStatistics();
+}
 } // namespace OCIO_NAMESPACE
@@ -6,6 +6,8 @@
 #define INCLUDED_OCIO_CACHING_H
 
 
+#include <cstddef>
+#include <list>
 #include <map>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -21,12 +23,18 @@ namespace OCIO_NAMESPACE
 // instance type of the key. Note that having efficient key generation & comparison are critical.
 // For example integer comparison is efficent but string one could be far less efficient depending
 // of its length & where changes occur (e.g. absolute filepaths are inefficient). 
+//
+// The cache is unbounded by default but a capacity (i.e. a number of entries and/or an approximate
+// memory size) could be set, the least recently used entries being then evicted. The entries
+// pinned by a pending request (e.g. while their content is built outside of the cache lock) are
+// never evicted.
 template<typename KeyType, typename EntryType>
 class GenericCache
 {
 public:
 
-    using Entries = std::map<KeyType, EntryType>;
+    // Entries are ordered from the most recently used to the least recently used.
+    using Entries = std::list<std::pair<const KeyType, EntryType>>;
     using Iterator = typename Entries::iterator;
 
     // Forbid copy & move semantics. 
@@ -42,11 +50,14 @@ public:
 
     virtual ~GenericCache() = default;
 
+    // Remove all the entries. Note that the statistics counters are not reset.
     void clear() noexcept
     {
         AutoMutex lock(m_mutex);
 
         m_entries.clear();
+        m_index.clear();
+        m_sizeInBytes = 0;
     }
 
     inline void enable(bool enable) noexcept
@@ -58,6 +69,40 @@ public:
 
     inline bool isEnabled() const noexcept { return !m_envDisableAllCaches && m_enabled; }
 
+    // Limit the number of entries and the approximate memory size (in bytes) of the cache. The
+    // least recently used entries are evicted when one of the limits is exceeded. A zero value
+    // means no limit.
+    void setCapacity(size_t maxNumEntries, size_t maxSizeInBytes) noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        m_maxNumEntries  = maxNumEntries;
+        m_maxSizeInBytes = maxSizeInBytes;
+
+        evict();
+    }
+
+    void getCapacity(size_t & maxNumEntries, size_t & maxSizeInBytes) const noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        maxNumEntries  = m_maxNumEntries;
+        maxSizeInBytes = m_maxSizeInBytes;
+    }
+
+    CacheStatistics getStatistics() const noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        CacheStatistics stats;
+        stats.m_numEntries  = m_entries.size();
+        stats.m_sizeInBytes = m_sizeInBytes;
+        stats.m_hits        = m_hits;
+        stats.m_misses      = m_misses;
+        stats.m_evictions   = m_evictions;
+        return stats;
+    }
+
     // Get and lock the mutex before accessing to a cache entry.
     Mutex & lock() noexcept { return m_mutex; }
 
@@ -65,15 +110,83 @@ public:
     // To only use when lock is on to protect the cache access.
     bool exists(const KeyType & key) const noexcept
     {
-        return isEnabled() && m_entries.end() != m_entries.find(key);
+        return isEnabled() && m_index.end() != m_index.find(key);
     }
 
-    // Get a cache entry. It creates the cache entry if not existing.
+    // Get a cache entry. It creates the cache entry if not existing. The entry becomes the most
+    // recently used one, and creating it could evict the least recently used ones.
     // To only use when lock is on to protect the cache access.
     EntryType & operator[](const KeyType & key) noexcept
     {
         static EntryType dummy;
-        return isEnabled() ? m_entries[key] : dummy;
+        if (!isEnabled())
+        {
+            return dummy;
+        }
+
+        auto it = m_index.find(key);
+        if (it != m_index.end())
+        {
+            ++m_hits;
+            m_entries.splice(m_entries.begin(), m_entries, it->second.m_pos);
+            return it->second.m_pos->second;
+        }
+
+        ++m_misses;
+        m_entries.emplace_front(key, EntryType());
+        m_index.emplace(key, Index{ m_entries.begin(), 0, 0 });
+
+        evict();
+
+        return m_entries.front().second;
+    }
+
+    // Set the approximate memory size (in bytes) of a cache entry once its content is known. That
+    // could evict the least recently used entries. Nothing is done if the entry was meanwhile
+    // evicted or replaced by another one.
+    // To only use when lock is on to protect the cache access.
+    void setEntrySize(const KeyType & key, const EntryType & entry, size_t sizeInBytes) noexcept
+    {
+        auto it = m_index.find(key);
+        if (it == m_index.end() || !(it->second.m_pos->second == entry))
+        {
+            return;
+        }
+
+        m_sizeInBytes -= it->second.m_size;
+        m_sizeInBytes += sizeInBytes;
+        it->second.m_size = sizeInBytes;
+
+        evict();
+    }
+
+    // Protect an existing entry from the eviction while a request uses it outside of the cache
+    // lock (e.g. while its content is built). Each call must be balanced by a call to unpin().
+    // To only use when lock is on to protect the cache access.
+    void pin(const KeyType & key) noexcept
+    {
+        auto it = m_index.find(key);
+        if (it != m_index.end())
+        {
+            ++it->second.m_numPins;
+        }
+    }
+
+    // Release an entry pinned by pin(). That could evict the least recently used entries. Nothing
+    // is done if the entry was meanwhile cleared or replaced by another one.
+    // To only use when lock is on to protect the cache access.
+    void unpin(const KeyType & key, const EntryType & entry) noexcept
+    {
+        auto it = m_index.find(key);
+        if (it == m_index.end() || !(it->second.m_pos->second == entry)
+            || it->second.m_numPins == 0)
+        {
+            return;
+        }
+
+        --it->second.m_numPins;
+
+        evict();
     }
 
     Iterator begin() noexcept { return m_entries.begin(); }
@@ -89,8 +202,84 @@ protected:
     bool m_enabled = true;
 
 private:
-    Mutex m_mutex;
+    // Evict the least recently used entries until the capacity is respected. The most recently
+    // used entry is always kept even if it exceeds the capacity on its own, and the pinned entries
+    // are skipped i.e. the capacity could be temporarily exceeded.
+    void evict() noexcept
+    {
+        auto pos = m_entries.end();
+        while (pos != m_entries.begin()
+               && ((m_maxNumEntries  != 0 && m_entries.size() > m_maxNumEntries)
+                || (m_maxSizeInBytes != 0 && m_sizeInBytes > m_maxSizeInBytes)))
+        {
+            --pos;
+            if (pos == m_entries.begin())
+            {
+                break;
+            }
+
+            auto it = m_index.find(pos->first);
+            if (it->second.m_numPins != 0)
+            {
+                continue;
+            }
+
+            m_sizeInBytes -= it->second.m_size;
+            m_index.erase(it);
+            pos = m_entries.erase(pos);
+
+            ++m_evictions;
+        }
+    }
+
+    struct Index
+    {
+        Iterator m_pos;     // Position of the entry in the usage list.
+        size_t m_size;      // Approximate memory size of the entry.
+        size_t m_numPins;   // Number of pending requests using the entry.
+    };
+
+    mutable Mutex m_mutex;
     Entries m_entries;
+    std::map<KeyType, Index> m_index;
+
+    size_t m_maxNumEntries  = 0;
+    size_t m_maxSizeInBytes = 0;
+    size_t m_sizeInBytes    = 0;
+
+    size_t m_hits      = 0;
+    size_t m_misses    = 0;
+    size_t m_evictions = 0;
+};
+
+// Unpin, when going out of scope, a cache entry pinned with GenericCache::pin(). The cache lock
+// must not be held by the caller at that time.
+template<typename KeyType, typename EntryType>
+class CacheUnpinGuard
+{
+public:
+    CacheUnpinGuard(GenericCache<KeyType, EntryType> & cache,
+                    const KeyType & key,
+                    const EntryType & entry)
+        :   m_cache(cache)
+        ,   m_key(key)
+        ,   m_entry(entry)
+    {
+    }
+
+    CacheUnpinGuard(const CacheUnpinGuard &) = delete;
+    CacheUnpinGuard & operator=(const CacheUnpinGuard &) = delete;
+
+    ~CacheUnpinGuard()
+    {
+        AutoMutex guard(m_cache.lock());
+        m_cache.unpin(m_key, m_entry);
+    }
+
+private:
+    GenericCache<KeyType, EntryType> & m_cache;
+    const KeyType m_key;
+    const EntryType m_entry;
 };
 
 // A Processor instance uses this class to cache its derived optimized, CPU, and GPU Processors.
@@ -3,6 +3,7 @@
 
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -13,6 +14,36 @@
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+
+// Case insensitive hash of a name, computed without any allocation.
+size_t HashName(const char * name)
+{
+    size_t hash = 0;
+    for (const char * c = name; *c; ++c)
+    {
+        hash = hash * 31 + StringUtils::Lower(static_cast<unsigned char>(*c));
+    }
+    return hash;
+}
+
+// Case insensitive comparison of two names, without any allocation.
+bool EqualNames(const char * name1, const char * name2)
+{
+    for (; *name1 && *name2; ++name1, ++name2)
+    {
+        if (StringUtils::Lower(static_cast<unsigned char>(*name1))
+                != StringUtils::Lower(static_cast<unsigned char>(*name2)))
+        {
+            return false;
+        }
+    }
+    return *name1 == *name2;
+}
+
+} // anon.
+
 class ColorSpaceSet::Impl
 {
 public:
@@ -31,6 +62,7 @@ public:
             {
                 m_colorSpaces.push_back(cs->createEditableCopy());
             }
+            m_index = rhs.m_index;
         }
         return *this;
     }
@@ -89,27 +121,21 @@ public:
     int getIndex(const char * csName) const 
     {
         // Search for name and aliases.
+        int index = -1;
         if (csName && *csName)
         {
-            const std::string str = StringUtils::Lower(csName);
-            for (size_t idx = 0; idx < m_colorSpaces.size(); ++idx)
+            const auto range = m_index.equal_range(HashName(csName));
+            for (auto it = range.first; it != range.second; ++it)
             {
-                if (StringUtils::Compare(m_colorSpaces[idx]->getName(), str))
+                const int idx = static_cast<int>(it->second);
+                if ((index == -1 || idx < index) && hasName(*m_colorSpaces[idx], csName))
                 {
-                    return static_cast<int>(idx);
-                }
-                const size_t numAliases = m_colorSpaces[idx]->getNumAliases();
-                for (size_t aidx = 0; aidx < numAliases; ++aidx)
-                {
-                    if (StringUtils::Compare(m_colorSpaces[idx]->getAlias(aidx), str))
-                    {
-                        return static_cast<int>(idx);
-                    }
+                    index = idx;
                 }
             }
         }
 
-        return -1;
+        return index;
     }
 
     bool isPresent(const char * csName) const
@@ -164,10 +190,12 @@ public:
         {
             // The color space replaces the existing one.
             m_colorSpaces[replaceIdx] = cs->createEditableCopy();
+            rebuildIndex();
             return;
         }
 
         m_colorSpaces.push_back(cs->createEditableCopy());
+        addToIndex(m_colorSpaces.size() - 1);
     }
 
     void add(const Impl & rhs)
@@ -180,16 +208,12 @@ public:
 
     void remove(const char * csName)
     {
-        const std::string name = StringUtils::Lower(csName);
-        if (name.empty()) return;
-
-        for (auto itr = m_colorSpaces.begin(); itr != m_colorSpaces.end(); ++itr)
+        // Only the color space names are removed (i.e. not the aliases).
+        const int idx = getIndex(csName);
+        if (idx != -1 && EqualNames(m_colorSpaces[idx]->getName(), csName))
         {
-            if (StringUtils::Lower((*itr)->getName())==name)
-            {
-                m_colorSpaces.erase(itr);
-                return;
-            }
+            m_colorSpaces.erase(m_colorSpaces.begin() + idx);
+            rebuildIndex();
         }
     }
 
@@ -204,11 +228,53 @@ public:
     void clear()
     {
         m_colorSpaces.clear();
+        m_index.clear();
     }
 
 private:
+    static bool hasName(const ColorSpace & cs, const char * name)
+    {
+        if (EqualNames(cs.getName(), name))
+        {
+            return true;
+        }
+        const size_t numAliases = cs.getNumAliases();
+        for (size_t aidx = 0; aidx < numAliases; ++aidx)
+        {
+            if (EqualNames(cs.getAlias(aidx), name))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void addToIndex(size_t idx)
+    {
+        const ColorSpace & cs = *m_colorSpaces[idx];
+        m_index.emplace(HashName(cs.getName()), idx);
+        const size_t numAliases = cs.getNumAliases();
+        for (size_t aidx = 0; aidx < numAliases; ++aidx)
+        {
+            m_index.emplace(HashName(cs.getAlias(aidx)), idx);
+        }
+    }
+
+    void rebuildIndex()
+    {
+        m_index.clear();
+        for (size_t idx = 0; idx < m_colorSpaces.size(); ++idx)
+        {
+            addToIndex(idx);
+        }
+    }
+
     typedef std::vector<ColorSpaceRcPtr> ColorSpaceVec;
     ColorSpaceVec m_colorSpaces;
+
+    // Case insensitive hash of the color space names and aliases, to the color space
+    // index. The color spaces are never modified once added to the set.
+    std::unordered_multimap<size_t, size_t> m_index;
 };
 
 
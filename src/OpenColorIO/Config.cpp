@@ -7,6 +7,7 @@
 #include <set>
 #include <sstream>
 #include <fstream>
+#include <map>
 #include <utility>
 #include <vector>
 #include <regex>
@@ -50,6 +51,8 @@ const char * OCIO_ACTIVE_VIEWS_ENVVAR         = "OCIO_ACTIVE_VIEWS";
 const char * OCIO_INACTIVE_COLORSPACES_ENVVAR = "OCIO_INACTIVE_COLORSPACES";
 const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR   = "OCIO_OPTIMIZATION_FLAGS";
 const char * OCIO_USER_CATEGORIES_ENVVAR      = "OCIO_USER_CATEGORIES";
+const char * OCIO_LAZY_CONFIG_LOADING_ENVVAR  = "OCIO_LAZY_CONFIG_LOADING";
+const char * OCIO_CPU_PROCESSOR_STATS_ENVVAR  = "OCIO_CPU_PROCESSOR_STATS";
 
 // Default filename (with extension) of a config and archived config.
 const char * OCIO_CONFIG_DEFAULT_NAME         = "config";
@@ -91,6 +94,14 @@ constexpr char INTERNAL_RAW_PROFILE[] =
     "      allocation: uniform\n"
     "      description: 'A raw color space. Conversions to and from this space are no-ops.'\n";
 
+bool UseLazyLoading()
+{
+    std::string lazyLoading;
+    Platform::Getenv(OCIO_LAZY_CONFIG_LOADING_ENVVAR, lazyLoading);
+    lazyLoading = StringUtils::Trim(lazyLoading);
+    return !lazyLoading.empty() && lazyLoading != "0";
+}
+
 } // anon.
 
 
@@ -252,6 +263,24 @@ static const unsigned int LastSupportedMinorVersion[] = {0, // Version 1
 
 } // namespace
 
+// Entry of the processor cache. The cache lock only protects the access to the entries while the
+// entry mutex serializes the creation of its processor. So, processors for different keys are
+// built concurrently and a second caller for the same key only waits on that key. The processor
+// is only set while holding both the entry mutex and the cache lock, so reading it only requires
+// one of them.
+struct ProcessorCacheEntry
+{
+    Mutex mutex;
+    ProcessorRcPtr processor;
+
+    ProcessorCacheEntry() = default;
+};
+
+typedef OCIO_SHARED_PTR<ProcessorCacheEntry> ProcessorCacheEntryRcPtr;
+
+// Instantiate the cache with the right types.
+template class ProcessorCache<std::size_t, ProcessorCacheEntryRcPtr>;
+
 class Config::Impl
 {
 public:
@@ -279,6 +308,13 @@ public:
     // Refer to Config::Impl::refreshActiveColorSpaces() to have the implementation details.
 
     ColorSpaceSetRcPtr m_allColorSpaces; // All the color spaces (i.e. no filtering).
+
+    // Loaders of the color space transforms not built yet, refer to
+    // OCIO_LAZY_CONFIG_LOADING_ENVVAR. The mutex is shared by the config copies as their
+    // loaders read the same YAML document.
+    mutable OCIOYaml::ColorSpaceTransformsLoaders m_lazyColorSpaces;
+    std::shared_ptr<Mutex> m_lazyMutex;
+
     StringUtils::StringVec m_activeColorSpaceNames; // Active color space names.
     StringUtils::StringVec m_inactiveColorSpaceNames; // inactive color space names.
 
@@ -330,7 +366,12 @@ public:
     FileRulesRcPtr m_fileRules;
 
     mutable ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
-    mutable ProcessorCache<std::size_t, ProcessorRcPtr> m_processorCache;
+    mutable ProcessorCache<std::size_t, ProcessorCacheEntryRcPtr> m_processorCache;
+    OptimizationOptIns m_optimizationOptIns { OPTIMIZATION_OPT_IN_NONE };
+
+    // Capacity of the optimized, CPU and GPU processor caches of the created processors.
+    size_t m_subProcessorCacheMaxNumEntries { 0 };
+    size_t m_subProcessorCacheMaxSizeInBytes { 0 };
 
     Impl() :
         m_majorVersion(LastSupportedMajorVersion),
@@ -342,6 +383,27 @@ public:
         m_validation(VALIDATION_UNKNOWN),
         m_fileRules(FileRules::Create())
     {
+        loadEnvironmentOverrides();
+
+        m_defaultLumaCoefs.resize(3);
+        m_defaultLumaCoefs[0] = DEFAULT_LUMA_COEFF_R;
+        m_defaultLumaCoefs[1] = DEFAULT_LUMA_COEFF_G;
+        m_defaultLumaCoefs[2] = DEFAULT_LUMA_COEFF_B;
+
+        m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
+
+        // This is used to allow the YAML writer to not save any virtual displays that were
+        // instantiated.
+        m_virtualDisplay.m_temporary = true;
+    }
+
+    ~Impl() = default;
+    Impl(const Impl&) = delete;
+
+    // Read the env. variables overriding the active displays, views & color spaces.
+    void loadEnvironmentOverrides()
+    {
+        m_activeDisplaysEnvOverride.clear();
         std::string activeDisplays;
         Platform::Getenv(OCIO_ACTIVE_DISPLAYS_ENVVAR, activeDisplays);
         activeDisplays = StringUtils::Trim(activeDisplays);
@@ -350,6 +412,7 @@ public:
             m_activeDisplaysEnvOverride = SplitStringEnvStyle(activeDisplays);
         }
 
+        m_activeViewsEnvOverride.clear();
         std::string activeViews;
         Platform::Getenv(OCIO_ACTIVE_VIEWS_ENVVAR, activeViews);
         activeViews = StringUtils::Trim(activeViews);
@@ -358,24 +421,10 @@ public:
             m_activeViewsEnvOverride = SplitStringEnvStyle(activeViews);
         }
 
-        m_defaultLumaCoefs.resize(3);
-        m_defaultLumaCoefs[0] = DEFAULT_LUMA_COEFF_R;
-        m_defaultLumaCoefs[1] = DEFAULT_LUMA_COEFF_G;
-        m_defaultLumaCoefs[2] = DEFAULT_LUMA_COEFF_B;
-
         Platform::Getenv(OCIO_INACTIVE_COLORSPACES_ENVVAR, m_inactiveColorSpaceNamesEnv);
         m_inactiveColorSpaceNamesEnv = StringUtils::Trim(m_inactiveColorSpaceNamesEnv);
-
-        m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
-
-        // This is used to allow the YAML writer to not save any virtual displays that were
-        // instantiated.
-        m_virtualDisplay.m_temporary = true;
     }
 
-    ~Impl() = default;
-    Impl(const Impl&) = delete;
-
     Impl& operator= (const Impl & rhs)
     {
         if(this!=&rhs)
@@ -389,8 +438,19 @@ public:
             m_familySeparator = rhs.m_familySeparator;
             m_description = rhs.m_description;
 
-            // Deep copy the colorspaces.
-            m_allColorSpaces = rhs.m_allColorSpaces->createEditableCopy();
+            // Deep copy the colorspaces (and the loaders of their deferred transforms).
+            m_lazyMutex = rhs.m_lazyMutex;
+            if (m_lazyMutex)
+            {
+                AutoMutex lock(*m_lazyMutex);
+                m_allColorSpaces = rhs.m_allColorSpaces->createEditableCopy();
+                m_lazyColorSpaces = rhs.m_lazyColorSpaces;
+            }
+            else
+            {
+                m_allColorSpaces = rhs.m_allColorSpaces->createEditableCopy();
+                m_lazyColorSpaces.clear();
+            }
             m_activeColorSpaceNames       = rhs.m_activeColorSpaceNames;
             m_inactiveColorSpaceNames     = rhs.m_inactiveColorSpaceNames;
             m_inactiveColorSpaceNamesConf = rhs.m_inactiveColorSpaceNamesConf;
@@ -452,6 +512,14 @@ public:
 
             m_processorCache.clear();
             m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
+
+            size_t maxNumEntries = 0, maxSizeInBytes = 0;
+            rhs.m_processorCache.getCapacity(maxNumEntries, maxSizeInBytes);
+            m_processorCache.setCapacity(maxNumEntries, maxSizeInBytes);
+
+            m_subProcessorCacheMaxNumEntries  = rhs.m_subProcessorCacheMaxNumEntries;
+            m_subProcessorCacheMaxSizeInBytes = rhs.m_subProcessorCacheMaxSizeInBytes;
+            m_optimizationOptIns              = rhs.m_optimizationOptIns;
         }
         return *this;
     }
@@ -470,6 +538,73 @@ public:
         return cs;
     }
 
+    // Build the deferred transforms of the color space, if any. Note that the transforms are
+    // only built once for the config (and its copies made before the call).
+    void loadColorSpaceTransforms(const ConstColorSpaceRcPtr & cs) const
+    {
+        if (!cs || !m_lazyMutex) return;
+
+        AutoMutex lock(*m_lazyMutex);
+        loadColorSpaceTransformsNoLock(StringUtils::Lower(cs->getName()));
+    }
+
+    void loadAllColorSpaceTransforms() const
+    {
+        if (!m_lazyMutex) return;
+
+        AutoMutex lock(*m_lazyMutex);
+        while (!m_lazyColorSpaces.empty())
+        {
+            loadColorSpaceTransformsNoLock(m_lazyColorSpaces.begin()->first);
+        }
+    }
+
+    void loadColorSpaceTransformsNoLock(const std::string & csKey) const
+    {
+        auto it = m_lazyColorSpaces.find(csKey);
+        if (it == m_lazyColorSpaces.end()) return;
+
+        ConstColorSpaceRcPtr cs = m_allColorSpaces->getColorSpace(csKey.c_str());
+        if (cs)
+        {
+            // The color space instance is owned by the config and was never handed out with
+            // its transforms i.e. it can still be completed.
+            ColorSpaceRcPtr editableCS = std::const_pointer_cast<ColorSpace>(cs);
+            try
+            {
+                it->second(editableCS);
+
+                // Same validation as when reading a config without the lazy loading.
+                ConstTransformRcPtr tr = cs->getTransform(COLORSPACE_DIR_TO_REFERENCE);
+                checkVersionConsistency(tr);
+                tr = cs->getTransform(COLORSPACE_DIR_FROM_REFERENCE);
+                checkVersionConsistency(tr);
+            }
+            catch (const std::exception & e)
+            {
+                std::ostringstream os;
+                os << "Loading the transforms of the color space '" << cs->getName()
+                   << "' failed. " << e.what();
+                throw Exception(os.str().c_str());
+            }
+        }
+
+        m_lazyColorSpaces.erase(it);
+    }
+
+    // The color space instance is replaced or removed, so its deferred transforms are useless.
+    void removeLazyColorSpace(const char * csname)
+    {
+        if (!m_lazyMutex) return;
+
+        ConstColorSpaceRcPtr cs = m_allColorSpaces->getColorSpace(csname);
+        if (cs)
+        {
+            AutoMutex lock(*m_lazyMutex);
+            m_lazyColorSpaces.erase(StringUtils::Lower(cs->getName()));
+        }
+    }
+
     // Only search for a color space name (i.e. not for a role name).
     int getColorSpaceIndex(const char * csname) const
     {
@@ -582,8 +717,11 @@ public:
     void resetCacheIDs();
 
     // Get all internal transforms (to generate cacheIDs, validation, etc).
-    // This currently crawls colorspaces + looks + view transforms.
-    void getAllInternalTransforms(ConstTransformVec & transformVec) const;
+    // This currently crawls colorspaces + looks + view transforms. When ignoreLoadingErrors is
+    // true, the color spaces whose deferred transforms fail to build are logged and skipped
+    // instead of throwing.
+    void getAllInternalTransforms(ConstTransformVec & transformVec,
+                                  bool ignoreLoadingErrors = false) const;
 
     static ConstConfigRcPtr Read(std::istream & istream, const char * filename);
     static ConstConfigRcPtr Read(std::istream & istream, ConfigIOProxyRcPtr ciop);
@@ -781,6 +919,15 @@ public:
     void checkVersionConsistency(ConstTransformRcPtr & transform) const;
     void checkVersionConsistency() const;
 
+    void setLazyColorSpaces(OCIOYaml::ColorSpaceTransformsLoaders & loaders)
+    {
+        if (!loaders.empty())
+        {
+            m_lazyColorSpaces.swap(loaders);
+            m_lazyMutex = std::make_shared<Mutex>();
+        }
+    }
+
     const View * getView(const char * display, const char * view) const
     {
         if (!view || !*view) return nullptr;
@@ -944,6 +1091,7 @@ public:
         
         ProcessorRcPtr processor = Processor::Create();
         processor->getImpl()->setProcessorCacheFlags(PROCESSOR_CACHE_OFF);
+        processor->getImpl()->setOptimizationOptIns(m_optimizationOptIns);
         processor->getImpl()->setTransform(config, m_context, transform, direction);
         return processor;
     }
@@ -1033,6 +1181,7 @@ public:
 
             // Note that it adds it or updates the existing one.
             m_allColorSpaces->addColorSpace(cs);
+            removeLazyColorSpace(cs->getName());
         }
         catch(const Exception & /* ex */)
         {
@@ -1108,10 +1257,6 @@ public:
 
 
 
-// Instantiate the cache with the right types.
-extern template class ProcessorCache<std::size_t, ProcessorRcPtr>;
-
-
 ///////////////////////////////////////////////////////////////////////////
 
 ConfigRcPtr Config::Create()
@@ -1252,14 +1397,44 @@ ConstConfigRcPtr Config::CreateFromBuiltinConfig(const char * configName)
         builtinConfigName = match.str(1).c_str();
     }
 
-    ConstConfigRcPtr builtinConfig;
-    const BuiltinConfigRegistry & reg = BuiltinConfigRegistry::Get();
+    // The built-in configs are only parsed once. Each request then gets a copy of the parsed
+    // config, which is much faster, but the environment is read again to behave as if the
+    // config was parsed. As the lazy loading mode changes the parsing, it is part of the key.
+    static Mutex parsedConfigsMutex;
+    static std::map<std::pair<std::string, bool>, ConstConfigRcPtr> parsedConfigs;
+
+    const auto key = std::make_pair(builtinConfigName, UseLazyLoading());
+
+    ConstConfigRcPtr parsedConfig;
+    {
+        AutoMutex guard(parsedConfigsMutex);
+
+        auto it = parsedConfigs.find(key);
+        if (it != parsedConfigs.end())
+        {
+            parsedConfig = it->second;
+        }
+        else
+        {
+            const BuiltinConfigRegistry & reg = BuiltinConfigRegistry::Get();
+
+            // getBuiltinConfigByName will throw if config name not found.
+            const char * builtinConfigStr = reg.getBuiltinConfigByName(builtinConfigName.c_str());
+            std::istringstream iss;
+            iss.str(builtinConfigStr);
+            parsedConfig = Config::CreateFromStream(iss);
+
+            parsedConfigs.emplace(key, parsedConfig);
+        }
+    }
+
+    ConfigRcPtr builtinConfig = Config::Create();
+    *builtinConfig->getImpl() = *parsedConfig->getImpl();
 
-    // getBuiltinConfigByName will throw if config name not found.
-    const char * builtinConfigStr = reg.getBuiltinConfigByName(builtinConfigName.c_str());
-    std::istringstream iss;
-    iss.str(builtinConfigStr);
-    builtinConfig = Config::CreateFromStream(iss);
+    builtinConfig->getImpl()->loadEnvironmentOverrides();
+    builtinConfig->getImpl()->m_displayCache.clear();
+    builtinConfig->getImpl()->refreshActiveColorSpaces();
+    builtinConfig->loadEnvironment();
 
     return builtinConfig;
 }
@@ -1455,7 +1630,7 @@ void Config::validate() const
         const char* interop = cs->getInteropID();
         if(interop && *interop)
         {
-            if(!getColorSpace(interop))
+            if(!getImpl()->getColorSpace(interop))
             {
                 std::ostringstream os;
                 os << "Config failed color space validation. ";
@@ -1546,7 +1721,7 @@ void Config::validate() const
                 {
                     hasRoleAcesInterchange = true;
 
-                    ConstColorSpaceRcPtr cs = getColorSpace(role.second.c_str());
+                    ConstColorSpaceRcPtr cs = getImpl()->getColorSpace(role.second.c_str());
                     acesInterHasSceneRefColorspace = 
                         cs->getReferenceSpaceType() == REFERENCE_SPACE_SCENE;
                 }
@@ -1554,7 +1729,7 @@ void Config::validate() const
                 {
                     hasRoleCieXyzD65Interchange = true;
 
-                    ConstColorSpaceRcPtr cs = getColorSpace(role.second.c_str());
+                    ConstColorSpaceRcPtr cs = getImpl()->getColorSpace(role.second.c_str());
                     cieInterHasDisplayRefColorspace = 
                         cs->getReferenceSpaceType() == REFERENCE_SPACE_DISPLAY;
                 }
@@ -2305,6 +2480,7 @@ ColorSpaceSetRcPtr Config::getColorSpaces(const char * category) const
         ConstColorSpaceRcPtr cs = getImpl()->m_allColorSpaces->getColorSpace(csName);
         if(!category || !*category || cs->hasCategory(category))
         {
+            getImpl()->loadColorSpaceTransforms(cs);
             res->addColorSpace(cs);
         }
     }
@@ -2361,7 +2537,7 @@ int Config::getNumColorSpaces(SearchReferenceSpaceType searchReferenceType,
         }
         for (auto csname : getImpl()->m_activeColorSpaceNames)
         {
-            auto cs = getColorSpace(csname.c_str());
+            auto cs = getImpl()->getColorSpace(csname.c_str());
             if (MatchReferenceType(searchReferenceType, cs->getReferenceSpaceType()))
             {
                 ++res;
@@ -2378,7 +2554,7 @@ int Config::getNumColorSpaces(SearchReferenceSpaceType searchReferenceType,
         }
         for (auto csname : getImpl()->m_inactiveColorSpaceNames)
         {
-            auto cs = getColorSpace(csname.c_str());
+            auto cs = getImpl()->getColorSpace(csname.c_str());
             if (MatchReferenceType(searchReferenceType, cs->getReferenceSpaceType()))
             {
                 ++res;
@@ -2447,7 +2623,7 @@ const char * Config::getColorSpaceNameByIndex(SearchReferenceSpaceType searchRef
         for (int i = 0; i < nbCS; ++i)
         {
             auto csname = getImpl()->m_activeColorSpaceNames[i];
-            auto cs = getColorSpace(csname.c_str());
+            auto cs = getImpl()->getColorSpace(csname.c_str());
             if (MatchReferenceType(searchReferenceType, cs->getReferenceSpaceType()))
             {
                 if (current == index)
@@ -2476,7 +2652,7 @@ const char * Config::getColorSpaceNameByIndex(SearchReferenceSpaceType searchRef
         for (int i = 0; i < nbCS; ++i)
         {
             auto csname = getImpl()->m_inactiveColorSpaceNames[i];
-            auto cs = getColorSpace(csname.c_str());
+            auto cs = getImpl()->getColorSpace(csname.c_str());
             if (MatchReferenceType(searchReferenceType, cs->getReferenceSpaceType()))
             {
                 if (current == index)
@@ -2496,12 +2672,14 @@ const char * Config::getColorSpaceNameByIndex(SearchReferenceSpaceType searchRef
 // Note: works from the list of all color spaces.
 ConstColorSpaceRcPtr Config::getColorSpace(const char * name) const
 {
-    return getImpl()->getColorSpace(name);
+    ConstColorSpaceRcPtr cs = getImpl()->getColorSpace(name);
+    getImpl()->loadColorSpaceTransforms(cs);
+    return cs;
 }
 
 const char * Config::getCanonicalName(const char * name) const
 {
-    ConstColorSpaceRcPtr cs = getColorSpace(name);
+    ConstColorSpaceRcPtr cs = getImpl()->getColorSpace(name);
     if (cs)
     {
         return cs->getName();
@@ -2526,7 +2704,7 @@ const char * Config::getColorSpaceNameByIndex(int index) const
 
 int Config::getIndexForColorSpace(const char * name) const
 {
-    ConstColorSpaceRcPtr cs = getColorSpace(name);
+    ConstColorSpaceRcPtr cs = getImpl()->getColorSpace(name);
     if (!cs)
     {
         return -1;
@@ -2641,6 +2819,7 @@ void Config::addColorSpace(const ConstColorSpaceRcPtr & original)
 
     // This is verifying that name and aliases are fine with other color spaces.
     getImpl()->m_allColorSpaces->addColorSpace(original);
+    getImpl()->removeLazyColorSpace(name.c_str());
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -2649,6 +2828,7 @@ void Config::addColorSpace(const ConstColorSpaceRcPtr & original)
 
 void Config::removeColorSpace(const char * name)
 {
+    getImpl()->removeLazyColorSpace(name);
     getImpl()->m_allColorSpaces->removeColorSpace(name);
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
@@ -2664,10 +2844,11 @@ bool Config::isColorSpaceUsed(const char * name) const noexcept
 
     if (!name || !*name) return false;
 
-    // Check for all color spaces, looks and view transforms.
+    // Check for all color spaces, looks and view transforms. As the method does not throw, the
+    // color spaces whose transforms fail to load are skipped.
 
     ConstTransformVec allTransforms;
-    getImpl()->getAllInternalTransforms(allTransforms);
+    getImpl()->getAllInternalTransforms(allTransforms, true);
 
     std::set<std::string> colorSpaceNames;
     for (const auto & transform : allTransforms)
@@ -2773,6 +2954,11 @@ bool Config::isColorSpaceUsed(const char * name) const noexcept
 void Config::clearColorSpaces()
 {
     getImpl()->m_allColorSpaces->clearColorSpaces();
+    if (getImpl()->m_lazyMutex)
+    {
+        AutoMutex lock(*getImpl()->m_lazyMutex);
+        getImpl()->m_lazyColorSpaces.clear();
+    }
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -2987,7 +3173,7 @@ void Config::setRole(const char * role, const char * colorSpaceName)
     {
         if (!hasRole(role))
         {
-            if (getColorSpace(role))
+            if (getImpl()->getColorSpace(role))
             {
                 std::ostringstream os;
                 os << "Cannot add '" << role << "' role, there is already a color space using this "
@@ -3190,7 +3376,7 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
               "name.";
         throw Exception(os.str().c_str());
     }
-    auto cs = getColorSpace(name.c_str());
+    auto cs = getImpl()->getColorSpace(name.c_str());
     if (cs)
     {
         std::ostringstream os;
@@ -3239,7 +3425,7 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
                << "' and there is already a role with this name.";
             throw Exception(os.str().c_str());
         }
-        auto cs = getColorSpace(alias);
+        auto cs = getImpl()->getColorSpace(alias);
         if (cs)
         {
             std::ostringstream os;
@@ -4795,6 +4981,10 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
     {
         ProcessorRcPtr processor = Processor::Create();
         processor->getImpl()->setProcessorCacheFlags(config.getImpl()->m_cacheFlags);
+        processor->getImpl()->setSubProcessorCacheCapacity(
+            config.getImpl()->m_subProcessorCacheMaxNumEntries,
+            config.getImpl()->m_subProcessorCacheMaxSizeInBytes);
+        processor->getImpl()->setOptimizationOptIns(config.getImpl()->m_optimizationOptIns);
         processor->getImpl()->setTransform(config, context, transform, direction);
         processor->getImpl()->computeMetadata();
         return processor;
@@ -4802,8 +4992,6 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
     if (getImpl()->m_processorCache.isEnabled())
     {
-        AutoMutex guard(getImpl()->m_processorCache.lock());
-
         // Note that the key includes a string description of the transform which does not include
         // all the LUT entries (just the arguments of the FileTransforms for LUTs).
         std::ostringstream oss;
@@ -4813,14 +5001,42 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        ProcessorRcPtr & processor = getImpl()->m_processorCache[key];
-        if (!processor)
+        // Only hold the cache lock to find or add the entry, the processor creation could be long
+        // (e.g. LUT file loading) and must not block the requests for other processors.
+        ProcessorCacheEntryRcPtr entry;
+        {
+            AutoMutex guard(getImpl()->m_processorCache.lock());
+
+            ProcessorCacheEntryRcPtr & cacheEntry = getImpl()->m_processorCache[key];
+            if (!cacheEntry)
+            {
+                cacheEntry = std::make_shared<ProcessorCacheEntry>();
+            }
+            entry = cacheEntry;
+
+            // Evicting the entry while the processor is created would let another request for
+            // the same key create it again.
+            getImpl()->m_processorCache.pin(key);
+        }
+
+        CacheUnpinGuard<std::size_t, ProcessorCacheEntryRcPtr>
+            unpinGuard(getImpl()->m_processorCache, key, entry);
+
+        // Concurrent requests for the same key wait here until the processor is created. If the
+        // creation fails, the entry stays empty and the next request tries again.
+        AutoMutex entryGuard(entry->mutex);
+
+        if (!entry->processor)
         {
             ProcessorRcPtr proc = CreateProcessor(*this, context, transform, direction);
 
             const bool doFallback = !Platform::isEnvPresent(OCIO_DISABLE_CACHE_FALLBACK);
+
+            // Compute the cache ID before locking the cache as it could be lengthy.
+            const std::string cacheID = doFallback ? proc->getCacheID() : "";
+
+            AutoMutex guard(getImpl()->m_processorCache.lock());
+
             if (doFallback)
             {
                 // If an entry with the same cache ID already exists in the cache then reuse it
@@ -4835,23 +5051,32 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
                 // compare the two contexts before doing the lengthy Processor::getCacheID()
                 // computation.
 
-                for (auto & entry : getImpl()->m_processorCache)
+                for (auto & cacheEntry : getImpl()->m_processorCache)
                 {
-                    if (entry.second && 0 == strcmp(entry.second->getCacheID(), proc->getCacheID()))
+                    if (!cacheEntry.second)
+                    {
+                        continue;
+                    }
+
+                    const ProcessorRcPtr & processor = cacheEntry.second->processor;
+                    if (processor && cacheID == processor->getCacheID())
                     {
-                        processor = entry.second;
+                        entry->processor = processor;
                         break;
                     }
                 }
             }
 
-            if (!processor)
+            if (!entry->processor)
             {
-                processor = proc;
+                entry->processor = proc;
             }
+
+            getImpl()->m_processorCache.setEntrySize(key, entry,
+                                                     entry->processor->getImpl()->getMemorySize());
         }
 
-        return processor;
+        return entry->processor;
     }
     else
     {
@@ -4968,6 +5193,10 @@ ConstProcessorRcPtr Config::GetProcessorFromConfigs(const ConstContextRcPtr & sr
 
     ProcessorRcPtr processor = Processor::Create();
     processor->getImpl()->setProcessorCacheFlags(srcConfig->getImpl()->m_cacheFlags);
+    processor->getImpl()->setSubProcessorCacheCapacity(
+        srcConfig->getImpl()->m_subProcessorCacheMaxNumEntries,
+        srcConfig->getImpl()->m_subProcessorCacheMaxSizeInBytes);
+    processor->getImpl()->setOptimizationOptIns(srcConfig->getImpl()->m_optimizationOptIns);
 
     // If either of the color spaces are data spaces, its corresponding processor
     // will be empty, but need to make sure the entire result is also empty to
@@ -5114,6 +5343,10 @@ ConstProcessorRcPtr Config::GetProcessorFromConfigs(const ConstContextRcPtr & sr
 
     ProcessorRcPtr processor = Processor::Create();
     processor->getImpl()->setProcessorCacheFlags(srcConfig->getImpl()->m_cacheFlags);
+    processor->getImpl()->setSubProcessorCacheCapacity(
+        srcConfig->getImpl()->m_subProcessorCacheMaxNumEntries,
+        srcConfig->getImpl()->m_subProcessorCacheMaxSizeInBytes);
+    processor->getImpl()->setOptimizationOptIns(srcConfig->getImpl()->m_optimizationOptIns);
 
     // If either of the color spaces are data spaces, its corresponding processor
     // will be empty, but need to make sure the entire result is also empty to
@@ -5318,6 +5551,39 @@ void Config::clearProcessorCache() noexcept
     getImpl()->m_processorCache.clear();
 }
 
+void Config::setProcessorCacheCapacity(size_t maxNumEntries, size_t maxSizeInBytes) noexcept
+{
+    getImpl()->m_processorCache.setCapacity(maxNumEntries, maxSizeInBytes);
+}
+
+CacheStatistics Config::getProcessorCacheStatistics() const noexcept
+{
+    return getImpl()->m_processorCache.getStatistics();
+}
+
+void Config::setSubProcessorCacheCapacity(size_t maxNumEntries,
+                                          size_t maxSizeInBytes) noexcept
+{
+    getImpl()->m_subProcessorCacheMaxNumEntries  = maxNumEntries;
+    getImpl()->m_subProcessorCacheMaxSizeInBytes = maxSizeInBytes;
+}
+
+OptimizationOptIns Config::getOptimizationOptIns() const noexcept
+{
+    return getImpl()->m_optimizationOptIns;
+}
+
+void Config::setOptimizationOptIns(OptimizationOptIns optIns) noexcept
+{
+    if (getImpl()->m_optimizationOptIns != optIns)
+    {
+        getImpl()->m_optimizationOptIns = optIns;
+
+        // The cached processors were created with the previous optimizations.
+        getImpl()->m_processorCache.clear();
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////
 //  Config::Impl
 
@@ -5446,10 +5712,30 @@ void Config::Impl::resetCacheIDs()
     m_processorCache.clear();
 }
 
-void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) const
+void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec,
+                                            bool ignoreLoadingErrors) const
 {
     // Grab all transforms from the ColorSpaces.
 
+    if (ignoreLoadingErrors)
+    {
+        for (int i = 0; i < m_allColorSpaces->getNumColorSpaces(); ++i)
+        {
+            try
+            {
+                loadColorSpaceTransforms(m_allColorSpaces->getColorSpaceByIndex(i));
+            }
+            catch (const std::exception & e)
+            {
+                LogWarning(e.what());
+            }
+        }
+    }
+    else
+    {
+        loadAllColorSpaceTransforms();
+    }
+
     for (int i = 0; i < m_allColorSpaces->getNumColorSpaces(); ++i)
     {
         ConstTransformRcPtr tr
@@ -5521,9 +5807,11 @@ void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) co
 ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filename)
 {
     ConfigRcPtr config = Config::Create();
-    OCIOYaml::Read(istream, config, filename);
+    OCIOYaml::ColorSpaceTransformsLoaders lazyLoaders;
+    OCIOYaml::Read(istream, config, filename, UseLazyLoading() ? &lazyLoaders : nullptr);
 
     config->getImpl()->checkVersionConsistency();
+    config->getImpl()->setLazyColorSpaces(lazyLoaders);
 
     // An API request always supersedes the env. variable. As the OCIOYaml helper methods
     // use the Config public API, the variable reset highlights that only the
@@ -5540,9 +5828,11 @@ ConstConfigRcPtr Config::Impl::Read(std::istream & istream, ConfigIOProxyRcPtr c
     // Passing special string for the file path to enable the parser to provide a more
     // meaningful error message if a problem is encountered.  (The working directory is not
     // set to this string.)
-    OCIOYaml::Read(istream, config, "from Archive/ConfigIOProxy");
+    OCIOYaml::ColorSpaceTransformsLoaders lazyLoaders;
+    OCIOYaml::Read(istream, config, "from Archive/ConfigIOProxy", UseLazyLoading() ? &lazyLoaders : nullptr);
 
     config->getImpl()->checkVersionConsistency();
+    config->getImpl()->setLazyColorSpaces(lazyLoaders);
 
     // An API request always supersedes the env. variable. As the OCIOYaml helper methods
     // use the Config public API, the variable reset highlights that only the
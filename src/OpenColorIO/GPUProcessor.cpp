@@ -70,7 +70,8 @@ void WriteShaderFooter(GpuShaderCreatorRcPtr & shaderCreator)
 
 }
 
-void GPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps, OptimizationFlags oFlags)
+void GPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps, OptimizationFlags oFlags,
+                                  OptimizationOptIns optIns)
 {
     AutoMutex lock(m_mutex);
 
@@ -79,7 +80,7 @@ void GPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps, OptimizationFlags o
     m_ops = rawOps;
 
     m_ops.finalize();
-    m_ops.optimize(oFlags);
+    m_ops.optimize(oFlags, optIns);
     m_ops.validateDynamicProperties();
 
     // Is NoOp ?
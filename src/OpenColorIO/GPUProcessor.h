@@ -35,7 +35,8 @@ public:
     //
     // Builder functions, Not exposed
 
-    void finalize(const OpRcPtrVec & rawOps, OptimizationFlags oFlags);
+    void finalize(const OpRcPtrVec & rawOps, OptimizationFlags oFlags,
+                  OptimizationOptIns optIns = OPTIMIZATION_OPT_IN_NONE);
 
 private:
     OpRcPtrVec    m_ops;
@@ -40,6 +40,10 @@ struct GenericImageDesc
 
     // Is the image buffer a packed RGBA 32-bit float buffer?
     bool isPackedFloatRGBA() const;
+    // Is the image buffer a packed RGB 32-bit float buffer (i.e. without alpha channel)?
+    bool isPackedFloatRGB() const;
+    // Is the image buffer made of contiguous 32-bit float planes (i.e. one buffer per channel)?
+    bool isPlanarFloat() const;
     // Is the image buffer a RGBA packed buffer?
     bool isRGBAPacked() const;
     // Is the image buffer a 32-bit float image buffer?
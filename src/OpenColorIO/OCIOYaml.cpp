@@ -3,6 +3,7 @@
 
 #include <cstring>
 #include <unordered_set>
+#include <vector>
 
 #include <pystring.h>
 
@@ -3249,7 +3250,8 @@ void save(YAML::Emitter& out, ConstTransformRcPtr t, unsigned int majorVersion)
 
 // ColorSpace
 
-inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int majorVersion)
+inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int majorVersion,
+                 OCIOYaml::ColorSpaceTransformsLoaders * lazyLoaders)
 {
     if(node.Tag() != "ColorSpace")
         return; // not a !<ColorSpace> tag
@@ -3266,6 +3268,22 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
     std::string stringval;
     bool boolval;
 
+    // In lazy mode, only keep the transform nodes to build the transforms on first use.
+    std::vector<std::pair<YAML::Node, ColorSpaceDirection>> transformNodes;
+    auto loadTransform = [&](const YAML::Node & trNode, ColorSpaceDirection dir)
+    {
+        if (lazyLoaders)
+        {
+            transformNodes.emplace_back(trNode, dir);
+        }
+        else
+        {
+            TransformRcPtr val;
+            load(trNode, val);
+            cs->setTransform(val, dir);
+        }
+    };
+
     for (Iterator iter = node.begin(); iter != node.end(); ++iter)
     {
         const std::string & key = iter->first.as<std::string>();
@@ -3355,9 +3373,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'to_reference' or 'to_scene_reference' cannot be used for a "
                                  "display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+            loadTransform(iter->second, COLORSPACE_DIR_TO_REFERENCE);
         }
         else if (key == "to_display_reference")
         {
@@ -3366,9 +3382,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'to_display_reference' cannot be used for a "
                                  "non-display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+            loadTransform(iter->second, COLORSPACE_DIR_TO_REFERENCE);
         }
         else if(key == "from_reference" || (majorVersion >= 2 && key == "from_scene_reference"))
         {
@@ -3377,9 +3391,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'from_reference' or 'from_scene_reference' cannot be used for "
                                  "a display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+            loadTransform(iter->second, COLORSPACE_DIR_FROM_REFERENCE);
         }
         else if (key == "from_display_reference")
         {
@@ -3388,15 +3400,26 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'from_display_reference' cannot be used for a "
                                  "non-display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+            loadTransform(iter->second, COLORSPACE_DIR_FROM_REFERENCE);
         }
         else
         {
             LogUnknownKeyWarning(node, iter->first);
         }
     }
+
+    if (!transformNodes.empty())
+    {
+        (*lazyLoaders)[StringUtils::Lower(cs->getName())] = [transformNodes](ColorSpaceRcPtr & lazyCS)
+        {
+            for (const auto & trNode : transformNodes)
+            {
+                TransformRcPtr val;
+                load(trNode.first, val);
+                lazyCS->setTransform(val, trNode.second);
+            }
+        };
+    }
 }
 
 
@@ -4223,7 +4246,8 @@ inline void save(YAML::Emitter & out, ConstViewingRulesRcPtr & vr, size_t positi
 
 // Config
 
-inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filename)
+inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filename,
+                 OCIOYaml::ColorSpaceTransformsLoaders * lazyLoaders)
 {
 
     // check profile version
@@ -4610,7 +4634,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if(val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_SCENE);
-                    load(val, cs, config->getMajorVersion());
+                    load(val, cs, config->getMajorVersion(), lazyLoaders);
                     for(int ii = 0; ii < config->getNumColorSpaces(); ++ii)
                     {
                         if(strcmp(config->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
@@ -4646,7 +4670,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if (val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_DISPLAY);
-                    load(val, cs, config->getMajorVersion());
+                    load(val, cs, config->getMajorVersion(), lazyLoaders);
                     for (int ii = 0; ii < config->getNumColorSpaces(); ++ii)
                     {
                         if (strcmp(config->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
@@ -5238,12 +5262,13 @@ inline void save(YAML::Emitter & out, const Config & config)
 
 ///////////////////////////////////////////////////////////////////////////
 
-void OCIOYaml::Read(std::istream & istream, ConfigRcPtr & config, const char * filename)
+void OCIOYaml::Read(std::istream & istream, ConfigRcPtr & config, const char * filename,
+                    ColorSpaceTransformsLoaders * lazyLoaders)
 {
     try
     {
         YAML::Node node = YAML::Load(istream);
-        load(node, config, filename);
+        load(node, config, filename, lazyLoaders);
     }
     catch(const std::exception & e)
     {
@@ -1,6 +1,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <functional>
+#include <map>
+#include <string>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #ifndef INCLUDED_OCIO_YAML_H
@@ -12,7 +16,15 @@ namespace OCIO_NAMESPACE
 namespace OCIOYaml
 {
 
-void Read(std::istream & istream, ConfigRcPtr & c, const char * filename);
+// Builds the transforms of a color space whose loading was deferred.
+typedef std::function<void(ColorSpaceRcPtr & cs)> ColorSpaceTransformsLoader;
+// The loaders of the deferred color spaces, keyed by the lower case color space name.
+typedef std::map<std::string, ColorSpaceTransformsLoader> ColorSpaceTransformsLoaders;
+
+// When lazyLoaders is not null, the color space transforms are not built but a loader
+// is added for each color space having some.
+void Read(std::istream & istream, ConfigRcPtr & c, const char * filename,
+          ColorSpaceTransformsLoaders * lazyLoaders = nullptr);
 void Write(std::ostream & ostream, const Config & c);
 
 } // namespace OCIOYaml
@@ -25,6 +25,28 @@
 
 namespace OCIO_NAMESPACE
 {
+bool OpCPU::hasRGBSupport() const
+{
+    return false;
+}
+
+void OpCPU::applyRGB(const float * /* inImg */, float * /* outImg */, long /* numPixels */) const
+{
+    throw Exception("Op does not support the RGB pixel processing.");
+}
+
+bool OpCPU::hasPlanarSupport() const
+{
+    return false;
+}
+
+void OpCPU::applyPlanar(const float * const * /* inPlanes */,
+                        float * const * /* outPlanes */,
+                        long /* numPixels */) const
+{
+    throw Exception("Op does not support the planar pixel processing.");
+}
+
 bool OpCPU::isDynamic() const
 {
     return false;
@@ -157,6 +179,11 @@ void Op::validate() const
     m_data->validate();
 }
 
+ConstOpCPURcPtr Op::getOptimizedCPUOp(OptimizationFlags oFlags) const
+{
+    return getCPUOp(HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW));
+}
+
 bool Op::isDynamic() const
 {
     return false;
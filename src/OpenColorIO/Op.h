@@ -45,6 +45,21 @@ public:
     // the 1D LUT CPU Op where the finalization depends on input and output bit depths.
     virtual void apply(const void * inImg, void * outImg, long numPixels) const = 0;
 
+    // Some renderers could also directly process packed RGB F32 pixels (i.e. without alpha
+    // channel) to avoid the conversion to/from an intermediate RGBA buffer. The result of
+    // applyRGB() is the same as the apply() one for a zero alpha.
+    virtual bool hasRGBSupport() const;
+    virtual void applyRGB(const float * inImg, float * outImg, long numPixels) const;
+
+    // Some renderers could also directly process planar F32 images i.e. one buffer per channel.
+    // The planes are in the R, G, B, A order and the alpha plane could be null for an image
+    // without alpha channel (i.e. then processed as a zero alpha and not written). The result
+    // of applyPlanar() is the same as the apply() one.
+    virtual bool hasPlanarSupport() const;
+    virtual void applyPlanar(const float * const * inPlanes,
+                             float * const * outPlanes,
+                             long numPixels) const;
+
     virtual bool isDynamic() const;
     virtual bool hasDynamicProperty(DynamicPropertyType type) const;
     virtual DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
@@ -279,6 +294,10 @@ public:
     // On-demand creation of the OpCPU instance. Op has to be finalized.
     virtual ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const = 0;
 
+    // Same as above for the CPU processor optimization flags. Only the ops having renderers
+    // selected by other flags than OPTIMIZATION_FAST_LOG_EXP_POW need to override it.
+    virtual ConstOpCPURcPtr getOptimizedCPUOp(OptimizationFlags oFlags) const;
+
     ConstOpDataRcPtr data() const { return std::const_pointer_cast<const OpData>(m_data); }
 
 protected:
@@ -394,7 +413,8 @@ public:
     // already inverted (i.e. no inv matrices are present in the OpVec when reaching the
     // optimization step).
     //
-    void optimize(OptimizationFlags oFlags);
+    // The optIns enable the optimizations that are not part of the OptimizationFlags.
+    void optimize(OptimizationFlags oFlags, OptimizationOptIns optIns = OPTIMIZATION_OPT_IN_NONE);
 
     // Only OptimizationFlags related to bitdepth optimization are used.
     void optimizeForBitdepth(const BitDepth & inBitDepth,
@@ -2,7 +2,9 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <limits>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -10,6 +12,7 @@
 #include "BitDepthUtils.h"
 #include "Logging.h"
 #include "Op.h"
+#include "ops/OpTools.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ops/range/RangeOp.h"
@@ -364,8 +367,9 @@ int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
 // bakes the inverse into another forward LUT (using the exact method). For Lut1D, a half-domain
 // LUT is used and so this is quite accurate even for scene-linear values, but for Lut3D the baked
 // version is more of an approximation. The default optimization level uses the FAST method since
-// it is the only one available on both CPU and GPU.
-int ReplaceInverseLuts(OpRcPtrVec & opVec)
+// it is the only one available on both CPU and GPU. The highResLut3D argument bakes the Lut3D
+// inverses on a finer grid.
+int ReplaceInverseLuts(OpRcPtrVec & opVec, bool highResLut3D)
 {
     int count = 0;
 
@@ -393,7 +397,7 @@ int ReplaceInverseLuts(OpRcPtrVec & opVec)
             auto lutData = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(opData);
             if (lutData->getDirection() == TRANSFORM_DIR_INVERSE)
             {
-                auto invLutData = MakeFastLut3DFromInverse(lutData);
+                auto invLutData = MakeFastLut3DFromInverse(lutData, highResLut3D);
                 OpRcPtrVec tmpops;
                 CreateLut3DOp(tmpops, invLutData, TRANSFORM_DIR_FORWARD);
                 FinalizeOps(tmpops);
@@ -592,6 +596,350 @@ void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
 
     ops.insert(ops.begin(), lutOps.begin(), lutOps.end());
 }
+
+// Settings of the LUT baking i.e. see OptimizeBakeLut().
+//
+// The shaper is a log2 allocation of [0, BakeShaperMaxValue], BakeShaperOffset controlling the
+// resolution close to zero. It covers scene-linear values as well as the [0, 1] range.
+constexpr float BakeShaperOffset   = 1.0f / 64.0f;
+constexpr float BakeShaperMaxValue = 1024.0f;
+constexpr unsigned long BakeLut3DGridSize = 65;
+// The baked LUTs are only used if the measured errors are below these tolerances. The error is
+// absolute for values below 1 and relative above i.e. see MeasureBakeError().
+constexpr float BakeMaxMeanError = 1e-4f;
+constexpr float BakeMaxError     = 1e-3f;
+
+inline float BakeShaperFwd(float v)
+{
+    static const float scale = 1.0f / std::log2(BakeShaperMaxValue / BakeShaperOffset + 1.0f);
+    if (!(v > 0.0f)) // Also handles NaN.
+    {
+        return 0.0f;
+    }
+    return std::min(1.0f, std::log2(v / BakeShaperOffset + 1.0f) * scale);
+}
+
+inline float BakeShaperInv(float t)
+{
+    static const float range = std::log2(BakeShaperMaxValue / BakeShaperOffset + 1.0f);
+    return BakeShaperOffset * (std::exp2(t * range) - 1.0f);
+}
+
+struct BakeError
+{
+    float m_max  = 0.0f;
+    float m_mean = 0.0f;
+};
+
+// Measure the maximum and mean errors between two lists of ops. The error is absolute for values
+// below 1 and relative above. Sample values are taken in between the 3D LUT grid points (using
+// the shaper allocation unless the 3D LUT input is known to be in the [0, 1] range) and on a
+// uniform grid of the [0, 1] range. For float input bit-depths, values outside of the 3D LUT
+// domain (i.e. negative and above BakeShaperMaxValue) are also sampled so that the baking is
+// refused when the ops do not clamp them the way the 3D LUT does.
+BakeError MeasureBakeError(const OpRcPtrVec & ops, const OpRcPtrVec & bakedOps, BitDepth in,
+                           bool unitDomain)
+{
+    std::vector<float> samples;
+
+    constexpr unsigned long numShaperSamples = 17;
+    for (unsigned long r = 0; r < numShaperSamples; ++r)
+    {
+        for (unsigned long g = 0; g < numShaperSamples; ++g)
+        {
+            for (unsigned long b = 0; b < numShaperSamples; ++b)
+            {
+                // Offset the samples to hit the middle of the 3D LUT cells.
+                const float step = 1.0f / float(numShaperSamples);
+                const float rgb[3] = { (float(r) + 0.37f) * step,
+                                       (float(g) + 0.61f) * step,
+                                       (float(b) + 0.53f) * step };
+                for (const float v : rgb)
+                {
+                    samples.push_back(unitDomain ? v : BakeShaperInv(v));
+                }
+            }
+        }
+    }
+
+    constexpr unsigned long numLinearSamples = 11;
+    for (unsigned long r = 0; r < numLinearSamples; ++r)
+    {
+        for (unsigned long g = 0; g < numLinearSamples; ++g)
+        {
+            for (unsigned long b = 0; b < numLinearSamples; ++b)
+            {
+                const float step = 1.0f / float(numLinearSamples - 1);
+                samples.push_back(float(r) * step);
+                samples.push_back(float(g) * step);
+                samples.push_back(float(b) * step);
+            }
+        }
+    }
+
+    if (IsFloatBitDepth(in))
+    {
+        // The tails are combined with in-domain values on the other channels. The largest value
+        // stays below the half float maximum that the half-domain 1D LUT supports.
+        static const float tails[] = { -100.0f, -1.0f, -0.01f, -1e-5f,
+                                       2.0f * BakeShaperMaxValue, 60000.0f };
+        static const float values[] = { 0.0f, 0.18f, 1.0f, 100.0f };
+
+        for (const float tail : tails)
+        {
+            samples.push_back(tail);
+            samples.push_back(tail);
+            samples.push_back(tail);
+
+            for (const float v1 : values)
+            {
+                for (const float v2 : values)
+                {
+                    const float pixels[3][3] = { { tail, v1, v2 },
+                                                 { v1, tail, v2 },
+                                                 { v1, v2, tail } };
+                    for (const auto & pixel : pixels)
+                    {
+                        samples.insert(samples.end(), pixel, pixel + 3);
+                    }
+                }
+            }
+        }
+    }
+
+    const long numPixels = long(samples.size() / 3);
+
+    std::vector<float> expected(samples.size());
+    OpRcPtrVec refOps = ops.clone();
+    EvalTransform(samples.data(), expected.data(), numPixels, refOps);
+
+    std::vector<float> actual(samples.size());
+    OpRcPtrVec testOps = bakedOps.clone();
+    EvalTransform(samples.data(), actual.data(), numPixels, testOps);
+
+    BakeError bakeError;
+    double sum = 0.0;
+    size_t count = 0;
+    for (size_t idx = 0; idx < expected.size(); ++idx)
+    {
+        if (!std::isfinite(expected[idx]))
+        {
+            // A LUT cannot reproduce these values anyway.
+            continue;
+        }
+
+        float error = std::abs(actual[idx] - expected[idx])
+                      / std::max(1.0f, std::abs(expected[idx]));
+        if (std::isnan(error))
+        {
+            error = std::numeric_limits<float>::infinity();
+        }
+
+        bakeError.m_max = std::max(bakeError.m_max, error);
+        sum += error;
+        ++count;
+    }
+
+    bakeError.m_mean = count > 0 ? float(sum / double(count)) : 0.0f;
+
+    return bakeError;
+}
+
+bool HasExpensiveOps(OpRcPtrVec::const_iterator first, OpRcPtrVec::const_iterator last)
+{
+    for (auto it = first; it != last; ++it)
+    {
+        ConstOpRcPtr constOp = *it;
+        const auto type = constOp->data()->getType();
+
+        // Matrices, ranges and LUTs are already fast to process.
+        if (type != OpData::MatrixType && type != OpData::RangeType
+            && type != OpData::Lut1DType && type != OpData::Lut3DType)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Return true if the values are known to be in the [0, 1] range after the ops. That is the case
+// when the input bit-depth is an integer one and there are no ops, or when the last op is a
+// range clamping to [0, 1].
+bool IsInUnitDomain(OpRcPtrVec::const_iterator first, OpRcPtrVec::const_iterator last,
+                    BitDepth in)
+{
+    if (first == last)
+    {
+        return !IsFloatBitDepth(in);
+    }
+
+    ConstOpRcPtr constOp = *(last - 1);
+    ConstRangeOpDataRcPtr range = OCIO_DYNAMIC_POINTER_CAST<const RangeOpData>(constOp->data());
+    return range && !range->minIsEmpty() && !range->maxIsEmpty()
+           && range->getMinOutValue() >= 0. && range->getMaxOutValue() <= 1.;
+}
+
+// Replace a list of costly ops by LUTs. The ops up to the last non-separable one are baked into
+// a shaper 1D LUT followed by a 3D LUT (the shaper being omitted when the 3D LUT input is known
+// to be in the [0, 1] range), and the remaining separable ops (e.g. the display
+// encoding) are baked into a half-domain 1D LUT. Keeping the trailing separable ops out of the
+// 3D LUT preserves their clamps, which otherwise introduce large interpolation errors.
+// The LUTs are kept only if the measured errors (absolute below 1 and relative above) stay below
+// BakeMaxError, and BakeMaxMeanError for the mean. The measure includes negative and very large
+// input values i.e. the ops must clamp them the same way than the LUTs. The max & mean errors are
+// recorded in the LUT metadata description.
+void OptimizeBakeLut(OpRcPtrVec & ops, BitDepth in)
+{
+    if (ops.empty())
+    {
+        return;
+    }
+
+    size_t separableStart = 0;
+    for (size_t idx = 0; idx < ops.size(); ++idx)
+    {
+        if (ops[idx]->isDynamic())
+        {
+            // The baked LUTs would not follow the dynamic property changes.
+            return;
+        }
+
+        if (ops[idx]->hasChannelCrosstalk())
+        {
+            separableStart = idx + 1;
+        }
+    }
+
+    // The leading inexpensive ops (e.g. a gamut conversion matrix followed by a clamp) are kept
+    // as is, so that their clamps do not have to be interpolated by the 3D LUT.
+    size_t bakeStart = 0;
+    while (bakeStart < separableStart && !HasExpensiveOps(ops.begin() + bakeStart,
+                                                          ops.begin() + bakeStart + 1))
+    {
+        ++bakeStart;
+    }
+
+    const auto bakeIt      = ops.begin() + bakeStart;
+    const auto separableIt = ops.begin() + separableStart;
+
+    const bool bakeLut3D = bakeStart < separableStart;
+
+    // For integer bit-depths, separable ops at the start of the list are better handled by the
+    // separable prefix optimization that builds an exact lookup.
+    const bool bakeLut1D = HasExpensiveOps(separableIt, ops.end())
+                           && (separableStart != 0 || IsFloatBitDepth(in));
+
+    if (!bakeLut3D && !bakeLut1D)
+    {
+        return;
+    }
+
+    OpRcPtrVec bakedOps;
+    OpDataRcPtr bakedData;
+
+    for (auto it = ops.begin(); it != bakeIt; ++it)
+    {
+        bakedOps.push_back((*it)->clone());
+    }
+
+    // Without a shaper, all the 3D LUT grid points are used for the [0, 1] range.
+    const bool unitDomain = bakeLut3D && IsInUnitDomain(ops.begin(), bakeIt, in);
+
+    if (bakeLut3D)
+    {
+        Lut3DOpDataRcPtr lut = std::make_shared<Lut3DOpData>(INTERP_TETRAHEDRAL, BakeLut3DGridSize);
+        Array::Values & values = lut->getArray().getValues();
+
+        if (!unitDomain)
+        {
+            Lut1DOpDataRcPtr shaper = Lut1DOpData::MakeLookupDomain(BIT_DEPTH_F16);
+            for (auto & v : shaper->getArray().getValues())
+            {
+                v = BakeShaperFwd(v);
+            }
+            CreateLut1DOp(bakedOps, shaper, TRANSFORM_DIR_FORWARD);
+
+            // The grid points are the shaper inverse of the identity values.
+            for (auto & v : values)
+            {
+                v = BakeShaperInv(v);
+            }
+        }
+
+        OpRcPtrVec tmpOps;
+        for (auto it = bakeIt; it != separableIt; ++it)
+        {
+            tmpOps.push_back((*it)->clone());
+        }
+
+        EvalTransform(values.data(), values.data(), long(values.size() / 3), tmpOps);
+
+        CreateLut3DOp(bakedOps, lut, TRANSFORM_DIR_FORWARD);
+        bakedData = lut;
+    }
+    else
+    {
+        for (auto it = bakeIt; it != separableIt; ++it)
+        {
+            bakedOps.push_back((*it)->clone());
+        }
+    }
+
+    if (bakeLut1D)
+    {
+        Lut1DOpDataRcPtr lut = Lut1DOpData::MakeLookupDomain(BIT_DEPTH_F16);
+
+        OpRcPtrVec tmpOps;
+        for (auto it = separableIt; it != ops.end(); ++it)
+        {
+            tmpOps.push_back((*it)->clone());
+        }
+
+        Lut1DOpData::ComposeVec(lut, tmpOps);
+
+        CreateLut1DOp(bakedOps, lut, TRANSFORM_DIR_FORWARD);
+        bakedData = lut;
+    }
+    else
+    {
+        for (auto it = separableIt; it != ops.end(); ++it)
+        {
+            bakedOps.push_back((*it)->clone());
+        }
+    }
+
+    FinalizeOps(bakedOps);
+
+    const BakeError error = MeasureBakeError(ops, bakedOps, in, unitDomain);
+
+    std::ostringstream oss;
+    oss << "Baked " << ops.size() << " ops into "
+        << (bakeLut3D ? (unitDomain ? "a 3D LUT" : "a shaper 1D LUT and a 3D LUT") : "")
+        << (bakeLut3D && bakeLut1D ? " followed by " : "")
+        << (bakeLut1D ? "a half-domain 1D LUT" : "")
+        << ", measured max error: " << error.m_max << ", mean error: " << error.m_mean;
+
+    if (!(error.m_mean <= BakeMaxMeanError && error.m_max <= BakeMaxError))
+    {
+        if (IsDebugLoggingEnabled())
+        {
+            LogDebug(oss.str() + " exceeds the tolerance, keeping the original ops.");
+        }
+        return;
+    }
+
+    if (IsDebugLoggingEnabled())
+    {
+        LogDebug(oss.str());
+    }
+
+    // Record the measured error in the metadata of the last LUT.
+    bakedData->getFormatMetadata().addChildElement(METADATA_DESCRIPTION, oss.str().c_str());
+
+    ops.erase(ops.begin(), ops.end());
+    ops.insert(ops.begin(), bakedOps.begin(), bakedOps.end());
+}
+
 } // namespace
 
 void OpRcPtrVec::finalize()
@@ -607,7 +955,7 @@ void OpRcPtrVec::finalize()
     FinalizeOps(*this);
 }
 
-void OpRcPtrVec::optimize(OptimizationFlags oFlags)
+void OpRcPtrVec::optimize(OptimizationFlags oFlags, OptimizationOptIns optIns)
 {
     if (m_ops.empty())
     {
@@ -672,6 +1020,8 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
     const bool replaceOps = HasFlag(oFlags, OPTIMIZATION_SIMPLIFY_OPS);
 
     const bool fastLut = HasFlag(oFlags, OPTIMIZATION_LUT_INV_FAST);
+    const bool highResLut
+        = (optIns & OPTIMIZATION_OPT_IN_LUT_INV_FAST_HIGH_RES) == OPTIMIZATION_OPT_IN_LUT_INV_FAST_HIGH_RES;
 
     while (passes <= MAX_OPTIMIZATION_PASSES)
     {
@@ -699,7 +1049,7 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
             // optimization is possible.
             if (fastLut)
             {
-                const int inverses = ReplaceInverseLuts(*this);
+                const int inverses = ReplaceInverseLuts(*this, highResLut);
                 if (inverses == 0)
                 {
                     break;
@@ -768,6 +1118,10 @@ void OpRcPtrVec::optimizeForBitdepth(const BitDepth & inBitDepth,
         {
             RemoveTrailingClampIdentity(*this);
         }
+        if (HasFlag(oFlags, OPTIMIZATION_BAKE_LUT))
+        {
+            OptimizeBakeLut(*this, inBitDepth);
+        }
         if (HasFlag(oFlags, OPTIMIZATION_COMP_SEPARABLE_PREFIX))
         {
             OptimizeSeparablePrefix(*this, inBitDepth);
@@ -682,6 +682,46 @@ bool nextline(std::istream &istream, std::string &line)
     return false;
 }
 
+MemoryIStreamBuf::MemoryIStreamBuf(const char * data, size_t size)
+{
+    char * begin = const_cast<char *>(data);
+    setg(begin, begin, begin + size);
+}
+
+MemoryIStreamBuf::pos_type MemoryIStreamBuf::seekoff(off_type off,
+                                                     std::ios_base::seekdir dir,
+                                                     std::ios_base::openmode which)
+{
+    if (!(which & std::ios_base::in))
+    {
+        return pos_type(off_type(-1));
+    }
+
+    off_type newPos = off;
+    if (dir == std::ios_base::cur)
+    {
+        newPos += gptr() - eback();
+    }
+    else if (dir == std::ios_base::end)
+    {
+        newPos += egptr() - eback();
+    }
+
+    if (newPos < 0 || newPos > egptr() - eback())
+    {
+        return pos_type(off_type(-1));
+    }
+
+    setg(eback(), eback() + newPos, egptr());
+    return pos_type(newPos);
+}
+
+MemoryIStreamBuf::pos_type MemoryIStreamBuf::seekpos(pos_type pos,
+                                                     std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
 bool StrEqualsCaseIgnore(const std::string & a, const std::string & b)
 {
     return 0 == Platform::Strcasecmp(a.c_str(), b.c_str());
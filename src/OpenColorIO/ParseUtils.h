@@ -46,6 +46,37 @@ bool StringVecToIntVec(std::vector<int> & intArray,
 
 bool nextline(std::istream &istream, std::string &line);
 
+// Read-only and seekable stream over a memory buffer, without copying it. The buffer must
+// outlive the stream.
+class MemoryIStreamBuf : public std::streambuf
+{
+public:
+    MemoryIStreamBuf(const char * data, size_t size);
+
+    // Unread part of the buffer.
+    const char * current() const { return gptr(); }
+    const char * end() const { return egptr(); }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+};
+
+class MemoryIStream : public std::istream
+{
+public:
+    MemoryIStream(const char * data, size_t size)
+        : std::istream(nullptr)
+        , m_buffer(data, size)
+    {
+        rdbuf(&m_buffer);
+    }
+
+private:
+    MemoryIStreamBuf m_buffer;
+};
+
 bool StrEqualsCaseIgnore(const std::string & a, const std::string & b);
 
 // If a ',' is in the string, split on it
@@ -352,6 +352,31 @@ std::string CreateFileContentHash(const std::string &filename)
     return "";
 }
 
+std::string CreateFileStatHash(const std::string &filename)
+{
+#if defined(_WIN32) && defined(UNICODE)
+    struct _stat fileInfo;
+    if (_wstat(Platform::Utf8ToUtf16(filename).c_str(), &fileInfo) == 0)
+#else
+    struct stat fileInfo;
+    if (stat(filename.c_str(), &fileInfo) == 0)
+#endif
+    {
+        std::ostringstream fasthash;
+        fasthash << fileInfo.st_size << ":";
+        fasthash << fileInfo.st_mtime;
+        // Add the sub-second part of the modification time when the platform provides it.
+#if defined(__APPLE__)
+        fasthash << "." << fileInfo.st_mtimespec.tv_nsec;
+#elif !defined(_WIN32)
+        fasthash << "." << fileInfo.st_mtim.tv_nsec;
+#endif
+        return fasthash.str();
+    }
+
+    return "";
+}
+
 } // Platform
 
 } // namespace OCIO_NAMESPACE
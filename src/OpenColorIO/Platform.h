@@ -106,6 +106,12 @@ void OpenInputFileStream(std::ifstream & stream, const char * filename, std::ios
 // Create a unique hash of a file provided as a UTF-8 filename on any platform.
 std::string CreateFileContentHash(const std::string &filename);
 
+// Create a hash of the last modification of a file (i.e. size and modification time) provided as
+// a UTF-8 filename on any platform. Contrary to CreateFileContentHash(), the hash changes when the
+// file is edited in place. Note that the modification time resolution is only one second on some
+// platforms. Returns an empty string if the file does not exist.
+std::string CreateFileStatHash(const std::string &filename);
+
 // Convert UTF-8 string to UTF-16LE.
 std::wstring Utf8ToUtf16(const std::string & str);
 
@@ -13,6 +13,8 @@
 #include "HashUtils.h"
 #include "Logging.h"
 #include "OpBuilders.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
 #include "ops/noop/NoOps.h"
 #include "Processor.h"
 #include "TransformBuilder.h"
@@ -174,6 +176,11 @@ const char * Processor::getCacheID() const
     return getImpl()->getCacheID();
 }
 
+CacheStatistics Processor::getSubProcessorCacheStatistics() const noexcept
+{
+    return getImpl()->getSubProcessorCacheStatistics();
+}
+
 ConstProcessorRcPtr Processor::getOptimizedProcessor(OptimizationFlags oFlags) const
 {
     return getImpl()->getOptimizedProcessor(oFlags);
@@ -258,6 +265,10 @@ Processor::Impl & Processor::Impl::operator=(const Impl & rhs)
 
         m_cpuProcessorCache.clear();
         m_cpuProcessorCache.enable(enableCaches);
+
+        setSubProcessorCacheCapacity(rhs.m_subCacheMaxNumEntries, rhs.m_subCacheMaxSizeInBytes);
+
+        m_optimizationOptIns = rhs.m_optimizationOptIns;
     }
     return *this;
 }
@@ -343,6 +354,38 @@ const char * Processor::Impl::getCacheID() const
     return m_cacheID.c_str();
 }
 
+namespace
+{
+// Approximate memory size (in bytes) of a list of ops. Only the LUT values are accounted for, the
+// other ops have a negligible memory footprint.
+size_t GetOpsMemorySize(const OpRcPtrVec & ops) noexcept
+{
+    size_t size = 0;
+
+    for (ConstOpRcPtr op : ops)
+    {
+        ConstOpDataRcPtr data = op->data();
+        if (data->getType() == OpData::Lut1DType)
+        {
+            ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(data);
+            size += lut->getArray().getValues().size() * sizeof(float);
+        }
+        else if (data->getType() == OpData::Lut3DType)
+        {
+            ConstLut3DOpDataRcPtr lut = DynamicPtrCast<const Lut3DOpData>(data);
+            size += lut->getArray().getValues().size() * sizeof(float);
+        }
+    }
+
+    return size;
+}
+} // anon.
+
+size_t Processor::Impl::getMemorySize() const noexcept
+{
+    return sizeof(Processor::Impl) + GetOpsMemorySize(m_ops);
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 namespace
@@ -377,8 +420,10 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
         ProcessorRcPtr proc = Create();
         *proc->getImpl() = procImpl;
 
+        const OptimizationOptIns optIns = procImpl.m_optimizationOptIns;
+
         proc->getImpl()->m_ops.finalize();
-        proc->getImpl()->m_ops.optimize(oFlags);
+        proc->getImpl()->m_ops.optimize(oFlags, optIns);
         proc->getImpl()->m_ops.optimizeForBitdepth(inBitDepth, outBitDepth, oFlags);
         proc->getImpl()->m_ops.validateDynamicProperties();
 
@@ -407,6 +452,8 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
             // slow to attempt here.
 
             processor = CreateProcessor(*this, inBitDepth, outBitDepth, oFlags);
+
+            m_optProcessorCache.setEntrySize(key, processor, processor->getImpl()->getMemorySize());
         }
 
         return processor;
@@ -478,10 +525,11 @@ ConstGPUProcessorRcPtr Processor::Impl::getGPUProcessor(const OpRcPtrVec & gpuOp
 {
     // Helper method.
     auto CreateProcessor = [](const OpRcPtrVec & ops,
-                              OptimizationFlags oFlags) -> GPUProcessorRcPtr
+                              OptimizationFlags oFlags,
+                              OptimizationOptIns optIns) -> GPUProcessorRcPtr
     {
         GPUProcessorRcPtr gpu = GPUProcessorRcPtr(new GPUProcessor(), &GPUProcessor::deleter);
-        gpu->getImpl()->finalize(ops, oFlags);
+        gpu->getImpl()->finalize(ops, oFlags, optIns);
         return gpu;
     };
 
@@ -496,14 +544,16 @@ ConstGPUProcessorRcPtr Processor::Impl::getGPUProcessor(const OpRcPtrVec & gpuOp
         GPUProcessorRcPtr & processor = m_gpuProcessorCache[oFlags];
         if (!processor)
         {
-            processor = CreateProcessor(gpuOps, oFlags);
+            processor = CreateProcessor(gpuOps, oFlags, m_optimizationOptIns);
+
+            m_gpuProcessorCache.setEntrySize(oFlags, processor, GetOpsMemorySize(gpuOps));
         }
         
         return processor;
     }
     else
     {
-        return CreateProcessor(gpuOps, oFlags);
+        return CreateProcessor(gpuOps, oFlags, m_optimizationOptIns);
     }
 }
 
@@ -527,10 +577,11 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
     auto CreateProcessor = [](const OpRcPtrVec & ops,
                               BitDepth inBitDepth,
                               BitDepth outBitDepth,
-                              OptimizationFlags oFlags) -> CPUProcessorRcPtr
+                              OptimizationFlags oFlags,
+                              OptimizationOptIns optIns) -> CPUProcessorRcPtr
     {
         CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
-        cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags);
+        cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags, optIns);
         return cpu;
     };
 
@@ -555,14 +606,18 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
         CPUProcessorRcPtr & processor = m_cpuProcessorCache[key];
         if (!processor)
         {
-            processor = CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags);
+            processor = CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags,
+                                        m_optimizationOptIns);
+
+            // The CPU renderers hold their own copy of the LUT values.
+            m_cpuProcessorCache.setEntrySize(key, processor, GetOpsMemorySize(m_ops));
         }
         
         return processor;
     }
     else
     {
-        return CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags);
+        return CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags, m_optimizationOptIns);
     }
 }
 
@@ -577,6 +632,35 @@ void Processor::Impl::setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept
     m_cpuProcessorCache.enable(cacheEnabled);
 }
 
+void Processor::Impl::setSubProcessorCacheCapacity(size_t maxNumEntries,
+                                                   size_t maxSizeInBytes) noexcept
+{
+    m_subCacheMaxNumEntries  = maxNumEntries;
+    m_subCacheMaxSizeInBytes = maxSizeInBytes;
+
+    m_optProcessorCache.setCapacity(maxNumEntries, maxSizeInBytes);
+    m_gpuProcessorCache.setCapacity(maxNumEntries, maxSizeInBytes);
+    m_cpuProcessorCache.setCapacity(maxNumEntries, maxSizeInBytes);
+}
+
+CacheStatistics Processor::Impl::getSubProcessorCacheStatistics() const noexcept
+{
+    CacheStatistics stats;
+
+    for (const CacheStatistics & cacheStats : { m_optProcessorCache.getStatistics(),
+                                                m_gpuProcessorCache.getStatistics(),
+                                                m_cpuProcessorCache.getStatistics() })
+    {
+        stats.m_numEntries  += cacheStats.m_numEntries;
+        stats.m_sizeInBytes += cacheStats.m_sizeInBytes;
+        stats.m_hits        += cacheStats.m_hits;
+        stats.m_misses      += cacheStats.m_misses;
+        stats.m_evictions   += cacheStats.m_evictions;
+    }
+
+    return stats;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 
@@ -34,6 +34,13 @@ private:
     mutable ProcessorCache<std::size_t, GPUProcessorRcPtr> m_gpuProcessorCache;
     mutable ProcessorCache<std::size_t, CPUProcessorRcPtr> m_cpuProcessorCache;
 
+    // Capacity of each of the above caches. It is kept here as the cache mutexes are already
+    // locked when an optimized processor copies this instance.
+    size_t m_subCacheMaxNumEntries  = 0;
+    size_t m_subCacheMaxSizeInBytes = 0;
+
+    OptimizationOptIns m_optimizationOptIns { OPTIMIZATION_OPT_IN_NONE };
+
 public:
     Impl();
     Impl(Impl &) = delete;
@@ -56,6 +63,9 @@ public:
 
     const char * getCacheID() const;
 
+    // Approximate memory size (in bytes) of the processor i.e. mostly the size of its LUTs.
+    size_t getMemorySize() const noexcept;
+
     GroupTransformRcPtr createGroupTransform() const;
 
     ConstProcessorRcPtr getOptimizedProcessor(OptimizationFlags oFlags) const;
@@ -87,6 +97,14 @@ public:
     // Enable or disable the internal caches.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept;
 
+    // Limit each of the optimized, CPU and GPU processor caches.
+    void setSubProcessorCacheCapacity(size_t maxNumEntries, size_t maxSizeInBytes) noexcept;
+
+    CacheStatistics getSubProcessorCacheStatistics() const noexcept;
+
+    // Optimizations applied in addition to the requested OptimizationFlags.
+    void setOptimizationOptIns(OptimizationOptIns optIns) noexcept { m_optimizationOptIns = optIns; }
+
     ////////////////////////////////////////////
     //
     // Builder functions, Not exposed
@@ -155,6 +155,52 @@ inline __m128 sseSelect(const __m128& mask, const __m128& arg_true, const __m128
             _mm_xor_ps( arg_true, arg_false ) ) );      // bit-wise XOR of arg_true, arg_false
 }
 
+// Store the first three floats of a register (e.g. a RGB pixel) without writing the fourth one.
+inline void sseStoreRGB(float * out, const __m128 & pix)
+{
+    _mm_storel_pi(reinterpret_cast<__m64 *>(out), pix);
+    _mm_store_ss(out + 2, _mm_movehl_ps(pix, pix));
+}
+
+// Load a RGBA pixel, or a RGB pixel with a zero alpha.
+template<int NumChannels>
+inline __m128 sseLoadPixel(const float * in)
+{
+    return _mm_set_ps(NumChannels == 4 ? in[3] : 0.0f, in[2], in[1], in[0]);
+}
+
+// Store a RGBA pixel, or only the RGB values for RGB pixels.
+template<int NumChannels>
+inline void sseStorePixel(float * out, const __m128 & pix)
+{
+    if (NumChannels == 4)
+    {
+        _mm_storeu_ps(out, pix);
+    }
+    else
+    {
+        sseStoreRGB(out, pix);
+    }
+}
+
+// Store the RGB values of a register and, for RGBA pixels, the alpha value of the input pixel
+// (i.e. 'in' and 'out' could be pointers to the same memory buffer).
+template<int NumChannels>
+inline void sseStorePixel(float * out, const __m128 & pix, const float * in)
+{
+    if (NumChannels == 4)
+    {
+        const float alphares = in[3];
+
+        _mm_storeu_ps(out, pix);
+        out[3] = alphares;
+    }
+    else
+    {
+        sseStoreRGB(out, pix);
+    }
+}
+
 // Coefficients of Chebyshev (minimax) degree 5 polynomial
 // approximation to log2() over the range [1.0, 2.0[.
 static const __m128 PNLOG5 = _mm_set1_ps((float)+4.487361286440374006195e-2);
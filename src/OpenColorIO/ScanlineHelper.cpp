@@ -2,16 +2,49 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cstdlib>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ScanlineHelper.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+
+// The scanlines are processed by blocks of pixels so that the buffers of a block stay in the L1
+// data cache while the complete op chain, including the bit-depth conversions, is applied to it.
+// Otherwise each op streams the complete scanline through the caches. Half of the L1 data cache
+// is left to the op data (e.g. the LUTs).
+constexpr long MinPixelsPerBlock   = 64;
+constexpr long MaxPixelsPerBlock   = 4096;
+// Keep the blocks aligned for the SIMD kernels.
+constexpr long PixelsPerBlockAlign = 16;
+
+long GetPixelsPerBlock(size_t bytesPerPixel)
+{
+    const size_t budget = CPUInfo::instance().getL1DataCacheSize() / 2;
+
+    long numPixels = long(budget / std::max(bytesPerPixel, size_t(1)));
+    numPixels = numPixels / PixelsPerBlockAlign * PixelsPerBlockAlign;
+
+    return std::min(std::max(numPixels, MinPixelsPerBlock), MaxPixelsPerBlock);
+}
+
+// Number of bytes of a pixel in the image buffer, whatever the layout (i.e. packed or planar) is.
+template<typename Type>
+size_t GetImagePixelBytes(const GenericImageDesc & img)
+{
+    return std::max(size_t(std::abs(img.m_xStrideBytes)), 4 * sizeof(Type));
+}
+
+} // anon.
+
 Optimizations GetOptimizationMode(const GenericImageDesc & imgDesc)
 {
     Optimizations optim = NO_OPTIMIZATION;
@@ -42,7 +75,11 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
     ,   m_outBitDepthOp(outBitDepthOp)
     ,   m_inOptimizedMode(NO_OPTIMIZATION)
     ,   m_outOptimizedMode(NO_OPTIMIZATION)
+    ,   m_xIndex(0)
+    ,   m_numPixels(0)
     ,   m_yIndex(0)
+    ,   m_yEnd(0)
+    ,   m_pixelsPerBlock(MinPixelsPerBlock)
     ,   m_useDstBuffer(false)
 {
 }
@@ -50,11 +87,14 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, const ImageDesc & dstImg)
 {
+    m_xIndex = 0;
     m_yIndex = 0;
 
     m_srcImg.init(srcImg, m_inputBitDepth, m_inBitDepthOp);
     m_dstImg.init(dstImg, m_outputBitDepth, m_outBitDepthOp);
 
+    m_yEnd = (int)m_dstImg.m_height;
+
     if(m_srcImg.m_width!=m_dstImg.m_width || m_srcImg.m_height!=m_dstImg.m_height)
     {
         throw Exception("Dimension inconsistency between source and destination image buffers.");
@@ -67,15 +107,31 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
-    if( (m_inOptimizedMode & PACKED_OPTIMIZATION) != PACKED_OPTIMIZATION)
+    const bool useInBitDepthBuffer
+        = (m_inOptimizedMode & PACKED_OPTIMIZATION) != PACKED_OPTIMIZATION;
+
+    size_t bytesPerPixel = GetImagePixelBytes<InType>(m_srcImg)
+                         + GetImagePixelBytes<OutType>(m_dstImg);
+    if(useInBitDepthBuffer)
+    {
+        bytesPerPixel += 4 * sizeof(InType);
+    }
+    if(!m_useDstBuffer)
+    {
+        bytesPerPixel += 4 * sizeof(float) + 4 * sizeof(OutType);
+    }
+
+    m_pixelsPerBlock = GetPixelsPerBlock(bytesPerPixel);
+
+    const long bufferSize = 4 * std::min(m_dstImg.m_width, m_pixelsPerBlock);
+
+    if(useInBitDepthBuffer)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
         m_inBitDepthBuffer.resize(bufferSize);
     }
 
     if(!m_useDstBuffer)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
         m_rgbaFloatBuffer.resize(bufferSize);
         m_outBitDepthBuffer.resize(bufferSize);
     }
@@ -84,11 +140,14 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
 {
+    m_xIndex = 0;
     m_yIndex = 0;
 
     m_srcImg.init(img, m_inputBitDepth, m_inBitDepthOp);
     m_dstImg.init(img, m_outputBitDepth, m_outBitDepthOp);
 
+    m_yEnd = (int)m_dstImg.m_height;
+
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = m_inOptimizedMode;
 
@@ -96,12 +155,17 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
+    size_t bytesPerPixel = GetImagePixelBytes<InType>(m_srcImg);
     if(!m_useDstBuffer)
     {
-        // TODO: Re-use memory from thread-safe memory pool, rather
-        // than doing a new allocation each time.
+        bytesPerPixel += 4 * sizeof(float) + 4 * sizeof(InType) + 4 * sizeof(OutType);
+    }
+
+    m_pixelsPerBlock = GetPixelsPerBlock(bytesPerPixel);
 
-        const long bufferSize = 4 * m_dstImg.m_width;
+    if(!m_useDstBuffer)
+    {
+        const long bufferSize = 4 * std::min(m_dstImg.m_width, m_pixelsPerBlock);
 
         m_rgbaFloatBuffer.resize(bufferSize);
         m_inBitDepthBuffer.resize(bufferSize);
@@ -109,6 +173,31 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     }
 }
 
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::setRowRange(int yBegin, int yEnd)
+{
+    if (yBegin < 0 || yBegin > yEnd || yEnd > m_dstImg.m_height)
+    {
+        throw Exception("Invalid scanline range to process.");
+    }
+
+    m_xIndex = 0;
+    m_yIndex = yBegin;
+    m_yEnd   = yEnd;
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::reserve()
+{
+    // Note that resizing a vector within its capacity never reallocates it. The buffers are only
+    // used when the blocks hold, at least, a RGBA F32 pixel in addition to the image pixels.
+    const long bufferSize = 4 * GetPixelsPerBlock(4 * sizeof(float));
+
+    m_rgbaFloatBuffer.reserve(bufferSize);
+    m_inBitDepthBuffer.reserve(bufferSize);
+    m_outBitDepthBuffer.reserve(bufferSize);
+}
+
 template<typename InType, typename OutType>
 GenericScanlineHelper<InType, OutType>::~GenericScanlineHelper()
 {
@@ -118,22 +207,26 @@ GenericScanlineHelper<InType, OutType>::~GenericScanlineHelper()
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, long & numPixels)
 {
-    // Note that only a line-by-line processing is done on the image buffer.
+    // Note that only a block-by-block processing of the lines is done on the image buffer.
 
-    if(m_yIndex >= m_dstImg.m_height)
+    if(m_yIndex >= m_yEnd)
     {
         numPixels = 0;
         return;
     }
 
-    *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex)
+    m_numPixels = std::min(m_dstImg.m_width - m_xIndex, m_pixelsPerBlock);
+
+    *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex
+                                                         + m_dstImg.m_xStrideBytes * m_xIndex)
                              : &m_rgbaFloatBuffer[0];
 
     if((m_inOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
-        const void * inBuffer = (void*)(m_srcImg.m_rData + m_srcImg.m_yStrideBytes * m_yIndex);
+        const void * inBuffer = (void*)(m_srcImg.m_rData + m_srcImg.m_yStrideBytes * m_yIndex
+                                                         + m_srcImg.m_xStrideBytes * m_xIndex);
 
-        m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_dstImg.m_width);
+        m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_numPixels);
     }
     else
     {
@@ -142,26 +235,27 @@ void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, lo
         Generic<InType>::PackRGBAFromImageDesc(m_srcImg,
                                                &m_inBitDepthBuffer[0],
                                                *buffer,
-                                               m_dstImg.m_width,
-                                               m_yIndex * m_dstImg.m_width);
+                                               m_numPixels,
+                                               m_yIndex * m_dstImg.m_width + m_xIndex);
     }
 
-    numPixels = m_dstImg.m_width;
+    numPixels = m_numPixels;
 }
 
 // Write back the result of our work, from the scanline to our destination image.
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
 {
-    // Note that only a line-by-line processing is done on the image buffer.
+    // Note that only a block-by-block processing of the lines is done on the image buffer.
 
     if((m_outOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
-        void * out = (void*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex);
+        void * out = (void*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex
+                                              + m_dstImg.m_xStrideBytes * m_xIndex);
 
         const void * in  = m_useDstBuffer ? out : (void*)&m_rgbaFloatBuffer[0];
 
-        m_dstImg.m_bitDepthOp->apply(in, out, m_dstImg.m_width);
+        m_dstImg.m_bitDepthOp->apply(in, out, m_numPixels);
     }
     else
     {
@@ -169,11 +263,101 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
         Generic<OutType>::UnpackRGBAToImageDesc(m_dstImg,
                                                 &m_rgbaFloatBuffer[0],
                                                 &m_outBitDepthBuffer[0],
-                                                m_dstImg.m_width,
-                                                m_yIndex * m_dstImg.m_width);
+                                                m_numPixels,
+                                                m_yIndex * m_dstImg.m_width + m_xIndex);
+    }
+
+    moveToNextBlock();
+}
+
+template<typename InType, typename OutType>
+bool GenericScanlineHelper<InType, OutType>::isPackedFloatRGB() const
+{
+    return m_srcImg.isPackedFloatRGB() && m_dstImg.isPackedFloatRGB();
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::prepRGBScanline(const float ** inBuffer,
+                                                             float ** outBuffer,
+                                                             long & numPixels)
+{
+    if(m_yIndex >= m_yEnd)
+    {
+        numPixels = 0;
+        return;
     }
 
-    ++m_yIndex;
+    m_numPixels = std::min(m_dstImg.m_width - m_xIndex, m_pixelsPerBlock);
+
+    *inBuffer  = (const float *)(m_srcImg.m_rData + m_srcImg.m_yStrideBytes * m_yIndex
+                                                  + m_srcImg.m_xStrideBytes * m_xIndex);
+    *outBuffer = (float *)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex
+                                            + m_dstImg.m_xStrideBytes * m_xIndex);
+
+    numPixels = m_numPixels;
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::finishRGBScanline()
+{
+    // The ops directly wrote the result in the destination image.
+    moveToNextBlock();
+}
+
+template<typename InType, typename OutType>
+bool GenericScanlineHelper<InType, OutType>::isPlanarFloat() const
+{
+    return m_srcImg.isPlanarFloat() && m_dstImg.isPlanarFloat()
+        && (m_srcImg.m_aData == nullptr) == (m_dstImg.m_aData == nullptr);
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::prepPlanarScanline(const float * inPlanes[4],
+                                                                float * outPlanes[4],
+                                                                long & numPixels)
+{
+    if(m_yIndex >= m_yEnd)
+    {
+        numPixels = 0;
+        return;
+    }
+
+    m_numPixels = std::min(m_dstImg.m_width - m_xIndex, m_pixelsPerBlock);
+
+    const ptrdiff_t srcOffset = m_srcImg.m_yStrideBytes * m_yIndex
+                              + m_srcImg.m_xStrideBytes * m_xIndex;
+    const ptrdiff_t dstOffset = m_dstImg.m_yStrideBytes * m_yIndex
+                              + m_dstImg.m_xStrideBytes * m_xIndex;
+
+    inPlanes[0] = (const float *)(m_srcImg.m_rData + srcOffset);
+    inPlanes[1] = (const float *)(m_srcImg.m_gData + srcOffset);
+    inPlanes[2] = (const float *)(m_srcImg.m_bData + srcOffset);
+    inPlanes[3] = m_srcImg.m_aData ? (const float *)(m_srcImg.m_aData + srcOffset) : nullptr;
+
+    outPlanes[0] = (float *)(m_dstImg.m_rData + dstOffset);
+    outPlanes[1] = (float *)(m_dstImg.m_gData + dstOffset);
+    outPlanes[2] = (float *)(m_dstImg.m_bData + dstOffset);
+    outPlanes[3] = m_dstImg.m_aData ? (float *)(m_dstImg.m_aData + dstOffset) : nullptr;
+
+    numPixels = m_numPixels;
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::finishPlanarScanline()
+{
+    // The ops directly wrote the result in the destination image.
+    moveToNextBlock();
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::moveToNextBlock()
+{
+    m_xIndex += m_numPixels;
+    if(m_xIndex >= m_dstImg.m_width)
+    {
+        m_xIndex = 0;
+        ++m_yIndex;
+    }
 }
 
 
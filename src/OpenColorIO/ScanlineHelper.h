@@ -37,9 +37,38 @@ public:
     virtual void init(const ImageDesc & srcImg, const ImageDesc & dstImg) = 0;
     virtual void init(const ImageDesc & img) = 0;
 
+    // Restrict the processing to the scanlines [yBegin, yEnd) of the image. Note that init()
+    // resets the range to the complete image.
+    virtual void setRowRange(int yBegin, int yEnd) = 0;
+
+    // Allocate the processing buffers for the largest block of pixels so that the following
+    // init() calls, whatever the image sizes are, do not allocate memory.
+    virtual void reserve() = 0;
+
     virtual void prepRGBAScanline(float** buffer, long & numPixels) = 0;
 
     virtual void finishRGBAScanline() = 0;
+
+    // When the source and destination images are both packed RGB F32 buffers, the CPU ops
+    // supporting it could directly process the image buffers (i.e. without the intermediate
+    // RGBA F32 buffer).
+    virtual bool isPackedFloatRGB() const = 0;
+
+    virtual void prepRGBScanline(const float ** inBuffer, float ** outBuffer, long & numPixels) = 0;
+
+    virtual void finishRGBScanline() = 0;
+
+    // When the source and destination images are both planar F32 buffers with the same alpha
+    // channel presence, the CPU ops supporting it could directly process the image planes.
+    virtual bool isPlanarFloat() const = 0;
+
+    // The planes are in the R, G, B, A order and the alpha planes are null for images without
+    // alpha channel.
+    virtual void prepPlanarScanline(const float * inPlanes[4],
+                                    float * outPlanes[4],
+                                    long & numPixels) = 0;
+
+    virtual void finishPlanarScanline() = 0;
 };
 
 template<typename InType, typename OutType>
@@ -56,10 +85,14 @@ public:
     void init(const ImageDesc & srcImg, const ImageDesc & dstImg) override;
     void init(const ImageDesc & img) override;
 
+    void setRowRange(int yBegin, int yEnd) override;
+
+    void reserve() override;
+
     ~GenericScanlineHelper() override;
 
-    // Copy from the src image to our scanline, in our preferred
-    // pixel layout. Return the number of pixels to process.
+    // Copy the next block of pixels from the src image to our scanline, in
+    // our preferred pixel layout. Return the number of pixels to process.
 
     void prepRGBAScanline(float** buffer, long & numPixels) override;
 
@@ -68,7 +101,29 @@ public:
 
     void finishRGBAScanline() override;
 
+    bool isPackedFloatRGB() const override;
+
+    // Return the next block of pixels of the src and dst images. Only valid when
+    // isPackedFloatRGB() is true.
+
+    void prepRGBScanline(const float ** inBuffer, float ** outBuffer, long & numPixels) override;
+
+    void finishRGBScanline() override;
+
+    bool isPlanarFloat() const override;
+
+    // Return the planes of the next block of pixels of the src and dst images. Only valid
+    // when isPlanarFloat() is true.
+
+    void prepPlanarScanline(const float * inPlanes[4],
+                            float * outPlanes[4],
+                            long & numPixels) override;
+
+    void finishPlanarScanline() override;
+
 private:
+    void moveToNextBlock();
+
     BitDepth m_inputBitDepth;
     BitDepth m_outputBitDepth;
     ConstOpCPURcPtr m_inBitDepthOp;
@@ -88,8 +143,16 @@ private:
     std::vector<InType> m_inBitDepthBuffer;
     std::vector<OutType> m_outBitDepthBuffer;
 
+    // The index of the first pixel of the current block in the line to process.
+    long m_xIndex;
+    // The number of pixels of the current block.
+    long m_numPixels;
     // The index of the current line to process.
     int m_yIndex;
+    // The index of the line following the last line to process.
+    int m_yEnd;
+    // The number of pixels of a block, derived from the L1 data cache size and the pixel sizes.
+    long m_pixelsPerBlock;
 
     // If the destination buffer is packed RGBA F32 it could then be used
     // as the internal processing buffer (i.e. instead of m_rgbaFloatBuffer
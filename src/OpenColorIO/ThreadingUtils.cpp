@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+#include "ThreadingUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+unsigned GetNumThreads(unsigned numThreads)
+{
+    if (numThreads == 0)
+    {
+        // Note that hardware_concurrency() could return 0 if the value is not computable.
+        numThreads = std::thread::hardware_concurrency();
+    }
+
+    return std::max(numThreads, 1u);
+}
+
+void ParallelFor(long numItems, long chunkSize, unsigned numThreads,
+                 const ParallelForFunction & func)
+{
+    if (numItems <= 0)
+    {
+        return;
+    }
+
+    chunkSize = std::max(chunkSize, 1L);
+
+    const long numChunks = (numItems + chunkSize - 1) / chunkSize;
+
+    // No need for more threads than chunks.
+    numThreads = (unsigned)std::min((long)GetNumThreads(numThreads), numChunks);
+
+    if (numThreads == 1)
+    {
+        for (long begin = 0; begin < numItems; begin += chunkSize)
+        {
+            func(0, begin, std::min(begin + chunkSize, numItems));
+        }
+        return;
+    }
+
+    std::atomic<long> nextChunk{ 0 };
+    std::atomic<bool> failed{ false };
+
+    Mutex exceptionMutex;
+    std::exception_ptr exception;
+
+    auto worker = [&](unsigned threadIndex)
+    {
+        try
+        {
+            for (long chunk = nextChunk++; chunk < numChunks && !failed; chunk = nextChunk++)
+            {
+                const long begin = chunk * chunkSize;
+                func(threadIndex, begin, std::min(begin + chunkSize, numItems));
+            }
+        }
+        catch (...)
+        {
+            AutoMutex lock(exceptionMutex);
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+            failed = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+
+    for (unsigned idx = 1; idx < numThreads; ++idx)
+    {
+        try
+        {
+            threads.emplace_back(worker, idx);
+        }
+        catch (const std::system_error &)
+        {
+            // The system cannot create more threads, the started ones and the calling thread
+            // process the remaining chunks.
+            break;
+        }
+    }
+
+    worker(0);
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+} // namespace OCIO_NAMESPACE
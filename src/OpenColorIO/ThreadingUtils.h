@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_THREADINGUTILS_H
+#define INCLUDED_OCIO_THREADINGUTILS_H
+
+
+#include <functional>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Get the number of threads to use for a parallel task where 0 means all the hardware
+// threads available. The returned value is always at least 1.
+unsigned GetNumThreads(unsigned numThreads);
+
+// Process the items [begin, end) on the thread of index threadIndex (in [0, numThreads) ).
+typedef std::function<void(unsigned threadIndex, long begin, long end)> ParallelForFunction;
+
+// Process the items [0, numItems) by chunks of chunkSize items which are dynamically dispatched
+// to numThreads threads, the calling thread being the thread of index 0. The method returns
+// when all the chunks are processed. If a chunk throws, the remaining ones are skipped and
+// the first exception is rethrown in the calling thread.
+//
+// Note that the thread index allows the caller to preallocate per-thread working data.
+void ParallelFor(long numItems, long chunkSize, unsigned numThreads,
+                 const ParallelForFunction & func);
+
+} // namespace OCIO_NAMESPACE
+
+
+#endif // INCLUDED_OCIO_THREADINGUTILS_H
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_WIDEOPCPU_H
+#define INCLUDED_OCIO_WIDEOPCPU_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+namespace OCIO_NAMESPACE
+{
+
+// Wide vector (i.e. AVX2 or AVX-512) renderer of a CPU op, with one function per pixel layout
+// (refer to OpCPU::apply(), OpCPU::applyRGB() and OpCPU::applyPlanar() for the layouts). The
+// first argument of the functions is the array of the op parameters, its content being
+// specific to each op.
+struct WideOpCPURenderer
+{
+    typedef void (ApplyFunc)(const float * params, const float * in, float * out, long numPixels);
+    typedef void (ApplyPlanarFunc)(const float * params,
+                                   const float * const * inPlanes,
+                                   float * const * outPlanes,
+                                   long numPixels);
+
+    ApplyFunc * apply = nullptr;
+    ApplyFunc * applyRGB = nullptr;
+    ApplyPlanarFunc * applyPlanar = nullptr;
+
+    bool isValid() const { return apply != nullptr; }
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_WIDEOPCPU_H
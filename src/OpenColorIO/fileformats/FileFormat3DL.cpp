@@ -10,6 +10,7 @@
 
 #include "BitDepthUtils.h"
 #include "fileformats/FileFormatUtils.h"
+#include "fileformats/TextLutScanner.h"
 #include "MathUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
@@ -244,44 +245,29 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
 
     // Parse the file 3D LUT data to an int array.
     {
-        const int MAX_LINE_SIZE = 4096;
-        char lineBuffer[MAX_LINE_SIZE];
-
-        StringUtils::StringVec lineParts;
         std::vector<int> tmpData;
 
-        int lineNumber = 0;
-
-        while(istream.good())
+        TextLutScanner scanner(istream);
+        while(scanner.nextLine())
         {
-            istream.getline(lineBuffer, MAX_LINE_SIZE);
-            ++lineNumber;
-
-            // Strip and split the line.
-            lineParts = StringUtils::SplitByWhiteSpaces(StringUtils::Trim(lineBuffer));
-
-            if(lineParts.empty()) continue;
-            if (lineParts.size() > 0)
+            if (scanner.lineStartsWith('#'))
             {
-                if (StringUtils::StartsWith(lineParts[0], '#'))
-                {
-                    continue;
-                }
-                if (StringUtils::StartsWith(lineParts[0], '<'))
-                {
-                    // Format error: reject files that could be
-                    // formatted as xml.
-                    std::ostringstream os;
-                    os << "Error parsing .3dl file. ";
-                    os << "Not expecting a line starting with \"<\".";
-                    os << "Line (" << lineNumber << "): '";
-                    os << lineBuffer << "'.";
-                    throw Exception(os.str().c_str());
-                }
+                continue;
+            }
+            if (scanner.lineStartsWith('<'))
+            {
+                // Format error: reject files that could be
+                // formatted as xml.
+                std::ostringstream os;
+                os << "Error parsing .3dl file. ";
+                os << "Not expecting a line starting with \"<\".";
+                os << "Line (" << scanner.getLineNumber() << "): '";
+                os << scanner.getLine() << "'.";
+                throw Exception(os.str().c_str());
             }
 
             // If we haven't found a list of ints, continue.
-            if (!StringVecToIntVec(tmpData, lineParts))
+            if (!ParseInts(scanner.lineBegin(), scanner.lineEnd(), tmpData))
             {
                 // Some keywords are valid (3DMESH, mesh, gamma, LUT*)
                 // but others could be format error.
@@ -306,8 +292,8 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                     std::ostringstream os;
                     os << "Error parsing .3dl file. ";
                     os << "Appears to contain more than 1 shaper LUT.";
-                    os << "Line (" << lineNumber << "): '";
-                    os << lineBuffer << "'.";
+                    os << "Line (" << scanner.getLineNumber() << "): '";
+                    os << scanner.getLine() << "'.";
                     throw Exception(os.str().c_str());
                 }
             }
@@ -328,8 +314,8 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                 std::ostringstream os;
                 os << "Error parsing .3dl file. ";
                 os << "Invalid line with less than 3 values.";
-                os << "Line (" << lineNumber << "): '";
-                os << lineBuffer << "'.";
+                os << "Line (" << scanner.getLineNumber() << "): '";
+                os << scanner.getLine() << "'.";
                 throw Exception(os.str().c_str());
             }
         }
@@ -527,9 +513,8 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_BLUE);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyToCube(inputToTarget, cubeData.data(), cubeSize);
 
     // Write out the file.
     // For for maximum compatibility with other apps, we will
@@ -5,6 +5,7 @@
 
 #include "fileformats/cdl/CDLParser.h"
 #include "fileformats/cdl/CDLWriter.h"
+#include "fileformats/FileFormatUtils.h"
 #include "fileformats/xmlutils/XMLReaderUtils.h"
 #include "fileformats/xmlutils/XMLWriterUtils.h"
 #include "transforms/FileTransform.h"
@@ -48,6 +49,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -75,6 +78,19 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    const ProbeResult res = ProbeXmlRootTag(buffer, size, "<ColorCorrection");
+
+    // A ColorCorrection element could also be part of a .ccc or of a .cdl file.
+    if (res == PROBE_YES && (FindInBuffer(buffer, size, "<ColorCorrectionCollection")
+                             || FindInBuffer(buffer, size, "<ColorDecisionList")))
+    {
+        return PROBE_MAYBE;
+    }
+    return res;
+}
+
 // Try and load the format
 // Raise an exception if it can't be loaded.
 
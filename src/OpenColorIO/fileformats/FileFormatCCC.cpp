@@ -7,6 +7,7 @@
 
 #include "fileformats/cdl/CDLParser.h"
 #include "fileformats/cdl/CDLWriter.h"
+#include "fileformats/FileFormatUtils.h"
 #include "fileformats/xmlutils/XMLReaderUtils.h"
 #include "fileformats/xmlutils/XMLWriterUtils.h"
 #include "fileformats/FormatMetadata.h"
@@ -58,6 +59,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -85,6 +88,11 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    return ProbeXmlRootTag(buffer, size, "<ColorCorrectionCollection");
+}
+
 // Try and load the format
 // Raise an exception if it can't be loaded.
 
@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "fileformats/cdl/CDLParser.h"
 #include "fileformats/cdl/CDLWriter.h"
+#include "fileformats/FileFormatUtils.h"
 #include "fileformats/xmlutils/XMLReaderUtils.h"
 #include "fileformats/xmlutils/XMLWriterUtils.h"
 #include "OpBuilders.h"
@@ -80,6 +81,8 @@ public:
     ~LocalFileFormat() = default;
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
+
+    ProbeResult probe(const char * buffer, size_t size) const override;
     
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
@@ -108,6 +111,11 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    return ProbeXmlRootTag(buffer, size, "<ColorDecisionList");
+}
+
 // Try and load the format.
 // Raise an exception if it can't be loaded.
 
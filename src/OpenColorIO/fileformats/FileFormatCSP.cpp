@@ -14,6 +14,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "fileformats/FileFormatUtils.h"
+#include "fileformats/TextLutScanner.h"
 #include "MathUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
@@ -321,6 +322,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -358,6 +361,17 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    size_t pos = 0;
+    std::string line;
+    if (!NextLineInBuffer(buffer, size, pos, line))
+    {
+        return PROBE_MAYBE;
+    }
+    return startswithU(line, "CSPLUTV100") ? PROBE_YES : PROBE_NO;
+}
+
 CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                                       const std::string & fileName,
                                       Interpolation interp) const
@@ -506,30 +520,20 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
         lut1d_ptr->setFileOutputBitDepth(BIT_DEPTH_F32);
         Array & lutArray = lut1d_ptr->getArray();
 
+        TextLutScanner scanner(istream);
         for(int i = 0; i < points1D; ++i)
         {
-            // Scan for the three floats.
-            nextline (istream, line);
-
-            const StringUtils::StringVec lineParts = StringUtils::SplitByWhiteSpaces(line);
-            std::vector<float> floatArray;
-
-            if (!StringVecToFloatVec(floatArray, lineParts)
-                || 3 != floatArray.size())
+            // Scan for the three floats, straight into the LUT.
+            if (!scanner.nextLine()
+                || !ParseFloats(scanner.lineBegin(), scanner.lineEnd(), &lutArray[i*3], 3))
             {
                 std::ostringstream os;
                 os << "Malformed 1D csp LUT. Each line of LUT values ";
                 os << "must contain three numbers. Line: '";
-                os << line << "'. File: ";
+                os << scanner.getLine() << "'. File: ";
                 os << fileName << ".";
                 throw Exception(os.str().c_str());
             }
-
-            // Store each channel.
-            lutArray[i*3 + 0] = floatArray[0];
-            lutArray[i*3 + 1] = floatArray[1];
-            lutArray[i*3 + 2] = floatArray[2];
-
         }
 
     }
@@ -585,32 +589,24 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
         int g = 0;
         int b = 0;
 
+        TextLutScanner scanner(istream);
         for(int i=0; i<num3dentries; ++i)
         {
-            // Load the cube.
-            nextline (istream, line);
-
             // OpData::Lut3D Array index, b changes fastest.
             const unsigned long arrayIdx =
                 GetLut3DIndex_BlueFast(r, g, b,
                                         lutSize, lutSize, lutSize);
 
-            const StringUtils::StringVec lineParts = StringUtils::SplitByWhiteSpaces(line);
-            std::vector<float> floatArray;
-
-            if (!StringVecToFloatVec(floatArray, lineParts)
-                || 3 != floatArray.size())
+            // Load the cube, straight into the LUT.
+            if (!scanner.nextLine()
+                || !ParseFloats(scanner.lineBegin(), scanner.lineEnd(), &lutArray[arrayIdx], 3))
             {
                 std::ostringstream os;
                 os << "Malformed 3D csp LUT, couldn't read cube row (";
-                os << i << "): " << line << "' in " << fileName << ".";
+                os << i << "): " << scanner.getLine() << "' in " << fileName << ".";
                 throw Exception(os.str().c_str());
             }
 
-            lutArray[arrayIdx + 0] = floatArray[0];
-            lutArray[arrayIdx + 1] = floatArray[1];
-            lutArray[arrayIdx + 2] = floatArray[2];
-
             // CSP stores the LUT in red-fastest order.
             r += 1;
             if (r == lutSize)
@@ -708,7 +704,6 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
     std::vector<float> shaperInData;
     std::vector<float> shaperOutData;
@@ -732,7 +727,7 @@ void LocalFileFormat::bake(const Baker & baker,
         shaperToInput->apply(shaperInImg);
 
         ConstCPUProcessorRcPtr shaperToTarget = GetShaperToTargetProcessor(baker);
-        shaperToTarget->apply(cubeImg);
+        ApplyToCube(shaperToTarget, cubeData.data(), cubeSize);
     }
     else
     {
@@ -779,11 +774,11 @@ void LocalFileFormat::bake(const Baker & baker,
 
         PackedImageDesc shaperInImg(&shaperInData[0], shaperSize, 1, 3);
         shaperToInput->apply(shaperInImg);
-        shaperToInput->apply(cubeImg);
+        ApplyToCube(shaperToInput, cubeData.data(), cubeSize);
 
         // Apply the 3D LUT to the remainder (from the input to the output).
         ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-        inputToTarget->apply(cubeImg);
+        ApplyToCube(inputToTarget, cubeData.data(), cubeSize);
     }
 
     // Write out the file.
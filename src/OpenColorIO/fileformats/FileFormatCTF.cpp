@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -122,6 +124,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -169,6 +173,12 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info2);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    // Same as isLoadableCTF(), the ProcessList tag is required.
+    return FindInBuffer(buffer, size, "<ProcessList") ? PROBE_YES : PROBE_NO;
+}
+
 class XMLParserHelper
 {
 public:
@@ -177,6 +187,7 @@ public:
 
     explicit XMLParserHelper(const std::string & fileName)
         : m_parser(XML_ParserCreate(nullptr))
+        , m_lineNumber(0)
         , m_fileName(fileName)
     {
         XML_SetUserData(m_parser, this);
@@ -195,22 +206,73 @@ public:
 
     void Parse(std::istream & istream)
     {
-        std::string line;
+        // The stream is parsed by large blocks. Parsing will copy the block in a buffer
+        // up to its length without the null termination. Our code will be called back
+        // to parse the buffer into numbers. Code uses strtod. The character data has to
+        // be delimited so that strtod does not access it after its length i.e. a block
+        // must end with a newline character or with the end of a tag.
+        static constexpr size_t BlockSize = 256 * 1024;
+
+        std::vector<char> buffer;
+        size_t pendingSize = 0; // Size of the undelimited end of the previous blocks.
+        size_t readSize = BlockSize;
+
+        unsigned int numLines = 0;
         m_lineNumber = 0;
+
         while (istream.good())
         {
-            std::getline(istream, line);
-            // Add back the newline character. Parsing will copy the line in a
-            // buffer up to the length of the line without the null termination.
-            // Our code will be called back to parse the buffer into a number.
-            // Code uses strtod. The buffer has to be delimited so that strtod
-            // does not access it after its length.
-            line.push_back('\n');
-            ++m_lineNumber;
-
-            Parse(line, !istream.good());
+            buffer.resize(pendingSize + readSize);
+            istream.read(buffer.data() + pendingSize, readSize);
+            size_t size = pendingSize + static_cast<size_t>(istream.gcount());
+
+            size_t blockSize = size;
+            if (istream.good())
+            {
+                // Keep the undelimited end for the next block. The pending data has no
+                // delimiter so only the newly read data is searched.
+                while (blockSize > pendingSize
+                       && buffer[blockSize - 1] != '\n' && buffer[blockSize - 1] != '>')
+                {
+                    --blockSize;
+                }
+
+                if (blockSize == pendingSize)
+                {
+                    // No delimiter (e.g. a very long single line), read more data at once.
+                    blockSize = 0;
+                    readSize *= 2;
+                }
+                else
+                {
+                    readSize = BlockSize;
+                }
+            }
+            else
+            {
+                // Terminate the last line.
+                buffer.resize(size);
+                buffer.push_back('\n');
+                blockSize = ++size;
+            }
+
+            if (blockSize > 0)
+            {
+                numLines += static_cast<unsigned int>(
+                    std::count(buffer.data(), buffer.data() + blockSize, '\n'));
+                Parse(buffer.data(), blockSize, !istream.good());
+            }
+
+            pendingSize = size - blockSize;
+            if (blockSize > 0 && pendingSize > 0)
+            {
+                memmove(buffer.data(), buffer.data() + blockSize, pendingSize);
+            }
         }
 
+        // The remaining errors are reported at the last line.
+        m_lineNumber = numLines;
+
         if (!m_elms.empty())
         {
             std::string error("CTF/CLF parsing error (no closing tag for '");
@@ -235,13 +297,13 @@ public:
         }
     }
 
-    void Parse(const std::string & buffer, bool lastLine)
+    void Parse(const char * buffer, size_t size, bool lastBlock)
     {
-        const int done = lastLine?1:0;
+        const int done = lastBlock?1:0;
 
         if (XML_STATUS_ERROR == XML_Parse(m_parser,
-                                          buffer.c_str(),
-                                          (int)buffer.size(), done))
+                                          buffer,
+                                          (int)size, done))
         {
             XML_Error eXpatErrorCode = XML_GetErrorCode(m_parser);
             if (eXpatErrorCode == XML_ERROR_TAG_MISMATCH)
@@ -328,7 +390,7 @@ private:
         os << "Error parsing CTF/CLF file (";
         os << m_fileName.c_str() << "). ";
         os << "Error is: " << error.c_str();
-        os << ". At line (" << m_lineNumber << ")";
+        os << ". At line (" << getXmLineNumber() << ")";
         throw Exception(os.str().c_str());
     }
 
@@ -492,7 +554,7 @@ private:
                     std::make_shared<CTFReaderMetadataElt>(
                         name,
                         pMD,
-                        pImpl->m_lineNumber,
+                        pImpl->getXmLineNumber(),
                         pImpl->m_fileName));
 
                 pImpl->m_elms.back()->start(atts);
@@ -1117,9 +1179,29 @@ private:
         }
     }
 
+    // Line of the current parsing position. As when the parser was fed line by line, that is
+    // the line where the current event ends e.g. the last line of a multi-line start tag.
     unsigned int getXmLineNumber() const
     {
-        return m_lineNumber;
+        if (m_lineNumber != 0)
+        {
+            return m_lineNumber;
+        }
+
+        unsigned int lineNumber = static_cast<unsigned int>(XML_GetCurrentLineNumber(m_parser));
+
+        int offset = 0;
+        int size   = 0;
+        const char * context = XML_GetInputContext(m_parser, &offset, &size);
+        const int count = XML_GetCurrentByteCount(m_parser);
+        if (context && count > 1 && offset >= 0 && offset + count <= size)
+        {
+            // A trailing newline belongs to the line it ends.
+            lineNumber += static_cast<unsigned int>(
+                std::count(context + offset, context + offset + count - 1, '\n'));
+        }
+
+        return lineNumber;
     }
 
     const std::string & getXmlFilename() const
@@ -1133,7 +1215,7 @@ private:
     }
 
     XML_Parser m_parser;
-    unsigned int m_lineNumber;
+    unsigned int m_lineNumber; // Number of lines once the whole stream is parsed.
     std::string m_fileName;
     bool m_isCLF;
     XmlReaderElementStack m_elms; // Parsing stack
@@ -1446,7 +1528,6 @@ void LocalFileFormat::bake(const Baker & baker,
     {
         cubeData.resize(cubeSize*cubeSize*cubeSize * 3);
         GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_BLUE);
-        PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
         ConstCPUProcessorRcPtr cubeProc;
         if (required_lut == CTF_1D_3D)
@@ -1458,7 +1539,7 @@ void LocalFileFormat::bake(const Baker & baker,
             cubeProc = inputToTarget;
         }
 
-        cubeProc->apply(cubeImg);
+        ApplyToCube(cubeProc, cubeData.data(), cubeSize);
     }
 
     //
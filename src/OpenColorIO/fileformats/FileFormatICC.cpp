@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <cstring>
 #include <sstream>
 #include <fstream>
 
@@ -63,6 +64,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     // Only reads the information data of the file.
     static LocalCachedFileRcPtr ReadInfo(std::istream & istream, 
                                          const std::string & fileName,
@@ -115,6 +118,12 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    // The profile header holds the 'acsp' signature at offset 36.
+    return (size >= 40 && memcmp(buffer + 36, "acsp", 4) == 0) ? PROBE_YES : PROBE_NO;
+}
+
 void LocalFileFormat::ThrowErrorMessage(const std::string & error,
                                         const std::string & fileName)
 {
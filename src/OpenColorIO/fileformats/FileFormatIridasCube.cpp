@@ -9,6 +9,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "fileformats/FileFormatUtils.h"
+#include "fileformats/TextLutScanner.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ops/matrix/MatrixOp.h"
@@ -96,6 +97,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -147,6 +150,58 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    // Look at the header keywords to tell an Iridas .cube file from a Resolve one.
+    bool has1D = false;
+    bool has3D = false;
+    bool hasDomain = false;
+
+    size_t pos = 0;
+    std::string line;
+    while (NextLineInBuffer(buffer, size, pos, line))
+    {
+        line = StringUtils::Lower(StringUtils::Trim(line));
+
+        if (StringUtils::StartsWith(line, '#') || StringUtils::StartsWith(line, "title"))
+        {
+            continue;
+        }
+        else if (StringUtils::StartsWith(line, "lut_1d_size"))
+        {
+            has1D = true;
+        }
+        else if (StringUtils::StartsWith(line, "lut_3d_size"))
+        {
+            has3D = true;
+        }
+        else if (StringUtils::StartsWith(line, "domain_min")
+                 || StringUtils::StartsWith(line, "domain_max"))
+        {
+            hasDomain = true;
+        }
+        else if (StringUtils::StartsWith(line, "lut_2d_size")
+                 || StringUtils::StartsWith(line, "lut_1d_input_range")
+                 || StringUtils::StartsWith(line, "lut_3d_input_range"))
+        {
+            return PROBE_NO;
+        }
+        else
+        {
+            // Start of the LUT entries.
+            break;
+        }
+    }
+
+    if (has1D && has3D)
+    {
+        // A shaper and a 3D LUT, only the Resolve format supports that.
+        return PROBE_NO;
+    }
+
+    return hasDomain ? PROBE_YES : PROBE_MAYBE;
+}
+
 CachedFileRcPtr
 LocalFileFormat::read(std::istream & istream,
                       const std::string & fileName,
@@ -159,7 +214,10 @@ LocalFileFormat::read(std::istream & istream,
     }
 
     // Parse the file
-    std::vector<float> raw;
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    // Number of LUT entries found.
+    unsigned long numEntries = 0;
 
     int size3d = 0;
     int size1d = 0;
@@ -175,9 +233,13 @@ LocalFileFormat::read(std::istream & istream,
         int lineNumber = 0;
         char endTok;
         bool entriesStarted = false;
+        std::streampos linePos;
 
-        while(!entriesStarted && nextline(istream, line))
+        while(!entriesStarted)
         {
+            linePos = istream.tellg();
+            if (!nextline(istream, line)) break;
+
             ++lineNumber;
             // All lines starting with '#' are comments
             if (StringUtils::StartsWith(line,'#')) continue;
@@ -205,7 +267,6 @@ LocalFileFormat::read(std::istream & istream,
                         line);
                 }
 
-                raw.reserve(3*size1d);
                 in1d = true;
             }
             else if (StringUtils::StartsWith(line, "lut_2d_size"))
@@ -231,7 +292,6 @@ LocalFileFormat::read(std::istream & istream,
                         line);
                 }
 
-                raw.reserve(3*size3d*size3d*size3d);
                 in3d = true;
             }
             else if (StringUtils::StartsWith(line, "domain_min"))
@@ -308,72 +368,103 @@ LocalFileFormat::read(std::istream & istream,
             }
         }
 
-        do
+        if (entriesStarted)
         {
-            line = StringUtils::LeftTrim(line);
-
-            // All lines starting with '#' are comments
-            if (StringUtils::StartsWith(line,'#')) continue;
-
-            if (line.empty()) continue;
-
-            char valR[64] = "";
-            char valG[64] = "";
-            char valB[64] = "";
-
-#ifdef _WIN32
-            if (sscanf_s(line.c_str(), "%s %s %s %c", valR, 64, valG, 64, valB, 64, &endTok, 1) != 3)
-#else
-            if (sscanf(line.c_str(), "%s %s %s %c", valR, valG, valB, &endTok) != 3)
-#endif
+            // Scan the entries in place, from the first one.
+            istream.clear();
+            istream.seekg(linePos);
+            --lineNumber;
+
+            // The entries are written directly into the LUT array. The array is only
+            // allocated for a valid size, the number of entries is validated below.
+            Array * lutArray = nullptr;
+            unsigned long lutSize = 0;
+            unsigned long numValues = 0;
+            if (in1d)
             {
-                // It must be a float triple!
-                ThrowErrorMessage(
-                    "Malformed color triples specified.",
-                    fileName,
-                    lineNumber,
-                    line);
+                if (size1d > 0)
+                {
+                    lutSize = static_cast<unsigned long>(size1d);
+                    cachedFile->lut1D = std::make_shared<Lut1DOpData>(lutSize);
+                    lutArray = &cachedFile->lut1D->getArray();
+                }
             }
-            else
+            else if (in3d)
+            {
+                if (size3d > 0 && static_cast<unsigned long>(size3d) <= Lut3DOpData::maxSupportedLength)
+                {
+                    lutSize = static_cast<unsigned long>(size3d);
+                    cachedFile->lut3D = std::make_shared<Lut3DOpData>(lutSize);
+                    lutArray = &cachedFile->lut3D->getArray();
+                }
+            }
+            if (lutArray)
+            {
+                numValues = lutArray->getNumValues();
+            }
+
+            // The 3D LUT entries are in red fastest order, the Lut3DOpData array is in blue
+            // fastest order.
+            unsigned long r = 0, g = 0, b = 0;
+
+            TextLutScanner scanner(istream);
+            while (scanner.nextLine())
             {
-                float r = NAN;
-                float g = NAN;
-                float b = NAN;
+                // All lines starting with '#' are comments
+                if (scanner.lineStartsWith('#')) continue;
 
-                const auto rAnswer = NumberUtils::from_chars(valR, valR + 64, r);
-                const auto gAnswer = NumberUtils::from_chars(valG, valG + 64, g);
-                const auto bAnswer = NumberUtils::from_chars(valB, valB + 64, b);
+                ++lineNumber;
 
-                if (rAnswer.ec != std::errc() || gAnswer.ec != std::errc() || bAnswer.ec != std::errc())
+                float rgb[3];
+                if (!ParseFloats(scanner.lineBegin(), scanner.lineEnd(), rgb, 3))
                 {
+                    // It must be a float triple!
                     ThrowErrorMessage(
-                        "Invalid color triples",
+                        CountTokens(scanner.lineBegin(), scanner.lineEnd()) != 3
+                            ? "Malformed color triples specified."
+                            : "Invalid color triples",
                         fileName,
                         lineNumber,
-                        line);
+                        std::string(scanner.lineBegin(), scanner.lineEnd()));
                 }
 
-                raw.push_back(r);
-                raw.push_back(g);
-                raw.push_back(b);
-            }
+                if (3 * numEntries < numValues)
+                {
+                    unsigned long idx = 3 * numEntries;
+                    if (cachedFile->lut3D)
+                    {
+                        idx = 3 * ((r * lutSize + g) * lutSize + b);
+                        if (++r == lutSize)
+                        {
+                            r = 0;
+                            if (++g == lutSize)
+                            {
+                                g = 0;
+                                ++b;
+                            }
+                        }
+                    }
 
-            ++lineNumber;
+                    Array::Values & values = lutArray->getValues();
+                    values[idx + 0] = rgb[0];
+                    values[idx + 1] = rgb[1];
+                    values[idx + 2] = rgb[2];
+                }
+
+                ++numEntries;
+            }
         }
-        while (nextline(istream, line));
     }
 
-    // Interpret the parsed data, validate LUT sizes.
-
-    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+    // Validate LUT sizes.
 
     if(in1d)
     {
-        if(size1d != static_cast<int>(raw.size()/3))
+        if(size1d != static_cast<int>(numEntries))
         {
             std::ostringstream os;
             os << "Incorrect number of lut1d entries. ";
-            os << "Found " << raw.size() / 3;
+            os << "Found " << numEntries;
             os << ", expected " << size1d << ".";
             ThrowErrorMessage(
                 os.str().c_str(),
@@ -386,32 +477,22 @@ LocalFileFormat::read(std::istream & istream,
             memcpy(cachedFile->domain_min, domain_min, 3 * sizeof(float));
             memcpy(cachedFile->domain_max, domain_max, 3 * sizeof(float));
 
-            const auto lutLenght = static_cast<unsigned long>(size1d);
-            cachedFile->lut1D = std::make_shared<Lut1DOpData>(lutLenght);
             if (Lut1DOpData::IsValidInterpolation(interp))
             {
                 cachedFile->lut1D->setInterpolation(interp);
             }
 
             cachedFile->lut1D->setFileOutputBitDepth(BIT_DEPTH_F32);
-
-            auto & lutArray = cachedFile->lut1D->getArray();
-
-            const auto numVals = lutArray.getNumValues();
-            for(unsigned long i = 0; i < numVals; ++i)
-            {
-                lutArray[i] = raw[i];
-            }
         }
     }
     else if(in3d)
     {
         if(size3d*size3d*size3d 
-            != static_cast<int>(raw.size()/3))
+            != static_cast<int>(numEntries))
         {
             std::ostringstream os;
             os << "Incorrect number of 3D LUT entries. ";
-            os << "Found " << raw.size() / 3 << ", expected ";
+            os << "Found " << numEntries << ", expected ";
             os << size3d * size3d * size3d << ".";
             ThrowErrorMessage(
                 os.str().c_str(),
@@ -421,13 +502,16 @@ LocalFileFormat::read(std::istream & istream,
         // Reformat 3D data
         memcpy(cachedFile->domain_min, domain_min, 3*sizeof(float));
         memcpy(cachedFile->domain_max, domain_max, 3*sizeof(float));
-        cachedFile->lut3D = std::make_shared<Lut3DOpData>(size3d);
+        if (!cachedFile->lut3D)
+        {
+            // Unsupported size, let the LUT report it.
+            cachedFile->lut3D = std::make_shared<Lut3DOpData>(size3d);
+        }
         if (Lut3DOpData::IsValidInterpolation(interp))
         {
             cachedFile->lut3D->setInterpolation(interp);
         }
         cachedFile->lut3D->setFileOutputBitDepth(BIT_DEPTH_F32);
-        cachedFile->lut3D->setArrayFromRedFastestOrder(raw);
     }
     else
     {
@@ -463,9 +547,8 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyToCube(inputToTarget, cubeData.data(), cubeSize);
 
     const auto & metadata = baker.getFormatMetadata();
     const auto nb = metadata.getNumChildrenElements();
@@ -488,6 +488,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -509,6 +511,11 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    return ProbeXmlRootTag(buffer, size, "<look");
+}
+
 CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                                       const std::string & fileName,
                                       Interpolation interp) const
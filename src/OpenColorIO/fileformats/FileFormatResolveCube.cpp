@@ -9,6 +9,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "fileformats/FileFormatUtils.h"
+#include "fileformats/TextLutScanner.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ops/matrix/MatrixOp.h"
@@ -204,6 +205,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -256,6 +259,53 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    // Look at the header keywords to tell a Resolve .cube file from an Iridas one.
+    bool has1D = false;
+    bool has3D = false;
+    bool hasRange = false;
+
+    size_t pos = 0;
+    std::string line;
+    while (NextLineInBuffer(buffer, size, pos, line))
+    {
+        line = StringUtils::Lower(StringUtils::Trim(line));
+
+        if (StringUtils::StartsWith(line, '#'))
+        {
+            continue;
+        }
+        else if (StringUtils::StartsWith(line, "lut_1d_size"))
+        {
+            has1D = true;
+        }
+        else if (StringUtils::StartsWith(line, "lut_3d_size"))
+        {
+            has3D = true;
+        }
+        else if (StringUtils::StartsWith(line, "lut_1d_input_range")
+                 || StringUtils::StartsWith(line, "lut_3d_input_range"))
+        {
+            hasRange = true;
+        }
+        else if (StringUtils::StartsWith(line, "title")
+                 || StringUtils::StartsWith(line, "lut_2d_size")
+                 || StringUtils::StartsWith(line, "domain_min")
+                 || StringUtils::StartsWith(line, "domain_max"))
+        {
+            return PROBE_NO;
+        }
+        else
+        {
+            // Start of the LUT entries.
+            break;
+        }
+    }
+
+    return (hasRange || (has1D && has3D)) ? PROBE_YES : PROBE_MAYBE;
+}
+
 CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                                       const std::string & fileName,
                                       Interpolation interp) const
@@ -286,17 +336,28 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
     {
         std::string line;
         StringUtils::StringVec parts;
-        std::vector<float> tmpfloats;
+        float rgb[3];
         int lineNumber = 0;
         bool headerComplete = false;
         int tripletNumber = 0;
 
-        while(nextline(istream, line))
+        auto addTriplet = [&]()
+        {
+            std::vector<float> & raw = (has1d && tripletNumber < size1d) ? raw1d : raw3d;
+            raw.push_back(rgb[0]);
+            raw.push_back(rgb[1]);
+            raw.push_back(rgb[2]);
+
+            ++tripletNumber;
+        };
+
+        TextLutScanner scanner(istream);
+        while(scanner.nextLine())
         {
             ++lineNumber;
 
             // All lines starting with '#' are comments
-            if(StringUtils::StartsWith(line,'#'))
+            if(scanner.lineStartsWith('#'))
             {
                 if(headerComplete)
                 {
@@ -304,7 +365,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                         "Comments not allowed after header.",
                         fileName,
                         lineNumber,
-                        line);
+                        scanner.getLine());
                 }
                 else
                 {
@@ -312,7 +373,16 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                 }
             }
 
+            // Most of the lines are entries, convert them in place.
+            if(ParseFloats(scanner.lineBegin(), scanner.lineEnd(), rgb, 3))
+            {
+                headerComplete = true;
+                addTriplet();
+                continue;
+            }
+
             // Strip, lowercase, and split the line
+            line = scanner.getLine();
             parts = StringUtils::SplitByWhiteSpaces(StringUtils::Lower(StringUtils::Trim(line)));
             if(parts.empty()) continue;
 
@@ -390,31 +460,12 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
             }
             else
             {
-                headerComplete = true;
-
                 // It must be a float triple!
-                if(!StringVecToFloatVec(tmpfloats, parts) || tmpfloats.size() != 3)
-                {
-                    ThrowErrorMessage(
-                        "Malformed color triples specified.",
-                        fileName,
-                        lineNumber,
-                        line);
-                }
-
-                for(int i=0; i<3; ++i)
-                {
-                    if(has1d && tripletNumber < size1d)
-                    {
-                        raw1d.push_back(tmpfloats[i]);
-                    }
-                    else
-                    {
-                        raw3d.push_back(tmpfloats[i]);
-                    }
-                }
-
-                ++tripletNumber;
+                ThrowErrorMessage(
+                    "Malformed color triples specified.",
+                    fileName,
+                    lineNumber,
+                    line);
             }
         }
     }
@@ -598,7 +649,6 @@ void LocalFileFormat::bake(const Baker & baker,
     {
         cubeData.resize(cubeSize*cubeSize*cubeSize*3);
         GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-        PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
         ConstCPUProcessorRcPtr cubeProc;
         if(required_lut == CUBE_1D_3D)
@@ -611,7 +661,7 @@ void LocalFileFormat::bake(const Baker & baker,
             cubeProc = inputToTarget;
         }
 
-        cubeProc->apply(cubeImg);
+        ApplyToCube(cubeProc, cubeData.data(), cubeSize);
     }
 
     //
@@ -58,6 +58,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -89,6 +91,25 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    // The 'Version' tag is mandatory in the header, which ends with '{'.
+    size_t pos = 0;
+    std::string line;
+    while (NextLineInBuffer(buffer, size, pos, line))
+    {
+        if (StringUtils::StartsWith(line, "Version"))
+        {
+            return PROBE_YES;
+        }
+        if (StringUtils::StartsWith(line, '{'))
+        {
+            return PROBE_NO;
+        }
+    }
+    return PROBE_MAYBE;
+}
+
 // Try and load the format.
 // Raise an exception if it can't be loaded.
 
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstdio>
 #include <sstream>
 #include <vector>
@@ -8,6 +9,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "fileformats/FileFormatUtils.h"
+#include "fileformats/TextLutScanner.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "Platform.h"
 #include "BakingUtils.h"
@@ -53,6 +55,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -79,6 +83,13 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    // The header must be on the very first line.
+    const size_t len = std::min(size, size_t(6));
+    return StringUtils::Lower(std::string(buffer, len)) == "spilut" ? PROBE_YES : PROBE_NO;
+}
+
 CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                                       const std::string & fileName,
                                       Interpolation interp) const
@@ -144,34 +155,30 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
     Array & lutArray = lut3d->getArray();
     unsigned long numVal = lutArray.getNumValues();
     std::vector<bool> indexDefined(numVal, false);
-    while (istream.good() && entriesRemaining > 0)
+
+    // Lines are made of 3 indices and 3 values, the lines not starting with 3 integers are
+    // ignored. The values are converted in place.
+    TextLutScanner scanner(istream);
+    while (entriesRemaining > 0 && scanner.nextLine())
     {
-        istream.getline(lineBuffer, MAX_LINE_SIZE);
-
-        char redValueS[64] = "";
-        char greenValueS[64] = "";
-        char blueValueS[64] = "";
-
-#ifdef _WIN32
-        if (sscanf(lineBuffer,
-            "%d %d %d %s %s %s",
-            &rIndex, &gIndex, &bIndex,
-            redValueS, 64,
-            greenValueS, 64,
-            blueValueS, 64) == 6)
-#else
-        if (sscanf(lineBuffer, "%d %d %d %s %s %s",
-            &rIndex, &gIndex, &bIndex,
-            redValueS, greenValueS, blueValueS) == 6)
-#endif
+        const char * current = scanner.lineBegin();
+        const char * end     = scanner.lineEnd();
+
+        const char * token[6][2];
+        int numTokens = 0;
+        while (numTokens < 6 && NextToken(current, end, token[numTokens][0], token[numTokens][1]))
         {
-            const auto redValueAnswer = NumberUtils::from_chars(redValueS, redValueS + 64, redValue);
-            const auto greenValueAnswer = NumberUtils::from_chars(greenValueS, greenValueS + 64, greenValue);
-            const auto blueValueAnswer = NumberUtils::from_chars(blueValueS, blueValueS + 64, blueValue);
+            ++numTokens;
+        }
 
-            if (redValueAnswer.ec != std::errc()
-                || greenValueAnswer.ec != std::errc()
-                || blueValueAnswer.ec != std::errc())
+        if (numTokens == 6
+            && ParseInt(token[0][0], token[0][1], rIndex)
+            && ParseInt(token[1][0], token[1][1], gIndex)
+            && ParseInt(token[2][0], token[2][1], bIndex))
+        {
+            if (!ParseFloat(token[3][0], token[3][1], redValue)
+                || !ParseFloat(token[4][0], token[4][1], greenValue)
+                || !ParseFloat(token[5][0], token[5][1], blueValue))
             {
                 std::ostringstream os;
                 os << "Error parsing .spi3d file (";
@@ -179,7 +186,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                 os << "). ";
                 os << "Data is invalid. ";
                 os << "A color value is specified (";
-                os << redValueS << " " << greenValueS << " " << blueValueS;
+                os << std::string(token[3][0], token[5][1]);
                 os << ") that cannot be parsed as a floating-point triplet.";
                 throw Exception(os.str().c_str());
             }
@@ -278,9 +285,8 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_BLUE);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyToCube(inputToTarget, cubeData.data(), cubeSize);
 
     ostream << "SPILUT 1.0\n";
     ostream << "3 3\n";
@@ -60,6 +60,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -86,6 +88,18 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    size_t pos = 0;
+    std::string line;
+    if (!NextLineInBuffer(buffer, size, pos, line))
+    {
+        return PROBE_MAYBE;
+    }
+    return StringUtils::StartsWith(StringUtils::Lower(line), "# truelight cube") ? PROBE_YES
+                                                                                   : PROBE_NO;
+}
+
 CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                                       const std::string & /* fileName unused */,
                                       Interpolation interp) const
@@ -290,11 +304,10 @@ LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
     // Apply processor to LUT data
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyToCube(inputToTarget, cubeData.data(), cubeSize);
 
     int shaperSize = baker.getShaperSize();
     if (shaperSize==-1) shaperSize = DEFAULT_SHAPER_SIZE;
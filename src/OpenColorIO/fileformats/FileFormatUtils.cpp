@@ -2,9 +2,13 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
+#include <cstring>
+
 #include "fileformats/FileFormatUtils.h"
 
 #include "Logging.h"
+#include "utils/StringUtils.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -64,4 +68,59 @@ void LogWarningInterpolationNotUsed(Interpolation interp, const FileTransform &
     oss << std::string(fileTransform.getSrc()) << "'.";
     LogWarning(oss.str());
 }
+
+bool NextLineInBuffer(const char * buffer, size_t size, size_t & pos, std::string & line)
+{
+    while (pos < size)
+    {
+        const char * start = buffer + pos;
+        const char * eol   = static_cast<const char *>(memchr(start, '\n', size - pos));
+        const char * end   = eol ? eol : buffer + size;
+
+        pos = static_cast<size_t>(end - buffer) + (eol ? 1 : 0);
+
+        line.assign(start, end);
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (!StringUtils::IsEmptyOrWhiteSpace(line))
+        {
+            return true;
+        }
+    }
+
+    line.clear();
+    return false;
+}
+
+bool FindInBuffer(const char * buffer, size_t size, const char * pattern)
+{
+    const char * end = buffer + size;
+    return std::search(buffer, end, pattern, pattern + strlen(pattern)) != end;
+}
+
+FileFormat::ProbeResult ProbeXmlRootTag(const char * buffer, size_t size, const char * rootTag)
+{
+    size_t pos = 0;
+
+    // Skip the UTF-8 byte order mark and the leading white spaces.
+    if (size >= 3 && memcmp(buffer, "\xEF\xBB\xBF", 3) == 0)
+    {
+        pos = 3;
+    }
+    while (pos < size && strchr(" \t\r\n", buffer[pos]) && buffer[pos] != '\0')
+    {
+        ++pos;
+    }
+
+    // Any other printable ASCII character can not start a XML document. Other bytes
+    // (e.g. UTF-16 content) are left to the XML parser.
+    if (pos < size && buffer[pos] != '<' && buffer[pos] > ' ' && buffer[pos] < 127)
+    {
+        return FileFormat::PROBE_NO;
+    }
+
+    return FindInBuffer(buffer, size, rootTag) ? FileFormat::PROBE_YES : FileFormat::PROBE_MAYBE;
+}
 } // OCIO_NAMESPACE
@@ -9,9 +9,24 @@
 
 #include "ops/lut1d/Lut1DOpData.h"
 #include "ops/lut3d/Lut3DOpData.h"
+#include "transforms/FileTransform.h"
 
 namespace OCIO_NAMESPACE
 {
+// Helpers for the FileFormat::probe() implementations.
+
+// Memory buffer counterpart of nextline(): read the next line from 'pos' which is not
+// empty or white space only, without its end of line characters. Return false when the
+// end of the buffer is reached.
+bool NextLineInBuffer(const char * buffer, size_t size, size_t & pos, std::string & line);
+
+// True if the pattern is found in the buffer.
+bool FindInBuffer(const char * buffer, size_t size, const char * pattern);
+
+// Probe of the XML based formats: PROBE_YES if the root tag (e.g. "<ProcessList") is found,
+// PROBE_NO if the content does not start like an XML document, PROBE_MAYBE otherwise.
+FileFormat::ProbeResult ProbeXmlRootTag(const char * buffer, size_t size, const char * rootTag);
+
 Lut1DOpDataRcPtr HandleLUT1D(const Lut1DOpDataRcPtr & fileLut1D,
                              Interpolation fileInterp,
                              bool & fileInterpUsed);
@@ -43,6 +43,8 @@ public:
 
     void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
 
+    ProbeResult probe(const char * buffer, size_t size) const override;
+
     CachedFileRcPtr read(std::istream & istream,
                          const std::string & fileName,
                          Interpolation interp) const override;
@@ -89,6 +91,17 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
     formatInfoVec.push_back(info);
 }
 
+FileFormat::ProbeResult LocalFileFormat::probe(const char * buffer, size_t size) const
+{
+    size_t pos = 0;
+    std::string line;
+    if (!NextLineInBuffer(buffer, size, pos, line))
+    {
+        return PROBE_MAYBE;
+    }
+    return StringUtils::StartsWith(StringUtils::Lower(line), "#inventor") ? PROBE_YES : PROBE_NO;
+}
+
 CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                                       const std::string & fileName,
                                       Interpolation interp) const
@@ -0,0 +1,237 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#include "fileformats/TextLutScanner.h"
+#include "ParseUtils.h"
+#include "utils/NumberUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+inline bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+} // anonymous namespace
+
+TextLutScanner::TextLutScanner(std::istream & istream)
+{
+    const MemoryIStreamBuf * buffer = dynamic_cast<const MemoryIStreamBuf *>(istream.rdbuf());
+    if (buffer)
+    {
+        m_current = buffer->current();
+        m_end     = buffer->end();
+    }
+    else
+    {
+        m_storage.assign(std::istreambuf_iterator<char>(istream), std::istreambuf_iterator<char>());
+        m_current = m_storage.data();
+        m_end     = m_current + m_storage.size();
+    }
+}
+
+bool TextLutScanner::nextLine()
+{
+    while (m_current < m_end)
+    {
+        const char * eol
+            = static_cast<const char *>(memchr(m_current, '\n', size_t(m_end - m_current)));
+
+        m_rawBegin = m_current;
+        m_rawEnd   = eol ? eol : m_end;
+        m_current  = eol ? eol + 1 : m_end;
+        ++m_lineNumber;
+
+        if (m_rawEnd != m_rawBegin && *(m_rawEnd - 1) == '\r')
+        {
+            --m_rawEnd;
+        }
+
+        m_lineBegin = m_rawBegin;
+        m_lineEnd   = m_rawEnd;
+        while (m_lineBegin != m_lineEnd && IsSpace(*m_lineBegin))
+        {
+            ++m_lineBegin;
+        }
+        while (m_lineEnd != m_lineBegin && IsSpace(*(m_lineEnd - 1)))
+        {
+            --m_lineEnd;
+        }
+
+        if (m_lineBegin != m_lineEnd)
+        {
+            return true;
+        }
+    }
+
+    m_rawBegin = m_rawEnd = m_lineBegin = m_lineEnd = m_end;
+    return false;
+}
+
+std::string TextLutScanner::getLine() const
+{
+    return std::string(m_rawBegin, m_rawEnd);
+}
+
+bool NextToken(const char * & current, const char * end,
+               const char * & tokenBegin, const char * & tokenEnd)
+{
+    while (current != end && IsSpace(*current))
+    {
+        ++current;
+    }
+
+    if (current == end)
+    {
+        return false;
+    }
+
+    tokenBegin = current;
+    while (current != end && !IsSpace(*current))
+    {
+        ++current;
+    }
+    tokenEnd = current;
+
+    return true;
+}
+
+bool ParseFloat(const char * tokenBegin, const char * tokenEnd, float & value)
+{
+    if (NumberUtils::from_chars_fast(tokenBegin, tokenEnd, value))
+    {
+        return true;
+    }
+
+    // The slow path may rely on a null terminated string.
+    static constexpr size_t MaxTokenSize = 64;
+    const size_t size = size_t(tokenEnd - tokenBegin);
+    if (size == 0 || size >= MaxTokenSize)
+    {
+        return false;
+    }
+
+    char token[MaxTokenSize];
+    memcpy(token, tokenBegin, size);
+    token[size] = '\0';
+
+    float x = 0.0f;
+    const auto result = NumberUtils::from_chars(token, token + size, x);
+    if (result.ec != std::errc())
+    {
+        return false;
+    }
+
+    value = x;
+    return true;
+}
+
+bool ParseInt(const char * tokenBegin, const char * tokenEnd, int & value)
+{
+    const char * p = tokenBegin;
+
+    bool negative = false;
+    if (p != tokenEnd && (*p == '-' || *p == '+'))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    if (p == tokenEnd)
+    {
+        return false;
+    }
+
+    int64_t x = 0;
+    for (; p != tokenEnd; ++p)
+    {
+        if (!IsDigit(*p))
+        {
+            return false;
+        }
+
+        x = x * 10 + (*p - '0');
+        if (x > int64_t(INT_MAX) + 1)
+        {
+            return false;
+        }
+    }
+
+    x = negative ? -x : x;
+    if (x > INT_MAX)
+    {
+        return false;
+    }
+
+    value = static_cast<int>(x);
+    return true;
+}
+
+bool ParseFloats(const char * begin, const char * end, float * values, unsigned numValues)
+{
+    const char * tokenBegin = nullptr;
+    const char * tokenEnd   = nullptr;
+
+    for (unsigned idx = 0; idx < numValues; ++idx)
+    {
+        if (!NextToken(begin, end, tokenBegin, tokenEnd)
+            || !ParseFloat(tokenBegin, tokenEnd, values[idx]))
+        {
+            return false;
+        }
+    }
+
+    // No extra token.
+    return !NextToken(begin, end, tokenBegin, tokenEnd);
+}
+
+bool ParseInts(const char * begin, const char * end, std::vector<int> & values)
+{
+    values.clear();
+
+    const char * tokenBegin = nullptr;
+    const char * tokenEnd   = nullptr;
+
+    while (NextToken(begin, end, tokenBegin, tokenEnd))
+    {
+        int value = 0;
+        if (!ParseInt(tokenBegin, tokenEnd, value))
+        {
+            return false;
+        }
+        values.push_back(value);
+    }
+
+    return true;
+}
+
+unsigned CountTokens(const char * begin, const char * end)
+{
+    unsigned count = 0;
+
+    const char * tokenBegin = nullptr;
+    const char * tokenEnd   = nullptr;
+    while (NextToken(begin, end, tokenBegin, tokenEnd))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+} // namespace OCIO_NAMESPACE
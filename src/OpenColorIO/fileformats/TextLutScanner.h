@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_FILEFORMATS_TEXTLUTSCANNER_H
+#define INCLUDED_OCIO_FILEFORMATS_TEXTLUTSCANNER_H
+
+#include <istream>
+#include <string>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Line scanner for the value section of the text LUT formats (i.e. .cube, .spi3d, .3dl, .csp).
+//
+// The content is scanned in place, without any per-line allocation. When the stream is a
+// MemoryIStream (i.e. all the files loaded through a FileTransform) its buffer is directly
+// used, otherwise the rest of the stream is read once in memory.
+class TextLutScanner
+{
+public:
+    TextLutScanner() = delete;
+    TextLutScanner(const TextLutScanner &) = delete;
+    TextLutScanner & operator=(const TextLutScanner &) = delete;
+
+    // Scan the stream content from its current position.
+    explicit TextLutScanner(std::istream & istream);
+
+    // Move to the next line which is not empty or white space only, same as nextline().
+    // Return false at the end of the content.
+    bool nextLine();
+
+    // Number of lines read so far, including the empty ones.
+    unsigned getLineNumber() const noexcept { return m_lineNumber; }
+
+    // The current line without its leading and trailing white spaces.
+    const char * lineBegin() const noexcept { return m_lineBegin; }
+    const char * lineEnd() const noexcept { return m_lineEnd; }
+
+    bool lineStartsWith(char c) const noexcept
+    {
+        return m_lineBegin != m_lineEnd && *m_lineBegin == c;
+    }
+
+    // The current line as returned by nextline() i.e. only without the end of line
+    // characters. Only meant to build error messages.
+    std::string getLine() const;
+
+private:
+    std::string m_storage;
+
+    const char * m_current   = nullptr;
+    const char * m_end       = nullptr;
+    const char * m_rawBegin  = nullptr;
+    const char * m_rawEnd    = nullptr;
+    const char * m_lineBegin = nullptr;
+    const char * m_lineEnd   = nullptr;
+
+    unsigned m_lineNumber = 0;
+};
+
+// Find the next token delimited by white spaces in [current, end). Return false if there
+// is none, otherwise current is moved after the token.
+bool NextToken(const char * & current, const char * end,
+               const char * & tokenBegin, const char * & tokenEnd);
+
+// Convert a token to a number. As NumberUtils::from_chars() (used for the uncommon cases),
+// characters following a valid number are ignored. Most of the LUT values are converted by
+// an exact fast path that does not need any locale or copy.
+bool ParseFloat(const char * tokenBegin, const char * tokenEnd, float & value);
+
+// Convert a token to an int, the whole token must be an integer.
+bool ParseInt(const char * tokenBegin, const char * tokenEnd, int & value);
+
+// Convert the white space separated tokens of [begin, end). Return true only if there
+// are exactly numValues tokens and they are all numbers.
+bool ParseFloats(const char * begin, const char * end, float * values, unsigned numValues);
+
+// Convert all the tokens of [begin, end) which must all be integers. The vector is reused
+// between lines to avoid allocations.
+bool ParseInts(const char * begin, const char * end, std::vector<int> & values);
+
+// Number of tokens of [begin, end).
+unsigned CountTokens(const char * begin, const char * end);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_FILEFORMATS_TEXTLUTSCANNER_H
@@ -364,6 +364,12 @@ void CTFReaderArrayElt::setRawData(const char * s,
     // needed here to process each value from the strings.  This function
     // is the most used when reading in large transforms.
     //
+    // The values are written in the array by batches.
+    //
+
+    static constexpr unsigned long BatchSize = 64;
+    double values[BatchSize];
+    unsigned long numValues = 0;
 
     pos = FindNextTokenStart(s, len, 0);
     while (pos != len)
@@ -380,9 +386,15 @@ void CTFReaderArrayElt::setRawData(const char * s,
                    "' in array of ", getTypeName(), ".");
         }
 
-        if (m_position<maxValues)
+        if (m_position + numValues < maxValues)
         {
-            m_array->setDoubleValue(m_position++, data);
+            values[numValues++] = data;
+            if (numValues == BatchSize)
+            {
+                m_array->setDoubleValues(m_position, values, numValues);
+                m_position += numValues;
+                numValues = 0;
+            }
         }
         else
         {
@@ -410,6 +422,12 @@ void CTFReaderArrayElt::setRawData(const char * s,
                    " Array, found too many values in array of '", getTypeName(), "'.");
         }
     }
+
+    if (numValues > 0)
+    {
+        m_array->setDoubleValues(m_position, values, numValues);
+        m_position += numValues;
+    }
 }
 
 const char * CTFReaderArrayElt::getTypeName() const
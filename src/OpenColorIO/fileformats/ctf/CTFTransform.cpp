@@ -1,6 +1,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <locale>
 #include <sstream>
 
 #include "BitDepthUtils.h"
@@ -542,6 +546,181 @@ void SetOStream<double>(double, std::ostream & xml)
     xml.precision(DOUBLE_PRECISION);
 }
 
+// Fast equivalent of 'stream << value' for a stream using the default flags, the classic
+// locale and the given precision i.e. printf("%.*g", precision, value). The value is scaled
+// to an integer of 'precision' digits using a single exact power of ten, so the digits are
+// certain unless the scaled value is too close to a rounding tie. Return the number of
+// characters written in the buffer, or 0 when the caller must use the stream instead.
+unsigned FormatDouble(double value, unsigned precision, char * buffer)
+{
+    static constexpr double Pow10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    static constexpr int MaxPow10 = 22;
+
+    // The scaled value must be an exact integer.
+    if (precision > 15 || !std::isfinite(value))
+    {
+        return 0;
+    }
+
+    const int numDigits = precision == 0 ? 1 : int(precision);
+
+    char * ptr = buffer;
+    if (std::signbit(value))
+    {
+        *ptr++ = '-';
+        value = -value;
+    }
+
+    if (value == 0.)
+    {
+        *ptr++ = '0';
+        return unsigned(ptr - buffer);
+    }
+
+    // First guess of the decimal exponent, it could be one too small.
+    int binaryExponent = 0;
+    std::frexp(value, &binaryExponent);
+    int exponent = int(std::floor((binaryExponent - 1) * 0.30102999566398120));
+
+    const double minScaled = Pow10[numDigits - 1];
+    const double maxScaled = Pow10[numDigits];
+
+    double scaled = 0.;
+    for (int attempt = 0; ; ++attempt)
+    {
+        const int scale = numDigits - 1 - exponent;
+        if (attempt == 2 || scale < -MaxPow10 || scale > MaxPow10)
+        {
+            return 0;
+        }
+
+        // Only one rounding i.e. the error is at most half an ulp.
+        scaled = scale >= 0 ? value * Pow10[scale] : value / Pow10[-scale];
+
+        if (scaled < minScaled)
+        {
+            --exponent;
+        }
+        else if (scaled >= maxScaled)
+        {
+            ++exponent;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // The exact scaled value is within half an ulp so the rounding is certain, unless the
+    // fraction is too close to one half.
+    const double integral = std::floor(scaled);
+    const double fraction = scaled - integral;
+    const double halfUlp  = (std::nextafter(scaled, maxScaled * 10.) - scaled) * 0.5;
+    if (std::fabs(fraction - 0.5) <= halfUlp)
+    {
+        return 0;
+    }
+
+    uint64_t digits = uint64_t(integral) + (fraction > 0.5 ? 1 : 0);
+    if (digits == uint64_t(maxScaled))
+    {
+        digits /= 10;
+        ++exponent;
+    }
+
+    char str[16];
+    for (int idx = numDigits - 1; idx >= 0; --idx)
+    {
+        str[idx] = char('0' + digits % 10);
+        digits /= 10;
+    }
+
+    // Trailing zeros are not written.
+    int lastDigit = numDigits;
+    while (lastDigit > 1 && str[lastDigit - 1] == '0')
+    {
+        --lastDigit;
+    }
+
+    if (exponent < -4 || exponent >= numDigits)
+    {
+        *ptr++ = str[0];
+        if (lastDigit > 1)
+        {
+            *ptr++ = '.';
+            for (int idx = 1; idx < lastDigit; ++idx)
+            {
+                *ptr++ = str[idx];
+            }
+        }
+
+        *ptr++ = 'e';
+        *ptr++ = exponent < 0 ? '-' : '+';
+        const int absExponent = std::abs(exponent);
+        if (absExponent >= 100)
+        {
+            *ptr++ = char('0' + absExponent / 100);
+        }
+        *ptr++ = char('0' + (absExponent / 10) % 10);
+        *ptr++ = char('0' + absExponent % 10);
+    }
+    else if (exponent >= 0)
+    {
+        for (int idx = 0; idx <= exponent; ++idx)
+        {
+            *ptr++ = str[idx];
+        }
+        if (lastDigit > exponent + 1)
+        {
+            *ptr++ = '.';
+            for (int idx = exponent + 1; idx < lastDigit; ++idx)
+            {
+                *ptr++ = str[idx];
+            }
+        }
+    }
+    else
+    {
+        *ptr++ = '0';
+        *ptr++ = '.';
+        for (int idx = exponent + 1; idx < 0; ++idx)
+        {
+            *ptr++ = '0';
+        }
+        for (int idx = 0; idx < lastDigit; ++idx)
+        {
+            *ptr++ = str[idx];
+        }
+    }
+
+    return unsigned(ptr - buffer);
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, unsigned>::type
+FormatValue(T value, unsigned precision, bool specialValues, char * buffer)
+{
+    if (specialValues && !std::isfinite(value))
+    {
+        // Same as WriteValue().
+        const char * str = IsNan(value) ? "nan" : (value > 0 ? "inf" : "-inf");
+        const size_t len = strlen(str);
+        memcpy(buffer, str, len);
+        return unsigned(len);
+    }
+
+    return FormatDouble(double(value), precision, buffer);
+}
+
+template <typename T>
+typename std::enable_if<!std::is_floating_point<T>::value, unsigned>::type
+FormatValue(T, unsigned, bool, char *)
+{
+    return 0;
+}
+
 template<typename Iter, typename scaleType>
 void WriteValues(XmlFormatter & formatter,
                  Iter valuesBegin,
@@ -554,7 +733,12 @@ void WriteValues(XmlFormatter & formatter,
     // Method used to write an array of values of the same type.
 
     std::ostream & xml = formatter.getStream();
+
+    // Only used for the values the fast formatting does not handle. As the fast formatting
+    // reproduces the classic locale output, the values are always formatted by the stream (which
+    // uses the global locale) when the global locale is another one e.g. with a decimal comma.
     std::ostringstream oss;
+    const bool fastFormatting = (oss.getloc() == std::locale::classic());
 
     // The numbers in a CLF/CTF file may always contain fractional values, regardless of the
     // bit-depth attributes.  E.g., even if the bit-depth is 8i, the array could contain values
@@ -563,34 +747,36 @@ void WriteValues(XmlFormatter & formatter,
     // And if the array really does only have integers, it is nicer to print those without
     // decimal points.
 
+    size_t width = 0;
+
     switch (bitDepth)
     {
     case BIT_DEPTH_UINT8:
     {
-        oss.width(3);
+        width = 3;
         break;
     }
     case BIT_DEPTH_UINT10:
     {
-        oss.width(4);
+        width = 4;
         break;
     }
 
     case BIT_DEPTH_UINT12:
     {
-        oss.width(4);
+        width = 4;
         break;
     }
 
     case BIT_DEPTH_UINT16:
     {
-        oss.width(5);
+        width = 5;
         break;
     }
 
     case BIT_DEPTH_F16:
     {
-        oss.width(11);
+        width = 11;
         oss.precision(5);
         break;
     }
@@ -598,6 +784,8 @@ void WriteValues(XmlFormatter & formatter,
     case BIT_DEPTH_F32:
     {
         SetOStream(*valuesBegin, oss);
+        width = (size_t)oss.width();
+        oss.width(0);
         break;
     }
 
@@ -616,42 +804,71 @@ void WriteValues(XmlFormatter & formatter,
     }
 
     const bool floatValues = (bitDepth == BIT_DEPTH_F16) || (bitDepth == BIT_DEPTH_F32);
+    const unsigned precision = (unsigned)oss.precision();
+
+    // The values are formatted in a large buffer written to the stream by complete lines.
+    static constexpr size_t BufferSize = 64 * 1024;
+    std::string buffer;
+    buffer.reserve(BufferSize + 1024);
+
+    char fastValue[64];
+    std::string streamValue;
 
     for (Iter it(valuesBegin); it != valuesEnd; it += iterStep)
     {
-        oss.str("");
+        const auto scaledValue = (*it) * scale;
 
-        if (floatValues)
+        // Note that the special values of the float arrays are specifically handled.
+        const char * value = fastValue;
+        size_t length
+            = fastFormatting ? FormatValue(scaledValue, precision, floatValues, fastValue) : 0;
+        if (length == 0)
         {
-            WriteValue((*it) * scale, oss);
+            oss.str("");
+
+            if (floatValues)
+            {
+                WriteValue(scaledValue, oss);
+            }
+            else
+            {
+                oss << scaledValue;
+            }
+
+            streamValue = oss.str();
+            value  = streamValue.c_str();
+            length = streamValue.length();
         }
-        else
+
+        // The values are right aligned. When the imposed precision requires more characters,
+        // the width is recomputed to better align the values for the next lines.
+        if (length < width)
         {
-            oss << (*it) * scale;
+            buffer.append(width - length, ' ');
         }
-
-        const std::string value = oss.str();
-        if (value.length() > (size_t)oss.width())
+        else
         {
-            // The imposed precision requires more characters so the code
-            // recomputes the width to better align the values for the next lines. 
-            oss.width(value.length());
+            width = length;
         }
-
-        xml << value;
+        buffer.append(value, length);
 
         if (std::distance(valuesBegin, it) % valuesPerLine == valuesPerLine - 1)
         {
-            // std::endln writes a newline and flushes the output buffer where '\n' only
-            // writes a newline. Flushing the buffer for all floats of large LUTs
-            // introduces a huge performance hit so only use '\n'.
-            xml << "\n";
+            buffer.push_back('\n');
+
+            if (buffer.size() >= BufferSize)
+            {
+                xml.write(buffer.data(), buffer.size());
+                buffer.clear();
+            }
         }
         else
         {
-            xml << " ";
+            buffer.push_back(' ');
         }
     }
+
+    xml.write(buffer.data(), buffer.size());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
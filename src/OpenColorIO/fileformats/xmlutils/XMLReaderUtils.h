@@ -164,7 +164,13 @@ void ParseNumber(const char * str, size_t startPos, size_t endPos, T & value)
 
     FindSubString(startParse, endPos - startPos, adjustedStartPos, adjustedEndPos);
 
-    const auto result = NumberUtils::from_chars(startParse + adjustedStartPos, startParse + adjustedEndPos, val);
+    const char * first = startParse + adjustedStartPos;
+    const char * last  = startParse + adjustedEndPos;
+
+    // Most of the array values are exactly converted by the fast path.
+    const auto result = NumberUtils::from_chars_fast(first, last, val)
+                            ? NumberUtils::from_chars_result{ last, std::errc() }
+                            : NumberUtils::from_chars(first, last, val);
 
     value = (T)val;
 
@@ -4,11 +4,13 @@
 #ifndef INCLUDED_OCIO_OPARRAY_H
 #define INCLUDED_OCIO_OPARRAY_H
 
+#include <memory>
 #include <sstream>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "HashUtils.h"
 #include "MathUtils.h"
 
 namespace OCIO_NAMESPACE
@@ -20,6 +22,8 @@ public:
     ArrayBase() {}
     virtual ~ArrayBase() {}
     virtual void setDoubleValue(unsigned long index, double value) = 0;
+    // Set the 'count' values starting at 'index' at once (e.g. while reading a file).
+    virtual void setDoubleValues(unsigned long index, const double * values, unsigned long count) = 0;
     virtual double getDoubleValue(unsigned long index) = 0;
     virtual unsigned long getLength() const = 0;
     virtual unsigned long getNumColorComponents() const = 0;
@@ -35,6 +39,13 @@ public:
 // other classes. Since the dimensionality of the underlying array of those 
 // classes varies, the interpretation of "length" is defined by child classes.
 // The class represents the array for a 3by1D LUT and a 3D LUT or a matrix.
+//
+// The values are shared between the copies of an array (e.g. the clones of an
+// op) and copied only when one of them is modified (i.e. copy-on-write). The hash
+// of the values is computed on demand and kept until the values are modified.
+// Note that the non-const accessors make the values unique to the array and
+// invalidate the hash, so a non-const reference to the values must not be kept
+// once the array is copied or the hash is requested.
 template<typename T> class ArrayT : public ArrayBase
 {
 public:
@@ -44,6 +55,7 @@ public:
     ArrayT()
         : m_length(0)
         , m_numColorComponents(0)
+        , m_data(std::make_shared<Values>())
     {
     }
 
@@ -58,7 +70,7 @@ public:
     {
         m_length = length;
         m_numColorComponents = numColorComponents;
-        m_data.resize(getNumValues());
+        editValues().resize(getNumValues());
     }
 
     void setLength(unsigned long length)
@@ -66,18 +78,27 @@ public:
         if (m_length != length)
         {
             m_length = length;
-            m_data.resize(getNumValues());
+            editValues().resize(getNumValues());
         }
     }
 
     void setDoubleValue(unsigned long index, double value) override
     {
-        m_data[index] = (T)value;
+        editValues()[index] = (T)value;
+    }
+
+    void setDoubleValues(unsigned long index, const double * values, unsigned long count) override
+    {
+        T * data = editValues().data() + index;
+        for (unsigned long idx = 0; idx < count; ++idx)
+        {
+            data[idx] = (T)values[idx];
+        }
     }
 
     double getDoubleValue(unsigned long index) override
     {
-        return double(m_data[index]);
+        return double((*m_data)[index]);
     }
 
     unsigned long getLength() const override
@@ -90,7 +111,7 @@ public:
         if (m_numColorComponents != getMaxColorComponents())
         {
             m_numColorComponents = getMaxColorComponents();
-            m_data.resize(getNumValues());
+            editValues().resize(getNumValues());
         }
     }
 
@@ -104,7 +125,7 @@ public:
         if (m_numColorComponents != numColorComponents)
         {
             m_numColorComponents = numColorComponents;
-            m_data.resize(getNumValues());
+            editValues().resize(getNumValues());
         }
     }
 
@@ -112,17 +133,18 @@ public:
     {
         if (m_numColorComponents == 3)
         {
+            const Values & values = *m_data;
             bool sameCoeff = true;
             for (unsigned long idx = 0; idx < m_length && sameCoeff; ++idx)
             {
-                if (IsNan(m_data[idx * 3]) &&
-                    IsNan(m_data[idx * 3 + 1]) &&
-                    IsNan(m_data[idx * 3 + 2]))
+                if (IsNan(values[idx * 3]) &&
+                    IsNan(values[idx * 3 + 1]) &&
+                    IsNan(values[idx * 3 + 2]))
                 {
                     continue;
                 }
-                if (m_data[idx * 3] != m_data[idx * 3 + 1]
-                    || m_data[idx * 3] != m_data[idx * 3 + 2])
+                if (values[idx * 3] != values[idx * 3 + 1]
+                    || values[idx * 3] != values[idx * 3 + 2])
                 {
                     sameCoeff = false;
                     break;
@@ -143,22 +165,28 @@ public:
 
     inline const Values& getValues() const
     {
-        return m_data;
+        return *m_data;
     }
 
     inline Values& getValues()
     {
-        return m_data;
+        return editValues();
     }
 
     inline const T& operator[](unsigned long index) const
     {
-        return m_data[index];
+        return (*m_data)[index];
     }
 
     inline T& operator[](unsigned long index)
     {
-        return m_data[index];
+        return editValues()[index];
+    }
+
+    // Return true if both arrays share the same values.
+    bool sharesValues(const ArrayT & a) const
+    {
+        return m_data == a.m_data;
     }
 
     virtual void validate() const
@@ -170,10 +198,10 @@ public:
 
         // getNumValues is based on the dimensions claimed in the file.  Check
         // that this matches the number of values that were actually set.
-        if (m_data.size() != getNumValues())
+        if (m_data->size() != getNumValues())
         {
             std::ostringstream os;
-            os << "Array contains: " << m_data.size() << " values, ";
+            os << "Array contains: " << m_data->size() << " values, ";
             os << "but " << getNumValues() << " are expected.";
             throw Exception(os.str().c_str());
         }
@@ -184,25 +212,52 @@ public:
         if (this == &a) return true;
         return (m_length == a.m_length)
             && (m_numColorComponents == a.m_numColorComponents)
-            && (m_data == a.m_data);
+            && (m_data == a.m_data || *m_data == *a.m_data);
     }
 
     void scale(T scale)
     {
         if (scale != (T)1.)
         {
-            const size_t nbVal = m_data.size();
+            Values & values = editValues();
+            const size_t nbVal = values.size();
             for (size_t i = 0; i < nbVal; ++i)
             {
-                m_data[i] *= scale;
+                values[i] *= scale;
             }
         }
     }
 
+    // Hash of the values, only computed once unless the values change. The caller is
+    // responsible for the thread safety (e.g. the op data mutex).
+    const std::string & getValuesHash() const
+    {
+        if (m_valuesHash.empty())
+        {
+            m_valuesHash = CacheIDHash(reinterpret_cast<const char *>(m_data->data()),
+                                       m_data->size() * sizeof(T));
+        }
+        return m_valuesHash;
+    }
+
 protected:
     unsigned long m_length;
     unsigned long m_numColorComponents;
-    Values        m_data;
+
+private:
+    // Make the values unique to this array before they are modified.
+    Values & editValues()
+    {
+        m_valuesHash.clear();
+        if (m_data.use_count() > 1)
+        {
+            m_data = std::make_shared<Values>(*m_data);
+        }
+        return *m_data;
+    }
+
+    std::shared_ptr<Values> m_data;
+    mutable std::string     m_valuesHash;
 };
 
 typedef ArrayT<double> ArrayDouble;
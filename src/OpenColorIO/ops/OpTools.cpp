@@ -5,6 +5,7 @@
 
 #include "BitDepthUtils.h"
 #include "ops/OpTools.h"
+#include "ThreadingUtils.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -30,11 +31,27 @@ void EvalTransform(const float * in,
     ops.finalize();
     ops.optimize(OPTIMIZATION_NONE);
 
+    // Create the CPU ops once, as some are costly to create (e.g. the exact inverse Lut3D
+    // search tree), and share them between the threads processing the pixels.
+    std::vector<ConstOpCPURcPtr> cpuOps;
     for (OpRcPtrVec::size_type i = 0, size = ops.size(); i<size; ++i)
     {
-        ops[i]->apply(&tmp[0], &tmp[0], numPixels);
+        ConstOpRcPtr op = ops[i];
+        cpuOps.push_back(op->getCPUOp(false));
     }
 
+    // Note that the pixels are independent so the result does not depend on the chunks.
+    static constexpr long PixelsPerChunk = 4096;
+    ParallelFor(numPixels, PixelsPerChunk, 0,
+                [&cpuOps, &tmp](unsigned /* threadIndex */, long begin, long end)
+                {
+                    float * chunk = &tmp[4 * begin];
+                    for (const auto & cpuOp : cpuOps)
+                    {
+                        cpuOp->apply(chunk, chunk, end - begin);
+                    }
+                });
+
     float * result = out;
     for (long idx = 0; idx<numPixels; ++idx)
     {
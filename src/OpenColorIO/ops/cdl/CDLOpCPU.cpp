@@ -11,6 +11,10 @@
 #include "CDLOpCPU.h"
 #include "SSE.h"
 
+#include "CPUInfo.h"
+#include "CDLOpCPU_AVX2.h"
+#include "CDLOpCPU_AVX512.h"
+
 
 namespace OCIO_NAMESPACE
 {
@@ -267,8 +271,30 @@ public:
     CDLOpCPU() = delete;
     CDLOpCPU(ConstCDLOpDataRcPtr & cdl);
 
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+    // Only the wide vector renderers process the RGB and planar images.
+    bool hasRGBSupport() const override { return m_wide.isValid(); }
+    bool hasPlanarSupport() const override { return m_wide.isValid(); }
+
+protected:
+    // Select the wide vector (i.e. AVX2 or AVX-512) renderer if the CPU supports it.
+    void updateWide(CDLOpData::Style style);
+
+    // Process the RGBA pixels using the wide vector renderer if any, return false otherwise.
+    bool applyWide(const void * inImg, void * outImg, long numPixels) const;
+
 protected:
     RenderParams m_renderParams;
+
+    // Only the fast power renderers use it as it relies on the same approximation as the
+    // SSE2 version. The parameters are the RGB values of the slope, offset and power
+    // followed by the saturation.
+    WideOpCPURenderer m_wide;
+    float m_wideParams[10];
 };
 
 template<bool CLAMP>
@@ -291,6 +317,7 @@ public:
     CDLRendererFwdSSE(ConstCDLOpDataRcPtr & cdl)
         : CDLRendererFwd<CLAMP>(cdl)
     {
+        this->updateWide(cdl->getStyle());
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
@@ -317,6 +344,7 @@ public:
     CDLRendererRevSSE(ConstCDLOpDataRcPtr & cdl)
         : CDLRendererRev<CLAMP>(cdl)
     {
+        this->updateWide(cdl->getStyle());
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
@@ -329,6 +357,68 @@ CDLOpCPU::CDLOpCPU(ConstCDLOpDataRcPtr & cdl)
     m_renderParams.update(cdl);
 }
 
+void CDLOpCPU::updateWide(CDLOpData::Style style)
+{
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_wide = AVX2GetCDLRenderer(style);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_wide = AVX512GetCDLRenderer(style);
+    }
+#endif
+
+#if OCIO_USE_AVX2 == 0 && OCIO_USE_AVX512 == 0
+    std::ignore = style;
+#endif
+
+    std::copy(m_renderParams.getSlope(),  m_renderParams.getSlope()  + 3, m_wideParams);
+    std::copy(m_renderParams.getOffset(), m_renderParams.getOffset() + 3, m_wideParams + 3);
+    std::copy(m_renderParams.getPower(),  m_renderParams.getPower()  + 3, m_wideParams + 6);
+    m_wideParams[9] = m_renderParams.getSaturation();
+}
+
+bool CDLOpCPU::applyWide(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        return false;
+    }
+
+    m_wide.apply(m_wideParams, (const float *)inImg, (float *)outImg, numPixels);
+
+    return true;
+}
+
+void CDLOpCPU::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        OpCPU::applyRGB(inImg, outImg, numPixels);
+        return;
+    }
+
+    m_wide.applyRGB(m_wideParams, inImg, outImg, numPixels);
+}
+
+void CDLOpCPU::applyPlanar(const float * const * inPlanes,
+                           float * const * outPlanes,
+                           long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        OpCPU::applyPlanar(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    m_wide.applyPlanar(m_wideParams, inPlanes, outPlanes, numPixels);
+}
+
 #if OCIO_USE_SSE2
 void LoadRenderParams(const RenderParams & renderParams,
                       __m128 & slope,
@@ -347,6 +437,11 @@ void LoadRenderParams(const RenderParams & renderParams,
 template<bool CLAMP>
 void CDLRendererFwdSSE<CLAMP>::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (this->applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     __m128 slope, offset, power, saturation, pix;
     LoadRenderParams(this->m_renderParams, slope, offset, power, saturation);
 
@@ -410,6 +505,11 @@ void CDLRendererFwd<CLAMP>::apply(const void * inImg, void * outImg, long numPix
 template<bool CLAMP>
 void CDLRendererRevSSE<CLAMP>::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (this->applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     __m128 slopeRev, offsetRev, powerRev, saturationRev, pix;
     LoadRenderParams(this->m_renderParams, slopeRev, offsetRev, powerRev, saturationRev);
 
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "CDLOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Conditionally clamp the values to the range [0, 1].
+template<bool CLAMP>
+inline __m256 ApplyClamp(__m256 pixel)
+{
+    return CLAMP ? _mm256_min_ps(_mm256_max_ps(pixel, _mm256_setzero_ps()), _mm256_set1_ps(1.0f))
+                 : pixel;
+}
+
+// Apply the power component. When not clamping, the negative values are passed through.
+template<bool CLAMP>
+inline __m256 ApplyPower(__m256 pixel, __m256 power)
+{
+    if (CLAMP)
+    {
+        return avx2Power(ApplyClamp<CLAMP>(pixel), power);
+    }
+
+    const __m256 negMask = _mm256_cmp_ps(pixel, _mm256_setzero_ps(), _CMP_LT_OQ);
+    return _mm256_blendv_ps(avx2Power(pixel, power), pixel, negMask);
+}
+
+template<bool CLAMP>
+struct CDLKernel
+{
+    explicit CDLKernel(const float * params)
+        : m_slope{ _mm256_set1_ps(params[0]), _mm256_set1_ps(params[1]),
+                   _mm256_set1_ps(params[2]) }
+        , m_offset{ _mm256_set1_ps(params[3]), _mm256_set1_ps(params[4]),
+                    _mm256_set1_ps(params[5]) }
+        , m_power{ _mm256_set1_ps(params[6]), _mm256_set1_ps(params[7]),
+                   _mm256_set1_ps(params[8]) }
+        , m_saturation(_mm256_set1_ps(params[9]))
+    {
+    }
+
+    void applySaturation(__m256 & r, __m256 & g, __m256 & b) const
+    {
+        const __m256 rg = _mm256_add_ps(_mm256_mul_ps(r, _mm256_set1_ps(0.2126f)),
+                                        _mm256_mul_ps(g, _mm256_set1_ps(0.7152f)));
+        const __m256 luma = _mm256_add_ps(rg, _mm256_mul_ps(b, _mm256_set1_ps(0.0722f)));
+
+        r = _mm256_add_ps(luma, _mm256_mul_ps(m_saturation, _mm256_sub_ps(r, luma)));
+        g = _mm256_add_ps(luma, _mm256_mul_ps(m_saturation, _mm256_sub_ps(g, luma)));
+        b = _mm256_add_ps(luma, _mm256_mul_ps(m_saturation, _mm256_sub_ps(b, luma)));
+    }
+
+    __m256 m_slope[3];
+    __m256 m_offset[3];
+    __m256 m_power[3];
+    __m256 m_saturation;
+};
+
+template<bool CLAMP>
+struct CDLFwdKernel : public CDLKernel<CLAMP>
+{
+    explicit CDLFwdKernel(const float * params)
+        : CDLKernel<CLAMP>(params)
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        __m256 * rgb[3] = { &r, &g, &b };
+        for (int c = 0; c < 3; ++c)
+        {
+            __m256 pixel = _mm256_add_ps(_mm256_mul_ps(*rgb[c], this->m_slope[c]),
+                                         this->m_offset[c]);
+            *rgb[c] = ApplyPower<CLAMP>(pixel, this->m_power[c]);
+        }
+
+        this->applySaturation(r, g, b);
+
+        r = ApplyClamp<CLAMP>(r);
+        g = ApplyClamp<CLAMP>(g);
+        b = ApplyClamp<CLAMP>(b);
+    }
+};
+
+template<bool CLAMP>
+struct CDLRevKernel : public CDLKernel<CLAMP>
+{
+    explicit CDLRevKernel(const float * params)
+        : CDLKernel<CLAMP>(params)
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        r = ApplyClamp<CLAMP>(r);
+        g = ApplyClamp<CLAMP>(g);
+        b = ApplyClamp<CLAMP>(b);
+
+        this->applySaturation(r, g, b);
+
+        __m256 * rgb[3] = { &r, &g, &b };
+        for (int c = 0; c < 3; ++c)
+        {
+            __m256 pixel = ApplyPower<CLAMP>(*rgb[c], this->m_power[c]);
+            pixel = _mm256_mul_ps(_mm256_add_ps(pixel, this->m_offset[c]), this->m_slope[c]);
+            *rgb[c] = ApplyClamp<CLAMP>(pixel);
+        }
+    }
+};
+
+} // anonymous namespace
+
+WideOpCPURenderer AVX2GetCDLRenderer(CDLOpData::Style style)
+{
+    switch(style)
+    {
+        case CDLOpData::CDL_V1_2_FWD:
+            return avx2GetKernelRenderer<CDLFwdKernel<true>>();
+        case CDLOpData::CDL_NO_CLAMP_FWD:
+            return avx2GetKernelRenderer<CDLFwdKernel<false>>();
+        case CDLOpData::CDL_V1_2_REV:
+            return avx2GetKernelRenderer<CDLRevKernel<true>>();
+        case CDLOpData::CDL_NO_CLAMP_REV:
+            return avx2GetKernelRenderer<CDLRevKernel<false>>();
+    }
+
+    return WideOpCPURenderer();
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
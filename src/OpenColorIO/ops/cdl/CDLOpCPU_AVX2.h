@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_CDLOP_CPU_AVX2_H
+#define INCLUDED_OCIO_CDLOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "WideOpCPU.h"
+#include "ops/cdl/CDLOpData.h"
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+// Get the renderer applying the CDL to F32 pixels, eight pixels at a time. The parameters are
+// the RGB values of the slope, offset and power followed by the saturation (refer to
+// RenderParams). The alpha channel is left unchanged.
+WideOpCPURenderer AVX2GetCDLRenderer(CDLOpData::Style style);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_CDLOP_CPU_AVX2_H */
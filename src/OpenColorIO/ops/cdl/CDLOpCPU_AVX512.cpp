@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "CDLOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Conditionally clamp the values to the range [0, 1].
+template<bool CLAMP>
+inline __m512 ApplyClamp(__m512 pixel)
+{
+    return CLAMP
+        ? _mm512_min_ps(_mm512_max_ps(pixel, _mm512_setzero_ps()), _mm512_set1_ps(1.0f))
+        : pixel;
+}
+
+// Apply the power component. When not clamping, the negative values are passed through.
+template<bool CLAMP>
+inline __m512 ApplyPower(__m512 pixel, __m512 power)
+{
+    if (CLAMP)
+    {
+        return avx512Power(ApplyClamp<CLAMP>(pixel), power);
+    }
+
+    const __mmask16 negMask = _mm512_cmp_ps_mask(pixel, _mm512_setzero_ps(), _CMP_LT_OQ);
+    return _mm512_mask_mov_ps(avx512Power(pixel, power), negMask, pixel);
+}
+
+template<bool CLAMP>
+struct CDLKernel
+{
+    explicit CDLKernel(const float * params)
+        : m_slope{ _mm512_set1_ps(params[0]), _mm512_set1_ps(params[1]),
+                   _mm512_set1_ps(params[2]) }
+        , m_offset{ _mm512_set1_ps(params[3]), _mm512_set1_ps(params[4]),
+                    _mm512_set1_ps(params[5]) }
+        , m_power{ _mm512_set1_ps(params[6]), _mm512_set1_ps(params[7]),
+                   _mm512_set1_ps(params[8]) }
+        , m_saturation(_mm512_set1_ps(params[9]))
+    {
+    }
+
+    void applySaturation(__m512 & r, __m512 & g, __m512 & b) const
+    {
+        const __m512 rg = _mm512_add_ps(_mm512_mul_ps(r, _mm512_set1_ps(0.2126f)),
+                                        _mm512_mul_ps(g, _mm512_set1_ps(0.7152f)));
+        const __m512 luma = _mm512_add_ps(rg, _mm512_mul_ps(b, _mm512_set1_ps(0.0722f)));
+
+        r = _mm512_add_ps(luma, _mm512_mul_ps(m_saturation, _mm512_sub_ps(r, luma)));
+        g = _mm512_add_ps(luma, _mm512_mul_ps(m_saturation, _mm512_sub_ps(g, luma)));
+        b = _mm512_add_ps(luma, _mm512_mul_ps(m_saturation, _mm512_sub_ps(b, luma)));
+    }
+
+    __m512 m_slope[3];
+    __m512 m_offset[3];
+    __m512 m_power[3];
+    __m512 m_saturation;
+};
+
+template<bool CLAMP>
+struct CDLFwdKernel : public CDLKernel<CLAMP>
+{
+    explicit CDLFwdKernel(const float * params)
+        : CDLKernel<CLAMP>(params)
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        __m512 * rgb[3] = { &r, &g, &b };
+        for (int c = 0; c < 3; ++c)
+        {
+            __m512 pixel = _mm512_add_ps(_mm512_mul_ps(*rgb[c], this->m_slope[c]),
+                                         this->m_offset[c]);
+            *rgb[c] = ApplyPower<CLAMP>(pixel, this->m_power[c]);
+        }
+
+        this->applySaturation(r, g, b);
+
+        r = ApplyClamp<CLAMP>(r);
+        g = ApplyClamp<CLAMP>(g);
+        b = ApplyClamp<CLAMP>(b);
+    }
+};
+
+template<bool CLAMP>
+struct CDLRevKernel : public CDLKernel<CLAMP>
+{
+    explicit CDLRevKernel(const float * params)
+        : CDLKernel<CLAMP>(params)
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        r = ApplyClamp<CLAMP>(r);
+        g = ApplyClamp<CLAMP>(g);
+        b = ApplyClamp<CLAMP>(b);
+
+        this->applySaturation(r, g, b);
+
+        __m512 * rgb[3] = { &r, &g, &b };
+        for (int c = 0; c < 3; ++c)
+        {
+            __m512 pixel = ApplyPower<CLAMP>(*rgb[c], this->m_power[c]);
+            pixel = _mm512_mul_ps(_mm512_add_ps(pixel, this->m_offset[c]), this->m_slope[c]);
+            *rgb[c] = ApplyClamp<CLAMP>(pixel);
+        }
+    }
+};
+
+} // anonymous namespace
+
+WideOpCPURenderer AVX512GetCDLRenderer(CDLOpData::Style style)
+{
+    switch(style)
+    {
+        case CDLOpData::CDL_V1_2_FWD:
+            return avx512GetKernelRenderer<CDLFwdKernel<true>>();
+        case CDLOpData::CDL_NO_CLAMP_FWD:
+            return avx512GetKernelRenderer<CDLFwdKernel<false>>();
+        case CDLOpData::CDL_V1_2_REV:
+            return avx512GetKernelRenderer<CDLRevKernel<true>>();
+        case CDLOpData::CDL_NO_CLAMP_REV:
+            return avx512GetKernelRenderer<CDLRevKernel<false>>();
+    }
+
+    return WideOpCPURenderer();
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
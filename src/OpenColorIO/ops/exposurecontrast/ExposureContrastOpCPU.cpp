@@ -11,6 +11,10 @@
 #include "ops/exposurecontrast/ExposureContrastOpCPU.h"
 #include "SSE.h"
 
+#include "CPUInfo.h"
+#include "ExposureContrastOpCPU_AVX2.h"
+#include "ExposureContrastOpCPU_AVX512.h"
+
 namespace OCIO_NAMESPACE
 {
 
@@ -25,6 +29,15 @@ public:
     explicit ECRendererBase(ConstExposureContrastOpDataRcPtr & ec);
     virtual ~ECRendererBase();
 
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+    // Only the wide vector renderers process the RGB and planar images.
+    bool hasRGBSupport() const override { return m_wideScale.isValid(); }
+    bool hasPlanarSupport() const override { return m_wideScale.isValid(); }
+
     bool isDynamic() const override;
     bool hasDynamicProperty(DynamicPropertyType type) const override;
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override;
@@ -32,6 +45,20 @@ public:
 protected:
     virtual void updateData(ConstExposureContrastOpDataRcPtr & ec) = 0;
 
+    // Get the wide vector renderer to use for the current values of the dynamic properties,
+    // and fill its parameters (i.e. at most three values).
+    virtual const WideOpCPURenderer & getWideRenderer(float * params) const = 0;
+
+    // Process the RGBA pixels using the wide vector (i.e. AVX2 or AVX-512) renderer if the CPU
+    // supports it, return false otherwise.
+    bool applyWide(const void * inImg, void * outImg, long numPixels) const;
+
+    // They rely on the same power approximation as the SSE2 version (refer to
+    // ExposureContrastOpCPU_AVX2.h for the parameters).
+    WideOpCPURenderer m_wideScale;
+    WideOpCPURenderer m_wideAffine;
+    WideOpCPURenderer m_widePower;
+
     DynamicPropertyDoubleImplRcPtr m_exposure;
     DynamicPropertyDoubleImplRcPtr m_contrast;
     DynamicPropertyDoubleImplRcPtr m_gamma;
@@ -59,12 +86,76 @@ ECRendererBase::ECRendererBase(ConstExposureContrastOpDataRcPtr & ec)
     {
         m_gamma = m_gamma->createEditableCopy();
     }
+
+#if OCIO_USE_SSE2
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_wideScale  = AVX2GetExposureContrastScaleRenderer();
+        m_wideAffine = AVX2GetExposureContrastAffineRenderer();
+        m_widePower  = AVX2GetExposureContrastPowerRenderer();
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_wideScale  = AVX512GetExposureContrastScaleRenderer();
+        m_wideAffine = AVX512GetExposureContrastAffineRenderer();
+        m_widePower  = AVX512GetExposureContrastPowerRenderer();
+    }
+#endif
+
+#endif // OCIO_USE_SSE2
 }
 
 ECRendererBase::~ECRendererBase()
 {
 }
 
+bool ECRendererBase::applyWide(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_wideScale.isValid())
+    {
+        return false;
+    }
+
+    float params[3];
+    const WideOpCPURenderer & renderer = getWideRenderer(params);
+    renderer.apply(params, (const float *)inImg, (float *)outImg, numPixels);
+
+    return true;
+}
+
+void ECRendererBase::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!m_wideScale.isValid())
+    {
+        OpCPU::applyRGB(inImg, outImg, numPixels);
+        return;
+    }
+
+    float params[3];
+    const WideOpCPURenderer & renderer = getWideRenderer(params);
+    renderer.applyRGB(params, inImg, outImg, numPixels);
+}
+
+void ECRendererBase::applyPlanar(const float * const * inPlanes,
+                                 float * const * outPlanes,
+                                 long numPixels) const
+{
+    if (!m_wideScale.isValid())
+    {
+        OpCPU::applyPlanar(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    float params[3];
+    const WideOpCPURenderer & renderer = getWideRenderer(params);
+    renderer.applyPlanar(params, inPlanes, outPlanes, numPixels);
+}
+
 bool ECRendererBase::isDynamic() const
 {
     return m_exposure->isDynamic() || m_contrast->isDynamic() || m_gamma->isDynamic();
@@ -137,6 +228,7 @@ public:
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    const WideOpCPURenderer & getWideRenderer(float * params) const override;
 };
 
 ECLinearRenderer::ECLinearRenderer(ConstExposureContrastOpDataRcPtr & ec)
@@ -150,8 +242,32 @@ void ECLinearRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
     m_pivot = (float)std::max(EC::MIN_PIVOT, ec->getPivot());
 }
 
+const WideOpCPURenderer & ECLinearRenderer::getWideRenderer(float * params) const
+{
+    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
+                                              m_contrast->getValue() *
+                                              m_gamma->getValue());
+    const float exposureVal = powf(2.f, (float)m_exposure->getValue());
+
+    if (contrastVal == 1.f)
+    {
+        params[0] = exposureVal;
+        return m_wideScale;
+    }
+
+    params[0] = exposureVal / m_pivot;
+    params[1] = contrastVal;
+    params[2] = m_pivot;
+    return m_widePower;
+}
+
 void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     // TODO: allow negative contrast?
     // TODO: is it worth adding a code path without dynamic parameters?
     const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
@@ -241,6 +357,7 @@ public:
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    const WideOpCPURenderer & getWideRenderer(float * params) const override;
 };
 
 ECLinearRevRenderer::ECLinearRevRenderer(ConstExposureContrastOpDataRcPtr & ec)
@@ -254,8 +371,31 @@ void ECLinearRevRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
     m_pivot = (float)std::max(EC::MIN_PIVOT, ec->getPivot());
 }
 
+const WideOpCPURenderer & ECLinearRevRenderer::getWideRenderer(float * params) const
+{
+    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
+                                              (m_contrast->getValue() * m_gamma->getValue()));
+    const float invExposureVal = 1.f / powf(2.f, (float)m_exposure->getValue());
+
+    if (contrastVal == 1.f)
+    {
+        params[0] = invExposureVal;
+        return m_wideScale;
+    }
+
+    params[0] = 1.f / m_pivot;
+    params[1] = 1.f / contrastVal;
+    params[2] = m_pivot * invExposureVal;
+    return m_widePower;
+}
+
 void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     // TODO: allow negative contrast?
     const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
                                               (m_contrast->getValue() * m_gamma->getValue()));
@@ -347,6 +487,7 @@ public:
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    const WideOpCPURenderer & getWideRenderer(float * params) const override;
 };
 
 ECVideoRenderer::ECVideoRenderer(ConstExposureContrastOpDataRcPtr & ec)
@@ -361,8 +502,32 @@ void ECVideoRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
                    (float)EC::VIDEO_OETF_POWER);
 }
 
+const WideOpCPURenderer & ECVideoRenderer::getWideRenderer(float * params) const
+{
+    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
+                                              (m_contrast->getValue() * m_gamma->getValue()));
+    const float exposureVal = powf(powf(2.f, (float)m_exposure->getValue()),
+                                   (float)EC::VIDEO_OETF_POWER);
+
+    if (contrastVal == 1.f)
+    {
+        params[0] = exposureVal;
+        return m_wideScale;
+    }
+
+    params[0] = exposureVal / m_pivot;
+    params[1] = contrastVal;
+    params[2] = m_pivot;
+    return m_widePower;
+}
+
 void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     // TODO: allow negative contrast?
     const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
                                               (m_contrast->getValue() * m_gamma->getValue()));
@@ -449,6 +614,7 @@ public:
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    const WideOpCPURenderer & getWideRenderer(float * params) const override;
 };
 
 ECVideoRevRenderer::ECVideoRevRenderer(ConstExposureContrastOpDataRcPtr & ec)
@@ -463,8 +629,32 @@ void ECVideoRevRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
                    (float)EC::VIDEO_OETF_POWER);
 }
 
+const WideOpCPURenderer & ECVideoRevRenderer::getWideRenderer(float * params) const
+{
+    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
+                                              (m_contrast->getValue() * m_gamma->getValue()));
+    const float invExposureVal = 1.f / powf(powf(2.f, (float)m_exposure->getValue()),
+                                            (float)EC::VIDEO_OETF_POWER);
+
+    if (contrastVal == 1.f)
+    {
+        params[0] = invExposureVal;
+        return m_wideScale;
+    }
+
+    params[0] = 1.f / m_pivot;
+    params[1] = 1.f / contrastVal;
+    params[2] = m_pivot * invExposureVal;
+    return m_widePower;
+}
+
 void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     // TODO: allow negative contrast?
     const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
                                               (m_contrast->getValue() * m_gamma->getValue()));
@@ -554,6 +744,7 @@ public:
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    const WideOpCPURenderer & getWideRenderer(float * params) const override;
 };
 
 ECLogarithmicRenderer::ECLogarithmicRenderer(ConstExposureContrastOpDataRcPtr & ec)
@@ -572,8 +763,26 @@ void ECLogarithmicRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
     m_logExposureStep = (float)ec->getLogExposureStep();
 }
 
+const WideOpCPURenderer & ECLogarithmicRenderer::getWideRenderer(float * params) const
+{
+    const float exposureVal = (float)m_exposure->getValue() *
+                              m_logExposureStep;
+    const float contrastVal
+        = (float)std::max(EC::MIN_CONTRAST,
+                          (m_contrast->getValue() * m_gamma->getValue()));
+
+    params[0] = contrastVal;
+    params[1] = (exposureVal - m_pivot) * contrastVal + m_pivot;
+    return m_wideAffine;
+}
+
 void ECLogarithmicRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float exposureVal = (float)m_exposure->getValue() *
                               m_logExposureStep;
     const float contrastVal
@@ -638,6 +847,7 @@ public:
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    const WideOpCPURenderer & getWideRenderer(float * params) const override;
 };
 
 ECLogarithmicRevRenderer::ECLogarithmicRevRenderer(ConstExposureContrastOpDataRcPtr & ec)
@@ -654,8 +864,26 @@ void ECLogarithmicRevRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
                                   ec->getLogMidGray());
 }
 
+const WideOpCPURenderer & ECLogarithmicRevRenderer::getWideRenderer(float * params) const
+{
+    const float exposureVal = (float)m_exposure->getValue() *
+                              m_logExposureStep;
+    const float inv_contrastVal
+        = (float)std::max(EC::MIN_CONTRAST,
+                          1. / (m_contrast->getValue() * m_gamma->getValue()));
+
+    params[0] = inv_contrastVal;
+    params[1] = m_pivot - m_pivot * inv_contrastVal - exposureVal;
+    return m_wideAffine;
+}
+
 void ECLogarithmicRevRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float exposureVal = (float)m_exposure->getValue() *
                               m_logExposureStep;
     const float inv_contrastVal
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ExposureContrastOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct ScaleKernel
+{
+    explicit ScaleKernel(const float * params)
+        : m_scale(_mm256_set1_ps(params[0]))
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        r = _mm256_mul_ps(r, m_scale);
+        g = _mm256_mul_ps(g, m_scale);
+        b = _mm256_mul_ps(b, m_scale);
+    }
+
+    const __m256 m_scale;
+};
+
+struct AffineKernel
+{
+    explicit AffineKernel(const float * params)
+        : m_scale(_mm256_set1_ps(params[0]))
+        , m_offset(_mm256_set1_ps(params[1]))
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        r = _mm256_add_ps(_mm256_mul_ps(r, m_scale), m_offset);
+        g = _mm256_add_ps(_mm256_mul_ps(g, m_scale), m_offset);
+        b = _mm256_add_ps(_mm256_mul_ps(b, m_scale), m_offset);
+    }
+
+    const __m256 m_scale;
+    const __m256 m_offset;
+};
+
+struct PowerKernel
+{
+    explicit PowerKernel(const float * params)
+        : m_inScale(_mm256_set1_ps(params[0]))
+        , m_power(_mm256_set1_ps(params[1]))
+        , m_outScale(_mm256_set1_ps(params[2]))
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        r = _mm256_mul_ps(avx2Power(_mm256_mul_ps(r, m_inScale), m_power), m_outScale);
+        g = _mm256_mul_ps(avx2Power(_mm256_mul_ps(g, m_inScale), m_power), m_outScale);
+        b = _mm256_mul_ps(avx2Power(_mm256_mul_ps(b, m_inScale), m_power), m_outScale);
+    }
+
+    const __m256 m_inScale;
+    const __m256 m_power;
+    const __m256 m_outScale;
+};
+
+} // anonymous namespace
+
+WideOpCPURenderer AVX2GetExposureContrastScaleRenderer()
+{
+    return avx2GetKernelRenderer<ScaleKernel>();
+}
+
+WideOpCPURenderer AVX2GetExposureContrastAffineRenderer()
+{
+    return avx2GetKernelRenderer<AffineKernel>();
+}
+
+WideOpCPURenderer AVX2GetExposureContrastPowerRenderer()
+{
+    return avx2GetKernelRenderer<PowerKernel>();
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX2_H
+#define INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "WideOpCPU.h"
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+// Get the renderers applying the exposure & contrast to F32 pixels, eight pixels at a time.
+// The alpha channel is left unchanged. The parameters are:
+//   Scale:  scale                     i.e. out = in * scale
+//   Affine: scale, offset             i.e. out = in * scale + offset
+//   Power:  inScale, power, outScale  i.e. out = pow(in * inScale, power) * outScale
+WideOpCPURenderer AVX2GetExposureContrastScaleRenderer();
+WideOpCPURenderer AVX2GetExposureContrastAffineRenderer();
+WideOpCPURenderer AVX2GetExposureContrastPowerRenderer();
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX2_H */
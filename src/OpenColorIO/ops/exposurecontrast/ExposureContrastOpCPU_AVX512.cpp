@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ExposureContrastOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct ScaleKernel
+{
+    explicit ScaleKernel(const float * params)
+        : m_scale(_mm512_set1_ps(params[0]))
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        r = _mm512_mul_ps(r, m_scale);
+        g = _mm512_mul_ps(g, m_scale);
+        b = _mm512_mul_ps(b, m_scale);
+    }
+
+    const __m512 m_scale;
+};
+
+struct AffineKernel
+{
+    explicit AffineKernel(const float * params)
+        : m_scale(_mm512_set1_ps(params[0]))
+        , m_offset(_mm512_set1_ps(params[1]))
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        r = _mm512_add_ps(_mm512_mul_ps(r, m_scale), m_offset);
+        g = _mm512_add_ps(_mm512_mul_ps(g, m_scale), m_offset);
+        b = _mm512_add_ps(_mm512_mul_ps(b, m_scale), m_offset);
+    }
+
+    const __m512 m_scale;
+    const __m512 m_offset;
+};
+
+struct PowerKernel
+{
+    explicit PowerKernel(const float * params)
+        : m_inScale(_mm512_set1_ps(params[0]))
+        , m_power(_mm512_set1_ps(params[1]))
+        , m_outScale(_mm512_set1_ps(params[2]))
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        r = _mm512_mul_ps(avx512Power(_mm512_mul_ps(r, m_inScale), m_power), m_outScale);
+        g = _mm512_mul_ps(avx512Power(_mm512_mul_ps(g, m_inScale), m_power), m_outScale);
+        b = _mm512_mul_ps(avx512Power(_mm512_mul_ps(b, m_inScale), m_power), m_outScale);
+    }
+
+    const __m512 m_inScale;
+    const __m512 m_power;
+    const __m512 m_outScale;
+};
+
+} // anonymous namespace
+
+WideOpCPURenderer AVX512GetExposureContrastScaleRenderer()
+{
+    return avx512GetKernelRenderer<ScaleKernel>();
+}
+
+WideOpCPURenderer AVX512GetExposureContrastAffineRenderer()
+{
+    return avx512GetKernelRenderer<AffineKernel>();
+}
+
+WideOpCPURenderer AVX512GetExposureContrastPowerRenderer()
+{
+    return avx512GetKernelRenderer<PowerKernel>();
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
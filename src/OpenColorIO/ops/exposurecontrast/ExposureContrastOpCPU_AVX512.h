@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX512_H
+#define INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "WideOpCPU.h"
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+// Get the renderers applying the exposure & contrast to F32 pixels, sixteen pixels at a time.
+// The alpha channel is left unchanged. The parameters are:
+//   Scale:  scale                     i.e. out = in * scale
+//   Affine: scale, offset             i.e. out = in * scale + offset
+//   Power:  inScale, power, outScale  i.e. out = pow(in * inScale, power) * outScale
+WideOpCPURenderer AVX512GetExposureContrastScaleRenderer();
+WideOpCPURenderer AVX512GetExposureContrastAffineRenderer();
+WideOpCPURenderer AVX512GetExposureContrastPowerRenderer();
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX512_H */
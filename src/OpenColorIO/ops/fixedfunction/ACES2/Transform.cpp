@@ -1395,6 +1395,220 @@ GamutCompressParams init_GamutCompressParams(float peakLuminance, const JMhParam
     return params;
 }
 
+#if OCIO_USE_SSE2
+
+//
+// SSE versions of the per-pixel stages, processing four pixels at once.
+// The channels are in SoA layout, i.e. one register per channel.
+//
+
+namespace
+{
+
+inline void mult_f3_f33_SSE(const __m128 in[3], const m33f &mat33, __m128 out[3])
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        out[i] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(in[0], _mm_set1_ps(mat33[3 * i + 0])),
+                                       _mm_mul_ps(in[1], _mm_set1_ps(mat33[3 * i + 1]))),
+                            _mm_mul_ps(in[2], _mm_set1_ps(mat33[3 * i + 2])));
+    }
+}
+
+inline __m128 copysign_SSE(const __m128 mag, const __m128 sgn)
+{
+    return _mm_or_ps(_mm_and_ps(mag, EABS_MASK), _mm_and_ps(sgn, ESIGN_MASK));
+}
+
+inline __m128 _post_adaptation_cone_response_compression_fwd_SSE(const __m128 Rc)
+{
+    const __m128 F_L_Y = ssePower(Rc, _mm_set1_ps(0.42f));
+    return _mm_div_ps(F_L_Y, _mm_add_ps(_mm_set1_ps(cam_nl_offset), F_L_Y));
+}
+
+inline __m128 _post_adaptation_cone_response_compression_inv_SSE(const __m128 Ra)
+{
+    const __m128 Ra_lim = _mm_min_ps(Ra, _mm_set1_ps(0.99f));
+    const __m128 F_L_Y  = _mm_div_ps(_mm_mul_ps(_mm_set1_ps(cam_nl_offset), Ra_lim),
+                                     _mm_sub_ps(EONE, Ra_lim));
+    return ssePower(F_L_Y, _mm_set1_ps(1.f / 0.42f));
+}
+
+inline __m128 post_adaptation_cone_response_compression_fwd_SSE(const __m128 v)
+{
+    const __m128 abs_v = _mm_and_ps(v, EABS_MASK);
+    return copysign_SSE(_post_adaptation_cone_response_compression_fwd_SSE(abs_v), v);
+}
+
+inline __m128 post_adaptation_cone_response_compression_inv_SSE(const __m128 v)
+{
+    const __m128 abs_v = _mm_and_ps(v, EABS_MASK);
+    return copysign_SSE(_post_adaptation_cone_response_compression_inv_SSE(abs_v), v);
+}
+
+inline __m128 toe_fwd_SSE(const __m128 x, const __m128 limit, const __m128 k1_in, const __m128 k2_in)
+{
+    const __m128 k2 = _mm_max_ps(k2_in, _mm_set1_ps(0.001f));
+    const __m128 k1 = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(k1_in, k1_in), _mm_mul_ps(k2, k2)));
+    const __m128 k3 = _mm_div_ps(_mm_add_ps(limit, k1), _mm_add_ps(limit, k2));
+
+    const __m128 minus_b  = _mm_sub_ps(_mm_mul_ps(k3, x), k1);
+    const __m128 minus_ac = _mm_mul_ps(_mm_mul_ps(k2, k3), x);
+    const __m128 delta    = _mm_add_ps(_mm_mul_ps(minus_b, minus_b),
+                                       _mm_mul_ps(_mm_set1_ps(4.f), minus_ac));
+    const __m128 res      = _mm_mul_ps(_mm_set1_ps(0.5f), _mm_add_ps(minus_b, _mm_sqrt_ps(delta)));
+
+    return sseSelect(_mm_cmpgt_ps(x, limit), x, res);
+}
+
+} // anon.
+
+void RGB_to_JMh_SSE(const __m128 RGB[3], const JMhParams &p,
+                    __m128 JMh[3], __m128 &A, __m128 &cos_hr, __m128 &sin_hr)
+{
+    __m128 rgb_m[3];
+    mult_f3_f33_SSE(RGB, p.MATRIX_RGB_to_CAM16_c, rgb_m);
+
+    const __m128 rgb_a[3] = {
+        post_adaptation_cone_response_compression_fwd_SSE(rgb_m[0]),
+        post_adaptation_cone_response_compression_fwd_SSE(rgb_m[1]),
+        post_adaptation_cone_response_compression_fwd_SSE(rgb_m[2])
+    };
+
+    __m128 Aab[3];
+    mult_f3_f33_SSE(rgb_a, p.MATRIX_cone_response_to_Aab, Aab);
+    A = Aab[0];
+
+    // Pixels with a non-positive achromatic response map to zero (see Aab_to_JMh).
+    const __m128 valid = _mm_cmpgt_ps(Aab[0], EZERO);
+
+    const __m128 J = _mm_mul_ps(_mm_set1_ps(J_scale), ssePower(Aab[0], _mm_set1_ps(p.cz)));
+    const __m128 M = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(Aab[1], Aab[1]), _mm_mul_ps(Aab[2], Aab[2])));
+
+    // The hue selects the entries of the hue dependent tables (e.g. the gamut cusps) so it is
+    // computed at full precision, as in Aab_to_JMh.
+    OCIO_ALIGN(float a[4]);
+    OCIO_ALIGN(float b[4]);
+    OCIO_ALIGN(float h[4]);
+    _mm_store_ps(a, Aab[1]);
+    _mm_store_ps(b, Aab[2]);
+    for (int i = 0; i < 4; ++i)
+    {
+        h[i] = _from_radians(std::atan2(b[i], a[i]));
+    }
+
+    JMh[0] = _mm_and_ps(J, valid);
+    JMh[1] = _mm_and_ps(M, valid);
+    JMh[2] = _mm_and_ps(_mm_load_ps(h), valid);
+
+    // The cosine and sine of the hue angle are directly available from the
+    // normalized a & b components, avoiding the trigonometric functions.
+    const __m128 chromatic = _mm_and_ps(valid, _mm_cmpgt_ps(M, EZERO));
+    cos_hr = sseSelect(chromatic, _mm_div_ps(Aab[1], M), EONE);
+    sin_hr = _mm_and_ps(_mm_div_ps(Aab[2], M), chromatic);
+}
+
+void JMh_to_RGB_SSE(const __m128 JMh[3], const __m128 &cos_hr, const __m128 &sin_hr,
+                    const JMhParams &p, __m128 RGB[3])
+{
+    const __m128 Aab[3] = {
+        ssePower(_mm_mul_ps(JMh[0], _mm_set1_ps(1.0f / J_scale)), _mm_set1_ps(p.inv_cz)),
+        _mm_mul_ps(JMh[1], cos_hr),
+        _mm_mul_ps(JMh[1], sin_hr)
+    };
+
+    __m128 rgb_a[3];
+    mult_f3_f33_SSE(Aab, p.MATRIX_Aab_to_cone_response, rgb_a);
+
+    const __m128 rgb_m[3] = {
+        post_adaptation_cone_response_compression_inv_SSE(rgb_a[0]),
+        post_adaptation_cone_response_compression_inv_SSE(rgb_a[1]),
+        post_adaptation_cone_response_compression_inv_SSE(rgb_a[2])
+    };
+
+    mult_f3_f33_SSE(rgb_m, p.MATRIX_CAM16_c_to_RGB, RGB);
+}
+
+__m128 tonescale_A_to_J_fwd_SSE(const __m128 &A, const JMhParams &p, const ToneScaleParams &pt)
+{
+    // A to Y.
+    const __m128 Ra   = _mm_mul_ps(_mm_set1_ps(p.A_w_J), A);
+    const __m128 Y_in = _mm_div_ps(_post_adaptation_cone_response_compression_inv_SSE(Ra),
+                                   _mm_set1_ps(p.F_L_n));
+
+    // Forward tonescale.
+    const __m128 s_2  = _mm_set1_ps(pt.s_2);
+    const __m128 f    = _mm_mul_ps(_mm_set1_ps(pt.m_2),
+                                   ssePower(_mm_div_ps(Y_in, _mm_add_ps(Y_in, s_2)),
+                                            _mm_set1_ps(pt.g)));
+    const __m128 Y_ts = _mm_mul_ps(_mm_max_ps(EZERO,
+                                              _mm_div_ps(_mm_mul_ps(f, f),
+                                                         _mm_add_ps(f, _mm_set1_ps(pt.t_1)))),
+                                   _mm_set1_ps(pt.n_r));
+
+    // Y to J.
+    const __m128 Ra_out = _post_adaptation_cone_response_compression_fwd_SSE(
+                              _mm_mul_ps(Y_ts, _mm_set1_ps(p.F_L_n)));
+    const __m128 J_out  = _mm_mul_ps(_mm_set1_ps(J_scale),
+                                     ssePower(_mm_mul_ps(Ra_out, _mm_set1_ps(p.inv_A_w_J)),
+                                              _mm_set1_ps(p.cz)));
+
+    return copysign_SSE(J_out, A);
+}
+
+__m128 chroma_compress_norm_SSE(const __m128 &cos_hr1, const __m128 &sin_hr1, float chroma_compress_scale)
+{
+    const __m128 cos_hr1_2 = _mm_mul_ps(cos_hr1, cos_hr1);
+    const __m128 sin_hr1_2 = _mm_mul_ps(sin_hr1, sin_hr1);
+
+    const __m128 cos_hr2 = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.0f), cos_hr1_2), EONE);
+    const __m128 sin_hr2 = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(2.0f), cos_hr1), sin_hr1);
+    const __m128 cos_hr3 = _mm_mul_ps(cos_hr1, _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(4.0f), cos_hr1_2),
+                                                          _mm_set1_ps(3.0f)));
+    const __m128 sin_hr3 = _mm_mul_ps(sin_hr1, _mm_sub_ps(_mm_set1_ps(3.0f),
+                                                          _mm_mul_ps(_mm_set1_ps(4.0f), sin_hr1_2)));
+
+    __m128 M = _mm_set1_ps(77.12896f);
+    M = _mm_add_ps(M, _mm_mul_ps(_mm_set1_ps(11.34072f), cos_hr1));
+    M = _mm_add_ps(M, _mm_mul_ps(_mm_set1_ps(16.46899f), cos_hr2));
+    M = _mm_add_ps(M, _mm_mul_ps(_mm_set1_ps(7.88380f),  cos_hr3));
+    M = _mm_add_ps(M, _mm_mul_ps(_mm_set1_ps(14.66441f), sin_hr1));
+    M = _mm_add_ps(M, _mm_mul_ps(_mm_set1_ps(-6.37224f), sin_hr2));
+    M = _mm_add_ps(M, _mm_mul_ps(_mm_set1_ps(9.19364f),  sin_hr3));
+
+    return _mm_mul_ps(M, _mm_set1_ps(chroma_compress_scale));
+}
+
+__m128 chroma_compress_fwd_SSE(const __m128 JMh[3], const __m128 &J_ts, const __m128 &Mnorm,
+                               const __m128 &reachMaxM, const SharedCompressionParameters &pr,
+                               const ChromaCompressParams &pc)
+{
+    const __m128 J = JMh[0];
+    const __m128 M = JMh[1];
+
+    const __m128 gamma_inv = _mm_set1_ps(pr.model_gamma_inv);
+
+    const __m128 nJ    = _mm_div_ps(J_ts, _mm_set1_ps(pr.limit_J_max));
+    const __m128 snJ   = _mm_max_ps(EZERO, _mm_sub_ps(EONE, nJ));
+    const __m128 limit = _mm_div_ps(_mm_mul_ps(ssePower(nJ, gamma_inv), reachMaxM), Mnorm);
+
+    __m128 M_cp = _mm_mul_ps(M, ssePower(_mm_div_ps(J_ts, J), gamma_inv));
+    M_cp = _mm_div_ps(M_cp, Mnorm);
+
+    const __m128 sat_k2 = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(nJ, nJ), _mm_set1_ps(pc.sat_thr)));
+    M_cp = _mm_sub_ps(limit, toe_fwd_SSE(_mm_sub_ps(limit, M_cp),
+                                         _mm_sub_ps(limit, _mm_set1_ps(0.001f)),
+                                         _mm_mul_ps(snJ, _mm_set1_ps(pc.sat)),
+                                         sat_k2));
+    M_cp = toe_fwd_SSE(M_cp, limit, _mm_mul_ps(nJ, _mm_set1_ps(pc.compr)), snJ);
+    M_cp = _mm_mul_ps(M_cp, Mnorm);
+
+    // Achromatic pixels are left untouched.
+    return sseSelect(_mm_cmpneq_ps(M, EZERO), M_cp, M);
+}
+
+#endif // OCIO_USE_SSE2
+
 } // namespace ACES2
 
 } // OCIO namespace
@@ -5,6 +5,7 @@
 #define INCLUDED_OCIO_ACES2_TRANSFORM_H
 
 #include "Common.h"
+#include "SSE.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -40,6 +41,23 @@ f3 chroma_compress_inv(const f3 &JMh, const float J, const float Mnorm, const Re
 f3 gamut_compress_fwd(const f3 &JMh, const ResolvedSharedCompressionParameters &ps, const GamutCompressParams &p);
 f3 gamut_compress_inv(const f3 &JMh, const ResolvedSharedCompressionParameters &ps, const GamutCompressParams &p);
 
+#if OCIO_USE_SSE2
+// Four pixel versions of the above, with the channels in SoA layout. They rely on the fast SSE
+// power approximation so they are only used when OPTIMIZATION_FAST_ACES_OUTPUT_TRANSFORM_20 is
+// requested.
+void RGB_to_JMh_SSE(const __m128 RGB[3], const JMhParams &p,
+                    __m128 JMh[3], __m128 &A, __m128 &cos_hr, __m128 &sin_hr);
+void JMh_to_RGB_SSE(const __m128 JMh[3], const __m128 &cos_hr, const __m128 &sin_hr,
+                    const JMhParams &p, __m128 RGB[3]);
+
+__m128 tonescale_A_to_J_fwd_SSE(const __m128 &A, const JMhParams &p, const ToneScaleParams &pt);
+
+__m128 chroma_compress_norm_SSE(const __m128 &cos_hr, const __m128 &sin_hr, float chroma_compress_scale);
+__m128 chroma_compress_fwd_SSE(const __m128 JMh[3], const __m128 &J_ts, const __m128 &Mnorm,
+                               const __m128 &reachMaxM, const SharedCompressionParameters &ps,
+                               const ChromaCompressParams &pc);
+#endif // OCIO_USE_SSE2
+
 
 } // namespace ACES2
 
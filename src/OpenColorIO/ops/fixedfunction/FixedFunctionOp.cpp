@@ -44,6 +44,7 @@ public:
     std::string getCacheID() const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getOptimizedCPUOp(OptimizationFlags oFlags) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -122,7 +123,15 @@ std::string FixedFunctionOp::getCacheID() const
 ConstOpCPURcPtr FixedFunctionOp::getCPUOp(bool fastLogExpPow) const
 {
     ConstFixedFunctionOpDataRcPtr data = fnData();
-    return GetFixedFunctionCPURenderer(data, fastLogExpPow);
+    return GetFixedFunctionCPURenderer(data, fastLogExpPow, false);
+}
+
+ConstOpCPURcPtr FixedFunctionOp::getOptimizedCPUOp(OptimizationFlags oFlags) const
+{
+    ConstFixedFunctionOpDataRcPtr data = fnData();
+    return GetFixedFunctionCPURenderer(data,
+                                       HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW),
+                                       HasFlag(oFlags, OPTIMIZATION_FAST_ACES_OUTPUT_TRANSFORM_20));
 }
 
 void FixedFunctionOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
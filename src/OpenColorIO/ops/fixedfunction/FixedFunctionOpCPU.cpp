@@ -138,11 +138,10 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
-private:
+protected:
     void fwd(const void * inImg, void * outImg, long numPixels) const;
     void inv(const void * inImg, void * outImg, long numPixels) const;
 
-protected:
     bool m_fwd;
     ACES2::JMhParams m_pIn;
     ACES2::JMhParams m_pOut;
@@ -152,6 +151,19 @@ protected:
     ACES2::GamutCompressParams m_g;
 };
 
+#if OCIO_USE_SSE2
+// The forward direction processes four pixels at once, only the hue dependent gamut
+// compression remains per pixel. It relies on the fast SSE power approximation.
+class Renderer_ACES_OutputTransform20_SSE : public Renderer_ACES_OutputTransform20
+{
+public:
+    Renderer_ACES_OutputTransform20_SSE() = delete;
+    explicit Renderer_ACES_OutputTransform20_SSE(ConstFixedFunctionOpDataRcPtr & data);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+#endif // OCIO_USE_SSE2
+
 class Renderer_ACES_RGB_TO_JMh_20 : public OpCPU
 {
 public:
@@ -1111,6 +1123,88 @@ void Renderer_ACES_OutputTransform20::inv(const void * inImg, void * outImg, lon
     }
 }
 
+#if OCIO_USE_SSE2
+Renderer_ACES_OutputTransform20_SSE::Renderer_ACES_OutputTransform20_SSE(ConstFixedFunctionOpDataRcPtr & data)
+    :   Renderer_ACES_OutputTransform20(data)
+{
+}
+
+void Renderer_ACES_OutputTransform20_SSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_fwd)
+    {
+        inv(inImg, outImg, numPixels);
+        return;
+    }
+
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    OCIO_ALIGN(float J[4]);
+    OCIO_ALIGN(float M[4]);
+    OCIO_ALIGN(float h[4]);
+    OCIO_ALIGN(float reachMaxM[4]);
+
+    long idx = 0;
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 r = _mm_loadu_ps(in);
+        __m128 g = _mm_loadu_ps(in + 4);
+        __m128 b = _mm_loadu_ps(in + 8);
+        __m128 a = _mm_loadu_ps(in + 12);
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+
+        const __m128 RGBIn[3] = { r, g, b };
+
+        __m128 JMh[3], A, cos_hr, sin_hr;
+        ACES2::RGB_to_JMh_SSE(RGBIn, m_pIn, JMh, A, cos_hr, sin_hr);
+
+        _mm_store_ps(h, JMh[2]);
+        for (int i = 0; i < 4; ++i)
+        {
+            reachMaxM[i] = ACES2::resolve_CompressionParams(h[i], m_s).reachMaxM;
+        }
+
+        const __m128 Mnorm = ACES2::chroma_compress_norm_SSE(cos_hr, sin_hr, m_c.chroma_compress_scale);
+        const __m128 J_ts  = ACES2::tonescale_A_to_J_fwd_SSE(A, m_pIn, m_t);
+
+        _mm_store_ps(J, J_ts);
+        _mm_store_ps(M, ACES2::chroma_compress_fwd_SSE(JMh, J_ts, Mnorm, _mm_load_ps(reachMaxM), m_s, m_c));
+
+        // The gamut compression relies on per hue tables and on iterative solves.
+        for (int i = 0; i < 4; ++i)
+        {
+            const ACES2::ResolvedSharedCompressionParameters rp
+                = { m_s.limit_J_max, m_s.model_gamma_inv, reachMaxM[i] };
+            const ACES2::f3 compressedJMh = ACES2::gamut_compress_fwd({J[i], M[i], h[i]}, rp, m_g);
+            J[i] = compressedJMh[0];
+            M[i] = compressedJMh[1];
+        }
+
+        const __m128 compressedJMh[3] = { _mm_load_ps(J), _mm_load_ps(M), JMh[2] };
+
+        __m128 RGBOut[3];
+        ACES2::JMh_to_RGB_SSE(compressedJMh, cos_hr, sin_hr, m_pOut, RGBOut);
+
+        r = RGBOut[0];
+        g = RGBOut[1];
+        b = RGBOut[2];
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+
+        _mm_storeu_ps(out,      r);
+        _mm_storeu_ps(out + 4,  g);
+        _mm_storeu_ps(out + 8,  b);
+        _mm_storeu_ps(out + 12, a);
+
+        in  += 16;
+        out += 16;
+    }
+
+    // Remaining pixels.
+    fwd(in, out, numPixels - idx);
+}
+#endif // OCIO_USE_SSE2
+
 Renderer_ACES_RGB_TO_JMh_20::Renderer_ACES_RGB_TO_JMh_20(ConstFixedFunctionOpDataRcPtr & data)
     :   OpCPU()
 {
@@ -2138,11 +2232,14 @@ void Renderer_DOUBLE_LOG_TO_LIN::apply(const void* inImg, void* outImg, long num
 
 
 
-ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func, bool fastLogExpPow)
+ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func,
+                                            bool fastLogExpPow,
+                                            bool fastOutputTransform)
 {
     // Prevent "unused-parameter" warning/error in case the using code is
     // ifdef'ed out.
     (void)fastLogExpPow; 
+    (void)fastOutputTransform;
 
     switch(func->getStyle())
     {
@@ -2198,6 +2295,13 @@ ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func
         case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD:
         case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_INV:
         {
+#if OCIO_USE_SSE2
+            if (fastOutputTransform && CPUInfo::instance().hasSSE2()
+                && func->getStyle() == FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD)
+            {
+                return std::make_shared<Renderer_ACES_OutputTransform20_SSE>(func);
+            }
+#endif // OCIO_USE_SSE2
             // Sharing same renderer (param will be inverted to handle direction).
             return std::make_shared<Renderer_ACES_OutputTransform20>(func);
         }
@@ -14,7 +14,11 @@
 namespace OCIO_NAMESPACE
 {
 
-ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func, bool fastLogExpPow);
+// The fastOutputTransform argument selects the four pixels at once version of the forward ACES 2.0
+// output transform (refer to OPTIMIZATION_FAST_ACES_OUTPUT_TRANSFORM_20).
+ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func,
+                                            bool fastLogExpPow,
+                                            bool fastOutputTransform = false);
 
 } // namespace OCIO_NAMESPACE
 
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <tuple>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -12,6 +13,10 @@
 
 #include "SSE.h"
 
+#include "CPUInfo.h"
+#include "GammaOpCPU_AVX2.h"
+#include "GammaOpCPU_AVX512.h"
+
 
 namespace OCIO_NAMESPACE
 {
@@ -20,6 +25,37 @@ namespace OCIO_NAMESPACE
 // math below does not require checks for divide by 0, etc.
 
 
+namespace
+{
+
+// Get the wide vector renderer of the style, if the CPU supports one.
+WideOpCPURenderer GetGammaWideRenderer(GammaOpData::Style style)
+{
+    WideOpCPURenderer renderer;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        renderer = AVX2GetGammaRenderer(style);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        renderer = AVX512GetGammaRenderer(style);
+    }
+#endif
+
+#if OCIO_USE_AVX2 == 0 && OCIO_USE_AVX512 == 0
+    std::ignore = style;
+#endif
+
+    return renderer;
+}
+
+} // anon.
+
 // Base class for the Gamma (i.e. basic style) operation renderers.
 class GammaBasicOpCPU : public OpCPU
 {
@@ -29,15 +65,38 @@ public:
     explicit GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+    bool hasRGBSupport() const override { return true; }
+    bool hasPlanarSupport() const override { return true; }
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 
+    // Process the pixels using the wide vector (i.e. AVX2 or AVX-512) renderer if the CPU
+    // supports it, return false otherwise.
+    bool applyWide(const void * inImg, void * outImg, long numPixels) const;
+    bool applyWideRGB(const float * inImg, float * outImg, long numPixels) const;
+    bool applyWidePlanar(const float * const * inPlanes,
+                         float * const * outPlanes,
+                         long numPixels) const;
+
 protected:
     float m_redGamma;
     float m_grnGamma;
     float m_bluGamma;
     float m_alpGamma;
+
+    // Only the fast power renderers use it as it relies on the same approximation as the
+    // SSE2 version.
+    WideOpCPURenderer m_wide;
 };
 
 #if OCIO_USE_SSE2
@@ -47,9 +106,18 @@ public:
     explicit GammaBasicOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicOpCPU(gamma)
     {
+        m_wide = GetGammaWideRenderer(gamma->getStyle());
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -61,6 +129,14 @@ public:
     explicit GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 #if OCIO_USE_SSE2
@@ -70,9 +146,18 @@ public:
     explicit GammaBasicMirrorOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicMirrorOpCPU(gamma)
     {
+        m_wide = GetGammaWideRenderer(gamma->getStyle());
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -84,6 +169,14 @@ public:
     explicit GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 #if OCIO_USE_SSE2
@@ -93,9 +186,18 @@ public:
     explicit GammaBasicPassThruOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicPassThruOpCPU(gamma)
     {
+        m_wide = GetGammaWideRenderer(gamma->getStyle());
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -104,11 +206,34 @@ class GammaMoncurveOpCPU : public OpCPU
 protected:
     explicit GammaMoncurveOpCPU(ConstGammaOpDataRcPtr &) : OpCPU() {}
 
+public:
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+    bool hasRGBSupport() const override { return true; }
+    // Only the wide vector renderers process the planar images.
+    bool hasPlanarSupport() const override { return m_wide.isValid(); }
+
+protected:
+    // Select the wide vector (i.e. AVX2 or AVX-512) renderer if the CPU supports it.
+    void updateWide(ConstGammaOpDataRcPtr & gamma);
+
+    // Process the pixels using the wide vector renderer if any, return false otherwise.
+    bool applyWide(const void * inImg, void * outImg, long numPixels) const;
+    bool applyWideRGB(const float * inImg, float * outImg, long numPixels) const;
+
 protected:
     RendererParams m_red;
     RendererParams m_green;
     RendererParams m_blue;
     RendererParams m_alpha;
+
+    // Only the fast power renderers use it as it relies on the same approximation as the
+    // SSE2 version.
+    WideOpCPURenderer m_wide;
+    // The RGBA values of the scale, offset, gamma, break point and slope.
+    float m_wideParams[20];
 };
 
 class GammaMoncurveOpCPUFwd : public GammaMoncurveOpCPU
@@ -117,6 +242,11 @@ public:
     explicit GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -129,9 +259,15 @@ public:
     explicit GammaMoncurveOpCPUFwdSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaMoncurveOpCPUFwd(gamma)
     {
+        updateWide(gamma);
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -141,6 +277,11 @@ public:
     explicit GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -154,9 +295,15 @@ public:
     explicit GammaMoncurveOpCPURevSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaMoncurveOpCPURev(gamma)
     {
+        updateWide(gamma);
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -166,6 +313,11 @@ public:
     explicit GammaMoncurveMirrorOpCPUFwd(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -178,9 +330,15 @@ public:
     explicit GammaMoncurveMirrorOpCPUFwdSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaMoncurveMirrorOpCPUFwd(gamma)
     {
+        updateWide(gamma);
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -190,6 +348,11 @@ public:
     explicit GammaMoncurveMirrorOpCPURev(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -202,9 +365,15 @@ public:
     explicit GammaMoncurveMirrorOpCPURevSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaMoncurveMirrorOpCPURev(gamma)
     {
+        updateWide(gamma);
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -292,6 +461,69 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
 }
 
 
+namespace
+{
+
+// Apply a per channel function to each plane of a planar image.
+template<typename Func>
+void ProcessPlanar(const float * const * inPlanes,
+                   float * const * outPlanes,
+                   long numPixels,
+                   const float (&gammas)[4],
+                   Func func)
+{
+    const int numChannels = inPlanes[3] ? 4 : 3;
+    for (int c = 0; c < numChannels; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+        const float gamma = gammas[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = func(in[idx], gamma);
+        }
+    }
+}
+
+#if OCIO_USE_SSE2
+// Apply a per channel SSE function to each plane of a planar image i.e. four pixels of the
+// same channel at once.
+template<typename Func>
+void ProcessPlanarSSE(const float * const * inPlanes,
+                      float * const * outPlanes,
+                      long numPixels,
+                      const float (&gammas)[4],
+                      Func func)
+{
+    const int numChannels = inPlanes[3] ? 4 : 3;
+    for (int c = 0; c < numChannels; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+        const __m128 gamma = _mm_set1_ps(gammas[c]);
+
+        long idx = 0;
+        for (; idx + 4 <= numPixels; idx += 4)
+        {
+            _mm_storeu_ps(out + idx, func(_mm_loadu_ps(in + idx), gamma));
+        }
+
+        if (idx < numPixels)
+        {
+            // Process the remaining pixels using a zero padded vector.
+            float pixels[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            std::copy(in + idx, in + numPixels, pixels);
+
+            _mm_storeu_ps(pixels, func(_mm_loadu_ps(pixels), gamma));
+            std::copy(pixels, pixels + (numPixels - idx), out + idx);
+        }
+    }
+}
+#endif
+
+} // anon.
+
 GammaBasicOpCPU::GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma)
     :   OpCPU()
     ,   m_redGamma(0.0f)
@@ -317,119 +549,275 @@ void GammaBasicOpCPU::update(ConstGammaOpDataRcPtr & gamma)
     m_alpGamma = (float)(forward ? gamma->getAlphaParams()[0] : 1. / gamma->getAlphaParams()[0]);
 }
 
-#if OCIO_USE_SSE2
-void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+bool GammaBasicOpCPU::applyWide(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    if (!m_wide.isValid())
+    {
+        return false;
+    }
+
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+    m_wide.apply(gammas, (const float *)inImg, (float *)outImg, numPixels);
 
+    return true;
+}
+
+bool GammaBasicOpCPU::applyWideRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        return false;
+    }
+
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+    m_wide.applyRGB(gammas, inImg, outImg, numPixels);
+
+    return true;
+}
+
+bool GammaBasicOpCPU::applyWidePlanar(const float * const * inPlanes,
+                                      float * const * outPlanes,
+                                      long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        return false;
+    }
+
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+    m_wide.applyPlanar(gammas, inPlanes, outPlanes, numPixels);
+
+    return true;
+}
+
+#if OCIO_USE_SSE2
+template<int NumChannels>
+void GammaBasicOpCPUSSE::process(const float * in, float * out, long numPixels) const
+{
     const __m128 gamma = _mm_set_ps(m_alpGamma, m_bluGamma, m_grnGamma, m_redGamma);
 
     for(long idx=0; idx<numPixels; ++idx)
     {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        __m128 pixel = sseLoadPixel<NumChannels>(in);
 
         pixel = ssePower(pixel, gamma);
 
-        _mm_storeu_ps(out, pixel);
+        sseStorePixel<NumChannels>(out, pixel);
+
+        in  += NumChannels;
+        out += NumChannels;
+    }
+}
+
+void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
 
-        in  += 4;
-        out += 4;
+void GammaBasicOpCPUSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
+    }
+}
+
+void GammaBasicOpCPUSSE::applyPlanar(const float * const * inPlanes,
+                                     float * const * outPlanes,
+                                     long numPixels) const
+{
+    if (!applyWidePlanar(inPlanes, outPlanes, numPixels))
+    {
+        const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+        ProcessPlanarSSE(inPlanes, outPlanes, numPixels, gammas,
+                         [](__m128 pixel, __m128 gamma)
+                         {
+                             return ssePower(pixel, gamma);
+                         });
     }
 }
 #endif // OCIO_USE_SSE2
 
-void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void GammaBasicOpCPU::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-    
     for(long idx=0; idx<numPixels; ++idx)
     {
+        // The alpha is zero when processing RGB pixels.
+        const float alpha = NumChannels == 4 ? in[3] : 0.0f;
+
         const float pixel[4] = { std::max(0.0f, in[0]), 
                                  std::max(0.0f, in[1]), 
                                  std::max(0.0f, in[2]),
-                                 std::max(0.0f, in[3]) };
+                                 std::max(0.0f, alpha) };
 
         out[0] = std::pow(pixel[0], m_redGamma);
         out[1] = std::pow(pixel[1], m_grnGamma);
         out[2] = std::pow(pixel[2], m_bluGamma);
-        out[3] = std::pow(pixel[3], m_alpGamma);
+        if (NumChannels == 4)
+        {
+            out[3] = std::pow(pixel[3], m_alpGamma);
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
+void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void GammaBasicOpCPU::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+void GammaBasicOpCPU::applyPlanar(const float * const * inPlanes,
+                                  float * const * outPlanes,
+                                  long numPixels) const
+{
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    ProcessPlanar(inPlanes, outPlanes, numPixels, gammas,
+                  [](float pixel, float gamma)
+                  {
+                      return std::pow(std::max(0.0f, pixel), gamma);
+                  });
+}
+
 GammaBasicMirrorOpCPU::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
     : GammaBasicOpCPU(gamma)
 {
 }
 
 #if OCIO_USE_SSE2
-void GammaBasicMirrorOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void GammaBasicMirrorOpCPUSSE::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 gamma = _mm_set_ps(m_alpGamma, m_bluGamma, m_grnGamma, m_redGamma);
 
     for (long idx = 0; idx<numPixels; ++idx)
     {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        __m128 pixel = sseLoadPixel<NumChannels>(in);
         __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
         __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
 
         pixel = ssePower(abs_pix, gamma);
         pixel = _mm_or_ps(sign_pix, pixel);
 
-        _mm_storeu_ps(out, pixel);
+        sseStorePixel<NumChannels>(out, pixel);
 
-        in += 4;
-        out += 4;
+        in += NumChannels;
+        out += NumChannels;
     }
 }
-#endif
 
-void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+void GammaBasicMirrorOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+
+void GammaBasicMirrorOpCPUSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
+    }
+}
+
+void GammaBasicMirrorOpCPUSSE::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    if (!applyWidePlanar(inPlanes, outPlanes, numPixels))
+    {
+        const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+        ProcessPlanarSSE(inPlanes, outPlanes, numPixels, gammas,
+                         [](__m128 pixel, __m128 gamma)
+                         {
+                             const __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
+                             const __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+
+                             return _mm_or_ps(sign_pix, ssePower(abs_pix, gamma));
+                         });
+    }
+}
+#endif
 
+template<int NumChannels>
+void GammaBasicMirrorOpCPU::process(const float * in, float * out, long numPixels) const
+{
     for (long idx = 0; idx<numPixels; ++idx)
     {
+        // The alpha is zero when processing RGB pixels.
+        const float alpha = NumChannels == 4 ? in[3] : 0.0f;
+
         const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
+                                std::copysign(1.0f, in[2]), std::copysign(1.0f, alpha) };
         const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
-                                 std::fabs(in[2]), std::fabs(in[3]) };
+                                 std::fabs(in[2]), std::fabs(alpha) };
 
         out[0] = sign[0] * std::pow(pixel[0], m_redGamma);
         out[1] = sign[1] * std::pow(pixel[1], m_grnGamma);
         out[2] = sign[2] * std::pow(pixel[2], m_bluGamma);
-        out[3] = sign[3] * std::pow(pixel[3], m_alpGamma);
+        if (NumChannels == 4)
+        {
+            out[3] = sign[3] * std::pow(pixel[3], m_alpGamma);
+        }
 
-        in += 4;
-        out += 4;
+        in += NumChannels;
+        out += NumChannels;
     }
 }
 
+void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void GammaBasicMirrorOpCPU::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+void GammaBasicMirrorOpCPU::applyPlanar(const float * const * inPlanes,
+                                        float * const * outPlanes,
+                                        long numPixels) const
+{
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    ProcessPlanar(inPlanes, outPlanes, numPixels, gammas,
+                  [](float pixel, float gamma)
+                  {
+                      return std::copysign(1.0f, pixel) * std::pow(std::fabs(pixel), gamma);
+                  });
+}
+
 GammaBasicPassThruOpCPU::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
     : GammaBasicOpCPU(gamma)
 {
 }
 
 #if OCIO_USE_SSE2
-void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void GammaBasicPassThruOpCPUSSE::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 gamma = _mm_set_ps(m_alpGamma, m_bluGamma, m_grnGamma, m_redGamma);
     const __m128 breakPnt = _mm_set_ps(0.0, 0.f, 0.f, 0.f);
 
     for (long idx = 0; idx<numPixels; ++idx)
     {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        __m128 pixel = sseLoadPixel<NumChannels>(in);
         __m128 data = pixel;
 
         data = ssePower(data, gamma);
@@ -439,33 +827,147 @@ void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long n
         data = _mm_or_ps(_mm_and_ps(flag, data),
                          _mm_andnot_ps(flag, pixel));
 
-        _mm_storeu_ps(out, data);
+        sseStorePixel<NumChannels>(out, data);
 
-        in += 4;
-        out += 4;
+        in += NumChannels;
+        out += NumChannels;
     }
 }
-#endif
 
-void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+
+void GammaBasicPassThruOpCPUSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
+    }
+}
+
+void GammaBasicPassThruOpCPUSSE::applyPlanar(const float * const * inPlanes,
+                                             float * const * outPlanes,
+                                             long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    if (!applyWidePlanar(inPlanes, outPlanes, numPixels))
+    {
+        const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+        ProcessPlanarSSE(inPlanes, outPlanes, numPixels, gammas,
+                         [](__m128 pixel, __m128 gamma)
+                         {
+                             const __m128 data = ssePower(pixel, gamma);
+                             const __m128 flag = _mm_cmpgt_ps(pixel, _mm_setzero_ps());
+
+                             return _mm_or_ps(_mm_and_ps(flag, data), _mm_andnot_ps(flag, pixel));
+                         });
+    }
+}
+#endif
 
+template<int NumChannels>
+void GammaBasicPassThruOpCPU::process(const float * in, float * out, long numPixels) const
+{
     for (long idx = 0; idx<numPixels; ++idx)
     {
-        const float pixel[4] = { in[0], in[1], in[2], in[3] };
+        // The alpha is zero when processing RGB pixels.
+        const float alpha = NumChannels == 4 ? in[3] : 0.0f;
+
+        const float pixel[4] = { in[0], in[1], in[2], alpha };
 
         out[0] = pixel[0] > 0.f ? std::pow(pixel[0], m_redGamma) : pixel[0];
         out[1] = pixel[1] > 0.f ? std::pow(pixel[1], m_grnGamma) : pixel[1];
         out[2] = pixel[2] > 0.f ? std::pow(pixel[2], m_bluGamma) : pixel[2];
-        out[3] = pixel[3] > 0.f ? std::pow(pixel[3], m_alpGamma) : pixel[3];
+        if (NumChannels == 4)
+        {
+            out[3] = pixel[3] > 0.f ? std::pow(pixel[3], m_alpGamma) : pixel[3];
+        }
+
+        in += NumChannels;
+        out += NumChannels;
+    }
+}
+
+void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void GammaBasicPassThruOpCPU::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+void GammaBasicPassThruOpCPU::applyPlanar(const float * const * inPlanes,
+                                          float * const * outPlanes,
+                                          long numPixels) const
+{
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    ProcessPlanar(inPlanes, outPlanes, numPixels, gammas,
+                  [](float pixel, float gamma)
+                  {
+                      return pixel > 0.f ? std::pow(pixel, gamma) : pixel;
+                  });
+}
 
-        in += 4;
-        out += 4;
+void GammaMoncurveOpCPU::updateWide(ConstGammaOpDataRcPtr & gamma)
+{
+    m_wide = GetGammaWideRenderer(gamma->getStyle());
+
+    const RendererParams * channels[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+    for (int c = 0; c < 4; ++c)
+    {
+        m_wideParams[c]      = channels[c]->scale;
+        m_wideParams[4 + c]  = channels[c]->offset;
+        m_wideParams[8 + c]  = channels[c]->gamma;
+        m_wideParams[12 + c] = channels[c]->breakPnt;
+        m_wideParams[16 + c] = channels[c]->slope;
     }
 }
 
+bool GammaMoncurveOpCPU::applyWide(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        return false;
+    }
+
+    m_wide.apply(m_wideParams, (const float *)inImg, (float *)outImg, numPixels);
+
+    return true;
+}
+
+bool GammaMoncurveOpCPU::applyWideRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        return false;
+    }
+
+    m_wide.applyRGB(m_wideParams, inImg, outImg, numPixels);
+
+    return true;
+}
+
+void GammaMoncurveOpCPU::applyPlanar(const float * const * inPlanes,
+                                     float * const * outPlanes,
+                                     long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        OpCPU::applyPlanar(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    m_wide.applyPlanar(m_wideParams, inPlanes, outPlanes, numPixels);
+}
+
 GammaMoncurveOpCPUFwd::GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
     :   GammaMoncurveOpCPU(gamma)
 {
@@ -481,11 +983,9 @@ void GammaMoncurveOpCPUFwd::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #if OCIO_USE_SSE2
-void GammaMoncurveOpCPUFwdSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void GammaMoncurveOpCPUFwdSSE::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 scale = _mm_set_ps(m_alpha.scale, m_blue.scale,
                                     m_green.scale, m_red.scale);
 
@@ -503,7 +1003,7 @@ void GammaMoncurveOpCPUFwdSSE::apply(const void * inImg, void * outImg, long num
 
     for(long idx=0; idx<numPixels; ++idx)
     {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        __m128 pixel = sseLoadPixel<NumChannels>(in);
 
         __m128 data = _mm_add_ps(_mm_mul_ps(pixel, scale), offset);
 
@@ -514,19 +1014,33 @@ void GammaMoncurveOpCPUFwdSSE::apply(const void * inImg, void * outImg, long num
         data = _mm_or_ps(_mm_and_ps(flag, data),
                          _mm_andnot_ps(flag, _mm_mul_ps(pixel, slope )));
 
-        _mm_storeu_ps(out, data);
+        sseStorePixel<NumChannels>(out, data);
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
-#endif // OCIO_USE_SSE2
 
-void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
+void GammaMoncurveOpCPUFwdSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
 
+void GammaMoncurveOpCPUFwdSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
+    }
+}
+#endif // OCIO_USE_SSE2
+
+template<int NumChannels>
+void GammaMoncurveOpCPUFwd::process(const float * in, float * out, long numPixels) const
+{
     const float red[5] = { m_red.scale,  m_red.offset,
                            m_red.gamma,  m_red.breakPnt, m_red.slope };
     const float grn[5] = { m_green.scale, m_green.offset, 
@@ -538,7 +1052,10 @@ void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPix
 
     for(long idx=0; idx<numPixels; ++idx)
     {
-        const float pixel[4] = { in[0], in[1], in[2], in[3] };
+        // The alpha is zero when processing RGB pixels.
+        const float alpha = NumChannels == 4 ? in[3] : 0.0f;
+
+        const float pixel[4] = { in[0], in[1], in[2], alpha };
 
         const float data[4] = { std::pow(pixel[0] * red[0] + red[1], red[2]),
                                 std::pow(pixel[1] * grn[0] + grn[1], grn[2]),
@@ -548,13 +1065,26 @@ void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPix
         out[0] = pixel[0]<=red[3] ? pixel[0] * red[4] : data[0];
         out[1] = pixel[1]<=grn[3] ? pixel[1] * grn[4] : data[1];
         out[2] = pixel[2]<=blu[3] ? pixel[2] * blu[4] : data[2];
-        out[3] = pixel[3]<=alp[3] ? pixel[3] * alp[4] : data[3];
+        if (NumChannels == 4)
+        {
+            out[3] = pixel[3]<=alp[3] ? pixel[3] * alp[4] : data[3];
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
+void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void GammaMoncurveOpCPUFwd::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 GammaMoncurveOpCPURev::GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma)
     :   GammaMoncurveOpCPU(gamma)
 {
@@ -570,11 +1100,9 @@ void GammaMoncurveOpCPURev::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #if OCIO_USE_SSE2
-void GammaMoncurveOpCPURevSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void GammaMoncurveOpCPURevSSE::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 scale = _mm_set_ps(m_alpha.scale, m_blue.scale,
                                     m_green.scale, m_red.scale);
 
@@ -592,7 +1120,7 @@ void GammaMoncurveOpCPURevSSE::apply(const void * inImg, void * outImg, long num
 
     for(long idx=0; idx<numPixels; ++idx)
     {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        __m128 pixel = sseLoadPixel<NumChannels>(in);
 
         __m128 data = ssePower(pixel, gamma);
 
@@ -603,19 +1131,33 @@ void GammaMoncurveOpCPURevSSE::apply(const void * inImg, void * outImg, long num
         data = _mm_or_ps(_mm_and_ps(flag, data),
                          _mm_andnot_ps(flag, _mm_mul_ps(pixel, slope)));
 
-        _mm_storeu_ps(out, data);
+        sseStorePixel<NumChannels>(out, data);
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
-#endif
 
-void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
+void GammaMoncurveOpCPURevSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+
+void GammaMoncurveOpCPURevSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
+    }
+}
+#endif
 
+template<int NumChannels>
+void GammaMoncurveOpCPURev::process(const float * in, float * out, long numPixels) const
+{
     const float red[5] = { m_red.gamma,  m_red.scale,
                            m_red.offset, m_red.breakPnt, m_red.slope };
     const float grn[5] = { m_green.gamma, m_green.scale, 
@@ -627,7 +1169,10 @@ void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPix
 
     for(long idx=0; idx<numPixels; ++idx)
     {
-        const float pixel[4] = { in[0], in[1], in[2], in[3] };
+        // The alpha is zero when processing RGB pixels.
+        const float alpha = NumChannels == 4 ? in[3] : 0.0f;
+
+        const float pixel[4] = { in[0], in[1], in[2], alpha };
 
         const float data[4] = { std::pow(pixel[0], red[0]) * red[1] - red[2],
                                 std::pow(pixel[1], grn[0]) * grn[1] - grn[2],
@@ -637,13 +1182,26 @@ void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPix
         out[0] = pixel[0]<=red[3] ? pixel[0] * red[4] : data[0];
         out[1] = pixel[1]<=grn[3] ? pixel[1] * grn[4] : data[1];
         out[2] = pixel[2]<=blu[3] ? pixel[2] * blu[4] : data[2];
-        out[3] = pixel[3]<=alp[3] ? pixel[3] * alp[4] : data[3];
+        if (NumChannels == 4)
+        {
+            out[3] = pixel[3]<=alp[3] ? pixel[3] * alp[4] : data[3];
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
+void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void GammaMoncurveOpCPURev::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 GammaMoncurveMirrorOpCPUFwd::GammaMoncurveMirrorOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
     : GammaMoncurveOpCPU(gamma)
 {
@@ -659,11 +1217,9 @@ void GammaMoncurveMirrorOpCPUFwd::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #if OCIO_USE_SSE2
-void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void GammaMoncurveMirrorOpCPUFwdSSE::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 scale = _mm_set_ps(m_alpha.scale, m_blue.scale,
                                     m_green.scale, m_red.scale);
 
@@ -681,7 +1237,7 @@ void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg, lo
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        __m128 pixel = sseLoadPixel<NumChannels>(in);
         __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
         __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
 
@@ -696,18 +1252,33 @@ void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg, lo
 
         data = _mm_or_ps(sign_pix, data);
 
-        _mm_storeu_ps(out, data);
+        sseStorePixel<NumChannels>(out, data);
+
+        in  += NumChannels;
+        out += NumChannels;
+    }
+}
+
+void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
 
-        in  += 4;
-        out += 4;
+void GammaMoncurveMirrorOpCPUFwdSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
     }
 }
 #endif
 
-void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void GammaMoncurveMirrorOpCPUFwd::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
     const float red[5] = { m_red.scale,  m_red.offset,
                            m_red.gamma,  m_red.breakPnt, m_red.slope };
     const float grn[5] = { m_green.scale, m_green.offset,
@@ -719,11 +1290,14 @@ void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long
 
     for (long idx = 0; idx<numPixels; ++idx)
     {
+        // The alpha is zero when processing RGB pixels.
+        const float alpha = NumChannels == 4 ? in[3] : 0.0f;
+
         const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
+                                std::copysign(1.0f, in[2]), std::copysign(1.0f, alpha) };
 
         const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
-                                 std::fabs(in[2]), std::fabs(in[3]) };
+                                 std::fabs(in[2]), std::fabs(alpha) };
 
         const float data[4] = { std::pow(pixel[0] * red[0] + red[1], red[2]),
                                 std::pow(pixel[1] * grn[0] + grn[1], grn[2]),
@@ -733,13 +1307,26 @@ void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long
         out[0] = sign[0] * (pixel[0] <= red[3] ? pixel[0] * red[4] : data[0]);
         out[1] = sign[1] * (pixel[1] <= grn[3] ? pixel[1] * grn[4] : data[1]);
         out[2] = sign[2] * (pixel[2] <= blu[3] ? pixel[2] * blu[4] : data[2]);
-        out[3] = sign[3] * (pixel[3] <= alp[3] ? pixel[3] * alp[4] : data[3]);
+        if (NumChannels == 4)
+        {
+            out[3] = sign[3] * (pixel[3] <= alp[3] ? pixel[3] * alp[4] : data[3]);
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
+void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void GammaMoncurveMirrorOpCPUFwd::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 GammaMoncurveMirrorOpCPURev::GammaMoncurveMirrorOpCPURev(ConstGammaOpDataRcPtr & gamma)
     : GammaMoncurveOpCPU(gamma)
 {
@@ -755,11 +1342,9 @@ void GammaMoncurveMirrorOpCPURev::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #if OCIO_USE_SSE2
-void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void GammaMoncurveMirrorOpCPURevSSE::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 scale = _mm_set_ps(m_alpha.scale, m_blue.scale,
                                     m_green.scale, m_red.scale);
 
@@ -777,7 +1362,7 @@ void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg, lo
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        __m128 pixel = sseLoadPixel<NumChannels>(in);
         __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
         __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
 
@@ -792,19 +1377,33 @@ void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg, lo
 
         data = _mm_or_ps(sign_pix, data);
 
-        _mm_storeu_ps(out, data);
+        sseStorePixel<NumChannels>(out, data);
 
-        in += 4;
-        out += 4;
+        in += NumChannels;
+        out += NumChannels;
     }
 }
-#endif
 
-void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
+void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+
+void GammaMoncurveMirrorOpCPURevSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
+    }
+}
+#endif
 
+template<int NumChannels>
+void GammaMoncurveMirrorOpCPURev::process(const float * in, float * out, long numPixels) const
+{
     const float red[5] = { m_red.gamma,  m_red.scale,
                            m_red.offset, m_red.breakPnt, m_red.slope };
     const float grn[5] = { m_green.gamma, m_green.scale,
@@ -816,11 +1415,14 @@ void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long
 
     for (long idx = 0; idx<numPixels; ++idx)
     {
+        // The alpha is zero when processing RGB pixels.
+        const float alpha = NumChannels == 4 ? in[3] : 0.0f;
+
         const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
+                                std::copysign(1.0f, in[2]), std::copysign(1.0f, alpha) };
 
         const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
-                                 std::fabs(in[2]), std::fabs(in[3]) };
+                                 std::fabs(in[2]), std::fabs(alpha) };
 
         const float data[4] = { std::pow(pixel[0], red[0]) * red[1] - red[2],
                                 std::pow(pixel[1], grn[0]) * grn[1] - grn[2],
@@ -830,11 +1432,24 @@ void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long
         out[0] = sign[0] * (pixel[0] <= red[3] ? pixel[0] * red[4] : data[0]);
         out[1] = sign[1] * (pixel[1] <= grn[3] ? pixel[1] * grn[4] : data[1]);
         out[2] = sign[2] * (pixel[2] <= blu[3] ? pixel[2] * blu[4] : data[2]);
-        out[3] = sign[3] * (pixel[3] <= alp[3] ? pixel[3] * alp[4] : data[3]);
+        if (NumChannels == 4)
+        {
+            out[3] = sign[3] * (pixel[3] <= alp[3] ? pixel[3] * alp[4] : data[3]);
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
+void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void GammaMoncurveMirrorOpCPURev::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 } // namespace OCIO_NAMESPACE
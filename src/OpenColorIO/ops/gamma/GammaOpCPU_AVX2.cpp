@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GammaOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+inline __m256 SignMask()
+{
+    return _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+}
+
+struct BasicPower
+{
+    static inline __m256 apply(__m256 pixel, __m256 gamma)
+    {
+        return avx2Power(pixel, gamma);
+    }
+};
+
+struct MirrorPower
+{
+    static inline __m256 apply(__m256 pixel, __m256 gamma)
+    {
+        const __m256 sign_pix = _mm256_and_ps(pixel, SignMask());
+        const __m256 abs_pix  = _mm256_andnot_ps(SignMask(), pixel);
+
+        return _mm256_or_ps(sign_pix, avx2Power(abs_pix, gamma));
+    }
+};
+
+struct PassThruPower
+{
+    static inline __m256 apply(__m256 pixel, __m256 gamma)
+    {
+        const __m256 flag = _mm256_cmp_ps(pixel, _mm256_setzero_ps(), _CMP_GT_OQ);
+
+        return _mm256_blendv_ps(pixel, avx2Power(pixel, gamma), flag);
+    }
+};
+
+template<typename Power>
+struct GammaBasicKernel
+{
+    explicit GammaBasicKernel(const float * gammas)
+        : m_red(_mm256_set1_ps(gammas[0]))
+        , m_grn(_mm256_set1_ps(gammas[1]))
+        , m_blu(_mm256_set1_ps(gammas[2]))
+        , m_alp(_mm256_set1_ps(gammas[3]))
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & a) const
+    {
+        r = Power::apply(r, m_red);
+        g = Power::apply(g, m_grn);
+        b = Power::apply(b, m_blu);
+        a = Power::apply(a, m_alp);
+    }
+
+    const __m256 m_red, m_grn, m_blu, m_alp;
+};
+
+// The moncurve parameters of one channel.
+struct MoncurveParams
+{
+    MoncurveParams(const float * params, int channel)
+        : scale(_mm256_set1_ps(params[channel]))
+        , offset(_mm256_set1_ps(params[4 + channel]))
+        , gamma(_mm256_set1_ps(params[8 + channel]))
+        , breakPnt(_mm256_set1_ps(params[12 + channel]))
+        , slope(_mm256_set1_ps(params[16 + channel]))
+    {
+    }
+
+    const __m256 scale, offset, gamma, breakPnt, slope;
+};
+
+struct MoncurveFwd
+{
+    static inline __m256 apply(__m256 pixel, const MoncurveParams & p)
+    {
+        __m256 data = _mm256_add_ps(_mm256_mul_ps(pixel, p.scale), p.offset);
+        data = avx2Power(data, p.gamma);
+
+        const __m256 flag = _mm256_cmp_ps(pixel, p.breakPnt, _CMP_GT_OQ);
+
+        return _mm256_blendv_ps(_mm256_mul_ps(pixel, p.slope), data, flag);
+    }
+};
+
+struct MoncurveRev
+{
+    static inline __m256 apply(__m256 pixel, const MoncurveParams & p)
+    {
+        __m256 data = avx2Power(pixel, p.gamma);
+        data = _mm256_sub_ps(_mm256_mul_ps(data, p.scale), p.offset);
+
+        const __m256 flag = _mm256_cmp_ps(pixel, p.breakPnt, _CMP_GT_OQ);
+
+        return _mm256_blendv_ps(_mm256_mul_ps(pixel, p.slope), data, flag);
+    }
+};
+
+template<typename Curve>
+struct MoncurveMirror
+{
+    static inline __m256 apply(__m256 pixel, const MoncurveParams & p)
+    {
+        const __m256 sign_pix = _mm256_and_ps(pixel, SignMask());
+        const __m256 abs_pix  = _mm256_andnot_ps(SignMask(), pixel);
+
+        return _mm256_or_ps(sign_pix, Curve::apply(abs_pix, p));
+    }
+};
+
+template<typename Curve>
+struct GammaMoncurveKernel
+{
+    explicit GammaMoncurveKernel(const float * params)
+        : m_red(params, 0)
+        , m_grn(params, 1)
+        , m_blu(params, 2)
+        , m_alp(params, 3)
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & a) const
+    {
+        r = Curve::apply(r, m_red);
+        g = Curve::apply(g, m_grn);
+        b = Curve::apply(b, m_blu);
+        a = Curve::apply(a, m_alp);
+    }
+
+    const MoncurveParams m_red, m_grn, m_blu, m_alp;
+};
+
+} // anonymous namespace
+
+WideOpCPURenderer AVX2GetGammaRenderer(GammaOpData::Style style)
+{
+    switch(style)
+    {
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_REV:
+            return avx2GetKernelRenderer<GammaBasicKernel<BasicPower>>();
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_MIRROR_REV:
+            return avx2GetKernelRenderer<GammaBasicKernel<MirrorPower>>();
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+            return avx2GetKernelRenderer<GammaBasicKernel<PassThruPower>>();
+        case GammaOpData::MONCURVE_FWD:
+            return avx2GetKernelRenderer<GammaMoncurveKernel<MoncurveFwd>>();
+        case GammaOpData::MONCURVE_REV:
+            return avx2GetKernelRenderer<GammaMoncurveKernel<MoncurveRev>>();
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+            return avx2GetKernelRenderer<GammaMoncurveKernel<MoncurveMirror<MoncurveFwd>>>();
+        case GammaOpData::MONCURVE_MIRROR_REV:
+            return avx2GetKernelRenderer<GammaMoncurveKernel<MoncurveMirror<MoncurveRev>>>();
+    }
+
+    return WideOpCPURenderer();
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GammaOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Apply a function to the absolute value and then restore the sign (i.e. mirror the function
+// for the negative values). Note: Only AVX512F instructions are used so the bit-wise
+// operations are done on integers.
+template<typename Func>
+inline __m512 MirrorApply(__m512 pixel, Func func)
+{
+    const __m512i signMask = _mm512_set1_epi32(0x80000000);
+
+    const __m512i sign_pix = _mm512_and_si512(_mm512_castps_si512(pixel), signMask);
+    const __m512 abs_pix
+        = _mm512_castsi512_ps(_mm512_andnot_si512(signMask, _mm512_castps_si512(pixel)));
+
+    return _mm512_castsi512_ps(_mm512_or_si512(sign_pix, _mm512_castps_si512(func(abs_pix))));
+}
+
+struct BasicPower
+{
+    static inline __m512 apply(__m512 pixel, __m512 gamma)
+    {
+        return avx512Power(pixel, gamma);
+    }
+};
+
+struct MirrorPower
+{
+    static inline __m512 apply(__m512 pixel, __m512 gamma)
+    {
+        return MirrorApply(pixel, [gamma](__m512 abs_pix) { return avx512Power(abs_pix, gamma); });
+    }
+};
+
+struct PassThruPower
+{
+    static inline __m512 apply(__m512 pixel, __m512 gamma)
+    {
+        const __mmask16 flag = _mm512_cmp_ps_mask(pixel, _mm512_setzero_ps(), _CMP_GT_OQ);
+
+        return _mm512_mask_mov_ps(pixel, flag, avx512Power(pixel, gamma));
+    }
+};
+
+template<typename Power>
+struct GammaBasicKernel
+{
+    explicit GammaBasicKernel(const float * gammas)
+        : m_red(_mm512_set1_ps(gammas[0]))
+        , m_grn(_mm512_set1_ps(gammas[1]))
+        , m_blu(_mm512_set1_ps(gammas[2]))
+        , m_alp(_mm512_set1_ps(gammas[3]))
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & a) const
+    {
+        r = Power::apply(r, m_red);
+        g = Power::apply(g, m_grn);
+        b = Power::apply(b, m_blu);
+        a = Power::apply(a, m_alp);
+    }
+
+    const __m512 m_red, m_grn, m_blu, m_alp;
+};
+
+// The moncurve parameters of one channel.
+struct MoncurveParams
+{
+    MoncurveParams(const float * params, int channel)
+        : scale(_mm512_set1_ps(params[channel]))
+        , offset(_mm512_set1_ps(params[4 + channel]))
+        , gamma(_mm512_set1_ps(params[8 + channel]))
+        , breakPnt(_mm512_set1_ps(params[12 + channel]))
+        , slope(_mm512_set1_ps(params[16 + channel]))
+    {
+    }
+
+    const __m512 scale, offset, gamma, breakPnt, slope;
+};
+
+struct MoncurveFwd
+{
+    static inline __m512 apply(__m512 pixel, const MoncurveParams & p)
+    {
+        __m512 data = _mm512_add_ps(_mm512_mul_ps(pixel, p.scale), p.offset);
+        data = avx512Power(data, p.gamma);
+
+        const __mmask16 flag = _mm512_cmp_ps_mask(pixel, p.breakPnt, _CMP_GT_OQ);
+
+        return _mm512_mask_mov_ps(_mm512_mul_ps(pixel, p.slope), flag, data);
+    }
+};
+
+struct MoncurveRev
+{
+    static inline __m512 apply(__m512 pixel, const MoncurveParams & p)
+    {
+        __m512 data = avx512Power(pixel, p.gamma);
+        data = _mm512_sub_ps(_mm512_mul_ps(data, p.scale), p.offset);
+
+        const __mmask16 flag = _mm512_cmp_ps_mask(pixel, p.breakPnt, _CMP_GT_OQ);
+
+        return _mm512_mask_mov_ps(_mm512_mul_ps(pixel, p.slope), flag, data);
+    }
+};
+
+template<typename Curve>
+struct MoncurveMirror
+{
+    static inline __m512 apply(__m512 pixel, const MoncurveParams & p)
+    {
+        return MirrorApply(pixel, [&p](__m512 abs_pix) { return Curve::apply(abs_pix, p); });
+    }
+};
+
+template<typename Curve>
+struct GammaMoncurveKernel
+{
+    explicit GammaMoncurveKernel(const float * params)
+        : m_red(params, 0)
+        , m_grn(params, 1)
+        , m_blu(params, 2)
+        , m_alp(params, 3)
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & a) const
+    {
+        r = Curve::apply(r, m_red);
+        g = Curve::apply(g, m_grn);
+        b = Curve::apply(b, m_blu);
+        a = Curve::apply(a, m_alp);
+    }
+
+    const MoncurveParams m_red, m_grn, m_blu, m_alp;
+};
+
+} // anonymous namespace
+
+WideOpCPURenderer AVX512GetGammaRenderer(GammaOpData::Style style)
+{
+    switch(style)
+    {
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_REV:
+            return avx512GetKernelRenderer<GammaBasicKernel<BasicPower>>();
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_MIRROR_REV:
+            return avx512GetKernelRenderer<GammaBasicKernel<MirrorPower>>();
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+            return avx512GetKernelRenderer<GammaBasicKernel<PassThruPower>>();
+        case GammaOpData::MONCURVE_FWD:
+            return avx512GetKernelRenderer<GammaMoncurveKernel<MoncurveFwd>>();
+        case GammaOpData::MONCURVE_REV:
+            return avx512GetKernelRenderer<GammaMoncurveKernel<MoncurveRev>>();
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+            return avx512GetKernelRenderer<GammaMoncurveKernel<MoncurveMirror<MoncurveFwd>>>();
+        case GammaOpData::MONCURVE_MIRROR_REV:
+            return avx512GetKernelRenderer<GammaMoncurveKernel<MoncurveMirror<MoncurveRev>>>();
+    }
+
+    return WideOpCPURenderer();
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
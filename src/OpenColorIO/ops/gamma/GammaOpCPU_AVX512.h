@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H
+#define INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "WideOpCPU.h"
+#include "ops/gamma/GammaOpData.h"
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+// Get the renderer applying a gamma to F32 pixels, sixteen pixels at a time. The parameters are
+// the four channel powers for the basic styles, and the RGBA values of the scale, offset,
+// gamma, break point and slope (refer to RendererParams) for the moncurve styles.
+WideOpCPURenderer AVX512GetGammaRenderer(GammaOpData::Style style);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H */
@@ -12,6 +12,10 @@
 #include "ops/gradingprimary/GradingPrimaryOpCPU.h"
 #include "SSE.h"
 
+#include "CPUInfo.h"
+#include "GradingPrimaryOpCPU_AVX2.h"
+#include "GradingPrimaryOpCPU_AVX512.h"
+
 namespace OCIO_NAMESPACE
 {
 
@@ -25,12 +29,33 @@ public:
 
     explicit GradingPrimaryOpCPU(ConstGradingPrimaryOpDataRcPtr & gp);
 
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+    // Only the wide vector renderers process the RGB and planar images.
+    bool hasRGBSupport() const override { return m_wide.isValid(); }
+    bool hasPlanarSupport() const override { return m_wide.isValid(); }
+
     bool isDynamic() const override;
     bool hasDynamicProperty(DynamicPropertyType type) const override;
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override;
 
+protected:
+    // Fill the wide vector renderer parameters from the current values of the dynamic
+    // property (refer to GradingPrimaryOpCPU_AVX2.h).
+    virtual void getWideParams(float * params) const = 0;
+
+    // Process the RGBA pixels using the wide vector (i.e. AVX2 or AVX-512) renderer if the CPU
+    // supports it, return false otherwise. Note that the local bypass is not handled.
+    bool applyWide(const void * inImg, void * outImg, long numPixels) const;
+
 protected:
     DynamicPropertyGradingPrimaryImplRcPtr m_gp;
+
+    // It relies on the same power approximation as the SSE2 version.
+    WideOpCPURenderer m_wide;
 };
 
 GradingPrimaryOpCPU::GradingPrimaryOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
@@ -41,6 +66,88 @@ GradingPrimaryOpCPU::GradingPrimaryOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
     {
         m_gp = m_gp->createEditableCopy();
     }
+
+#if OCIO_USE_SSE2
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_wide = AVX2GetGradingPrimaryRenderer(gp->getStyle(), gp->getDirection());
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_wide = AVX512GetGradingPrimaryRenderer(gp->getStyle(), gp->getDirection());
+    }
+#endif
+
+#endif // OCIO_USE_SSE2
+}
+
+bool GradingPrimaryOpCPU::applyWide(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        return false;
+    }
+
+    float params[17];
+    getWideParams(params);
+    m_wide.apply(params, (const float *)inImg, (float *)outImg, numPixels);
+
+    return true;
+}
+
+void GradingPrimaryOpCPU::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        OpCPU::applyRGB(inImg, outImg, numPixels);
+        return;
+    }
+
+    if (m_gp->getLocalBypass())
+    {
+        if (inImg != outImg)
+        {
+            memcpy(outImg, inImg, numPixels * 3 * sizeof(float));
+        }
+        return;
+    }
+
+    float params[17];
+    getWideParams(params);
+    m_wide.applyRGB(params, inImg, outImg, numPixels);
+}
+
+void GradingPrimaryOpCPU::applyPlanar(const float * const * inPlanes,
+                                      float * const * outPlanes,
+                                      long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        OpCPU::applyPlanar(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    if (m_gp->getLocalBypass())
+    {
+        const int numChannels = inPlanes[3] ? 4 : 3;
+        for (int c = 0; c < numChannels; ++c)
+        {
+            if (inPlanes[c] != outPlanes[c])
+            {
+                memcpy(outPlanes[c], inPlanes[c], numPixels * sizeof(float));
+            }
+        }
+        return;
+    }
+
+    float params[17];
+    getWideParams(params);
+    m_wide.applyPlanar(params, inPlanes, outPlanes, numPixels);
 }
 
 bool GradingPrimaryOpCPU::isDynamic() const
@@ -81,6 +188,9 @@ public:
     explicit GradingPrimaryLogFwdOpCPU(ConstGradingPrimaryOpDataRcPtr & gp);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    void getWideParams(float * params) const override;
 };
 
 class GradingPrimaryLogRevOpCPU : public GradingPrimaryLogFwdOpCPU
@@ -89,6 +199,9 @@ public:
     explicit GradingPrimaryLogRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    void getWideParams(float * params) const override;
 };
 
 class GradingPrimaryLinFwdOpCPU : public GradingPrimaryOpCPU
@@ -97,6 +210,9 @@ public:
     explicit GradingPrimaryLinFwdOpCPU(ConstGradingPrimaryOpDataRcPtr & gp);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    void getWideParams(float * params) const override;
 };
 
 class GradingPrimaryLinRevOpCPU : public GradingPrimaryLinFwdOpCPU
@@ -105,6 +221,9 @@ public:
     explicit GradingPrimaryLinRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    void getWideParams(float * params) const override;
 };
 
 class GradingPrimaryVidFwdOpCPU : public GradingPrimaryOpCPU
@@ -113,6 +232,9 @@ public:
     explicit GradingPrimaryVidFwdOpCPU(ConstGradingPrimaryOpDataRcPtr & gp);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    void getWideParams(float * params) const override;
 };
 
 class GradingPrimaryVidRevOpCPU : public GradingPrimaryVidFwdOpCPU
@@ -121,6 +243,9 @@ public:
     explicit GradingPrimaryVidRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    void getWideParams(float * params) const override;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -251,11 +376,57 @@ inline void ApplyClamp(float * pix, float clampMin, float clampMax)
 
 static constexpr auto PixelSize = 4 * sizeof(float);
 
+// Fill the wide vector renderer parameters (refer to GradingPrimaryOpCPU_AVX2.h).
+void FillWideParams(float * params,
+                    const Float3 & offset,
+                    const Float3 & contrast,
+                    const Float3 & power,
+                    float pivot,
+                    const GradingPrimary & v,
+                    float saturation,
+                    bool applySaturation,
+                    bool applyPower)
+{
+    std::copy(offset.begin(), offset.end(), params);
+    std::copy(contrast.begin(), contrast.end(), params + 3);
+    std::copy(power.begin(), power.end(), params + 6);
+
+    params[9]  = pivot;
+    params[10] = static_cast<float>(v.m_pivotBlack);
+    params[11] = static_cast<float>(v.m_pivotWhite);
+    params[12] = saturation;
+    params[13] = static_cast<float>(v.m_clampBlack);
+    params[14] = static_cast<float>(v.m_clampWhite);
+    params[15] = applySaturation ? 1.f : 0.f;
+    params[16] = applyPower ? 1.f : 0.f;
+}
+
+// The reverse styles only apply the (inverted) saturation when it is not 1 or 0.
+inline bool ApplyRevSaturation(const GradingPrimary & v)
+{
+    return v.m_saturation != 1. && v.m_saturation != 0.;
+}
+
+inline float RevSaturation(const GradingPrimary & v)
+{
+    return ApplyRevSaturation(v) ? static_cast<float>(1. / v.m_saturation) : 1.f;
+}
+
 GradingPrimaryLogFwdOpCPU::GradingPrimaryLogFwdOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
     : GradingPrimaryOpCPU(gp)
 {
 }
 
+void GradingPrimaryLogFwdOpCPU::getWideParams(float * params) const
+{
+    auto & v = m_gp->getValue();
+    auto & comp = m_gp->getComputedValue();
+
+    FillWideParams(params, comp.getBrightness(), comp.getContrast(), comp.getGamma(),
+                   static_cast<float>(comp.getPivot()), v, static_cast<float>(v.m_saturation),
+                   v.m_saturation != 1.0, !comp.isGammaIdentity());
+}
+
 void GradingPrimaryLogFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
     if (m_gp->getLocalBypass())
@@ -267,6 +438,11 @@ void GradingPrimaryLogFwdOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -435,6 +611,16 @@ GradingPrimaryLogRevOpCPU::GradingPrimaryLogRevOpCPU(ConstGradingPrimaryOpDataRc
 {
 }
 
+void GradingPrimaryLogRevOpCPU::getWideParams(float * params) const
+{
+    auto & v = m_gp->getValue();
+    auto & comp = m_gp->getComputedValue();
+
+    FillWideParams(params, comp.getBrightness(), comp.getContrast(), comp.getGamma(),
+                   static_cast<float>(comp.getPivot()), v, RevSaturation(v),
+                   ApplyRevSaturation(v), !comp.isGammaIdentity());
+}
+
 void GradingPrimaryLogRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
     if (m_gp->getLocalBypass())
@@ -446,6 +632,11 @@ void GradingPrimaryLogRevOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -609,6 +800,16 @@ GradingPrimaryLinFwdOpCPU::GradingPrimaryLinFwdOpCPU(ConstGradingPrimaryOpDataRc
 {
 }
 
+void GradingPrimaryLinFwdOpCPU::getWideParams(float * params) const
+{
+    auto & v = m_gp->getValue();
+    auto & comp = m_gp->getComputedValue();
+
+    FillWideParams(params, comp.getOffset(), comp.getExposure(), comp.getContrast(),
+                   static_cast<float>(comp.getPivot()), v, static_cast<float>(v.m_saturation),
+                   v.m_saturation != 1.0, !comp.isContrastIdentity());
+}
+
 void GradingPrimaryLinFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
     if (m_gp->getLocalBypass())
@@ -620,6 +821,11 @@ void GradingPrimaryLinFwdOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -783,6 +989,18 @@ GradingPrimaryLinRevOpCPU::GradingPrimaryLinRevOpCPU(ConstGradingPrimaryOpDataRc
 {
 }
 
+void GradingPrimaryLinRevOpCPU::getWideParams(float * params) const
+{
+    auto & v = m_gp->getValue();
+    auto & comp = m_gp->getComputedValue();
+
+    // Note: Like the SSE2 version, the contrast is always applied when the saturation is not.
+    const bool applySaturation = ApplyRevSaturation(v);
+    FillWideParams(params, comp.getOffset(), comp.getExposure(), comp.getContrast(),
+                   static_cast<float>(comp.getPivot()), v, RevSaturation(v),
+                   applySaturation, !comp.isContrastIdentity() || !applySaturation);
+}
+
 void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
     if (m_gp->getLocalBypass())
@@ -794,6 +1012,11 @@ void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -951,6 +1174,17 @@ GradingPrimaryVidFwdOpCPU::GradingPrimaryVidFwdOpCPU(ConstGradingPrimaryOpDataRc
 {
 }
 
+void GradingPrimaryVidFwdOpCPU::getWideParams(float * params) const
+{
+    auto & v = m_gp->getValue();
+    auto & comp = m_gp->getComputedValue();
+
+    // The black pivot is the contrast (i.e. slope) pivot.
+    FillWideParams(params, comp.getOffset(), comp.getSlope(), comp.getGamma(),
+                   static_cast<float>(v.m_pivotBlack), v, static_cast<float>(v.m_saturation),
+                   v.m_saturation != 1.0, !comp.isGammaIdentity());
+}
+
 void GradingPrimaryVidFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
     if (m_gp->getLocalBypass())
@@ -962,6 +1196,11 @@ void GradingPrimaryVidFwdOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -1131,6 +1370,17 @@ GradingPrimaryVidRevOpCPU::GradingPrimaryVidRevOpCPU(ConstGradingPrimaryOpDataRc
 {
 }
 
+void GradingPrimaryVidRevOpCPU::getWideParams(float * params) const
+{
+    auto & v = m_gp->getValue();
+    auto & comp = m_gp->getComputedValue();
+
+    // The black pivot is the contrast (i.e. slope) pivot.
+    FillWideParams(params, comp.getOffset(), comp.getSlope(), comp.getGamma(),
+                   static_cast<float>(v.m_pivotBlack), v, RevSaturation(v),
+                   ApplyRevSaturation(v), !comp.isGammaIdentity());
+}
+
 void GradingPrimaryVidRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
     if (m_gp->getLocalBypass())
@@ -1142,6 +1392,11 @@ void GradingPrimaryVidRevOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (applyWide(inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GradingPrimaryOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+inline __m256 SignMask()
+{
+    return _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+}
+
+struct GradingPrimaryParams
+{
+    explicit GradingPrimaryParams(const float * params)
+        : m_offset{ _mm256_set1_ps(params[0]), _mm256_set1_ps(params[1]),
+                    _mm256_set1_ps(params[2]) }
+        , m_contrast{ _mm256_set1_ps(params[3]), _mm256_set1_ps(params[4]),
+                      _mm256_set1_ps(params[5]) }
+        , m_power{ _mm256_set1_ps(params[6]), _mm256_set1_ps(params[7]),
+                   _mm256_set1_ps(params[8]) }
+        , m_pivot(_mm256_set1_ps(params[9]))
+        , m_pivotBlack(_mm256_set1_ps(params[10]))
+        , m_pivotWhite(_mm256_set1_ps(params[11]))
+        , m_saturation(_mm256_set1_ps(params[12]))
+        , m_clampBlack(_mm256_set1_ps(params[13]))
+        , m_clampWhite(_mm256_set1_ps(params[14]))
+        , m_applySaturation(params[15] != 0.f)
+        , m_applyPower(params[16] != 0.f)
+    {
+    }
+
+    void applyOffset(__m256 & r, __m256 & g, __m256 & b) const
+    {
+        r = _mm256_add_ps(r, m_offset[0]);
+        g = _mm256_add_ps(g, m_offset[1]);
+        b = _mm256_add_ps(b, m_offset[2]);
+    }
+
+    void applySlope(__m256 & r, __m256 & g, __m256 & b) const
+    {
+        r = _mm256_mul_ps(r, m_contrast[0]);
+        g = _mm256_mul_ps(g, m_contrast[1]);
+        b = _mm256_mul_ps(b, m_contrast[2]);
+    }
+
+    // out = (in - pivot) * contrast + pivot
+    void applyContrast(__m256 & r, __m256 & g, __m256 & b) const
+    {
+        __m256 * rgb[3] = { &r, &g, &b };
+        for (int c = 0; c < 3; ++c)
+        {
+            *rgb[c] = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(*rgb[c], m_pivot), m_contrast[c]),
+                                    m_pivot);
+        }
+    }
+
+    // out = pow(abs(in / pivot), contrast) * sign(in) * pivot
+    void applyLinContrast(__m256 & r, __m256 & g, __m256 & b) const
+    {
+        __m256 * rgb[3] = { &r, &g, &b };
+        for (int c = 0; c < 3; ++c)
+        {
+            const __m256 pixel = _mm256_div_ps(*rgb[c], m_pivot);
+            const __m256 sign_pix = _mm256_and_ps(pixel, SignMask());
+            const __m256 abs_pix = _mm256_andnot_ps(SignMask(), pixel);
+
+            *rgb[c] = _mm256_xor_ps(_mm256_mul_ps(avx2Power(abs_pix, m_power[c]), m_pivot),
+                                    sign_pix);
+        }
+    }
+
+    // out = pow(abs(in - black) / range, gamma) * sign(in - black) * range + black
+    void applyGamma(__m256 & r, __m256 & g, __m256 & b) const
+    {
+        const __m256 range = _mm256_sub_ps(m_pivotWhite, m_pivotBlack);
+
+        __m256 * rgb[3] = { &r, &g, &b };
+        for (int c = 0; c < 3; ++c)
+        {
+            const __m256 pixel = _mm256_sub_ps(*rgb[c], m_pivotBlack);
+            const __m256 sign_pix = _mm256_and_ps(pixel, SignMask());
+            const __m256 abs_pix = _mm256_andnot_ps(SignMask(), pixel);
+
+            const __m256 data = avx2Power(_mm256_div_ps(abs_pix, range), m_power[c]);
+            *rgb[c] = _mm256_add_ps(_mm256_mul_ps(_mm256_xor_ps(data, sign_pix), range),
+                                    m_pivotBlack);
+        }
+    }
+
+    void applySaturation(__m256 & r, __m256 & g, __m256 & b) const
+    {
+        const __m256 rg = _mm256_add_ps(_mm256_mul_ps(r, _mm256_set1_ps(0.2126f)),
+                                        _mm256_mul_ps(g, _mm256_set1_ps(0.7152f)));
+        const __m256 luma = _mm256_add_ps(rg, _mm256_mul_ps(b, _mm256_set1_ps(0.0722f)));
+
+        r = _mm256_add_ps(luma, _mm256_mul_ps(m_saturation, _mm256_sub_ps(r, luma)));
+        g = _mm256_add_ps(luma, _mm256_mul_ps(m_saturation, _mm256_sub_ps(g, luma)));
+        b = _mm256_add_ps(luma, _mm256_mul_ps(m_saturation, _mm256_sub_ps(b, luma)));
+    }
+
+    void applyClamp(__m256 & r, __m256 & g, __m256 & b) const
+    {
+        r = _mm256_min_ps(_mm256_max_ps(r, m_clampBlack), m_clampWhite);
+        g = _mm256_min_ps(_mm256_max_ps(g, m_clampBlack), m_clampWhite);
+        b = _mm256_min_ps(_mm256_max_ps(b, m_clampBlack), m_clampWhite);
+    }
+
+    __m256 m_offset[3];
+    __m256 m_contrast[3];
+    __m256 m_power[3];
+    __m256 m_pivot;
+    __m256 m_pivotBlack;
+    __m256 m_pivotWhite;
+    __m256 m_saturation;
+    __m256 m_clampBlack;
+    __m256 m_clampWhite;
+    bool m_applySaturation;
+    bool m_applyPower;
+};
+
+// Log and video styles (i.e. the video style uses the black pivot as contrast pivot).
+struct GradingPrimaryFwdKernel : public GradingPrimaryParams
+{
+    explicit GradingPrimaryFwdKernel(const float * params) : GradingPrimaryParams(params) {}
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        applyOffset(r, g, b);
+        applyContrast(r, g, b);
+        if (m_applyPower)
+        {
+            applyGamma(r, g, b);
+        }
+        if (m_applySaturation)
+        {
+            applySaturation(r, g, b);
+        }
+        applyClamp(r, g, b);
+    }
+};
+
+struct GradingPrimaryRevKernel : public GradingPrimaryParams
+{
+    explicit GradingPrimaryRevKernel(const float * params) : GradingPrimaryParams(params) {}
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        applyClamp(r, g, b);
+        if (m_applySaturation)
+        {
+            applySaturation(r, g, b);
+        }
+        if (m_applyPower)
+        {
+            applyGamma(r, g, b);
+        }
+        applyContrast(r, g, b);
+        applyOffset(r, g, b);
+    }
+};
+
+struct GradingPrimaryLinFwdKernel : public GradingPrimaryParams
+{
+    explicit GradingPrimaryLinFwdKernel(const float * params) : GradingPrimaryParams(params) {}
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        applyOffset(r, g, b);
+        applySlope(r, g, b);
+        if (m_applyPower)
+        {
+            applyLinContrast(r, g, b);
+        }
+        if (m_applySaturation)
+        {
+            applySaturation(r, g, b);
+        }
+        applyClamp(r, g, b);
+    }
+};
+
+struct GradingPrimaryLinRevKernel : public GradingPrimaryParams
+{
+    explicit GradingPrimaryLinRevKernel(const float * params) : GradingPrimaryParams(params) {}
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        applyClamp(r, g, b);
+        if (m_applySaturation)
+        {
+            applySaturation(r, g, b);
+        }
+        if (m_applyPower)
+        {
+            applyLinContrast(r, g, b);
+        }
+        applySlope(r, g, b);
+        applyOffset(r, g, b);
+    }
+};
+
+} // anonymous namespace
+
+WideOpCPURenderer AVX2GetGradingPrimaryRenderer(GradingStyle style, TransformDirection dir)
+{
+    const bool isFwd = dir == TRANSFORM_DIR_FORWARD;
+
+    switch (style)
+    {
+        case GRADING_LOG:
+        case GRADING_VIDEO:
+            return isFwd ? avx2GetKernelRenderer<GradingPrimaryFwdKernel>()
+                         : avx2GetKernelRenderer<GradingPrimaryRevKernel>();
+        case GRADING_LIN:
+            return isFwd ? avx2GetKernelRenderer<GradingPrimaryLinFwdKernel>()
+                         : avx2GetKernelRenderer<GradingPrimaryLinRevKernel>();
+    }
+
+    return WideOpCPURenderer();
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GradingPrimaryOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Note: Only AVX512F instructions are used so the bit-wise operations are done on integers.
+inline __m512 SignOf(__m512 x)
+{
+    return _mm512_castsi512_ps(
+        _mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32(0x80000000)));
+}
+
+inline __m512 AbsOf(__m512 x)
+{
+    return _mm512_castsi512_ps(
+        _mm512_andnot_si512(_mm512_set1_epi32(0x80000000), _mm512_castps_si512(x)));
+}
+
+inline __m512 XorSign(__m512 x, __m512 sign)
+{
+    return _mm512_castsi512_ps(
+        _mm512_xor_si512(_mm512_castps_si512(x), _mm512_castps_si512(sign)));
+}
+
+struct GradingPrimaryParams
+{
+    explicit GradingPrimaryParams(const float * params)
+        : m_offset{ _mm512_set1_ps(params[0]), _mm512_set1_ps(params[1]),
+                    _mm512_set1_ps(params[2]) }
+        , m_contrast{ _mm512_set1_ps(params[3]), _mm512_set1_ps(params[4]),
+                      _mm512_set1_ps(params[5]) }
+        , m_power{ _mm512_set1_ps(params[6]), _mm512_set1_ps(params[7]),
+                   _mm512_set1_ps(params[8]) }
+        , m_pivot(_mm512_set1_ps(params[9]))
+        , m_pivotBlack(_mm512_set1_ps(params[10]))
+        , m_pivotWhite(_mm512_set1_ps(params[11]))
+        , m_saturation(_mm512_set1_ps(params[12]))
+        , m_clampBlack(_mm512_set1_ps(params[13]))
+        , m_clampWhite(_mm512_set1_ps(params[14]))
+        , m_applySaturation(params[15] != 0.f)
+        , m_applyPower(params[16] != 0.f)
+    {
+    }
+
+    void applyOffset(__m512 & r, __m512 & g, __m512 & b) const
+    {
+        r = _mm512_add_ps(r, m_offset[0]);
+        g = _mm512_add_ps(g, m_offset[1]);
+        b = _mm512_add_ps(b, m_offset[2]);
+    }
+
+    void applySlope(__m512 & r, __m512 & g, __m512 & b) const
+    {
+        r = _mm512_mul_ps(r, m_contrast[0]);
+        g = _mm512_mul_ps(g, m_contrast[1]);
+        b = _mm512_mul_ps(b, m_contrast[2]);
+    }
+
+    // out = (in - pivot) * contrast + pivot
+    void applyContrast(__m512 & r, __m512 & g, __m512 & b) const
+    {
+        __m512 * rgb[3] = { &r, &g, &b };
+        for (int c = 0; c < 3; ++c)
+        {
+            *rgb[c] = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(*rgb[c], m_pivot), m_contrast[c]),
+                                    m_pivot);
+        }
+    }
+
+    // out = pow(abs(in / pivot), contrast) * sign(in) * pivot
+    void applyLinContrast(__m512 & r, __m512 & g, __m512 & b) const
+    {
+        __m512 * rgb[3] = { &r, &g, &b };
+        for (int c = 0; c < 3; ++c)
+        {
+            const __m512 pixel = _mm512_div_ps(*rgb[c], m_pivot);
+            const __m512 sign_pix = SignOf(pixel);
+            const __m512 abs_pix = AbsOf(pixel);
+
+            *rgb[c] = XorSign(_mm512_mul_ps(avx512Power(abs_pix, m_power[c]), m_pivot),
+                              sign_pix);
+        }
+    }
+
+    // out = pow(abs(in - black) / range, gamma) * sign(in - black) * range + black
+    void applyGamma(__m512 & r, __m512 & g, __m512 & b) const
+    {
+        const __m512 range = _mm512_sub_ps(m_pivotWhite, m_pivotBlack);
+
+        __m512 * rgb[3] = { &r, &g, &b };
+        for (int c = 0; c < 3; ++c)
+        {
+            const __m512 pixel = _mm512_sub_ps(*rgb[c], m_pivotBlack);
+            const __m512 sign_pix = SignOf(pixel);
+            const __m512 abs_pix = AbsOf(pixel);
+
+            const __m512 data = avx512Power(_mm512_div_ps(abs_pix, range), m_power[c]);
+            *rgb[c] = _mm512_add_ps(_mm512_mul_ps(XorSign(data, sign_pix), range),
+                                    m_pivotBlack);
+        }
+    }
+
+    void applySaturation(__m512 & r, __m512 & g, __m512 & b) const
+    {
+        const __m512 rg = _mm512_add_ps(_mm512_mul_ps(r, _mm512_set1_ps(0.2126f)),
+                                        _mm512_mul_ps(g, _mm512_set1_ps(0.7152f)));
+        const __m512 luma = _mm512_add_ps(rg, _mm512_mul_ps(b, _mm512_set1_ps(0.0722f)));
+
+        r = _mm512_add_ps(luma, _mm512_mul_ps(m_saturation, _mm512_sub_ps(r, luma)));
+        g = _mm512_add_ps(luma, _mm512_mul_ps(m_saturation, _mm512_sub_ps(g, luma)));
+        b = _mm512_add_ps(luma, _mm512_mul_ps(m_saturation, _mm512_sub_ps(b, luma)));
+    }
+
+    void applyClamp(__m512 & r, __m512 & g, __m512 & b) const
+    {
+        r = _mm512_min_ps(_mm512_max_ps(r, m_clampBlack), m_clampWhite);
+        g = _mm512_min_ps(_mm512_max_ps(g, m_clampBlack), m_clampWhite);
+        b = _mm512_min_ps(_mm512_max_ps(b, m_clampBlack), m_clampWhite);
+    }
+
+    __m512 m_offset[3];
+    __m512 m_contrast[3];
+    __m512 m_power[3];
+    __m512 m_pivot;
+    __m512 m_pivotBlack;
+    __m512 m_pivotWhite;
+    __m512 m_saturation;
+    __m512 m_clampBlack;
+    __m512 m_clampWhite;
+    bool m_applySaturation;
+    bool m_applyPower;
+};
+
+// Log and video styles (i.e. the video style uses the black pivot as contrast pivot).
+struct GradingPrimaryFwdKernel : public GradingPrimaryParams
+{
+    explicit GradingPrimaryFwdKernel(const float * params) : GradingPrimaryParams(params) {}
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        applyOffset(r, g, b);
+        applyContrast(r, g, b);
+        if (m_applyPower)
+        {
+            applyGamma(r, g, b);
+        }
+        if (m_applySaturation)
+        {
+            applySaturation(r, g, b);
+        }
+        applyClamp(r, g, b);
+    }
+};
+
+struct GradingPrimaryRevKernel : public GradingPrimaryParams
+{
+    explicit GradingPrimaryRevKernel(const float * params) : GradingPrimaryParams(params) {}
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        applyClamp(r, g, b);
+        if (m_applySaturation)
+        {
+            applySaturation(r, g, b);
+        }
+        if (m_applyPower)
+        {
+            applyGamma(r, g, b);
+        }
+        applyContrast(r, g, b);
+        applyOffset(r, g, b);
+    }
+};
+
+struct GradingPrimaryLinFwdKernel : public GradingPrimaryParams
+{
+    explicit GradingPrimaryLinFwdKernel(const float * params) : GradingPrimaryParams(params) {}
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        applyOffset(r, g, b);
+        applySlope(r, g, b);
+        if (m_applyPower)
+        {
+            applyLinContrast(r, g, b);
+        }
+        if (m_applySaturation)
+        {
+            applySaturation(r, g, b);
+        }
+        applyClamp(r, g, b);
+    }
+};
+
+struct GradingPrimaryLinRevKernel : public GradingPrimaryParams
+{
+    explicit GradingPrimaryLinRevKernel(const float * params) : GradingPrimaryParams(params) {}
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        applyClamp(r, g, b);
+        if (m_applySaturation)
+        {
+            applySaturation(r, g, b);
+        }
+        if (m_applyPower)
+        {
+            applyLinContrast(r, g, b);
+        }
+        applySlope(r, g, b);
+        applyOffset(r, g, b);
+    }
+};
+
+} // anonymous namespace
+
+WideOpCPURenderer AVX512GetGradingPrimaryRenderer(GradingStyle style, TransformDirection dir)
+{
+    const bool isFwd = dir == TRANSFORM_DIR_FORWARD;
+
+    switch (style)
+    {
+        case GRADING_LOG:
+        case GRADING_VIDEO:
+            return isFwd ? avx512GetKernelRenderer<GradingPrimaryFwdKernel>()
+                         : avx512GetKernelRenderer<GradingPrimaryRevKernel>();
+        case GRADING_LIN:
+            return isFwd ? avx512GetKernelRenderer<GradingPrimaryLinFwdKernel>()
+                         : avx512GetKernelRenderer<GradingPrimaryLinRevKernel>();
+    }
+
+    return WideOpCPURenderer();
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GRADINGPRIMARYOP_CPU_AVX512_H
+#define INCLUDED_OCIO_GRADINGPRIMARYOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "WideOpCPU.h"
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+// Get the renderer applying the grading primary to F32 pixels, sixteen pixels at a time. The
+// alpha channel is left unchanged. The parameters are (refer to GradingPrimaryOpCPU.cpp):
+//   0-2:   offset (i.e. brightness for the log style)
+//   3-5:   contrast (i.e. exposure for the linear style, slope for the video style)
+//   6-8:   power (i.e. gamma, or contrast for the linear style)
+//   9-14:  contrast pivot, black pivot, white pivot, saturation, black clamp and white clamp
+//   15-16: apply the saturation and apply the power flags (i.e. 0 or 1)
+WideOpCPURenderer AVX512GetGradingPrimaryRenderer(GradingStyle style, TransformDirection dir);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_GRADINGPRIMARYOP_CPU_AVX512_H */
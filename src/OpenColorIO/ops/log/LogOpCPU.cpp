@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cstring>
 #include <cmath>
+#include <initializer_list>
 #if OCIO_USE_SSE2 == 0
 #include <tuple>
 #endif
@@ -18,6 +19,10 @@
 #include "Platform.h"
 #include "SSE.h"
 
+#include "CPUInfo.h"
+#include "LogOpCPU_AVX2.h"
+#include "LogOpCPU_AVX512.h"
+
 namespace OCIO_NAMESPACE
 {
 class LogOpCPU : public OpCPU
@@ -28,9 +33,28 @@ public:
 
     explicit LogOpCPU(ConstLogOpDataRcPtr & log);
 
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+    bool hasRGBSupport() const override { return true; }
+    // Only the wide vector renderers process the planar images.
+    bool hasPlanarSupport() const override { return m_wide.isValid(); }
+
 protected:
     // Update renderer parameters.
     virtual void updateData(ConstLogOpDataRcPtr & log);
+
+    // Process the pixels using the wide vector (i.e. AVX2 or AVX-512) renderer if the CPU
+    // supports it, return false otherwise.
+    bool applyWide(const void * inImg, void * outImg, long numPixels) const;
+    bool applyWideRGB(const float * inImg, float * outImg, long numPixels) const;
+
+protected:
+    // Only the fast exponent renderers use it as it relies on the same approximation as the
+    // SSE2 version. Refer to LogOpCPU_AVX2.h for the content of the parameters.
+    WideOpCPURenderer m_wide;
+    float m_wideParams[21];
 };
 
 // Base class for LogToLin and LinToLog renderers.
@@ -56,6 +80,11 @@ public:
     explicit Log2LinRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -73,6 +102,11 @@ public:
     explicit Log2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -83,6 +117,11 @@ public:
     explicit Lin2LogRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -100,6 +139,11 @@ public:
     explicit Lin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -124,6 +168,11 @@ public:
     explicit CameraLog2LinRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -143,6 +192,11 @@ public:
     explicit CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -153,6 +207,11 @@ public:
     explicit CameraLin2LogRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -171,6 +230,11 @@ public:
     explicit CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -181,6 +245,11 @@ public:
     explicit LogRenderer(ConstLogOpDataRcPtr & log, float logScale);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     float m_logScale;
@@ -193,6 +262,11 @@ public:
     explicit LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
@@ -203,6 +277,11 @@ public:
     explicit AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 protected:
     float m_log2_base;
@@ -215,9 +294,28 @@ public:
     explicit AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 #endif
 
+namespace
+{
+
+// Copy the RGB values of the renderer coefficients into the wide vector renderer parameters.
+inline void CopyRGBCoefs(float * params, std::initializer_list<const float *> coefs)
+{
+    for (const float * coef : coefs)
+    {
+        params = std::copy(coef, coef + 3, params);
+    }
+}
+
+} // anon.
+
 static constexpr float LOG2_10 = ((float) 3.3219280948873623478703194294894);
 static constexpr float LOG10_2 = ((float) 0.3010299956639811952137388947245);
 
@@ -323,6 +421,43 @@ void LogOpCPU::updateData(ConstLogOpDataRcPtr & /* log */)
 {
 }
 
+void LogOpCPU::applyPlanar(const float * const * inPlanes,
+                           float * const * outPlanes,
+                           long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        OpCPU::applyPlanar(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    m_wide.applyPlanar(m_wideParams, inPlanes, outPlanes, numPixels);
+}
+
+bool LogOpCPU::applyWide(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        return false;
+    }
+
+    m_wide.apply(m_wideParams, (const float *)inImg, (float *)outImg, numPixels);
+
+    return true;
+}
+
+bool LogOpCPU::applyWideRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!m_wide.isValid())
+    {
+        return false;
+    }
+
+    m_wide.applyRGB(m_wideParams, inImg, outImg, numPixels);
+
+    return true;
+}
+
 
 L2LBaseRenderer::L2LBaseRenderer(ConstLogOpDataRcPtr & log)
     : LogOpCPU(log)
@@ -388,46 +523,63 @@ inline void ApplyExp2(float * pix)
     pix[2] = exp2(pix[2]);
 }
 
-void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void LogRenderer::process(const float * in, float * out, long numPixels) const
 {
     static constexpr float minValue = std::numeric_limits<float>::min();
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for (long idx = 0; idx<numPixels; ++idx)
     {
-        const float alphares = in[3];
-
         // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        std::memcpy(out, in, 4 * sizeof(float));
+        std::memcpy(out, in, NumChannels * sizeof(float));
 
         ApplyMax(out, minValue);
         ApplyLog2(out);
         ApplyScale(out, m_logScale);
 
-        out[3] = alphares;
-
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
+void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void LogRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 #if OCIO_USE_SSE2
 LogRendererSSE::LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale)
     : LogRenderer(log, logScale)
 {
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_wide = AVX2GetLogRenderer();
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_wide = AVX512GetLogRenderer();
+    }
+#endif
+
+    m_wideParams[0] = m_logScale;
 }
-void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void LogRendererSSE::process(const float * in, float * out, long numPixels) const
 {
     //
     // out = log2( max(in, minValue) ) * logScale;
     //
     static constexpr float minValue = std::numeric_limits<float>::min();
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 mm_minValue = _mm_set1_ps(minValue);
     const __m128 mm_logScale = _mm_set1_ps(m_logScale);
 
@@ -440,13 +592,26 @@ void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) co
         mm_pixel = sseLog2(mm_pixel);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_logScale);
 
-        const float alphares = in[3];
+        sseStorePixel<NumChannels>(out, mm_pixel, in);
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+        in  += NumChannels;
+        out += NumChannels;
+    }
+}
 
-        in  += 4;
-        out += 4;
+void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+
+void LogRendererSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
     }
 }
 #endif
@@ -459,35 +624,55 @@ AntiLogRenderer::AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base)
     LogOpCPU::updateData(log);
 }
 
-void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void AntiLogRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for (long idx = 0; idx<numPixels; ++idx)
     {
-        const float alphares = in[3];
-
         // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        std::memcpy(out, in, 4 * sizeof(float));
+        std::memcpy(out, in, NumChannels * sizeof(float));
 
         ApplyScale(out, m_log2_base);
         ApplyExp2(out);
 
-        out[3] = alphares;
-
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
+void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void AntiLogRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 #if OCIO_USE_SSE2
 AntiLogRendererSSE::AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base)
     : AntiLogRenderer(log, log2base)
 {
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_wide = AVX2GetAntiLogRenderer();
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_wide = AVX512GetAntiLogRenderer();
+    }
+#endif
+
+    m_wideParams[0] = m_log2_base;
 }
 
-void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void AntiLogRendererSSE::process(const float * in, float * out, long numPixels) const
 {
     //
     // out = pow(base, in);
@@ -497,9 +682,6 @@ void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     //   so that the constant factor log2(base) can be moved outside the loop.
     //
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 mm_log2_base = _mm_set1_ps(m_log2_base);
 
     __m128 mm_pixel;
@@ -509,13 +691,26 @@ void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
         mm_pixel = sseExp2(_mm_mul_ps(mm_pixel, mm_log2_base));
 
-        const float alphares = in[3];
+        sseStorePixel<NumChannels>(out, mm_pixel, in);
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+        in  += NumChannels;
+        out += NumChannels;
+    }
+}
 
-        in  += 4;
-        out += 4;
+void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+
+void AntiLogRendererSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
     }
 }
 #endif
@@ -546,17 +741,13 @@ void Log2LinRenderer::updateData(ConstLogOpDataRcPtr & log)
 }
 
 
-void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void Log2LinRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for (long idx = 0; idx<numPixels; ++idx)
     {
-        const float alphares = in[3];
-
         // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        std::memcpy(out, in, 4 * sizeof(float));
+        std::memcpy(out, in, NumChannels * sizeof(float));
 
         ApplyAdd(out, m_minuskb);
         ApplyScale(out, m_kinv);
@@ -564,21 +755,44 @@ void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) c
         ApplyAdd(out, m_minusb);
         ApplyScale(out, m_minv);
 
-        out[3] = alphares;
-
-        out += 4;
-        in  += 4;
+        out += NumChannels;
+        in  += NumChannels;
     }
 }
 
+void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void Log2LinRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 #if OCIO_USE_SSE2
 Log2LinRendererSSE::Log2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : Log2LinRenderer(log)
 {
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_wide = AVX2GetLog2LinRenderer();
+    }
+#endif
 
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_wide = AVX512GetLog2LinRenderer();
+    }
+#endif
+
+    CopyRGBCoefs(m_wideParams, { m_kinv, m_minuskb, m_minusb, m_minv });
 }
 
-void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void Log2LinRendererSSE::process(const float * in, float * out, long numPixels) const
 {
     //
     // out = ( pow( base, (in - logOffset) / logSlope ) - linOffset ) / linSlope;
@@ -590,9 +804,6 @@ void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     //   so that the constant factor log2(base) can be moved outside the loop.
     //
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 mm_kinv = _mm_set_ps(0.0f, m_kinv[2], m_kinv[1], m_kinv[0]);
     const __m128 mm_minuskb = _mm_set_ps(0.0f, m_minuskb[2], m_minuskb[1], m_minuskb[0]);
     const __m128 mm_minusb = _mm_set_ps(0.0f, m_minusb[2], m_minusb[1], m_minusb[0]);
@@ -609,13 +820,26 @@ void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_minv);
 
-        const float alphares = in[3];
+        sseStorePixel<NumChannels>(out, mm_pixel, in);
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+        out += NumChannels;
+        in  += NumChannels;
+    }
+}
 
-        out += 4;
-        in  += 4;
+void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+
+void Log2LinRendererSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
     }
 }
 #endif
@@ -645,19 +869,15 @@ void Lin2LogRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_kb[2] = (float)m_paramsB[LOG_SIDE_OFFSET];
 }
 
-void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void Lin2LogRenderer::process(const float * in, float * out, long numPixels) const
 {
     static constexpr float minValue = std::numeric_limits<float>::min();
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for (long idx = 0; idx<numPixels; ++idx)
     {
-        const float alphares = in[3];
-
         // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        std::memcpy(out, in, 4 * sizeof(float));
+        std::memcpy(out, in, NumChannels * sizeof(float));
 
         ApplyScale(out, m_m);
         ApplyAdd(out, m_b);
@@ -666,20 +886,44 @@ void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
         ApplyScale(out, m_klog);
         ApplyAdd(out, m_kb);
 
-        out[3] = alphares;
-
-        out += 4;
-        in  += 4;
+        out += NumChannels;
+        in  += NumChannels;
     }
 }
 
+void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void Lin2LogRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 #if OCIO_USE_SSE2
 Lin2LogRendererSSE::Lin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : Lin2LogRenderer(log)
 {
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_wide = AVX2GetLin2LogRenderer();
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_wide = AVX512GetLin2LogRenderer();
+    }
+#endif
+
+    CopyRGBCoefs(m_wideParams, { m_m, m_b, m_klog, m_kb });
 }
 
-void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void Lin2LogRendererSSE::process(const float * in, float * out, long numPixels) const
 {
     // out = ( logSlope * log( base, max( minValue, (in*linSlope + linOffset) ) ) + logOffset )
     //
@@ -687,9 +931,6 @@ void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     //
     static constexpr float minValue = std::numeric_limits<float>::min();
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 mm_minValue = _mm_set1_ps(minValue);
 
     const __m128 mm_m = _mm_set_ps(0.0f, m_m[2], m_m[1], m_m[0]);
@@ -709,13 +950,26 @@ void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
         mm_pixel = _mm_add_ps(mm_pixel, mm_kb);
 
-        const float alphares = in[3];
+        sseStorePixel<NumChannels>(out, mm_pixel, in);
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+        out += NumChannels;
+        in  += NumChannels;
+    }
+}
 
-        out += 4;
-        in  += 4;
+void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+
+void Lin2LogRendererSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
     }
 }
 #endif
@@ -771,15 +1025,11 @@ void CameraLog2LinRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_minuslino[2] = -m_linearOffset[2];
 }
 
-void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void CameraLog2LinRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for (long idx = 0; idx < numPixels; ++idx)
     {
-        const float alphares = in[3];
-
         for (int i = 0; i < 3; ++i)
         {
             if (in[i] < m_logSideBreak[i])
@@ -794,20 +1044,50 @@ void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPix
             }
         }
 
-        out[3] = alphares;
+        if (NumChannels == 4)
+        {
+            out[3] = in[3];
+        }
 
-        out += 4;
-        in += 4;
+        out += NumChannels;
+        in += NumChannels;
     }
 }
 
+void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void CameraLog2LinRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 #if OCIO_USE_SSE2
 CameraLog2LinRendererSSE::CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLog2LinRenderer(log)
 {
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_wide = AVX2GetCameraLog2LinRenderer();
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_wide = AVX512GetCameraLog2LinRenderer();
+    }
+#endif
+
+    CopyRGBCoefs(m_wideParams, { m_kinv, m_minuskb, m_minusb, m_minv,
+                                 m_logSideBreak, m_minuslino, m_linsinv });
 }
 
-void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void CameraLog2LinRendererSSE::process(const float * in, float * out, long numPixels) const
 {
     // if in <= logBreak
     //  out = ( in - linearOffset ) / linearSlope
@@ -817,9 +1097,6 @@ void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long num
     //  out = ( exp2( log2(base)/logSlope * (in - logOffset) ) - linOffset ) / linSlope;
     //
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 mm_kinv = _mm_set_ps(0.0f, m_kinv[2], m_kinv[1], m_kinv[0]);
     const __m128 mm_minuskb = _mm_set_ps(0.0f, m_minuskb[2], m_minuskb[1], m_minuskb[0]);
     const __m128 mm_minusb = _mm_set_ps(0.0f, m_minusb[2], m_minusb[1], m_minusb[0]);
@@ -848,13 +1125,26 @@ void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long num
         mm_pixel = _mm_or_ps(_mm_and_ps(flag, mm_pixel),
                              _mm_andnot_ps(flag, mm_pixel_lin));
 
-        const float alphares = in[3];
+        sseStorePixel<NumChannels>(out, mm_pixel, in);
+
+        out += NumChannels;
+        in += NumChannels;
+    }
+}
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
 
-        out += 4;
-        in += 4;
+void CameraLog2LinRendererSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
     }
 }
 #endif
@@ -886,17 +1176,13 @@ void CameraLin2LogRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_linb[2] = (float)m_paramsB[LIN_SIDE_BREAK];
 }
 
-void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void CameraLin2LogRenderer::process(const float * in, float * out, long numPixels) const
 {
     static constexpr float minValue = std::numeric_limits<float>::min();
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for (long idx = 0; idx<numPixels; ++idx)
     {
-        const float alphares = in[3];
-
         for (int i = 0; i < 3; ++i)
         {
             if (in[i] < m_linb[i])
@@ -912,20 +1198,50 @@ void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPix
             }
         }
 
-        out[3] = alphares;
+        if (NumChannels == 4)
+        {
+            out[3] = in[3];
+        }
 
-        out += 4;
-        in += 4;
+        out += NumChannels;
+        in += NumChannels;
     }
 }
 
+void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void CameraLin2LogRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 #if OCIO_USE_SSE2
 CameraLin2LogRendererSSE::CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLin2LogRenderer(log)
 {
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_wide = AVX2GetCameraLin2LogRenderer();
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_wide = AVX512GetCameraLin2LogRenderer();
+    }
+#endif
+
+    CopyRGBCoefs(m_wideParams, { m_m, m_b, m_klog, m_kb,
+                                 m_linearSlope, m_linearOffset, m_linb });
 }
 
-void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void CameraLin2LogRendererSSE::process(const float * in, float * out, long numPixels) const
 {
     // if in <= linBreak
     //  out = linearSlope * in + linearOffset 
@@ -936,9 +1252,6 @@ void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long num
     //
     static constexpr float minValue = std::numeric_limits<float>::min();
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 mm_minValue = _mm_set1_ps(minValue);
 
     const __m128 mm_m = _mm_set_ps(0.0f, m_m[2], m_m[1], m_m[0]);
@@ -970,13 +1283,26 @@ void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long num
         mm_pixel = _mm_or_ps(_mm_and_ps(flag, mm_pixel),
                              _mm_andnot_ps(flag, mm_pixel_lin));
 
-        const float alphares = in[3];
+        sseStorePixel<NumChannels>(out, mm_pixel, in);
+
+        out += NumChannels;
+        in += NumChannels;
+    }
+}
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!applyWide(inImg, outImg, numPixels))
+    {
+        process<4>((const float *)inImg, (float *)outImg, numPixels);
+    }
+}
 
-        out += 4;
-        in += 4;
+void CameraLin2LogRendererSSE::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    if (!applyWideRGB(inImg, outImg, numPixels))
+    {
+        process<3>(inImg, outImg, numPixels);
     }
 }
 #endif
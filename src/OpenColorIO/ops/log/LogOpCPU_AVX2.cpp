@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "LogOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+#include <limits>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// The RGB values of one renderer coefficient.
+struct RGBCoefs
+{
+    RGBCoefs(const float * params, int index)
+        : m_rgb{ _mm256_set1_ps(params[3 * index]),
+                 _mm256_set1_ps(params[3 * index + 1]),
+                 _mm256_set1_ps(params[3 * index + 2]) }
+    {
+    }
+
+    const __m256 & operator[](int c) const { return m_rgb[c]; }
+
+    __m256 m_rgb[3];
+};
+
+// Apply a per channel function to the RGB channels, the alpha channel is left unchanged.
+template<typename Func>
+inline void ApplyRGB(__m256 & r, __m256 & g, __m256 & b, Func func)
+{
+    r = func(r, 0);
+    g = func(g, 1);
+    b = func(b, 2);
+}
+
+struct LogKernel
+{
+    explicit LogKernel(const float * params)
+        : m_logScale(_mm256_set1_ps(params[0]))
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        // out = log2( max(in, minValue) ) * logScale
+
+        const __m256 minValue = _mm256_set1_ps(std::numeric_limits<float>::min());
+
+        ApplyRGB(r, g, b, [&](__m256 pixel, int /* c */)
+        {
+            return _mm256_mul_ps(avx2Log2(_mm256_max_ps(pixel, minValue)), m_logScale);
+        });
+    }
+
+    const __m256 m_logScale;
+};
+
+struct AntiLogKernel
+{
+    explicit AntiLogKernel(const float * params)
+        : m_log2_base(_mm256_set1_ps(params[0]))
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        // out = exp2( log2(base) * in )
+
+        ApplyRGB(r, g, b, [&](__m256 pixel, int /* c */)
+        {
+            return avx2Exp2(_mm256_mul_ps(pixel, m_log2_base));
+        });
+    }
+
+    const __m256 m_log2_base;
+};
+
+// out = log2( max( minValue, (in*linSlope + linOffset) ) ) * logSlope / log2(base) + logOffset
+struct Lin2Log
+{
+    explicit Lin2Log(const float * params)
+        : m_m(params, 0)
+        , m_b(params, 1)
+        , m_klog(params, 2)
+        , m_kb(params, 3)
+    {
+    }
+
+    inline __m256 apply(__m256 pixel, int c) const
+    {
+        const __m256 minValue = _mm256_set1_ps(std::numeric_limits<float>::min());
+
+        pixel = _mm256_add_ps(_mm256_mul_ps(pixel, m_m[c]), m_b[c]);
+        pixel = _mm256_max_ps(pixel, minValue);
+        return _mm256_add_ps(_mm256_mul_ps(avx2Log2(pixel), m_klog[c]), m_kb[c]);
+    }
+
+    const RGBCoefs m_m, m_b, m_klog, m_kb;
+};
+
+// out = ( exp2( log2(base)/logSlope * (in - logOffset) ) - linOffset ) / linSlope
+struct Log2Lin
+{
+    explicit Log2Lin(const float * params)
+        : m_kinv(params, 0)
+        , m_minuskb(params, 1)
+        , m_minusb(params, 2)
+        , m_minv(params, 3)
+    {
+    }
+
+    inline __m256 apply(__m256 pixel, int c) const
+    {
+        pixel = _mm256_mul_ps(_mm256_add_ps(pixel, m_minuskb[c]), m_kinv[c]);
+        pixel = avx2Exp2(pixel);
+        return _mm256_mul_ps(_mm256_add_ps(pixel, m_minusb[c]), m_minv[c]);
+    }
+
+    const RGBCoefs m_kinv, m_minuskb, m_minusb, m_minv;
+};
+
+template<typename Curve>
+struct CurveKernel
+{
+    explicit CurveKernel(const float * params)
+        : m_curve(params)
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        ApplyRGB(r, g, b, [&](__m256 pixel, int c) { return m_curve.apply(pixel, c); });
+    }
+
+    const Curve m_curve;
+};
+
+// if in <= linBreak
+//  out = linearSlope * in + linearOffset
+// else
+//  out = Lin2Log(in)
+struct CameraLin2LogKernel
+{
+    explicit CameraLin2LogKernel(const float * params)
+        : m_lin2Log(params)
+        , m_lins(params, 4)
+        , m_lino(params, 5)
+        , m_linb(params, 6)
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        ApplyRGB(r, g, b, [&](__m256 pixel, int c)
+        {
+            const __m256 flag = _mm256_cmp_ps(pixel, m_linb[c], _CMP_GT_OQ);
+            const __m256 pixel_lin = _mm256_add_ps(_mm256_mul_ps(pixel, m_lins[c]), m_lino[c]);
+
+            return _mm256_blendv_ps(pixel_lin, m_lin2Log.apply(pixel, c), flag);
+        });
+    }
+
+    const Lin2Log m_lin2Log;
+    const RGBCoefs m_lins, m_lino, m_linb;
+};
+
+// if in <= logBreak
+//  out = ( in - linearOffset ) / linearSlope
+// else
+//  out = Log2Lin(in)
+struct CameraLog2LinKernel
+{
+    explicit CameraLog2LinKernel(const float * params)
+        : m_log2Lin(params)
+        , m_logb(params, 4)
+        , m_minuslino(params, 5)
+        , m_linsinv(params, 6)
+    {
+    }
+
+    void operator()(__m256 & r, __m256 & g, __m256 & b, __m256 & /* a */) const
+    {
+        ApplyRGB(r, g, b, [&](__m256 pixel, int c)
+        {
+            const __m256 flag = _mm256_cmp_ps(pixel, m_logb[c], _CMP_GT_OQ);
+            const __m256 pixel_lin
+                = _mm256_mul_ps(_mm256_add_ps(pixel, m_minuslino[c]), m_linsinv[c]);
+
+            return _mm256_blendv_ps(pixel_lin, m_log2Lin.apply(pixel, c), flag);
+        });
+    }
+
+    const Log2Lin m_log2Lin;
+    const RGBCoefs m_logb, m_minuslino, m_linsinv;
+};
+
+} // anonymous namespace
+
+WideOpCPURenderer AVX2GetLogRenderer()
+{
+    return avx2GetKernelRenderer<LogKernel>();
+}
+
+WideOpCPURenderer AVX2GetAntiLogRenderer()
+{
+    return avx2GetKernelRenderer<AntiLogKernel>();
+}
+
+WideOpCPURenderer AVX2GetLin2LogRenderer()
+{
+    return avx2GetKernelRenderer<CurveKernel<Lin2Log>>();
+}
+
+WideOpCPURenderer AVX2GetLog2LinRenderer()
+{
+    return avx2GetKernelRenderer<CurveKernel<Log2Lin>>();
+}
+
+WideOpCPURenderer AVX2GetCameraLin2LogRenderer()
+{
+    return avx2GetKernelRenderer<CameraLin2LogKernel>();
+}
+
+WideOpCPURenderer AVX2GetCameraLog2LinRenderer()
+{
+    return avx2GetKernelRenderer<CameraLog2LinKernel>();
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "LogOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+#include <limits>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// The RGB values of one renderer coefficient.
+struct RGBCoefs
+{
+    RGBCoefs(const float * params, int index)
+        : m_rgb{ _mm512_set1_ps(params[3 * index]),
+                 _mm512_set1_ps(params[3 * index + 1]),
+                 _mm512_set1_ps(params[3 * index + 2]) }
+    {
+    }
+
+    const __m512 & operator[](int c) const { return m_rgb[c]; }
+
+    __m512 m_rgb[3];
+};
+
+// Apply a per channel function to the RGB channels, the alpha channel is left unchanged.
+template<typename Func>
+inline void ApplyRGB(__m512 & r, __m512 & g, __m512 & b, Func func)
+{
+    r = func(r, 0);
+    g = func(g, 1);
+    b = func(b, 2);
+}
+
+struct LogKernel
+{
+    explicit LogKernel(const float * params)
+        : m_logScale(_mm512_set1_ps(params[0]))
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        // out = log2( max(in, minValue) ) * logScale
+
+        const __m512 minValue = _mm512_set1_ps(std::numeric_limits<float>::min());
+
+        ApplyRGB(r, g, b, [&](__m512 pixel, int /* c */)
+        {
+            return _mm512_mul_ps(avx512Log2(_mm512_max_ps(pixel, minValue)), m_logScale);
+        });
+    }
+
+    const __m512 m_logScale;
+};
+
+struct AntiLogKernel
+{
+    explicit AntiLogKernel(const float * params)
+        : m_log2_base(_mm512_set1_ps(params[0]))
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        // out = exp2( log2(base) * in )
+
+        ApplyRGB(r, g, b, [&](__m512 pixel, int /* c */)
+        {
+            return avx512Exp2(_mm512_mul_ps(pixel, m_log2_base));
+        });
+    }
+
+    const __m512 m_log2_base;
+};
+
+// out = log2( max( minValue, (in*linSlope + linOffset) ) ) * logSlope / log2(base) + logOffset
+struct Lin2Log
+{
+    explicit Lin2Log(const float * params)
+        : m_m(params, 0)
+        , m_b(params, 1)
+        , m_klog(params, 2)
+        , m_kb(params, 3)
+    {
+    }
+
+    inline __m512 apply(__m512 pixel, int c) const
+    {
+        const __m512 minValue = _mm512_set1_ps(std::numeric_limits<float>::min());
+
+        pixel = _mm512_add_ps(_mm512_mul_ps(pixel, m_m[c]), m_b[c]);
+        pixel = _mm512_max_ps(pixel, minValue);
+        return _mm512_add_ps(_mm512_mul_ps(avx512Log2(pixel), m_klog[c]), m_kb[c]);
+    }
+
+    const RGBCoefs m_m, m_b, m_klog, m_kb;
+};
+
+// out = ( exp2( log2(base)/logSlope * (in - logOffset) ) - linOffset ) / linSlope
+struct Log2Lin
+{
+    explicit Log2Lin(const float * params)
+        : m_kinv(params, 0)
+        , m_minuskb(params, 1)
+        , m_minusb(params, 2)
+        , m_minv(params, 3)
+    {
+    }
+
+    inline __m512 apply(__m512 pixel, int c) const
+    {
+        pixel = _mm512_mul_ps(_mm512_add_ps(pixel, m_minuskb[c]), m_kinv[c]);
+        pixel = avx512Exp2(pixel);
+        return _mm512_mul_ps(_mm512_add_ps(pixel, m_minusb[c]), m_minv[c]);
+    }
+
+    const RGBCoefs m_kinv, m_minuskb, m_minusb, m_minv;
+};
+
+template<typename Curve>
+struct CurveKernel
+{
+    explicit CurveKernel(const float * params)
+        : m_curve(params)
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        ApplyRGB(r, g, b, [&](__m512 pixel, int c) { return m_curve.apply(pixel, c); });
+    }
+
+    const Curve m_curve;
+};
+
+// if in <= linBreak
+//  out = linearSlope * in + linearOffset
+// else
+//  out = Lin2Log(in)
+struct CameraLin2LogKernel
+{
+    explicit CameraLin2LogKernel(const float * params)
+        : m_lin2Log(params)
+        , m_lins(params, 4)
+        , m_lino(params, 5)
+        , m_linb(params, 6)
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        ApplyRGB(r, g, b, [&](__m512 pixel, int c)
+        {
+            const __mmask16 flag = _mm512_cmp_ps_mask(pixel, m_linb[c], _CMP_GT_OQ);
+            const __m512 pixel_lin = _mm512_add_ps(_mm512_mul_ps(pixel, m_lins[c]), m_lino[c]);
+
+            return _mm512_mask_mov_ps(pixel_lin, flag, m_lin2Log.apply(pixel, c));
+        });
+    }
+
+    const Lin2Log m_lin2Log;
+    const RGBCoefs m_lins, m_lino, m_linb;
+};
+
+// if in <= logBreak
+//  out = ( in - linearOffset ) / linearSlope
+// else
+//  out = Log2Lin(in)
+struct CameraLog2LinKernel
+{
+    explicit CameraLog2LinKernel(const float * params)
+        : m_log2Lin(params)
+        , m_logb(params, 4)
+        , m_minuslino(params, 5)
+        , m_linsinv(params, 6)
+    {
+    }
+
+    void operator()(__m512 & r, __m512 & g, __m512 & b, __m512 & /* a */) const
+    {
+        ApplyRGB(r, g, b, [&](__m512 pixel, int c)
+        {
+            const __mmask16 flag = _mm512_cmp_ps_mask(pixel, m_logb[c], _CMP_GT_OQ);
+            const __m512 pixel_lin
+                = _mm512_mul_ps(_mm512_add_ps(pixel, m_minuslino[c]), m_linsinv[c]);
+
+            return _mm512_mask_mov_ps(pixel_lin, flag, m_log2Lin.apply(pixel, c));
+        });
+    }
+
+    const Log2Lin m_log2Lin;
+    const RGBCoefs m_logb, m_minuslino, m_linsinv;
+};
+
+} // anonymous namespace
+
+WideOpCPURenderer AVX512GetLogRenderer()
+{
+    return avx512GetKernelRenderer<LogKernel>();
+}
+
+WideOpCPURenderer AVX512GetAntiLogRenderer()
+{
+    return avx512GetKernelRenderer<AntiLogKernel>();
+}
+
+WideOpCPURenderer AVX512GetLin2LogRenderer()
+{
+    return avx512GetKernelRenderer<CurveKernel<Lin2Log>>();
+}
+
+WideOpCPURenderer AVX512GetLog2LinRenderer()
+{
+    return avx512GetKernelRenderer<CurveKernel<Log2Lin>>();
+}
+
+WideOpCPURenderer AVX512GetCameraLin2LogRenderer()
+{
+    return avx512GetKernelRenderer<CameraLin2LogKernel>();
+}
+
+WideOpCPURenderer AVX512GetCameraLog2LinRenderer()
+{
+    return avx512GetKernelRenderer<CameraLog2LinKernel>();
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
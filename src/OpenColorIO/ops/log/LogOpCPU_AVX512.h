@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_LOGOP_CPU_AVX512_H
+#define INCLUDED_OCIO_LOGOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "WideOpCPU.h"
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+// Get the renderers applying the log operations to F32 pixels, sixteen pixels at a time (refer
+// to LogOpCPU.cpp for the formulas). The alpha channel is left unchanged. The parameters are:
+//   Log:           logScale
+//   AntiLog:       log2(base)
+//   Lin2Log:       the RGB values of m, b, klog and kb
+//   Log2Lin:       the RGB values of kinv, minuskb, minusb and minv
+//   CameraLin2Log: the RGB values of m, b, klog, kb, linearSlope, linearOffset and linb
+//   CameraLog2Lin: the RGB values of kinv, minuskb, minusb, minv, logSideBreak, minuslino
+//                  and linsinv
+WideOpCPURenderer AVX512GetLogRenderer();
+WideOpCPURenderer AVX512GetAntiLogRenderer();
+WideOpCPURenderer AVX512GetLin2LogRenderer();
+WideOpCPURenderer AVX512GetLog2LinRenderer();
+WideOpCPURenderer AVX512GetCameraLin2LogRenderer();
+WideOpCPURenderer AVX512GetCameraLog2LinRenderer();
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_LOGOP_CPU_AVX512_H */
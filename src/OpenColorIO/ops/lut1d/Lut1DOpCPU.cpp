@@ -135,6 +135,18 @@ public:
         : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth) {}
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasRGBSupport() const override { return inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32; }
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+    bool hasPlanarSupport() const override { return inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const void * inImg, void * outImg, long numPixels) const;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -150,6 +162,18 @@ public:
         : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth) {}
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasRGBSupport() const override { return inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32; }
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+    bool hasPlanarSupport() const override { return inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const void * inImg, void * outImg, long numPixels) const;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -162,6 +186,9 @@ public:
         :  Lut1DRenderer<inBD, outBD>(lut, BIT_DEPTH_F32) {} // HueAdjust needs float processing.
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasRGBSupport() const override { return false; }
+    bool hasPlanarSupport() const override { return false; }
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -174,6 +201,9 @@ public:
         : Lut1DRendererHalfCode<inBD, outBD>(lut, BIT_DEPTH_F32) {} // HueAdjust needs float processing.
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasRGBSupport() const override { return false; }
+    bool hasPlanarSupport() const override { return false; }
 };
 
 // Holds the parameters of a color component.
@@ -499,7 +529,8 @@ BaseLut1DRenderer<inBD, outBD>::~BaseLut1DRenderer()
 }
 
 template<BitDepth inBD, BitDepth outBD>
-void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void Lut1DRendererHalfCode<inBD, outBD>::process(const void * inImg, void * outImg, long numPixels) const
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -522,10 +553,13 @@ void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg
             out[0] = LookupLut<InType, OutType>::compute(lutR, in[0]);
             out[1] = LookupLut<InType, OutType>::compute(lutG, in[1]);
             out[2] = LookupLut<InType, OutType>::compute(lutB, in[2]);
-            out[3] = OutType(in[3] * this->m_alphaScaling);
+            if (NumChannels == 4)
+            {
+                out[3] = OutType(in[3] * this->m_alphaScaling);
+            }
 
-            in  += 4;
-            out += 4;
+            in  += NumChannels;
+            out += NumChannels;
         }
     }
     else  // Need to interpolate rather than simply lookup.
@@ -557,10 +591,62 @@ void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg
                               lutB[blueInterVals.valA],
                               1.0f-blueInterVals.fraction));
 
-            out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+            if (NumChannels == 4)
+            {
+                out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+            }
 
-            in  += 4;
-            out += 4;
+            in  += NumChannels;
+            out += NumChannels;
+        }
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>(inImg, outImg, numPixels);
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRendererHalfCode<inBD, outBD>::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRendererHalfCode<inBD, outBD>::applyPlanar(const float * const * inPlanes,
+                                                     float * const * outPlanes,
+                                                     long numPixels) const
+{
+    const float * luts[3] = { (const float *)this->m_tmpLutR,
+                              (const float *)this->m_tmpLutG,
+                              (const float *)this->m_tmpLutB };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * lut = luts[c];
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const IndexPair interVals = IndexPair::GetEdgeFloatValues(in[idx]);
+
+            // Since fraction is in the domain [0, 1), interpolate using
+            // 1-fraction in order to avoid cases like -/+Inf * 0.
+            out[idx] = lerpf(lut[interVals.valB], lut[interVals.valA], 1.0f - interVals.fraction);
+        }
+    }
+
+    if (inPlanes[3])
+    {
+        const float * in = inPlanes[3];
+        float * out = outPlanes[3];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = in[idx] * this->m_alphaScaling;
         }
     }
 }
@@ -620,7 +706,8 @@ IndexPair IndexPair::GetEdgeFloatValues(float fIn)
 }
 
 template<BitDepth inBD, BitDepth outBD>
-void Lut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void Lut1DRenderer<inBD, outBD>::process(const void * inImg, void * outImg, long numPixels) const
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -643,10 +730,13 @@ void Lut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, long n
             out[0] = LookupLut<InType, OutType>::compute(lutR, in[0]);
             out[1] = LookupLut<InType, OutType>::compute(lutG, in[1]);
             out[2] = LookupLut<InType, OutType>::compute(lutB, in[2]);
-            out[3] = OutType(in[3] * this->m_alphaScaling);
+            if (NumChannels == 4)
+            {
+                out[3] = OutType(in[3] * this->m_alphaScaling);
+            }
 
-            in  += 4;
-            out += 4;
+            in  += NumChannels;
+            out += NumChannels;
         }
     }
     else if (this->m_applyLutFunc && numPixels > 1)
@@ -654,7 +744,42 @@ void Lut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, long n
         const float * lutR = (const float *)this->m_tmpLutR;
         const float * lutG = (const float *)this->m_tmpLutG;
         const float * lutB = (const float *)this->m_tmpLutB;
-        this->m_applyLutFunc(lutR, lutG, lutB, this->m_dim, inImg, outImg, numPixels);
+        if (NumChannels == 4)
+        {
+            this->m_applyLutFunc(lutR, lutG, lutB, this->m_dim, inImg, outImg, numPixels);
+        }
+        else
+        {
+            // The SIMD kernels only process RGBA pixels so the RGB pixels are processed by
+            // small chunks staying in the L1 cache.
+            constexpr long ChunkSize = 64;
+            float buf[4 * ChunkSize];
+
+            for (long idx = 0; idx < numPixels; idx += ChunkSize)
+            {
+                const long n = std::min(ChunkSize, numPixels - idx);
+
+                for (long i = 0; i < n; ++i)
+                {
+                    buf[4 * i + 0] = in[3 * i + 0];
+                    buf[4 * i + 1] = in[3 * i + 1];
+                    buf[4 * i + 2] = in[3 * i + 2];
+                    buf[4 * i + 3] = 0.0f;
+                }
+
+                this->m_applyLutFunc(lutR, lutG, lutB, this->m_dim, buf, buf, n);
+
+                for (long i = 0; i < n; ++i)
+                {
+                    out[3 * i + 0] = buf[4 * i + 0];
+                    out[3 * i + 1] = buf[4 * i + 1];
+                    out[3 * i + 2] = buf[4 * i + 2];
+                }
+
+                in  += 3 * n;
+                out += 3 * n;
+            }
+        }
     }
     else  // Need to interpolate rather than simply lookup.
     {
@@ -712,10 +837,103 @@ void Lut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, long n
                         lerpf(lutB[(unsigned int)highIdx[2]], 
                               lutB[(unsigned int)lowIdx[2]],
                               delta[2]));
-            out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+            if (NumChannels == 4)
+            {
+                out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+            }
 
-            in  += 4;
-            out += 4;
+            in  += NumChannels;
+            out += NumChannels;
+        }
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>(inImg, outImg, numPixels);
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRenderer<inBD, outBD>::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRenderer<inBD, outBD>::applyPlanar(const float * const * inPlanes,
+                                             float * const * outPlanes,
+                                             long numPixels) const
+{
+    const float * luts[3] = { (const float *)this->m_tmpLutR,
+                              (const float *)this->m_tmpLutG,
+                              (const float *)this->m_tmpLutB };
+
+    if (this->m_applyLutFunc && numPixels > 1)
+    {
+        // The SIMD kernels only process RGBA pixels so the planes are processed by small
+        // chunks staying in the L1 cache.
+        constexpr long ChunkSize = 64;
+        float buf[4 * ChunkSize];
+
+        for (long idx = 0; idx < numPixels; idx += ChunkSize)
+        {
+            const long n = std::min(ChunkSize, numPixels - idx);
+
+            for (long i = 0; i < n; ++i)
+            {
+                buf[4 * i + 0] = inPlanes[0][idx + i];
+                buf[4 * i + 1] = inPlanes[1][idx + i];
+                buf[4 * i + 2] = inPlanes[2][idx + i];
+                buf[4 * i + 3] = inPlanes[3] ? inPlanes[3][idx + i] : 0.0f;
+            }
+
+            this->m_applyLutFunc(luts[0], luts[1], luts[2], this->m_dim, buf, buf, n);
+
+            for (long i = 0; i < n; ++i)
+            {
+                outPlanes[0][idx + i] = buf[4 * i + 0];
+                outPlanes[1][idx + i] = buf[4 * i + 1];
+                outPlanes[2][idx + i] = buf[4 * i + 2];
+                if (outPlanes[3])
+                {
+                    outPlanes[3][idx + i] = buf[4 * i + 3];
+                }
+            }
+        }
+
+        return;
+    }
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * lut = luts[c];
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long i = 0; i < numPixels; ++i)
+        {
+            // NaNs become 0
+            const float idx = std::min(std::max(0.f, this->m_step * in[i]), this->m_dimMinusOne);
+
+            const unsigned int lowIdx  = static_cast<unsigned int>(std::floor(idx));
+            const unsigned int highIdx = static_cast<unsigned int>(std::ceil(idx));
+
+            // See process() for the interpolation details.
+            const float delta = (float)highIdx - idx;
+
+            out[i] = lerpf(lut[highIdx], lut[lowIdx], delta);
+        }
+    }
+
+    if (inPlanes[3])
+    {
+        const float * in = inPlanes[3];
+        float * out = outPlanes[3];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = in[idx] * this->m_alphaScaling;
         }
     }
 }
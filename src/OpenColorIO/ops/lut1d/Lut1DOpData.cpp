@@ -629,17 +629,14 @@ std::string Lut1DOpData::getCacheID() const
 {
     AutoMutex lock(m_mutex);
 
-    const Lut3by1DArray::Values & values = getArray().getValues();
-
     std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
         cacheIDStream << getID() << " ";
     }
 
-    cacheIDStream << CacheIDHash(reinterpret_cast<const char*>(&values[0]), 
-                                 values.size() * sizeof(values[0]))
-                  << " ";
+    // The hash of the LUT values is only computed once.
+    cacheIDStream << getArray().getValuesHash() << " ";
 
     cacheIDStream << TransformDirectionToString(m_direction)                   << " ";
     cacheIDStream << InterpolationToString(m_interpolation)                    << " ";
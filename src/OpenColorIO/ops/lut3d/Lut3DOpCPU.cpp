@@ -2,7 +2,10 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <map>
 #include <math.h>
+#include <memory>
+#include <sstream>
 #include <stdint.h>
 #include <vector>
 
@@ -10,6 +13,7 @@
 
 #include "BitDepthUtils.h"
 #include "MathUtils.h"
+#include "Mutex.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/OpTools.h"
 #include "Platform.h"
@@ -27,6 +31,8 @@ namespace
 
 typedef void (apply_lut_func)(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
 
+typedef std::shared_ptr<const float> OptLutRcPtr;
+
 class BaseLut3DRenderer : public OpCPU
 {
 public:
@@ -36,15 +42,12 @@ public:
 protected:
     void updateData(ConstLut3DOpDataRcPtr & lut);
 
-    // Creates a LUT aligned to a 16 byte boundary with RGB and 0 for alpha
-    // in order to be able to load the LUT using _mm_load_ps.
-    float* createOptLut(const Array::Values& lut) const;
-
 protected:
     // Keep all these values because they are invariant during the
     // processing. So to slim the processing code, these variables
     // are computed in the constructor.
-    float*         m_optLut;
+    OptLutRcPtr    m_optLutHolder;
+    const float*   m_optLut;
     unsigned long  m_dim;
     float          m_step;
     int            m_components;
@@ -62,7 +65,14 @@ public:
     explicit Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut);
     virtual ~Lut3DTetrahedralRenderer();
 
-    void apply(const void * inImg, void * outImg, long numPixels) const;
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasRGBSupport() const override { return true; }
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 class Lut3DRenderer : public BaseLut3DRenderer
@@ -71,8 +81,14 @@ public:
     explicit Lut3DRenderer(ConstLut3DOpDataRcPtr & lut);
     virtual ~Lut3DRenderer();
 
-    void apply(const void * inImg, void * outImg, long numPixels) const;
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasRGBSupport() const override { return true; }
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 class InvLut3DRenderer : public OpCPU
@@ -246,7 +262,7 @@ inline __m128i GetLut3DIndices(const __m128i &idxR,
     return _mm_slli_epi32(r, 2);
 }
 
-inline void LookupNearest4(float* optLut,
+inline void LookupNearest4(const float* optLut,
                            const __m128i &rIndices,
                            const __m128i &gIndices,
                            const __m128i &bIndices,
@@ -266,7 +282,7 @@ inline void LookupNearest4(float* optLut,
 #else
 
 // Linear
-inline void lerp_rgb(float* out, float* a, float* b, float* z)
+inline void lerp_rgb(float* out, const float* a, const float* b, const float* z)
 {
     out[0] = (b[0] - a[0]) * z[0] + a[0];
     out[1] = (b[1] - a[1]) * z[1] + a[1];
@@ -274,8 +290,8 @@ inline void lerp_rgb(float* out, float* a, float* b, float* z)
 }
 
 // Bilinear
-inline void lerp_rgb(float* out, float* a, float* b, float* c,
-                     float* d, float* y, float* z)
+inline void lerp_rgb(float* out, const float* a, const float* b, const float* c,
+                     const float* d, const float* y, const float* z)
 {
     float v1[3];
     float v2[3];
@@ -286,9 +302,9 @@ inline void lerp_rgb(float* out, float* a, float* b, float* c,
 }
 
 // Trilinear
-inline void lerp_rgb(float* out, float* a, float* b, float* c, float* d,
-                     float* e, float* f, float* g, float* h,
-                     float* x, float* y, float* z)
+inline void lerp_rgb(float* out, const float* a, const float* b, const float* c, const float* d,
+                     const float* e, const float* f, const float* g, const float* h,
+                     const float* x, const float* y, const float* z)
 {
     float v1[3];
     float v2[3];
@@ -304,51 +320,15 @@ inline int GetLut3DIndexBlueFast(int indexR, int indexG, int indexB, long dim, i
     return components * (indexB + (int)dim * (indexG + (int)dim * indexR));
 }
 
-BaseLut3DRenderer::BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
-    : OpCPU()
-    , m_optLut(0x0)
-    , m_dim(0)
-    , m_step(0.0f)
-    , m_components(0)
-    , m_applyLutFunc(nullptr)
-{
-    updateData(lut);
-}
-
-BaseLut3DRenderer::~BaseLut3DRenderer()
-{
-#if OCIO_USE_SSE2
-    Platform::AlignedFree(m_optLut);
-#else
-    free(m_optLut);
-#endif
-}
-
-void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
-{
-    m_dim = lut->getArray().getLength();
-
-    m_step = ((float)m_dim - 1.0f);
-
-#if OCIO_USE_SSE2
-    Platform::AlignedFree(m_optLut);
-    m_components = 4;
-#else
-    m_components = 3;
-    free(m_optLut);
-#endif
-    m_optLut = createOptLut(lut->getArray().getValues());
-}
-
 #if OCIO_USE_SSE2
 // Creates a LUT aligned to a 16 byte boundary with RGB and 0 for alpha
 // in order to be able to load the LUT using _mm_load_ps.
-float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
+OptLutRcPtr CreateOptLut(const Array::Values & lut, long dim, int components)
 {
-    const long maxEntries = m_dim * m_dim * m_dim;
+    const long maxEntries = dim * dim * dim;
 
     float *optLut =
-        (float*)Platform::AlignedMalloc(maxEntries * m_components * sizeof(float), 16);
+        (float*)Platform::AlignedMalloc(maxEntries * components * sizeof(float), 16);
 
     float* currentValue = optLut;
     for (long idx = 0; idx<maxEntries; idx++)
@@ -360,15 +340,15 @@ float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
         currentValue += 4;
     }
 
-    return optLut;
+    return OptLutRcPtr(optLut, [](const float * ptr) { Platform::AlignedFree((void *)ptr); });
 }
 #else
-float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
+OptLutRcPtr CreateOptLut(const Array::Values & lut, long dim, int components)
 {
-    const long maxEntries = m_dim * m_dim * m_dim;
+    const long maxEntries = dim * dim * dim;
 
     float *optLut =
-        (float*)malloc(maxEntries * m_components * sizeof(float));
+        (float*)malloc(maxEntries * components * sizeof(float));
 
     float* currentValue = optLut;
     for (long idx = 0; idx<maxEntries; idx++)
@@ -379,9 +359,70 @@ float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
         currentValue += 3;
     }
 
+    return OptLutRcPtr(optLut, [](const float * ptr) { free((void *)ptr); });
+}
+#endif
+
+// The renderers of identical LUTs (e.g. the same LUT used by several processors)
+// share the same optimized LUT while one of them exists.
+OptLutRcPtr GetOptLut(ConstLut3DOpDataRcPtr & lut, int components)
+{
+    static Mutex optLutsMutex;
+    static std::map<std::string, std::weak_ptr<const float>> optLuts;
+
+    const long dim = lut->getArray().getLength();
+
+    std::ostringstream oss;
+    oss << lut->getValuesHash() << " " << dim << " " << components;
+    const std::string key = oss.str();
+
+    AutoMutex guard(optLutsMutex);
+
+    OptLutRcPtr optLut = optLuts[key].lock();
+    if (!optLut)
+    {
+        // Remove the LUTs no longer used by any renderer.
+        for (auto it = optLuts.begin(); it != optLuts.end();)
+        {
+            it = it->second.expired() ? optLuts.erase(it) : std::next(it);
+        }
+
+        optLut = CreateOptLut(lut->getArray().getValues(), dim, components);
+        optLuts[key] = optLut;
+    }
+
     return optLut;
 }
+
+BaseLut3DRenderer::BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
+    : OpCPU()
+    , m_optLut(nullptr)
+    , m_dim(0)
+    , m_step(0.0f)
+    , m_components(0)
+    , m_applyLutFunc(nullptr)
+{
+    updateData(lut);
+}
+
+BaseLut3DRenderer::~BaseLut3DRenderer()
+{
+}
+
+void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
+{
+    m_dim = lut->getArray().getLength();
+
+    m_step = ((float)m_dim - 1.0f);
+
+#if OCIO_USE_SSE2
+    m_components = 4;
+#else
+    m_components = 3;
 #endif
+    m_optLutHolder = GetOptLut(lut, m_components);
+    m_optLut = m_optLutHolder.get();
+}
 
 Lut3DTetrahedralRenderer::Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut)
     : BaseLut3DRenderer(lut)
@@ -419,14 +460,47 @@ Lut3DTetrahedralRenderer::~Lut3DTetrahedralRenderer()
 {
 }
 
-void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void Lut3DTetrahedralRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     if (m_applyLutFunc && numPixels > 1)
     {
-        m_applyLutFunc(m_optLut, m_dim, in, out, numPixels);
+        if (NumChannels == 4)
+        {
+            m_applyLutFunc(m_optLut, m_dim, in, out, numPixels);
+        }
+        else
+        {
+            // The tetrahedral SIMD kernels expect RGBA pixels, so expand the RGB pixels
+            // by chunks into a small buffer remaining in the L1 cache.
+            constexpr long ChunkSize = 64;
+            float buf[4 * ChunkSize];
+
+            for (long idx = 0; idx < numPixels; idx += ChunkSize)
+            {
+                const long n = std::min(ChunkSize, numPixels - idx);
+
+                for (long i = 0; i < n; ++i)
+                {
+                    buf[4 * i + 0] = in[3 * i + 0];
+                    buf[4 * i + 1] = in[3 * i + 1];
+                    buf[4 * i + 2] = in[3 * i + 2];
+                    buf[4 * i + 3] = 0.0f;
+                }
+
+                m_applyLutFunc(m_optLut, m_dim, buf, buf, (int)n);
+
+                for (long i = 0; i < n; ++i)
+                {
+                    out[3 * i + 0] = buf[4 * i + 0];
+                    out[3 * i + 1] = buf[4 * i + 1];
+                    out[3 * i + 2] = buf[4 * i + 2];
+                }
+
+                in  += 3 * n;
+                out += 3 * n;
+            }
+        }
     }
     else
     {
@@ -434,7 +508,7 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
 
         for (long i = 0; i < numPixels; ++i)
         {
-            float newAlpha = (float)in[3];
+            const float newAlpha = NumChannels == 4 ? in[3] : 0.0f;
 
             float idx[3];
             idx[0] = in[0] * m_step;
@@ -615,14 +689,27 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
                 }
             }
 
-            out[3] = newAlpha;
+            if (NumChannels == 4)
+            {
+                out[3] = newAlpha;
+            }
 
-            in  += 4;
-            out += 4;
+            in  += NumChannels;
+            out += NumChannels;
         }
     }
 }
 
+void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void Lut3DTetrahedralRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 Lut3DRenderer::Lut3DRenderer(ConstLut3DOpDataRcPtr & lut)
     : BaseLut3DRenderer(lut)
 {
@@ -632,11 +719,9 @@ Lut3DRenderer::~Lut3DRenderer()
 {
 }
 
-void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void Lut3DRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
 #if OCIO_USE_SSE2
 
     __m128 step = _mm_set1_ps(m_step);
@@ -647,9 +732,9 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
 
     for (long i = 0; i < numPixels; ++i)
     {
-        float newAlpha = (float)in[3];
+        const float newAlpha = NumChannels == 4 ? in[3] : 0.0f;
 
-        __m128 data = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        __m128 data = sseLoadPixel<NumChannels>(in);
 
         __m128 idx = _mm_mul_ps(data, step);
 
@@ -730,19 +815,22 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
         __m128 result = _mm_add_ps(_mm_mul_ps(green1, oneMinusWr),
             _mm_mul_ps(green2, wr));
 
-        _mm_storeu_ps(out, result);
+        sseStorePixel<NumChannels>(out, result);
 
-        out[3] = newAlpha;
+        if (NumChannels == 4)
+        {
+            out[3] = newAlpha;
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 #else
     const float dimMinusOne = float(m_dim) - 1.f;
 
     for (long i = 0; i < numPixels; ++i)
     {
-        float newAlpha = (float)in[3];
+        const float newAlpha = NumChannels == 4 ? in[3] : 0.0f;
 
         float idx[3];
         idx[0] = in[0] * m_step;
@@ -811,14 +899,27 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
                  &m_optLut[n110], &m_optLut[n111],
                  x, y, z);
 
-        out[3] = newAlpha;
+        if (NumChannels == 4)
+        {
+            out[3] = newAlpha;
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 #endif
 }
 
+void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void Lut3DRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
 // The inversion code is based on an algorithm in "Numerical Linear Algebra
 // and Optimization, vol. 1," by Gill, Murray, and Wright.
 
@@ -1720,14 +1821,14 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
                 }
             }
             level--;
-
-            // Need to subtract 1 since the indices include the extrapolation.
-            out[0] = Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
-            out[1] = Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
-            out[2] = Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
-            out[3] = in[3];
         }
 
+        // Need to subtract 1 since the indices include the extrapolation.
+        out[0] = Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
+        out[1] = Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
+        out[2] = Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
+        out[3] = in[3];
+
         in  += 4;
         out += 4;
     }
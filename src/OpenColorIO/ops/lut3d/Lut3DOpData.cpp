@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -27,7 +28,7 @@ namespace OCIO_NAMESPACE
 // forward 3D LUT are clamped to someplace on the exterior surface
 // of the 3D LUT.
 
-Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut)
+Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut, bool highRes)
 {
     if (lut->getDirection() != TRANSFORM_DIR_INVERSE)
     {
@@ -37,11 +38,21 @@ Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut)
     // TODO: The FastLut will limit inputs to [0,1].  If the forward LUT has an extended range
     // output, perhaps add a Range op before the FastLut to bring values into [0,1].
 
-    // Make a domain for the composed Lut3D.
+    // Make a domain for the composed Lut3D. Note that the composition uses the
+    // grid size of the inverse LUT when it is larger than the domain one.
     // TODO: Using a large number like 48 here is better for accuracy,
     // but it causes a delay when creating the renderer.
-    const long GridSize = 48u;
-    Lut3DOpDataRcPtr newDomain = std::make_shared<Lut3DOpData>(GridSize);
+    long gridSize = 48u;
+    if (highRes)
+    {
+        // The inverse is not linear in between the forward LUT entries so a finer
+        // grid is more accurate. The exact inversion is evaluated in parallel
+        // (refer to EvalTransform) to limit the delay.
+        const long lutGridSize = lut->getGridSize();
+        gridSize = std::min(std::max(gridSize, 2 * lutGridSize - 1),
+                            (long)Lut3DOpData::maxSupportedLength);
+    }
+    Lut3DOpDataRcPtr newDomain = std::make_shared<Lut3DOpData>(gridSize);
 
     newDomain->setFileOutputBitDepth(lut->getFileOutputBitDepth());
 
@@ -471,17 +482,14 @@ std::string Lut3DOpData::getCacheID() const
 {
     AutoMutex lock(m_mutex);
 
-    const Lut3DArray::Values & values = getArray().getValues();
-
     std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
         cacheIDStream << getID() << " ";
     }
 
-    cacheIDStream << CacheIDHash(reinterpret_cast<const char*>(&values[0]),
-                                 values.size() * sizeof(values[0]))
-                  << " ";
+    // The hash of the LUT values is only computed once.
+    cacheIDStream << getArray().getValuesHash() << " ";
 
     cacheIDStream << InterpolationToString(m_interpolation)  << " ";
     cacheIDStream << TransformDirectionToString(m_direction) << " ";
@@ -489,6 +497,12 @@ std::string Lut3DOpData::getCacheID() const
     return cacheIDStream.str();
 }
 
+std::string Lut3DOpData::getValuesHash() const
+{
+    AutoMutex lock(m_mutex);
+    return getArray().getValuesHash();
+}
+
 void Lut3DOpData::scale(float scale)
 {
     getArray().scale(scale);
@@ -85,6 +85,9 @@ public:
 
     std::string getCacheID() const override;
 
+    // Hash of the LUT values only.
+    std::string getValuesHash() const;
+
     inline BitDepth getFileOutputBitDepth() const { return m_fileOutBitDepth; }
     inline void setFileOutputBitDepth(BitDepth out) { m_fileOutBitDepth = out; }
 
@@ -140,9 +143,10 @@ private:
 bool operator==(const Lut3DOpData & lhs, const Lut3DOpData & rhs);
 
 // Make a forward Lut3DOpData that approximates the exact inverse Lut3DOpData
-// to be used for the fast rendering style.
+// to be used for the fast rendering style. The highRes argument requests a grid
+// twice as fine as the LUT one (up to the max supported length).
 // LUT has to be inverse or the function will throw.
-Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut);
+Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut, bool highRes = false);
 
 } // namespace OCIO_NAMESPACE
 
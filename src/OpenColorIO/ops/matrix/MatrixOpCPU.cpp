@@ -14,6 +14,96 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
+// Apply the matrix (and the offsets when not null) to planar pixels. The channels of four
+// consecutive pixels are processed at once, and the arithmetic order follows the one of the
+// packed pixel processing so both produce the same results.
+template<bool HasAlpha>
+void ProcessPlanarMatrix(const float * const * inPlanes,
+                         float * const * outPlanes,
+                         long numPixels,
+                         const float (&column1)[4],
+                         const float (&column2)[4],
+                         const float (&column3)[4],
+                         const float (&column4)[4],
+                         const float * offset)
+{
+    constexpr int NumChannels = HasAlpha ? 4 : 3;
+
+    const float * inR = inPlanes[0];
+    const float * inG = inPlanes[1];
+    const float * inB = inPlanes[2];
+    const float * inA = inPlanes[3];
+
+    long idx = 0;
+
+#if OCIO_USE_SSE2
+    __m128 m0[4], m1[4], m2[4], m3[4], o[4];
+    for (int c = 0; c < 4; ++c)
+    {
+        m0[c] = _mm_set1_ps(column1[c]);
+        m1[c] = _mm_set1_ps(column2[c]);
+        m2[c] = _mm_set1_ps(column3[c]);
+        m3[c] = _mm_set1_ps(column4[c]);
+        o[c]  = _mm_set1_ps(offset ? offset[c] : 0.0f);
+    }
+
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        const __m128 r = _mm_loadu_ps(inR + idx);
+        const __m128 g = _mm_loadu_ps(inG + idx);
+        const __m128 b = _mm_loadu_ps(inB + idx);
+        const __m128 a = HasAlpha ? _mm_loadu_ps(inA + idx) : _mm_setzero_ps();
+
+        __m128 img[4];
+        for (int c = 0; c < NumChannels; ++c)
+        {
+            const __m128 rg = _mm_add_ps(_mm_mul_ps(m0[c], r), _mm_mul_ps(m1[c], g));
+            img[c] = HasAlpha ? _mm_add_ps(rg, _mm_add_ps(_mm_mul_ps(m2[c], b),
+                                                          _mm_mul_ps(m3[c], a)))
+                              : _mm_add_ps(rg, _mm_mul_ps(m2[c], b));
+            if (offset)
+            {
+                img[c] = _mm_add_ps(img[c], o[c]);
+            }
+        }
+
+        for (int c = 0; c < NumChannels; ++c)
+        {
+            _mm_storeu_ps(outPlanes[c] + idx, img[c]);
+        }
+    }
+#endif
+
+    for (; idx < numPixels; ++idx)
+    {
+        const float r = inR[idx];
+        const float g = inG[idx];
+        const float b = inB[idx];
+        // The alpha is zero when processing images without alpha.
+        const float a = HasAlpha ? inA[idx] : 0.0f;
+
+        float img[4];
+        for (int c = 0; c < NumChannels; ++c)
+        {
+#if OCIO_USE_SSE2
+            img[c] = HasAlpha ? (r*column1[c] + g*column2[c]) + (b*column3[c] + a*column4[c])
+                              : (r*column1[c] + g*column2[c]) + b*column3[c];
+#else
+            img[c] = r*column1[c] + g*column2[c] + b*column3[c] + a*column4[c];
+#endif
+            if (offset)
+            {
+                img[c] += offset[c];
+            }
+        }
+
+        for (int c = 0; c < NumChannels; ++c)
+        {
+            outPlanes[c][idx] = img[c];
+        }
+    }
+}
+
 class ScaleRenderer : public OpCPU
 {
 public:
@@ -23,7 +113,18 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasRGBSupport() const override { return true; }
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+    bool hasPlanarSupport() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
+
     float m_scale[4];
 };
 
@@ -36,7 +137,18 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasRGBSupport() const override { return true; }
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+    bool hasPlanarSupport() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
+
     float m_scale[4];
     float m_offset[4];
 };
@@ -50,7 +162,17 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasRGBSupport() const override { return true; }
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+    bool hasPlanarSupport() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
     float m_column1[4];
     float m_column2[4];
@@ -69,7 +191,18 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasRGBSupport() const override { return true; }
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+
+    bool hasPlanarSupport() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
+
     float m_column1[4];
     float m_column2[4];
     float m_column3[4];
@@ -87,20 +220,49 @@ ScaleRenderer::ScaleRenderer(ConstMatrixOpDataRcPtr & mat)
     m_scale[3] = (float)m[15];
 }
 
-void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void ScaleRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for (long idx = 0; idx < numPixels; ++idx)
     {
         out[0] = in[0] * m_scale[0];
         out[1] = in[1] * m_scale[1];
         out[2] = in[2] * m_scale[2];
-        out[3] = in[3] * m_scale[3];
+        if (NumChannels == 4)
+        {
+            out[3] = in[3] * m_scale[3];
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
+    }
+}
+
+void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void ScaleRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+void ScaleRenderer::applyPlanar(const float * const * inPlanes,
+                                float * const * outPlanes,
+                                long numPixels) const
+{
+    const int numChannels = inPlanes[3] ? 4 : 3;
+    for (int c = 0; c < numChannels; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+        const float scale = m_scale[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = in[idx] * scale;
+        }
     }
 }
 
@@ -122,20 +284,50 @@ ScaleWithOffsetRenderer::ScaleWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     m_offset[3] = (float)o[3];
 }
 
-void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void ScaleWithOffsetRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for (long idx = 0; idx < numPixels; ++idx)
     {
         out[0] = in[0] * m_scale[0] + m_offset[0];
         out[1] = in[1] * m_scale[1] + m_offset[1];
         out[2] = in[2] * m_scale[2] + m_offset[2];
-        out[3] = in[3] * m_scale[3] + m_offset[3];
+        if (NumChannels == 4)
+        {
+            out[3] = in[3] * m_scale[3] + m_offset[3];
+        }
+
+        in  += NumChannels;
+        out += NumChannels;
+    }
+}
+
+void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
 
-        in  += 4;
-        out += 4;
+void ScaleWithOffsetRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+void ScaleWithOffsetRenderer::applyPlanar(const float * const * inPlanes,
+                                          float * const * outPlanes,
+                                          long numPixels) const
+{
+    const int numChannels = inPlanes[3] ? 4 : 3;
+    for (int c = 0; c < numChannels; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+        const float scale = m_scale[c];
+        const float offset = m_offset[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = in[idx] * scale + offset;
+        }
     }
 }
 
@@ -206,11 +398,9 @@ MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
 //      res1 = rm0 + gm1
 //      res2 = bm2 + am3
 //      image = res1 + res2
-void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void MatrixWithOffsetRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
 #if OCIO_USE_SSE2
     // Matrix decomposition per _column.
     __m128 m0 = _mm_set_ps(m_column1[3],
@@ -236,20 +426,37 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
         __m128 r = _mm_set1_ps(in[0]);
         __m128 g = _mm_set1_ps(in[1]);
         __m128 b = _mm_set1_ps(in[2]);
-        __m128 a = _mm_set1_ps(in[3]);
 
         __m128 rm0 = _mm_mul_ps(m0, r);
         __m128 gm1 = _mm_mul_ps(m1, g);
         __m128 bm2 = _mm_mul_ps(m2, b);
-        __m128 am3 = _mm_mul_ps(m3, a);
 
-        __m128 img = _mm_add_ps(_mm_add_ps(rm0, gm1), _mm_add_ps(bm2, am3));
+        __m128 img;
+        if (NumChannels == 4)
+        {
+            __m128 a = _mm_set1_ps(in[3]);
+            __m128 am3 = _mm_mul_ps(m3, a);
+
+            img = _mm_add_ps(_mm_add_ps(rm0, gm1), _mm_add_ps(bm2, am3));
+        }
+        else
+        {
+            // The alpha is zero when processing RGB pixels.
+            img = _mm_add_ps(_mm_add_ps(rm0, gm1), bm2);
+        }
         img = _mm_add_ps(img, o);
 
-        _mm_storeu_ps(out, img);
+        if (NumChannels == 4)
+        {
+            _mm_storeu_ps(out, img);
+        }
+        else
+        {
+            sseStoreRGB(out, img);
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 #else
     for (long idx = 0; idx < numPixels; ++idx)
@@ -257,7 +464,8 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
         const float r = in[0];
         const float g = in[1];
         const float b = in[2];
-        const float a = in[3];
+        // The alpha is zero when processing RGB pixels.
+        const float a = NumChannels == 4 ? in[3] : 0.0f;
 
         out[0] = r*m_column1[0]
                 + g*m_column2[0]
@@ -274,19 +482,48 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
                 + b*m_column3[2]
                 + a*m_column4[2]
                 + m_offset[2];
-        out[3] = r*m_column1[3]
-                + g*m_column2[3]
-                + b*m_column3[3]
-                + a*m_column4[3]
-                + m_offset[3];
-
-        in  += 4;
-        out += 4;
+        if (NumChannels == 4)
+        {
+            out[3] = r*m_column1[3]
+                    + g*m_column2[3]
+                    + b*m_column3[3]
+                    + a*m_column4[3]
+                    + m_offset[3];
+        }
+
+        in  += NumChannels;
+        out += NumChannels;
     }
 #endif
 
 }
 
+void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void MatrixWithOffsetRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+void MatrixWithOffsetRenderer::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    if (inPlanes[3])
+    {
+        ProcessPlanarMatrix<true>(inPlanes, outPlanes, numPixels,
+                                  m_column1, m_column2, m_column3, m_column4, m_offset);
+    }
+    else
+    {
+        ProcessPlanarMatrix<false>(inPlanes, outPlanes, numPixels,
+                                   m_column1, m_column2, m_column3, m_column4, m_offset);
+    }
+}
+
 MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -320,11 +557,9 @@ MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     m_column4[3] = (float)m[threeDim + 3];
 }
 
-void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void MatrixRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
 #if OCIO_USE_SSE2
     // Matrix decomposition per _column.
     __m128 m0 = _mm_set_ps(m_column1[3],
@@ -349,19 +584,36 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
         __m128 r = _mm_set1_ps(in[0]);
         __m128 g = _mm_set1_ps(in[1]);
         __m128 b = _mm_set1_ps(in[2]);
-        __m128 a = _mm_set1_ps(in[3]);
 
         __m128 rm0 = _mm_mul_ps(m0, r);
         __m128 gm1 = _mm_mul_ps(m1, g);
         __m128 bm2 = _mm_mul_ps(m2, b);
-        __m128 am3 = _mm_mul_ps(m3, a);
 
-        __m128 img = _mm_add_ps(_mm_add_ps(rm0, gm1), _mm_add_ps(bm2, am3));
+        __m128 img;
+        if (NumChannels == 4)
+        {
+            __m128 a = _mm_set1_ps(in[3]);
+            __m128 am3 = _mm_mul_ps(m3, a);
+
+            img = _mm_add_ps(_mm_add_ps(rm0, gm1), _mm_add_ps(bm2, am3));
+        }
+        else
+        {
+            // The alpha is zero when processing RGB pixels.
+            img = _mm_add_ps(_mm_add_ps(rm0, gm1), bm2);
+        }
 
-        _mm_storeu_ps(out, img);
+        if (NumChannels == 4)
+        {
+            _mm_storeu_ps(out, img);
+        }
+        else
+        {
+            sseStoreRGB(out, img);
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 #else
     for (long idx = 0; idx < numPixels; ++idx)
@@ -369,7 +621,8 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
         const float r = in[0];
         const float g = in[1];
         const float b = in[2];
-        const float a = in[3];
+        // The alpha is zero when processing RGB pixels.
+        const float a = NumChannels == 4 ? in[3] : 0.0f;
 
         out[0] = r*m_column1[0]
                + g*m_column2[0]
@@ -383,18 +636,47 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
                + g*m_column2[2]
                + b*m_column3[2]
                + a*m_column4[2];
-        out[3] = r*m_column1[3]
-               + g*m_column2[3]
-               + b*m_column3[3]
-               + a*m_column4[3];
+        if (NumChannels == 4)
+        {
+            out[3] = r*m_column1[3]
+                   + g*m_column2[3]
+                   + b*m_column3[3]
+                   + a*m_column4[3];
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 
 #endif
 }
 
+void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void MatrixRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+void MatrixRenderer::applyPlanar(const float * const * inPlanes,
+                                 float * const * outPlanes,
+                                 long numPixels) const
+{
+    if (inPlanes[3])
+    {
+        ProcessPlanarMatrix<true>(inPlanes, outPlanes, numPixels,
+                                  m_column1, m_column2, m_column3, m_column4, nullptr);
+    }
+    else
+    {
+        ProcessPlanarMatrix<false>(inPlanes, outPlanes, numPixels,
+                                   m_column1, m_column2, m_column3, m_column4, nullptr);
+    }
+}
+
 }
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
@@ -19,7 +19,15 @@ public:
 
     RangeOpCPU(ConstRangeOpDataRcPtr & range);
 
+    bool hasRGBSupport() const override { return true; }
+    bool hasPlanarSupport() const override { return true; }
+
 protected:
+    // The alpha is not modified by the range.
+    static void copyPlanarAlpha(const float * const * inPlanes,
+                                float * const * outPlanes,
+                                long numPixels);
+
     float m_scale;
     float m_offset;
     float m_lowerBound;
@@ -35,6 +43,14 @@ public:
     RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 class RangeMinMaxRenderer : public RangeOpCPU
@@ -43,6 +59,14 @@ public:
     RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 class RangeMinRenderer : public RangeOpCPU
@@ -51,6 +75,14 @@ public:
     RangeMinRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 class RangeMaxRenderer : public RangeOpCPU
@@ -59,6 +91,14 @@ public:
     RangeMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 
@@ -75,16 +115,24 @@ RangeOpCPU::RangeOpCPU(ConstRangeOpDataRcPtr & range)
     m_upperBound = (float)range->getMaxOutValue();
 }
 
+void RangeOpCPU::copyPlanarAlpha(const float * const * inPlanes,
+                                 float * const * outPlanes,
+                                 long numPixels)
+{
+    if (inPlanes[3] && inPlanes[3] != outPlanes[3])
+    {
+        std::copy(inPlanes[3], inPlanes[3] + numPixels, outPlanes[3]);
+    }
+}
+
 RangeScaleMinMaxRenderer::RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
 }
 
-void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void RangeScaleMinMaxRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         const float t[3] = { in[0] * m_scale + m_offset,
@@ -95,11 +143,43 @@ void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long num
         out[0] = Clamp(t[0], m_lowerBound, m_upperBound);
         out[1] = Clamp(t[1], m_lowerBound, m_upperBound);
         out[2] = Clamp(t[2], m_lowerBound, m_upperBound);
-        out[3] = in[3];
+        if (NumChannels == 4)
+        {
+            out[3] = in[3];
+        }
+
+        in  += NumChannels;
+        out += NumChannels;
+    }
+}
+
+void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void RangeScaleMinMaxRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
 
-        in  += 4;
-        out += 4;
+void RangeScaleMinMaxRenderer::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        // NaNs become m_lowerBound.
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = Clamp(in[idx] * m_scale + m_offset, m_lowerBound, m_upperBound);
+        }
     }
+
+    copyPlanarAlpha(inPlanes, outPlanes, numPixels);
 }
 
 RangeMinMaxRenderer::RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range)
@@ -107,68 +187,158 @@ RangeMinMaxRenderer::RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range)
 {
 }
 
-void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void RangeMinMaxRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         // NaNs become m_lowerBound.
         out[0] = Clamp(in[0], m_lowerBound, m_upperBound);
         out[1] = Clamp(in[1], m_lowerBound, m_upperBound);
         out[2] = Clamp(in[2], m_lowerBound, m_upperBound);
-        out[3] = in[3];
+        if (NumChannels == 4)
+        {
+            out[3] = in[3];
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
+void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void RangeMinMaxRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+void RangeMinMaxRenderer::applyPlanar(const float * const * inPlanes,
+                                      float * const * outPlanes,
+                                      long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        // NaNs become m_lowerBound.
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = Clamp(in[idx], m_lowerBound, m_upperBound);
+        }
+    }
+
+    copyPlanarAlpha(inPlanes, outPlanes, numPixels);
+}
+
 RangeMinRenderer::RangeMinRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
 }
 
-void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void RangeMinRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         // NaNs become m_lowerBound.
         out[0] = std::max(m_lowerBound, in[0]);
         out[1] = std::max(m_lowerBound, in[1]);
         out[2] = std::max(m_lowerBound, in[2]);
-        out[3] = in[3];
+        if (NumChannels == 4)
+        {
+            out[3] = in[3];
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
+void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void RangeMinRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
+
+void RangeMinRenderer::applyPlanar(const float * const * inPlanes,
+                                   float * const * outPlanes,
+                                   long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        // NaNs become m_lowerBound.
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = std::max(m_lowerBound, in[idx]);
+        }
+    }
+
+    copyPlanarAlpha(inPlanes, outPlanes, numPixels);
+}
+
 RangeMaxRenderer::RangeMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
 }
 
-void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<int NumChannels>
+void RangeMaxRenderer::process(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         // NaNs become m_upperBound.
         out[0] = std::min(m_upperBound, in[0]);
         out[1] = std::min(m_upperBound, in[1]);
         out[2] = std::min(m_upperBound, in[2]);
-        out[3] = in[3];
+        if (NumChannels == 4)
+        {
+            out[3] = in[3];
+        }
+
+        in  += NumChannels;
+        out += NumChannels;
+    }
+}
+
+void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void RangeMaxRenderer::applyRGB(const float * inImg, float * outImg, long numPixels) const
+{
+    process<3>(inImg, outImg, numPixels);
+}
 
-        in  += 4;
-        out += 4;
+void RangeMaxRenderer::applyPlanar(const float * const * inPlanes,
+                                   float * const * outPlanes,
+                                   long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        // NaNs become m_upperBound.
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = std::min(m_upperBound, in[idx]);
+        }
     }
+
+    copyPlanarAlpha(inPlanes, outPlanes, numPixels);
 }
 
 
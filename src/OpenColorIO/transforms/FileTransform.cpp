@@ -4,8 +4,10 @@
 #include <algorithm>
 #include <fstream>
 #include <map>
+#include <set>
 #include <sstream>
 #include <string.h>
+#include <vector>
 #include <iostream>
 #include <iterator>
 
@@ -15,11 +17,13 @@
 
 #include "Caching.h"
 #include "FileTransform.h"
+#include "FileTransformDiskCache.h"
 #include "Logging.h"
 #include "Mutex.h"
 #include "OCIOZArchive.h"
 #include "ops/noop/NoOps.h"
 #include "PathUtils.h"
+#include "ParseUtils.h"
 #include "Platform.h"
 #include "utils/StringUtils.h"
 
@@ -553,6 +557,8 @@ bool FormatRegistry::isFormatExtensionSupported(const char * extension) const
 
 ///////////////////////////////////////////////////////////////////////////
 
+constexpr size_t FileFormat::PROBE_SIZE;
+
 FileFormat::~FileFormat()
 {
 
@@ -592,13 +598,49 @@ void FileFormat::write(const ConstConfigRcPtr & /*config*/,
 namespace
 {
 
+// Read the whole file content in memory, so that all the candidate formats are probed and
+// parsed from a single read of the file.
+void ReadLutData(std::vector<char> & buffer, const Config & config, const std::string & filepath)
+{
+    std::unique_ptr<std::istream> pStream = getLutData(config, filepath, std::ios_base::binary);
+
+    if (!pStream || !pStream->good())
+    {
+        std::ostringstream os;
+        os << "The specified FileTransform srcfile, '";
+        os << filepath << "', could not be opened. ";
+        os << "Please confirm the file exists with ";
+        os << "appropriate read permissions.";
+        throw Exception(os.str().c_str());
+    }
+
+    pStream->seekg(0, std::ios_base::end);
+    const std::streamoff size = pStream->tellg();
+    pStream->seekg(0, std::ios_base::beg);
+
+    if (size > 0 && pStream->good())
+    {
+        buffer.resize(static_cast<size_t>(size));
+        pStream->read(buffer.data(), size);
+        buffer.resize(static_cast<size_t>(pStream->gcount()));
+    }
+    else
+    {
+        // Not seekable, read it in chunks.
+        pStream->clear();
+        buffer.assign(std::istreambuf_iterator<char>(*pStream), std::istreambuf_iterator<char>());
+    }
+}
+
 void LoadFileUncached(FileFormat * & returnFormat,
                       CachedFileRcPtr & returnCachedFile,
+                      size_t & returnSize,
                       const std::string & filepath,
                       Interpolation interp,
                       const Config& config)
 {
     returnFormat = NULL;
+    returnSize = 0;
 
     {
         std::ostringstream oss;
@@ -607,6 +649,15 @@ void LoadFileUncached(FileFormat * & returnFormat,
         LogDebug(oss.str());
     }
 
+    std::vector<char> buffer;
+    ReadLutData(buffer, config, filepath);
+
+    const size_t probeSize = std::min(buffer.size(), FileFormat::PROBE_SIZE);
+    auto probe = [&buffer, probeSize](const FileFormat * format)
+    {
+        return format->probe(buffer.data(), probeSize);
+    };
+
     // Try the initial format.
     std::string primaryErrorText("\n"); // Add a separator for the first reader error.
 
@@ -619,32 +670,30 @@ void LoadFileUncached(FileFormat * & returnFormat,
 
     FileFormatVector possibleFormats;
     formatRegistry.getFileFormatForExtension(extension, possibleFormats);
-    FileFormatVector::const_iterator endFormat = possibleFormats.end();
-    FileFormatVector::const_iterator itFormat = possibleFormats.begin();
-    while(itFormat != endFormat)
+
+    // All the formats of the extension are tried (so that all their errors are reported)
+    // but the ones recognizing the content go first e.g. a Resolve .cube file is not
+    // parsed by the Iridas .cube reader beforehand.
+    FileFormatVector primaryFormats(possibleFormats);
     {
+        std::map<const FileFormat *, FileFormat::ProbeResult> results;
+        for (const FileFormat * format : primaryFormats)
+        {
+            results[format] = probe(format);
+        }
+        std::stable_sort(primaryFormats.begin(), primaryFormats.end(),
+                         [&results](const FileFormat * a, const FileFormat * b)
+                         {
+                             return results[a] > results[b];
+                         });
+    }
 
-        FileFormat * tryFormat = *itFormat;
-        std::unique_ptr<std::istream> pStream = nullptr;
+    for (FileFormat * tryFormat : primaryFormats)
+    {
         try
         {
-            pStream = getLutData(
-                config,
-                filepath, 
-                tryFormat->isBinary() ? std::ios_base::binary : std::ios_base::in 
-            );
-            
-            if (!pStream || !pStream->good())
-            {
-                std::ostringstream os;
-                os << "The specified FileTransform srcfile, '";
-                os << filepath << "', could not be opened. ";
-                os << "Please confirm the file exists with ";
-                os << "appropriate read permissions.";
-                throw Exception(os.str().c_str());
-            }
-
-            CachedFileRcPtr cachedFile = tryFormat->read(*pStream, filepath, interp);
+            MemoryIStream stream(buffer.data(), buffer.size());
+            CachedFileRcPtr cachedFile = tryFormat->read(stream, filepath, interp);
 
             if(IsDebugLoggingEnabled())
             {
@@ -656,6 +705,7 @@ void LoadFileUncached(FileFormat * & returnFormat,
 
             returnFormat = tryFormat;
             returnCachedFile = cachedFile;
+            returnSize = buffer.size();
 
             return;
         }
@@ -675,46 +725,54 @@ void LoadFileUncached(FileFormat * & returnFormat,
                 LogDebug(os.str());
             }
         }
-        ++itFormat;
     }
 
-    // If this fails, try all other formats
-    CachedFileRcPtr cachedFile;
-    FileFormat * altFormat = NULL;
+    // If this fails, try all other formats which could read the content, the ones
+    // recognizing it first.
+    FileFormatVector altFormats;
+    size_t numRecognized = 0;
 
     for(int findex = 0;
         findex<formatRegistry.getNumRawFormats();
         ++findex)
     {
-        altFormat = formatRegistry.getRawFormatByIndex(findex);
+        FileFormat * altFormat = formatRegistry.getRawFormatByIndex(findex);
 
         // Do not try primary formats twice.
-        FileFormatVector::const_iterator itAlt = std::find(
-            possibleFormats.begin(), possibleFormats.end(), altFormat);
-        if(itAlt != endFormat)
+        if (std::find(possibleFormats.begin(), possibleFormats.end(), altFormat)
+                != possibleFormats.end())
+        {
             continue;
+        }
 
-        std::unique_ptr<std::istream> pStream = nullptr;
-        try
+        switch (probe(altFormat))
         {
-            pStream = getLutData(
-                config,
-                filepath, 
-                altFormat->isBinary() ? std::ios_base::binary : std::ios_base::in 
-            );
-            
-            if (!pStream || !pStream->good())
-            {
-                std::ostringstream os;
-                os << "The specified FileTransform srcfile, '";
-                os << filepath << "', could not be opened. ";
-                os << "Please confirm the file exists with ";
-                os << "appropriate read";
-                os << " permissions.";
-                throw Exception(os.str().c_str());
-            }
+            case FileFormat::PROBE_YES:
+                altFormats.insert(altFormats.begin() + numRecognized, altFormat);
+                ++numRecognized;
+                break;
+            case FileFormat::PROBE_MAYBE:
+                altFormats.push_back(altFormat);
+                break;
+            case FileFormat::PROBE_NO:
+                if(IsDebugLoggingEnabled())
+                {
+                    std::ostringstream os;
+                    os << "    Skipped alt format ";
+                    os << altFormat->getName();
+                    os << ":  content not recognized.";
+                    LogDebug(os.str());
+                }
+                break;
+        }
+    }
 
-            cachedFile = altFormat->read(*pStream, filepath, interp);
+    for (FileFormat * altFormat : altFormats)
+    {
+        try
+        {
+            MemoryIStream stream(buffer.data(), buffer.size());
+            CachedFileRcPtr cachedFile = altFormat->read(stream, filepath, interp);
 
             if(IsDebugLoggingEnabled())
             {
@@ -726,6 +784,7 @@ void LoadFileUncached(FileFormat * & returnFormat,
 
             returnFormat = altFormat;
             returnCachedFile = cachedFile;
+            returnSize = buffer.size();
 
             return;
         }
@@ -818,12 +877,16 @@ void GetCachedFileAndFormat(FileFormat * & format,
             // As the entry is a shared pointer instance, having an empty one
             // means that the entry does not exist in the cache. So, it provides
             // a fast existence check.
-            result = g_fileCache[filepath];
-            if (!result)
+            FileCacheResultPtr & cacheEntry = g_fileCache[filepath];
+            if (!cacheEntry)
             {
-                result = std::make_shared<FileCacheResult>();
-                g_fileCache[filepath] = result;
+                cacheEntry = std::make_shared<FileCacheResult>();
             }
+            result = cacheEntry;
+
+            // Keep the entry while the file is loaded so that concurrent requests for the same
+            // file wait for it instead of loading it again.
+            g_fileCache.pin(filepath);
         }
         else
         {
@@ -831,6 +894,9 @@ void GetCachedFileAndFormat(FileFormat * & format,
         }
     }
 
+    // Note that nothing is unpinned for an entry which is not in the cache.
+    CacheUnpinGuard<std::string, FileCacheResultPtr> unpinGuard(g_fileCache, filepath, result);
+
     // If this file has already been loaded, return the result immediately.
 
     AutoMutex lock(result->mutex);
@@ -839,9 +905,10 @@ void GetCachedFileAndFormat(FileFormat * & format,
         result->ready = true;
         result->error = false;
 
+        size_t size = 0;
         try
         {
-            LoadFileUncached(result->format, result->cachedFile, filepath, interp, config);
+            LoadFileUncached(result->format, result->cachedFile, size, filepath, interp, config);
         }
         catch (std::exception & e)
         {
@@ -856,6 +923,9 @@ void GetCachedFileAndFormat(FileFormat * & format,
             os << filepath;
             result->exceptionText = os.str();
         }
+
+        AutoMutex guard(g_fileCache.lock());
+        g_fileCache.setEntrySize(filepath, result, size);
     }
 
     if (result->error)
@@ -887,9 +957,74 @@ void GetCachedFileAndFormat(FileFormat * & format,
     }
 }
 
+namespace
+{
+
+// The ops already loaded by this process from the persistent file cache, keyed by the entry key.
+// Note that the ops are never modified i.e. they are cloned when used.
+typedef OCIO_SHARED_PTR<const OpRcPtrVec> ConstOpRcPtrVecRcPtr;
+GenericCache<std::string, ConstOpRcPtrVecRcPtr> g_fileDiskCacheOps;
+
+// The files whose ops cannot be persisted (i.e. never look for their cache entries again).
+std::set<std::string> g_unpersistableFiles;
+Mutex g_unpersistableFilesMutex;
+
+bool IsUnpersistableFile(const std::string & filepath)
+{
+    AutoMutex guard(g_unpersistableFilesMutex);
+    return g_unpersistableFiles.find(filepath) != g_unpersistableFiles.end();
+}
+
+// Get the ops of the persistent cache entry, from memory if this process already loaded it. The
+// metadata of the list is the persisted one i.e. empty if the file added none. Returns null if
+// the entry does not exist or is invalid.
+ConstOpRcPtrVecRcPtr GetFileTransformDiskCacheOps(const std::string & cacheDir,
+                                                  const std::string & key)
+{
+    {
+        AutoMutex guard(g_fileDiskCacheOps.lock());
+        if (g_fileDiskCacheOps.exists(key))
+        {
+            return g_fileDiskCacheOps[key];
+        }
+    }
+
+    auto loadedOps = std::make_shared<OpRcPtrVec>();
+    size_t size = 0;
+    if (!LoadFileTransformOps(*loadedOps, size, cacheDir, key))
+    {
+        return ConstOpRcPtrVecRcPtr();
+    }
+
+    // The memory size of the ops is approximated by the entry size.
+    AutoMutex guard(g_fileDiskCacheOps.lock());
+    ConstOpRcPtrVecRcPtr & entry = g_fileDiskCacheOps[key];
+    entry = loadedOps;
+    g_fileDiskCacheOps.setEntrySize(key, entry, size);
+
+    return loadedOps;
+}
+
+} // anon.
+
 void ClearFileTransformCaches()
 {
     g_fileCache.clear();
+    g_fileDiskCacheOps.clear();
+
+    AutoMutex guard(g_unpersistableFilesMutex);
+    g_unpersistableFiles.clear();
+}
+
+void SetFileTransformCacheCapacity(size_t maxNumEntries, size_t maxSizeInBytes)
+{
+    g_fileCache.setCapacity(maxNumEntries, maxSizeInBytes);
+    g_fileDiskCacheOps.setCapacity(maxNumEntries, maxSizeInBytes);
+}
+
+CacheStatistics GetFileTransformCacheStatistics()
+{
+    return g_fileCache.getStatistics();
 }
 
 void BuildFileTransformOps(OpRcPtrVec & ops,
@@ -930,6 +1065,61 @@ void BuildFileTransformOps(OpRcPtrVec & ops,
         }
     }
 
+    // The ops could be persisted by a previous process. Note that a file already loaded by this
+    // process is faster to get from the in-memory cache.
+    std::string diskCacheDir;
+    std::string diskCacheKey;
+    if (!context->getConfigIOProxy())
+    {
+        diskCacheDir = GetFileTransformDiskCacheDir();
+        if (!diskCacheDir.empty() && !IsUnpersistableFile(filepath))
+        {
+            bool inMemory = false;
+            {
+                AutoMutex guard(g_fileCache.lock());
+                inMemory = g_fileCache.exists(filepath);
+            }
+
+            if (!inMemory)
+            {
+                diskCacheKey = CreateFileTransformDiskCacheKey(filepath, *context, config,
+                                                               fileTransform, dir);
+            }
+        }
+    }
+
+    if (!diskCacheKey.empty())
+    {
+        static const FormatMetadataImpl emptyMetadata;
+
+        const ConstOpRcPtrVecRcPtr cachedOps
+            = GetFileTransformDiskCacheOps(diskCacheDir, diskCacheKey);
+
+        // A persisted metadata could only be restored in an empty one.
+        if (cachedOps
+            && (cachedOps->getFormatMetadata() == emptyMetadata
+                || ops.getFormatMetadata() == emptyMetadata))
+        {
+            // No need to track the recursion as persisted ops never reference other files.
+            CreateFileNoOp(ops, filepath);
+            ConstOpRcPtr fileNoOpConst = ops.back();
+            DynamicPtrCast<const FileNoOpData>(fileNoOpConst->data())->setComplete();
+
+            if (!(cachedOps->getFormatMetadata() == emptyMetadata))
+            {
+                ops.getFormatMetadata() = cachedOps->getFormatMetadata();
+            }
+            for (const auto & op : *cachedOps)
+            {
+                ops.push_back(op->clone());
+            }
+            return;
+        }
+    }
+
+    const FormatMetadataImpl initialMetadata
+        = diskCacheKey.empty() ? FormatMetadataImpl() : ops.getFormatMetadata();
+
     FileFormat* format = NULL;
     CachedFileRcPtr cachedFile;
 
@@ -943,6 +1133,7 @@ void BuildFileTransformOps(OpRcPtrVec & ops,
     {
         // Add FileNoOp and keep track of it.
         CreateFileNoOp(ops, filepath);
+        const size_t firstFileOp = ops.size();
 
         ConstOpRcPtr fileNoOpConst = ops.back();
         OpRcPtr fileNoOp = ops.back();
@@ -958,6 +1149,16 @@ void BuildFileTransformOps(OpRcPtrVec & ops,
         {
             fileData->setComplete();
         }
+
+        if (!diskCacheKey.empty())
+        {
+            if (!SaveFileTransformOps(diskCacheDir, diskCacheKey, ops, firstFileOp,
+                                      initialMetadata))
+            {
+                AutoMutex guard(g_unpersistableFilesMutex);
+                g_unpersistableFiles.insert(filepath);
+            }
+        }
     }
     catch (Exception & e)
     {
@@ -19,6 +19,8 @@
 namespace OCIO_NAMESPACE
 {
 void ClearFileTransformCaches();
+void SetFileTransformCacheCapacity(size_t maxNumEntries, size_t maxSizeInBytes);
+CacheStatistics GetFileTransformCacheStatistics();
 
 class CachedFile
 {
@@ -68,10 +70,30 @@ typedef std::vector<FormatInfo> FormatInfoVec;
 class FileFormat
 {
 public:
+    // Result of a cheap look at the beginning of a file, see probe().
+    enum ProbeResult
+    {
+        PROBE_NO = 0, // The content can not be read by this format.
+        PROBE_MAYBE,  // Nothing conclusive, only a full read can tell.
+        PROBE_YES     // The content has the signature of this format.
+    };
+
+    // Number of bytes from the beginning of a file given to probe().
+    static constexpr size_t PROBE_SIZE = 64 * 1024;
+
     virtual ~FileFormat();
 
     virtual void getFormatInfo(FormatInfoVec & formatInfoVec) const = 0;
 
+    // Sniff the first bytes of a file (at most PROBE_SIZE) without parsing it, so that
+    // the likely formats are tried first and the impossible ones are skipped when the
+    // file extension is not conclusive. PROBE_NO must only be returned when read() would
+    // certainly fail on that content.
+    virtual ProbeResult probe(const char * /* buffer */, size_t /* size */) const
+    {
+        return PROBE_MAYBE;
+    }
+
     // read an istream. originalFileName is used by parsers that make use
     // of aspects of the file name as part of the parsing.
     // It may be set to an empty string if not known.
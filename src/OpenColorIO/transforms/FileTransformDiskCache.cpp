@@ -0,0 +1,756 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <pystring.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "HashUtils.h"
+#include "Logging.h"
+#include "PathUtils.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "ops/matrix/MatrixOpData.h"
+#include "ops/range/RangeOpData.h"
+#include "Platform.h"
+#include "transforms/FileTransformDiskCache.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Identify the cache entries and their layout. Increase the version when the layout changes
+// (or when the way ops are built from the files changes) so that stale entries are ignored.
+constexpr char CACHE_ENTRY_MAGIC[8]  = { 'O', 'C', 'I', 'O', 'L', 'U', 'T', 'C' };
+constexpr uint32_t CACHE_ENTRY_VERSION = 1;
+// Detect entries written on a platform with another endianness.
+constexpr uint32_t CACHE_ENTRY_BYTE_ORDER = 0x01020304;
+
+constexpr char CACHE_ENTRY_EXTENSION[] = ".ociolutc";
+
+bool IsPersistable(OpData::Type type)
+{
+    switch (type)
+    {
+    case OpData::Lut1DType:
+    case OpData::Lut3DType:
+    case OpData::MatrixType:
+    case OpData::RangeType:
+        return true;
+    case OpData::CDLType:
+    case OpData::ExponentType:
+    case OpData::ExposureContrastType:
+    case OpData::FixedFunctionType:
+    case OpData::GammaType:
+    case OpData::GradingPrimaryType:
+    case OpData::GradingRGBCurveType:
+    case OpData::GradingToneType:
+    case OpData::LogType:
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+        return false;
+    }
+
+    return false;
+}
+
+// Validate the enumeration values read from a cache entry, before casting them. A corrupted value
+// must not reach the op data as it is not always validated (e.g. the file bit-depths).
+
+bool IsValidEnum(uint32_t value, OpData::Type)
+{
+    switch (value)
+    {
+    case OpData::CDLType:
+    case OpData::ExponentType:
+    case OpData::ExposureContrastType:
+    case OpData::FixedFunctionType:
+    case OpData::GammaType:
+    case OpData::GradingPrimaryType:
+    case OpData::GradingRGBCurveType:
+    case OpData::GradingToneType:
+    case OpData::LogType:
+    case OpData::Lut1DType:
+    case OpData::Lut3DType:
+    case OpData::MatrixType:
+    case OpData::RangeType:
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+        return true;
+    }
+
+    return false;
+}
+
+bool IsValidEnum(uint32_t value, Interpolation)
+{
+    switch (value)
+    {
+    case INTERP_UNKNOWN:
+    case INTERP_NEAREST:
+    case INTERP_LINEAR:
+    case INTERP_TETRAHEDRAL:
+    case INTERP_CUBIC:
+    case INTERP_DEFAULT:
+    case INTERP_BEST:
+        return true;
+    }
+
+    return false;
+}
+
+bool IsValidEnum(uint32_t value, TransformDirection)
+{
+    switch (value)
+    {
+    case TRANSFORM_DIR_FORWARD:
+    case TRANSFORM_DIR_INVERSE:
+        return true;
+    }
+
+    return false;
+}
+
+bool IsValidEnum(uint32_t value, BitDepth)
+{
+    switch (value)
+    {
+    case BIT_DEPTH_UNKNOWN:
+    case BIT_DEPTH_UINT8:
+    case BIT_DEPTH_UINT10:
+    case BIT_DEPTH_UINT12:
+    case BIT_DEPTH_UINT14:
+    case BIT_DEPTH_UINT16:
+    case BIT_DEPTH_UINT32:
+    case BIT_DEPTH_F16:
+    case BIT_DEPTH_F32:
+        return true;
+    }
+
+    return false;
+}
+
+bool IsValidEnum(uint32_t value, Lut1DHueAdjust)
+{
+    switch (value)
+    {
+    case HUE_NONE:
+    case HUE_DW3:
+    case HUE_WYPN:
+        return true;
+    }
+
+    return false;
+}
+
+bool IsValidEnum(uint32_t value, Lut1DOpData::HalfFlags)
+{
+    switch (value)
+    {
+    case Lut1DOpData::LUT_STANDARD:
+    case Lut1DOpData::LUT_INPUT_HALF_CODE:
+    case Lut1DOpData::LUT_OUTPUT_HALF_CODE:
+    case Lut1DOpData::LUT_INPUT_OUTPUT_HALF_CODE:
+        return true;
+    }
+
+    return false;
+}
+
+template<typename T>
+void Write(std::ostream & ostream, const T & value)
+{
+    ostream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void WriteUInt(std::ostream & ostream, uint32_t value)
+{
+    Write(ostream, value);
+}
+
+void WriteString(std::ostream & ostream, const std::string & str)
+{
+    WriteUInt(ostream, static_cast<uint32_t>(str.size()));
+    ostream.write(str.data(), str.size());
+}
+
+template<typename T>
+void WriteValues(std::ostream & ostream, const std::vector<T> & values)
+{
+    WriteUInt(ostream, static_cast<uint32_t>(values.size()));
+    ostream.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+void WriteMetadata(std::ostream & ostream, const FormatMetadataImpl & metadata)
+{
+    WriteString(ostream, metadata.getElementName());
+    WriteString(ostream, metadata.getElementValue());
+
+    const FormatMetadataImpl::Attributes & attributes = metadata.getAttributes();
+    WriteUInt(ostream, static_cast<uint32_t>(attributes.size()));
+    for (const auto & attribute : attributes)
+    {
+        WriteString(ostream, attribute.first);
+        WriteString(ostream, attribute.second);
+    }
+
+    const FormatMetadataImpl::Elements & children = metadata.getChildrenElements();
+    WriteUInt(ostream, static_cast<uint32_t>(children.size()));
+    for (const auto & child : children)
+    {
+        WriteMetadata(ostream, child);
+    }
+}
+
+void WriteOpData(std::ostream & ostream, const ConstOpDataRcPtr & data)
+{
+    WriteUInt(ostream, static_cast<uint32_t>(data->getType()));
+    WriteMetadata(ostream, data->getFormatMetadata());
+
+    switch (data->getType())
+    {
+    case OpData::Lut1DType:
+    {
+        auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut1DOpData>(data);
+        const Array & array = lut->getArray();
+
+        WriteUInt(ostream, static_cast<uint32_t>(lut->getInterpolation()));
+        WriteUInt(ostream, static_cast<uint32_t>(lut->getDirection()));
+        WriteUInt(ostream, static_cast<uint32_t>(lut->getHalfFlags()));
+        WriteUInt(ostream, static_cast<uint32_t>(lut->getHueAdjust()));
+        WriteUInt(ostream, static_cast<uint32_t>(lut->getFileOutputBitDepth()));
+        WriteUInt(ostream, static_cast<uint32_t>(array.getLength()));
+        WriteUInt(ostream, static_cast<uint32_t>(array.getNumColorComponents()));
+        WriteValues(ostream, array.getValues());
+        break;
+    }
+    case OpData::Lut3DType:
+    {
+        auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(data);
+
+        WriteUInt(ostream, static_cast<uint32_t>(lut->getInterpolation()));
+        WriteUInt(ostream, static_cast<uint32_t>(lut->getDirection()));
+        WriteUInt(ostream, static_cast<uint32_t>(lut->getFileOutputBitDepth()));
+        WriteUInt(ostream, static_cast<uint32_t>(lut->getGridSize()));
+        WriteValues(ostream, lut->getArray().getValues());
+        break;
+    }
+    case OpData::MatrixType:
+    {
+        auto matrix = OCIO_DYNAMIC_POINTER_CAST<const MatrixOpData>(data);
+
+        WriteUInt(ostream, static_cast<uint32_t>(matrix->getDirection()));
+        WriteUInt(ostream, static_cast<uint32_t>(matrix->getFileInputBitDepth()));
+        WriteUInt(ostream, static_cast<uint32_t>(matrix->getFileOutputBitDepth()));
+        WriteValues(ostream, matrix->getArray().getValues());
+        for (unsigned long idx = 0; idx < 4; ++idx)
+        {
+            Write(ostream, matrix->getOffsetValue(idx));
+        }
+        break;
+    }
+    case OpData::RangeType:
+    {
+        auto range = OCIO_DYNAMIC_POINTER_CAST<const RangeOpData>(data);
+
+        WriteUInt(ostream, static_cast<uint32_t>(range->getDirection()));
+        WriteUInt(ostream, static_cast<uint32_t>(range->getFileInputBitDepth()));
+        WriteUInt(ostream, static_cast<uint32_t>(range->getFileOutputBitDepth()));
+        Write(ostream, range->getMinInValue());
+        Write(ostream, range->getMaxInValue());
+        Write(ostream, range->getMinOutValue());
+        Write(ostream, range->getMaxOutValue());
+        break;
+    }
+    case OpData::CDLType:
+    case OpData::ExponentType:
+    case OpData::ExposureContrastType:
+    case OpData::FixedFunctionType:
+    case OpData::GammaType:
+    case OpData::GradingPrimaryType:
+    case OpData::GradingRGBCurveType:
+    case OpData::GradingToneType:
+    case OpData::LogType:
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+    {
+        throw Exception("Op cannot be persisted in the file cache.");
+    }
+    }
+}
+
+// Read the values from a cache entry, throwing if the entry is truncated.
+class EntryReader
+{
+public:
+    EntryReader(const char * buffer, size_t size)
+        :   m_cur(buffer)
+        ,   m_end(buffer + size)
+    {
+    }
+
+    template<typename T>
+    T read()
+    {
+        T value;
+        readBytes(reinterpret_cast<char *>(&value), sizeof(T));
+        return value;
+    }
+
+    uint32_t readUInt()
+    {
+        return read<uint32_t>();
+    }
+
+    template<typename E>
+    E readEnum()
+    {
+        const uint32_t value = readUInt();
+        if (!IsValidEnum(value, E{}))
+        {
+            throw Exception("Invalid enumeration value.");
+        }
+        return static_cast<E>(value);
+    }
+
+    std::string readString()
+    {
+        const uint32_t size = readUInt();
+        checkRemaining(size);
+
+        std::string str(m_cur, size);
+        m_cur += size;
+        return str;
+    }
+
+    template<typename T>
+    void readValues(std::vector<T> & values)
+    {
+        const uint32_t numValues = readUInt();
+        if (numValues != values.size())
+        {
+            throw Exception("Unexpected number of values.");
+        }
+        readBytes(reinterpret_cast<char *>(values.data()), numValues * sizeof(T));
+    }
+
+    void readMetadata(FormatMetadataImpl & metadata)
+    {
+        // Note that the setters reject the content of the root element.
+        const std::string elementName = readString();
+        const std::string elementValue = readString();
+        metadata = FormatMetadataImpl(elementName, elementValue);
+
+        const uint32_t numAttributes = readUInt();
+        checkRemaining(numAttributes);
+        for (uint32_t idx = 0; idx < numAttributes; ++idx)
+        {
+            const std::string name = readString();
+            metadata.addAttribute(name.c_str(), readString().c_str());
+        }
+
+        const uint32_t numChildren = readUInt();
+        checkRemaining(numChildren);
+        FormatMetadataImpl::Elements & children = metadata.getChildrenElements();
+        children.resize(numChildren);
+        for (auto & child : children)
+        {
+            readMetadata(child);
+        }
+    }
+
+    bool atEnd() const noexcept { return m_cur == m_end; }
+
+    void checkRemaining(size_t size) const
+    {
+        if (size > static_cast<size_t>(m_end - m_cur))
+        {
+            throw Exception("Truncated entry.");
+        }
+    }
+
+private:
+
+    void readBytes(char * dst, size_t size)
+    {
+        checkRemaining(size);
+        memcpy(dst, m_cur, size);
+        m_cur += size;
+    }
+
+    const char * m_cur;
+    const char * m_end;
+};
+
+OpDataRcPtr ReadOpData(EntryReader & reader)
+{
+    const auto type = reader.readEnum<OpData::Type>();
+
+    FormatMetadataImpl metadata;
+    reader.readMetadata(metadata);
+
+    OpDataRcPtr data;
+    switch (type)
+    {
+    case OpData::Lut1DType:
+    {
+        const auto interpolation = reader.readEnum<Interpolation>();
+        const auto direction     = reader.readEnum<TransformDirection>();
+        const auto halfFlags     = reader.readEnum<Lut1DOpData::HalfFlags>();
+        const auto hueAdjust     = reader.readEnum<Lut1DHueAdjust>();
+        const auto fileOutDepth  = reader.readEnum<BitDepth>();
+        const uint32_t length    = reader.readUInt();
+        const uint32_t numComps  = reader.readUInt();
+
+        // Do not allocate more than what the entry could contain.
+        reader.checkRemaining(size_t(length) * numComps * sizeof(float));
+
+        auto lut = std::make_shared<Lut1DOpData>(halfFlags, length, false);
+        lut->setInterpolation(interpolation);
+        lut->setDirection(direction);
+        lut->setHueAdjust(hueAdjust);
+        lut->setFileOutputBitDepth(fileOutDepth);
+        lut->getArray().resize(length, numComps);
+        reader.readValues(lut->getArray().getValues());
+
+        data = lut;
+        break;
+    }
+    case OpData::Lut3DType:
+    {
+        const auto interpolation = reader.readEnum<Interpolation>();
+        const auto direction     = reader.readEnum<TransformDirection>();
+        const auto fileOutDepth  = reader.readEnum<BitDepth>();
+        const uint32_t gridSize  = reader.readUInt();
+
+        // Bound the grid size before computing the number of values (i.e. no overflow).
+        if (gridSize > Lut3DOpData::maxSupportedLength)
+        {
+            throw Exception("Unsupported 3D LUT grid size.");
+        }
+        reader.checkRemaining(size_t(gridSize) * gridSize * gridSize * 3 * sizeof(float));
+
+        auto lut = std::make_shared<Lut3DOpData>(interpolation, gridSize);
+        lut->setDirection(direction);
+        lut->setFileOutputBitDepth(fileOutDepth);
+        reader.readValues(lut->getArray().getValues());
+
+        data = lut;
+        break;
+    }
+    case OpData::MatrixType:
+    {
+        auto matrix = std::make_shared<MatrixOpData>(reader.readEnum<TransformDirection>());
+        matrix->setFileInputBitDepth(reader.readEnum<BitDepth>());
+        matrix->setFileOutputBitDepth(reader.readEnum<BitDepth>());
+        reader.readValues(matrix->getArray().getValues());
+        for (unsigned long idx = 0; idx < 4; ++idx)
+        {
+            matrix->setOffsetValue(idx, reader.read<double>());
+        }
+
+        data = matrix;
+        break;
+    }
+    case OpData::RangeType:
+    {
+        const auto direction    = reader.readEnum<TransformDirection>();
+        const auto fileInDepth  = reader.readEnum<BitDepth>();
+        const auto fileOutDepth = reader.readEnum<BitDepth>();
+        const double minIn      = reader.read<double>();
+        const double maxIn      = reader.read<double>();
+        const double minOut     = reader.read<double>();
+        const double maxOut     = reader.read<double>();
+
+        auto range = std::make_shared<RangeOpData>(minIn, maxIn, minOut, maxOut, direction);
+        range->setFileInputBitDepth(fileInDepth);
+        range->setFileOutputBitDepth(fileOutDepth);
+
+        data = range;
+        break;
+    }
+    case OpData::CDLType:
+    case OpData::ExponentType:
+    case OpData::ExposureContrastType:
+    case OpData::FixedFunctionType:
+    case OpData::GammaType:
+    case OpData::GradingPrimaryType:
+    case OpData::GradingRGBCurveType:
+    case OpData::GradingToneType:
+    case OpData::LogType:
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+    {
+        break;
+    }
+    }
+
+    // The other op types are never persisted.
+    if (!data)
+    {
+        throw Exception("Unexpected op type.");
+    }
+
+    data->getFormatMetadata() = metadata;
+    data->validate();
+
+    return data;
+}
+
+std::string GetEntryPath(const std::string & cacheDir, const std::string & key)
+{
+    const std::string hash = CacheIDHash(key.c_str(), key.size());
+    return pystring::os::path::join(cacheDir, hash + CACHE_ENTRY_EXTENSION);
+}
+
+} // anon.
+
+std::string GetFileTransformDiskCacheDir()
+{
+    if (Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES))
+    {
+        return "";
+    }
+
+    std::string cacheDir;
+    Platform::Getenv(OCIO_LUT_CACHE_DIR, cacheDir);
+    return cacheDir;
+}
+
+std::string CreateFileTransformDiskCacheKey(const std::string & filepath,
+                                            const Context & context,
+                                            const Config & config,
+                                            const FileTransform & fileTransform,
+                                            TransformDirection dir)
+{
+    // The file is never read to create the key. Modifying the file in place changes its size
+    // and/or modification time, and replacing it changes its fast hash (i.e. its inode).
+    const std::string statHash = Platform::CreateFileStatHash(filepath);
+    if (statHash.empty())
+    {
+        return "";
+    }
+
+    const std::string fileHash = GetFastFileHash(filepath, context);
+    if (fileHash.empty())
+    {
+        return "";
+    }
+
+    std::ostringstream key;
+    key << GetVersion() << " " << CACHE_ENTRY_VERSION << " ";
+    key << pystring::os::path::normpath(filepath) << " " << statHash << " " << fileHash << " ";
+    key << config.getMajorVersion() << " ";
+    key << InterpolationToString(fileTransform.getInterpolation()) << " ";
+    key << TransformDirectionToString(fileTransform.getDirection()) << " ";
+    key << TransformDirectionToString(dir) << " ";
+    key << CDLStyleToString(fileTransform.getCDLStyle()) << " ";
+    key << fileTransform.getCCCId();
+    return key.str();
+}
+
+bool SerializeFileTransformOps(std::ostream & ostream,
+                               const std::string & key,
+                               const OpRcPtrVec & ops,
+                               size_t firstOp,
+                               const FormatMetadataImpl & initialMetadata)
+{
+    if (firstOp > ops.size())
+    {
+        return false;
+    }
+
+    for (size_t idx = firstOp; idx < ops.size(); ++idx)
+    {
+        ConstOpRcPtr op = ops[idx];
+        if (!IsPersistable(op->data()->getType()))
+        {
+            return false;
+        }
+    }
+
+    // Only a metadata added from scratch can be restored when loading the entry.
+    static const FormatMetadataImpl emptyMetadata;
+    const FormatMetadataImpl & metadata = ops.getFormatMetadata();
+    if (!(metadata == initialMetadata) && !(initialMetadata == emptyMetadata))
+    {
+        return false;
+    }
+
+    ostream.write(CACHE_ENTRY_MAGIC, sizeof(CACHE_ENTRY_MAGIC));
+    WriteUInt(ostream, CACHE_ENTRY_VERSION);
+    WriteUInt(ostream, CACHE_ENTRY_BYTE_ORDER);
+    WriteString(ostream, key);
+
+    WriteMetadata(ostream, (metadata == initialMetadata) ? emptyMetadata : metadata);
+
+    WriteUInt(ostream, static_cast<uint32_t>(ops.size() - firstOp));
+    for (size_t idx = firstOp; idx < ops.size(); ++idx)
+    {
+        ConstOpRcPtr op = ops[idx];
+        WriteOpData(ostream, op->data());
+    }
+
+    return ostream.good();
+}
+
+void DeserializeFileTransformOps(OpRcPtrVec & ops,
+                                 const std::string & key,
+                                 const char * buffer,
+                                 size_t size)
+{
+    EntryReader reader(buffer, size);
+
+    char magic[sizeof(CACHE_ENTRY_MAGIC)];
+    for (auto & c : magic)
+    {
+        c = reader.read<char>();
+    }
+
+    if (0 != memcmp(magic, CACHE_ENTRY_MAGIC, sizeof(CACHE_ENTRY_MAGIC))
+        || reader.readUInt() != CACHE_ENTRY_VERSION
+        || reader.readUInt() != CACHE_ENTRY_BYTE_ORDER)
+    {
+        throw Exception("Unsupported file cache entry.");
+    }
+
+    if (reader.readString() != key)
+    {
+        throw Exception("The file cache entry belongs to another file.");
+    }
+
+    FormatMetadataImpl metadata;
+    reader.readMetadata(metadata);
+
+    // Only fill the ops once the entry was completely read.
+    OpRcPtrVec newOps;
+    const uint32_t numOps = reader.readUInt();
+    for (uint32_t idx = 0; idx < numOps; ++idx)
+    {
+        CreateOpVecFromOpData(newOps, ReadOpData(reader), TRANSFORM_DIR_FORWARD);
+    }
+
+    if (!reader.atEnd())
+    {
+        throw Exception("Unexpected data at the end of the file cache entry.");
+    }
+
+    static const FormatMetadataImpl emptyMetadata;
+    if (!(metadata == emptyMetadata))
+    {
+        if (!(ops.getFormatMetadata() == emptyMetadata))
+        {
+            throw Exception("The file cache entry metadata cannot be restored.");
+        }
+        ops.getFormatMetadata() = metadata;
+    }
+
+    for (auto & op : newOps)
+    {
+        ops.push_back(op);
+    }
+}
+
+bool LoadFileTransformOps(OpRcPtrVec & ops,
+                          size_t & size,
+                          const std::string & cacheDir,
+                          const std::string & key)
+{
+    const std::string entryPath = GetEntryPath(cacheDir, key);
+
+    std::ifstream fstream;
+    Platform::OpenInputFileStream(fstream, entryPath.c_str(), std::ios_base::in | std::ios_base::binary);
+    if (!fstream.good())
+    {
+        return false;
+    }
+
+    // Read the whole entry at once.
+    fstream.seekg(0, std::ios_base::end);
+    const std::streamoff entrySize = fstream.tellg();
+    fstream.seekg(0, std::ios_base::beg);
+    if (entrySize <= 0)
+    {
+        return false;
+    }
+
+    std::vector<char> buffer(static_cast<size_t>(entrySize));
+    if (!fstream.read(buffer.data(), entrySize))
+    {
+        return false;
+    }
+
+    try
+    {
+        DeserializeFileTransformOps(ops, key, buffer.data(), buffer.size());
+    }
+    catch (const std::exception & e)
+    {
+        // Note that a corrupted entry could also fail in the op data constructors (e.g. a memory
+        // allocation failure).
+        std::ostringstream oss;
+        oss << "Ignoring the file cache entry '" << entryPath << "': " << e.what();
+        LogDebug(oss.str());
+        return false;
+    }
+
+    size = buffer.size();
+    return true;
+}
+
+bool SaveFileTransformOps(const std::string & cacheDir,
+                          const std::string & key,
+                          const OpRcPtrVec & ops,
+                          size_t firstOp,
+                          const FormatMetadataImpl & initialMetadata)
+{
+    std::ostringstream entry;
+    if (!SerializeFileTransformOps(entry, key, ops, firstOp, initialMetadata))
+    {
+        return false;
+    }
+
+    const std::string entryPath = GetEntryPath(cacheDir, key);
+
+    // Concurrent processes may create the same entry so write a temporary file and then rename
+    // it, to never expose a partially written entry.
+    std::ostringstream tmpPath;
+    tmpPath << entryPath << "." << std::random_device{}() << ".tmp";
+
+    {
+        std::ofstream fstream(Platform::filenameToUTF(tmpPath.str()).c_str(),
+                              std::ios_base::out | std::ios_base::binary);
+        const std::string content = entry.str();
+        fstream.write(content.data(), content.size());
+        if (!fstream.good())
+        {
+            fstream.close();
+            std::remove(tmpPath.str().c_str());
+
+            std::ostringstream oss;
+            oss << "Could not write the file cache entry '" << entryPath << "'.";
+            LogDebug(oss.str());
+            return true;
+        }
+    }
+
+    if (0 != std::rename(tmpPath.str().c_str(), entryPath.c_str()))
+    {
+        // The entry may have been created meanwhile by another process.
+        std::remove(tmpPath.str().c_str());
+    }
+
+    return true;
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_FILETRANSFORMDISKCACHE_H
+#define INCLUDED_OCIO_FILETRANSFORMDISKCACHE_H
+
+
+#include <iosfwd>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "fileformats/FormatMetadata.h"
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The persistent file cache stores the ops built from a LUT file in a compact binary form so
+// that other processes (e.g. the tasks of a render farm) do not parse the same file again. It
+// is enabled by the OCIO_LUT_CACHE_DIR env. variable.
+//
+// Only the Lut1D, Lut3D, Matrix and Range ops are persisted, the files producing other ops are
+// always parsed. An entry is keyed by the normalized file path, its size, modification time &
+// fast hash (refer to GetFastFileHash), and by all the FileTransform parameters used to build
+// the ops. Creating a key never reads the file.
+
+// Return the directory of the persistent file cache, or an empty string if it is disabled.
+std::string GetFileTransformDiskCacheDir();
+
+// Return the key of the cache entry for the file, or an empty string if the file does not exist.
+std::string CreateFileTransformDiskCacheKey(const std::string & filepath,
+                                            const Context & context,
+                                            const Config & config,
+                                            const FileTransform & fileTransform,
+                                            TransformDirection dir);
+
+// Serialize the ops from firstOp to the end of the list. The FormatMetadata of the op list is
+// only persisted when the file added it to an empty one (i.e. initialMetadata is the content
+// before building the ops from the file). Returns false if the ops cannot be persisted.
+bool SerializeFileTransformOps(std::ostream & ostream,
+                               const std::string & key,
+                               const OpRcPtrVec & ops,
+                               size_t firstOp,
+                               const FormatMetadataImpl & initialMetadata);
+
+// Rebuild the ops from a serialized buffer. Throws if the buffer content is invalid or if it was
+// created for another key.
+void DeserializeFileTransformOps(OpRcPtrVec & ops,
+                                 const std::string & key,
+                                 const char * buffer,
+                                 size_t size);
+
+// Load the ops of the cache entry, size being the entry size in bytes. Returns false if the entry
+// does not exist or is invalid.
+bool LoadFileTransformOps(OpRcPtrVec & ops,
+                          size_t & size,
+                          const std::string & cacheDir,
+                          const std::string & key);
+
+// Save the ops in a new cache entry. Returns false if the ops cannot be persisted, note that
+// failing to write the entry is not an error.
+bool SaveFileTransformOps(const std::string & cacheDir,
+                          const std::string & key,
+                          const OpRcPtrVec & ops,
+                          size_t firstOp,
+                          const FormatMetadataImpl & initialMetadata);
+
+} // namespace OCIO_NAMESPACE
+
+#endif
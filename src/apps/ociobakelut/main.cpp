@@ -30,6 +30,16 @@ static int parse_end_args(int argc, const char *argv[])
 
 OCIO::GroupTransformRcPtr parse_luts(int argc, const char *argv[]);
 
+struct BakeTarget
+{
+    std::string display;
+    std::string view;
+    std::string looks;
+    std::string outputfile;
+};
+
+std::vector<BakeTarget> parse_batch(const std::string & batchfile);
+
 int main (int argc, const char* argv[])
 {
 
@@ -44,6 +54,7 @@ int main (int argc, const char* argv[])
     std::string outputspace;
     std::string display;
     std::string view;
+    std::string batchfile;
     bool usestdout = false;
     bool verbose = false;
 
@@ -78,7 +89,8 @@ int main (int argc, const char* argv[])
                "example:  ociobakelut --inputspace lg10 --outputspace srgb8 --format icc ~/Library/ColorSync/Profiles/test.icc\n"
                "example:  ociobakelut --inputspace lin --shaperspace lg10 --outputspace lg10 --format spi1d lintolog.spi1d\n"
                "example:  ociobakelut --inputspace lg10 --displayview sRGB Film --format spi3d display_view.spi3d\n"
-               "example:  ociobakelut --lut filmlut.3dl --lut calibration.3dl --format icc ~/Library/ColorSync/Profiles/test.icc\n\n",
+               "example:  ociobakelut --lut filmlut.3dl --lut calibration.3dl --format icc ~/Library/ColorSync/Profiles/test.icc\n"
+               "example:  ociobakelut --inputspace lg10 --batch show_luts.txt --format resolve_cube\n\n",
                "%*", parse_end_args, "",
                "<SEPARATOR>", "Using Existing OCIO Configurations",
                "<SEPARATOR>", "    (use either displayview or outputspace, but not both)",
@@ -87,7 +99,9 @@ int main (int argc, const char* argv[])
                "--outputspace %s", &outputspace, "Output OCIO ColorSpace (or Role)",
                "--shaperspace %s", &shaperspace, "the OCIO ColorSpace or Role, for the shaper",
                "--looks %s", &looks, "the OCIO looks to apply",
-               "--iconfig %s", &inputconfig, "Input .ocio configuration file (default: $OCIO)\n",
+               "--iconfig %s", &inputconfig, "Input .ocio configuration file (default: $OCIO)",
+               "--batch %s", &batchfile, "Bake all the targets listed in the file, one 'display;view;looks;outputfile' "
+                                         "line per LUT (the looks field is optional)\n",
                "<SEPARATOR>", "Config-Free LUT Baking",
                "<SEPARATOR>", "    (all options can be specified multiple times, each is applied in order)",
                "--cccid %s", &dummystr, "Specify a CCCId for any following LUTs",
@@ -198,6 +212,12 @@ int main (int argc, const char* argv[])
             std::cerr << "See --help for more info." << std::endl;
             return 1;
         }
+        if(!batchfile.empty())
+        {
+            std::cerr << "\nERROR: --batch is not allowed when using --lut\n\n";
+            std::cerr << "See --help for more info." << std::endl;
+            return 1;
+        }
 
         OCIO::ConfigRcPtr editableConfig = OCIO::Config::Create();
 
@@ -233,7 +253,29 @@ int main (int argc, const char* argv[])
             return 1;
         }
 
-        if(outputspace.empty() && (display.empty() && view.empty()))
+        if(!batchfile.empty())
+        {
+            if(!outputspace.empty() || !display.empty() || !view.empty() || !looks.empty())
+            {
+                std::cerr << "\nERROR: --outputspace, --displayview and --looks are not allowed "
+                             "when using --batch.\n\n";
+                std::cerr << "See --help for more info." << std::endl;
+                return 1;
+            }
+            if(usestdout || !outputfile.empty())
+            {
+                std::cerr << "\nERROR: The output files are listed in the --batch file.\n\n";
+                std::cerr << "See --help for more info." << std::endl;
+                return 1;
+            }
+            if(format == "icc")
+            {
+                std::cerr << "\nERROR: --batch is not supported when writing ICC profiles.\n\n";
+                std::cerr << "See --help for more info." << std::endl;
+                return 1;
+            }
+        }
+        else if(outputspace.empty() && (display.empty() && view.empty()))
         {
             std::cerr << "\nERROR: You must specify either --outputspace or --displayview.\n\n";
             std::cerr << "See --help for more info." << std::endl;
@@ -278,7 +320,7 @@ int main (int argc, const char* argv[])
         }
     }
 
-    if(outputfile.empty() && !usestdout)
+    if(outputfile.empty() && !usestdout && batchfile.empty())
     {
         std::cerr << "\nERROR: You must specify the outputfile or --stdout.\n\n";
         std::cerr << "See --help for more info." << std::endl;
@@ -370,6 +412,33 @@ int main (int argc, const char* argv[])
             if(shapersize!=-1) baker->setShaperSize(shapersize);
             if(cubesize!=-1) baker->setCubeSize(cubesize);
 
+            if(!batchfile.empty())
+            {
+                const std::vector<BakeTarget> targets = parse_batch(batchfile);
+
+                if(verbose)
+                    std::cout << "[OpenColorIO INFO]: Baking " << targets.size() << " '" << format << "' LUTs" << std::endl;
+
+                // All the targets share the config, its processors and the LUT files. Each file
+                // is only opened while its LUT is baked.
+                for(const auto & target : targets)
+                {
+                    std::ofstream f(target.outputfile.c_str());
+                    if(f.fail())
+                    {
+                        std::cerr << "ERROR: Non-writable file path " << target.outputfile << " specified." << std::endl;
+                        return 1;
+                    }
+
+                    baker->bake({ OCIO::BakerTarget{ target.display, target.view, target.looks, &f } });
+                    f.close();
+
+                    if(verbose)
+                        std::cout << "[OpenColorIO INFO]: Wrote '" << target.outputfile << "'" << std::endl;
+                }
+                return 0;
+            }
+
             // output LUT
             std::ostringstream output;
 
@@ -428,6 +497,66 @@ int main (int argc, const char* argv[])
 // then atof() will likely try to convert "--invlut" to its double equivalent,
 // resulting in an invalid (or at least undesired) scale value.
 
+static std::string trim(const std::string & str)
+{
+    const auto first = str.find_first_not_of(" \t\r");
+    if(first == std::string::npos) return "";
+    const auto last = str.find_last_not_of(" \t\r");
+    return str.substr(first, last - first + 1);
+}
+
+// Each line of the batch file is 'display;view;looks;outputfile' or 'display;view;outputfile'.
+// The empty lines and the lines starting with '#' are ignored.
+std::vector<BakeTarget> parse_batch(const std::string & batchfile)
+{
+    std::ifstream f(batchfile.c_str());
+    if(f.fail())
+    {
+        throw OCIO::Exception(("Could not open the batch file '" + batchfile + "'.").c_str());
+    }
+
+    std::vector<BakeTarget> targets;
+
+    std::string line;
+    int lineNumber = 0;
+    while(std::getline(f, line))
+    {
+        ++lineNumber;
+        line = trim(line);
+        if(line.empty() || line[0] == '#') continue;
+
+        std::vector<std::string> fields;
+        std::istringstream iss(line);
+        std::string field;
+        while(std::getline(iss, field, ';'))
+        {
+            fields.push_back(trim(field));
+        }
+
+        if(fields.size() != 3 && fields.size() != 4)
+        {
+            std::ostringstream os;
+            os << "Error parsing the batch file '" << batchfile << "' at line " << lineNumber
+               << ": expecting 'display;view;looks;outputfile' or 'display;view;outputfile'.";
+            throw OCIO::Exception(os.str().c_str());
+        }
+
+        BakeTarget target;
+        target.display    = fields[0];
+        target.view       = fields[1];
+        target.looks      = fields.size() == 4 ? fields[2] : "";
+        target.outputfile = fields.back();
+        targets.push_back(target);
+    }
+
+    if(targets.empty())
+    {
+        throw OCIO::Exception(("The batch file '" + batchfile + "' has no target.").c_str());
+    }
+
+    return targets;
+}
+
 OCIO::GroupTransformRcPtr parse_luts(int argc, const char *argv[])
 {
     OCIO::GroupTransformRcPtr groupTransform = OCIO::GroupTransform::Create();
@@ -1,9 +1,17 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <deque>
+#include <functional>
+#include <future>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <set>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -41,6 +49,34 @@ bool StringToFloat(float * fval, const char * str);
 
 bool StringToInt(int * ival, const char * str);
 
+// Set the "name=value" attributes on the image, returns false on a parsing error.
+bool SetImageAttributes(OCIO::ImageIO & img,
+                        const std::vector<std::string> & floatAttrs,
+                        const std::vector<std::string> & intAttrs,
+                        const std::vector<std::string> & stringAttrs);
+
+// Get the bit-depth of the processed image from the input bit-depth or the user request.
+OCIO::BitDepth GetOutputBitDepth(OCIO::BitDepth inputBitDepth, OCIO::BitDepth userOutputBitDepth);
+
+// Parse a list of frames i.e. '10', '1-100', '1-100x2' or any comma separated list of them.
+std::vector<int> ParseFrameRange(const std::string & str);
+
+// Substitute the frame number in an image file name using either a '#' (e.g. 'img.####.exr')
+// or a printf-like (e.g. 'img.%04d.exr') placeholder.
+std::string GetFrameFilename(const std::string & pattern, int frame);
+
+// Convert an image sequence where the reading and the writing of the neighbouring frames
+// overlap the (multithreaded) color processing of the current frame.
+void ConvertSequence(const OCIO::ConstProcessorRcPtr & processor,
+                     const std::string & inputPattern,
+                     const std::string & outputPattern,
+                     const std::vector<int> & frames,
+                     OCIO::BitDepth userOutputBitDepth,
+                     unsigned numThreads,
+                     unsigned queueSize,
+                     const std::function<void(OCIO::ImageIO &)> & setAttributes,
+                     bool verbose);
+
 int main(int argc, const char **argv)
 {
     ArgParse ap;
@@ -51,6 +87,10 @@ int main(int argc, const char **argv)
 
     std::string outputDepth;
     std::string inputconfig;
+    std::string frameRange;
+
+    int numThreads              = 0;
+    int queueSize               = 2;
 
     bool usegpu                 = false;
     bool usegpuLegacy           = false;
@@ -69,7 +109,9 @@ int main(int argc, const char **argv)
                "   or: ocioconvert [options] --view inputimage inputcolorspace outputimage displayname viewname\n"
                "   or: ocioconvert [options] --invertview inputimage displayname viewname outputimage outputcolorspace\n"
                "   or: ocioconvert [options] --namedtransform transformname inputimage outputimage\n"
-               "   or: ocioconvert [options] --invnamedtransform transformname inputimage outputimage\n\n",
+               "   or: ocioconvert [options] --invnamedtransform transformname inputimage outputimage\n"
+               "   or: ocioconvert [options] --frames 1-100 inputimage.####.exr inputcolorspace "
+               "outputimage.####.exr outputcolorspace\n\n",
                "%*", parse_end_args, "",
                "<SEPARATOR>", "Options:",
                "--lut",                 &useLut,                "Convert using a LUT rather than a config file",
@@ -87,6 +129,15 @@ int main(int argc, const char **argv)
                "--help",                &help,                  "Display the help and exit",
                "-v" ,                   &verbose,               "Display general information",
               "--iconfig %s",           &inputconfig,           "Input .ocio configuration file (default: $OCIO)",
+               "--threads %d",          &numThreads,            "Number of threads of the CPU color processing, "
+                                                                "0 uses all the hardware threads (default: 0)",
+               "<SEPARATOR>", "\nImage sequence options:",
+               "--frames %s",           &frameRange,            "Convert the frames (e.g. 1-100, 1-100x2 or 1,5,10-20) "
+                                                                "of an image sequence where the image names contain "
+                                                                "a frame number placeholder (e.g. img.####.exr or "
+                                                                "img.%04d.exr)",
+               "--queue %d",            &queueSize,             "Number of frames read ahead and written behind the "
+                                                                "processed frame (default: 2)",
                "<SEPARATOR>", "\nOpenImageIO or OpenEXR options:",
                "--bitdepth %s",         &outputDepth,  "Output image bitdepth",
                "--float-attribute %L",  &floatAttrs,   "\"name=float\" pair defining OIIO float attribute "
@@ -111,6 +162,32 @@ int main(int argc, const char **argv)
         return 0;
     }
 
+    if (numThreads < 0 || queueSize < 1)
+    {
+        std::cerr << "ERROR: Invalid number of threads or queue size." << std::endl;
+        exit(1);
+    }
+
+    std::vector<int> frames;
+    if (!frameRange.empty())
+    {
+        if (usegpu || usegpuLegacy)
+        {
+            std::cerr << "ERROR: Option frames can't be used with the GPU color processing." << std::endl;
+            exit(1);
+        }
+
+        try
+        {
+            frames = ParseFrameRange(frameRange);
+        }
+        catch (const OCIO::Exception & e)
+        {
+            std::cerr << "ERROR: " << e.what() << std::endl;
+            exit(1);
+        }
+    }
+
 #ifndef OCIO_GPU_ENABLED
     if (usegpu || outputgpuInfo || usegpuLegacy)
     {
@@ -327,6 +404,132 @@ int main(int argc, const char **argv)
         std::cout << "Using GPU color processing." << std::endl;
     }
 
+    // Get the processor.
+    auto createProcessor = [&]() -> OCIO::ConstProcessorRcPtr
+    {
+        try
+        {
+            if (useLut)
+            {
+                // Create the OCIO processor for the specified transform.
+                OCIO::FileTransformRcPtr t = OCIO::FileTransform::Create();
+                t->setSrc(lutFile);
+                t->setInterpolation(OCIO::INTERP_BEST);
+    
+                return config->getProcessor(t);
+            }
+            else if (useDisplayView)
+            {
+                OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
+                t->setSrc(inputcolorspace);
+                t->setDisplay(display);
+                t->setView(view);
+                return config->getProcessor(t);
+            }
+            else if (useInvertView)
+            {
+                OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
+                t->setSrc(outputcolorspace);
+                t->setDisplay(display);
+                t->setView(view);
+                return config->getProcessor(t, OCIO::TRANSFORM_DIR_INVERSE);
+            }
+            else if (useNamedTransform)
+            {
+                auto nt = config->getNamedTransform(namedtransform);
+
+                if (nt)
+                {
+                    return config->getProcessor(nt, OCIO::TRANSFORM_DIR_FORWARD);
+                }
+                else
+                {
+                   std::cout << "ERROR: Could not get NamedTransform " << namedtransform << std::endl;
+                   exit(1);
+                }                
+            }
+            else if (useInvNamedTransform)
+            {
+                auto nt = config->getNamedTransform(namedtransform);
+
+                if (nt)
+                {
+                    return config->getProcessor(nt, OCIO::TRANSFORM_DIR_INVERSE);
+                }
+                else
+                {
+                    std::cout << "ERROR: Could not get NamedTransform " << namedtransform << std::endl;
+                    exit(1);
+                }
+            }
+            else
+            {
+                return config->getProcessor(inputcolorspace, outputcolorspace);
+            }
+        }
+        catch (const OCIO::Exception & e)
+        {
+            std::cout << "ERROR: OCIO failed with: " << e.what() << std::endl;
+            exit(1);
+        }
+        catch (...)
+        {
+            std::cout << "ERROR: Creating processor unknown failure." << std::endl;
+            exit(1);
+        }
+    };
+
+    // Set the provided image attributes and the output color space.
+    auto setOutputAttributes = [&](OCIO::ImageIO & img)
+    {
+        if (!SetImageAttributes(img, floatAttrs, intAttrs, stringAttrs))
+        {
+            exit(1);
+        }
+
+        if (useDisplayView)
+        {
+            outputcolorspace = config->getDisplayViewColorSpaceName(display, view);
+        }
+
+        if (outputcolorspace)
+        {
+            img.attribute("oiio:ColorSpace", outputcolorspace);
+
+            // Set the color space interopID if available.
+            auto cs = config->getColorSpace(outputcolorspace);
+            const char* interopID = cs ? cs->getInteropID() : nullptr;
+            if(interopID && *interopID)
+            {
+                img.attribute("colorInteropID", interopID);
+            }
+        }
+    };
+
+    if (!frames.empty())
+    {
+        // The processor is built once and used by all the frames.
+        OCIO::ConstProcessorRcPtr processor = createProcessor();
+
+        try
+        {
+            ConvertSequence(processor, inputimage, outputimage, frames, userOutputBitDepth,
+                            (unsigned)numThreads, (unsigned)queueSize, setOutputAttributes, verbose);
+        }
+        catch (const std::exception & e)
+        {
+            std::cerr << "ERROR: " << e.what() << std::endl;
+            exit(1);
+        }
+        catch (...)
+        {
+            std::cerr << "ERROR: Unknown error converting the image sequence." << std::endl;
+            exit(1);
+        }
+
+        return 0;
+    }
+
     OCIO::ImageIO imgInput;
     OCIO::ImageIO imgOutputCPU;
     // Default is to perform in-place conversion.
@@ -408,78 +611,7 @@ int main(int argc, const char **argv)
     try
     {
         // Get the processor.
-        OCIO::ConstProcessorRcPtr processor;
-
-        try
-        {
-            if (useLut)
-            {
-                // Create the OCIO processor for the specified transform.
-                OCIO::FileTransformRcPtr t = OCIO::FileTransform::Create();
-                t->setSrc(lutFile);
-                t->setInterpolation(OCIO::INTERP_BEST);
-    
-                processor = config->getProcessor(t);
-            }
-            else if (useDisplayView)
-            {
-                OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
-                t->setSrc(inputcolorspace);
-                t->setDisplay(display);
-                t->setView(view);
-                processor = config->getProcessor(t);
-            }
-            else if (useInvertView)
-            {
-                OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
-                t->setSrc(outputcolorspace);
-                t->setDisplay(display);
-                t->setView(view);
-                processor = config->getProcessor(t, OCIO::TRANSFORM_DIR_INVERSE);
-            }
-            else if (useNamedTransform)
-            {
-                auto nt = config->getNamedTransform(namedtransform);
-
-                if (nt)
-                {
-                    processor = config->getProcessor(nt, OCIO::TRANSFORM_DIR_FORWARD);
-                }
-                else
-                {
-                   std::cout << "ERROR: Could not get NamedTransform " << namedtransform << std::endl;
-                   exit(1);
-                }                
-            }
-            else if (useInvNamedTransform)
-            {
-                auto nt = config->getNamedTransform(namedtransform);
-
-                if (nt)
-                {
-                    processor = config->getProcessor(nt, OCIO::TRANSFORM_DIR_INVERSE);
-                }
-                else
-                {
-                    std::cout << "ERROR: Could not get NamedTransform " << namedtransform << std::endl;
-                    exit(1);
-                }
-            }
-            else
-            {
-                processor = config->getProcessor(inputcolorspace, outputcolorspace);
-            }
-        }
-        catch (const OCIO::Exception & e)
-        {
-            std::cout << "ERROR: OCIO failed with: " << e.what() << std::endl;
-            exit(1);
-        }
-        catch (...)
-        {
-            std::cout << "ERROR: Creating processor unknown failure." << std::endl;
-            exit(1);
-        }
+        OCIO::ConstProcessorRcPtr processor = createProcessor();
 
 #ifdef OCIO_GPU_ENABLED
         if (usegpu || usegpuLegacy)
@@ -518,27 +650,8 @@ int main(int argc, const char **argv)
                 to emulate OpenImageIO's decision making process.
             */
             const OCIO::BitDepth inputBitDepth = imgInput.getBitDepth();
-            OCIO::BitDepth outputBitDepth;
-
-            if (userOutputBitDepth != OCIO::BIT_DEPTH_UNKNOWN)
-            {
-                outputBitDepth = userOutputBitDepth;
-            }
-            else
-            {
-                if (inputBitDepth == OCIO::BIT_DEPTH_UINT16 || inputBitDepth == OCIO::BIT_DEPTH_F32)
-                {
-                    outputBitDepth = OCIO::BIT_DEPTH_F32;
-                }
-                else if (inputBitDepth == OCIO::BIT_DEPTH_UINT8 || inputBitDepth == OCIO::BIT_DEPTH_F16)
-                {
-                    outputBitDepth = OCIO::BIT_DEPTH_F16;
-                }
-                else
-                {
-                    throw OCIO::Exception("Unsupported input bitdepth, must be uint8, uint16, half or float.");
-                }
-            }
+            const OCIO::BitDepth outputBitDepth
+                = GetOutputBitDepth(inputBitDepth, userOutputBitDepth);
 
             OCIO::ConstCPUProcessorRcPtr cpuProcessor
                 = processor->getOptimizedCPUProcessor(inputBitDepth,
@@ -560,12 +673,12 @@ int main(int argc, const char **argv)
             {
                 OCIO::ImageDescRcPtr srcImgDesc = imgInput.getImageDesc();
                 OCIO::ImageDescRcPtr dstImgDesc = imgOutputCPU.getImageDesc();
-                cpuProcessor->apply(*srcImgDesc, *dstImgDesc);
+                cpuProcessor->apply(*srcImgDesc, *dstImgDesc, (unsigned)numThreads);
             }
             else
             {
                 OCIO::ImageDescRcPtr imgDesc = imgInput.getImageDesc();
-                cpuProcessor->apply(*imgDesc);
+                cpuProcessor->apply(*imgDesc, (unsigned)numThreads);
             }
 
             if (verbose)
@@ -593,7 +706,93 @@ int main(int argc, const char **argv)
         exit(1);
     }
 
-    // Set the provided image attributes.
+    // Write out the result.
+    try
+    {
+        setOutputAttributes(*imgOutput);
+
+        imgOutput->write(outputimage, userOutputBitDepth);
+    }
+    catch (...)
+    {
+        std::cerr << "ERROR: Writing file \"" << outputimage << "\"." << std::endl;
+        exit(1);
+    }
+
+    std::cout << "Wrote " << outputimage << std::endl;
+    std::cout << imgOutput->getImageDescStr() << std::endl;
+
+    return 0;
+}
+
+
+// Parse name=value parts.
+// return true on success.
+
+bool ParseNameValuePair(std::string& name,
+                        std::string& value,
+                        const std::string& input)
+{
+    // split string into name=value.
+    size_t pos = input.find('=');
+    if (pos==std::string::npos)
+    {
+        return false;
+    }
+
+    name = input.substr(0,pos);
+    value = input.substr(pos+1);
+    return true;
+}
+
+// return true on success.
+bool StringToFloat(float * fval, const char * str)
+{
+    if (!str)
+    {
+        return false;
+    }
+
+    std::istringstream inputStringstream(str);
+    float x;
+    if (!(inputStringstream >> x))
+    {
+        return false;
+    }
+
+    if (fval)
+    {
+        *fval = x;
+    }
+    return true;
+}
+
+bool StringToInt(int * ival, const char * str)
+{
+    if (!str)
+    {
+        return false;
+    }
+
+    std::istringstream inputStringstream(str);
+    int x;
+    if (!(inputStringstream >> x))
+    {
+        return false;
+    }
+
+    if (ival)
+    {
+        *ival = x;
+    }
+    return true;
+}
+
+bool SetImageAttributes(OCIO::ImageIO & img,
+                        const std::vector<std::string> & floatAttrs,
+                        const std::vector<std::string> & intAttrs,
+                        const std::vector<std::string> & stringAttrs)
+{
     bool parseError = false;
     for (unsigned int i=0; i<floatAttrs.size(); ++i)
     {
@@ -609,7 +808,7 @@ int main(int argc, const char **argv)
             continue;
         }
 
-        imgOutput->attribute(name, fval);
+        img.attribute(name, fval);
     }
 
     for (unsigned int i=0; i<intAttrs.size(); ++i)
@@ -625,7 +824,7 @@ int main(int argc, const char **argv)
             continue;
         }
 
-        imgOutput->attribute(name, ival);
+        img.attribute(name, ival);
     }
 
     for (unsigned int i=0; i<stringAttrs.size(); ++i)
@@ -639,108 +838,280 @@ int main(int argc, const char **argv)
             continue;
         }
 
-        imgOutput->attribute(name, value);
+        img.attribute(name, value);
     }
 
-    if (parseError)
+    return !parseError;
+}
+
+OCIO::BitDepth GetOutputBitDepth(OCIO::BitDepth inputBitDepth, OCIO::BitDepth userOutputBitDepth)
+{
+    if (userOutputBitDepth != OCIO::BIT_DEPTH_UNKNOWN)
     {
-        exit(1);
+        return userOutputBitDepth;
     }
 
-    // Write out the result.
-    try
+    if (inputBitDepth == OCIO::BIT_DEPTH_UINT16 || inputBitDepth == OCIO::BIT_DEPTH_F32)
     {
-        if (useDisplayView)
+        return OCIO::BIT_DEPTH_F32;
+    }
+    else if (inputBitDepth == OCIO::BIT_DEPTH_UINT8 || inputBitDepth == OCIO::BIT_DEPTH_F16)
+    {
+        return OCIO::BIT_DEPTH_F16;
+    }
+
+    throw OCIO::Exception("Unsupported input bitdepth, must be uint8, uint16, half or float.");
+}
+
+std::vector<int> ParseFrameRange(const std::string & str)
+{
+    std::vector<int> frames;
+    std::set<int> uniqueFrames;
+
+    std::istringstream ranges(str);
+    std::string range;
+    while (std::getline(ranges, range, ','))
+    {
+        // Parse 'first[-last[xstep]]'.
+        int first = 0, last = 0, step = 1;
+        char dash = 0, x = 0;
+
+        std::istringstream iss(range);
+        if (!(iss >> first))
         {
-            outputcolorspace = config->getDisplayViewColorSpaceName(display, view);
+            std::string err("Invalid frame range: '");
+            err += str + "'.";
+            throw OCIO::Exception(err.c_str());
         }
 
-        if (outputcolorspace)
+        last = first;
+        if (iss >> dash)
         {
-            imgOutput->attribute("oiio:ColorSpace", outputcolorspace);
-
-            // Set the color space interopID if available.
-            auto cs = config->getColorSpace(outputcolorspace);
-            const char* interopID = cs ? cs->getInteropID() : nullptr;
-            if(interopID && *interopID)
+            if (dash != '-' || !(iss >> last) || (iss >> x && (x != 'x' || !(iss >> step))))
             {
-                imgOutput->attribute("colorInteropID", interopID);
+                std::string err("Invalid frame range: '");
+                err += str + "'.";
+                throw OCIO::Exception(err.c_str());
             }
         }
 
-        imgOutput->write(outputimage, userOutputBitDepth);
-    }
-    catch (...)
-    {
-        std::cerr << "ERROR: Writing file \"" << outputimage << "\"." << std::endl;
-        exit(1);
-    }
-
-    std::cout << "Wrote " << outputimage << std::endl;
-    std::cout << imgOutput->getImageDescStr() << std::endl;
-
-    return 0;
-}
-
+        std::string remaining;
+        if (iss >> remaining || last < first || step < 1)
+        {
+            std::string err("Invalid frame range: '");
+            err += str + "'.";
+            throw OCIO::Exception(err.c_str());
+        }
 
-// Parse name=value parts.
-// return true on success.
+        for (int frame = first; frame <= last; frame += step)
+        {
+            // Each frame is only converted once, in the order of the first occurrence.
+            if (uniqueFrames.insert(frame).second)
+            {
+                frames.push_back(frame);
+            }
+        }
+    }
 
-bool ParseNameValuePair(std::string& name,
-                        std::string& value,
-                        const std::string& input)
-{
-    // split string into name=value.
-    size_t pos = input.find('=');
-    if (pos==std::string::npos)
+    if (frames.empty())
     {
-        return false;
+        std::string err("Invalid frame range: '");
+        err += str + "'.";
+        throw OCIO::Exception(err.c_str());
     }
 
-    name = input.substr(0,pos);
-    value = input.substr(pos+1);
-    return true;
+    return frames;
 }
 
-// return true on success.
-bool StringToFloat(float * fval, const char * str)
+std::string GetFrameFilename(const std::string & pattern, int frame)
 {
-    if (!str)
+    // Look for the last '#' sequence (e.g. 'img.####.exr').
+    const size_t hashEnd = pattern.find_last_of('#');
+    if (hashEnd != std::string::npos)
     {
-        return false;
-    }
+        size_t hashStart = hashEnd;
+        while (hashStart > 0 && pattern[hashStart - 1] == '#')
+        {
+            --hashStart;
+        }
 
-    std::istringstream inputStringstream(str);
-    float x;
-    if (!(inputStringstream >> x))
-    {
-        return false;
+        std::ostringstream oss;
+        oss << std::setfill('0') << std::setw(int(hashEnd - hashStart + 1)) << frame;
+        return pattern.substr(0, hashStart) + oss.str() + pattern.substr(hashEnd + 1);
     }
 
-    if (fval)
+    // Look for a printf-like placeholder (e.g. 'img.%04d.exr').
+    const size_t percent = pattern.find_last_of('%');
+    if (percent != std::string::npos)
     {
-        *fval = x;
+        size_t end = percent + 1;
+        while (end < pattern.size() && std::isdigit((unsigned char)pattern[end]))
+        {
+            ++end;
+        }
+
+        if (end < pattern.size() && pattern[end] == 'd')
+        {
+            const int width = end > percent + 1 ? std::atoi(pattern.c_str() + percent + 1) : 0;
+
+            std::ostringstream oss;
+            oss << std::setfill('0') << std::setw(width) << frame;
+            return pattern.substr(0, percent) + oss.str() + pattern.substr(end + 1);
+        }
     }
-    return true;
+
+    std::string err("The image name '");
+    err += pattern + "' has no frame number placeholder (e.g. 'img.####.exr' or 'img.%04d.exr').";
+    throw OCIO::Exception(err.c_str());
 }
 
-bool StringToInt(int * ival, const char * str)
+void ConvertSequence(const OCIO::ConstProcessorRcPtr & processor,
+                     const std::string & inputPattern,
+                     const std::string & outputPattern,
+                     const std::vector<int> & frames,
+                     OCIO::BitDepth userOutputBitDepth,
+                     unsigned numThreads,
+                     unsigned queueSize,
+                     const std::function<void(OCIO::ImageIO &)> & setAttributes,
+                     bool verbose)
 {
-    if (!str)
+    // Validate the file names before starting any processing.
+    for (int frame : { frames.front(), frames.back() })
     {
-        return false;
+        GetFrameFilename(inputPattern, frame);
+        GetFrameFilename(outputPattern, frame);
     }
 
-    std::istringstream inputStringstream(str);
-    int x;
-    if (!(inputStringstream >> x))
+    typedef std::unique_ptr<OCIO::ImageIO> ImageIORcPtr;
+
+    // The frames being read (i.e. decoded) ahead of the processed frame.
+    std::deque<std::future<ImageIORcPtr>> reads;
+    size_t nextRead = 0;
+
+    // The frames being written (i.e. encoded) behind the processed frame.
+    std::deque<std::future<void>> writes;
+
+    // The CPU processors are built once per pair of bit-depths, which is usually a single
+    // one for a complete image sequence.
+    std::vector<OCIO::ConstCPUProcessorRcPtr> cpuProcessors;
+
+    const std::chrono::high_resolution_clock::time_point start
+        = std::chrono::high_resolution_clock::now();
+
+    for (int frame : frames)
     {
-        return false;
+        while (reads.size() < queueSize && nextRead < frames.size())
+        {
+            const std::string filename = GetFrameFilename(inputPattern, frames[nextRead++]);
+            reads.push_back(std::async(std::launch::async, [filename]()
+                {
+                    ImageIORcPtr img(new OCIO::ImageIO());
+                    try
+                    {
+                        img->read(filename);
+                    }
+                    catch (const std::exception & e)
+                    {
+                        std::string err("Loading file '");
+                        err += filename + "' failed: " + e.what();
+                        throw OCIO::Exception(err.c_str());
+                    }
+                    return img;
+                }));
+        }
+
+        ImageIORcPtr imgInput = reads.front().get();
+        reads.pop_front();
+
+        const OCIO::BitDepth inputBitDepth  = imgInput->getBitDepth();
+        const OCIO::BitDepth outputBitDepth = GetOutputBitDepth(inputBitDepth, userOutputBitDepth);
+
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+        for (const auto & cpu : cpuProcessors)
+        {
+            if (cpu->getInputBitDepth() == inputBitDepth && cpu->getOutputBitDepth() == outputBitDepth)
+            {
+                cpuProcessor = cpu;
+                break;
+            }
+        }
+
+        if (!cpuProcessor)
+        {
+            cpuProcessor = processor->getOptimizedCPUProcessor(inputBitDepth,
+                                                               outputBitDepth,
+                                                               OCIO::OPTIMIZATION_DEFAULT);
+            cpuProcessors.push_back(cpuProcessor);
+        }
+
+        const std::chrono::high_resolution_clock::time_point processStart
+            = std::chrono::high_resolution_clock::now();
+
+        ImageIORcPtr imgOutput;
+        if (inputBitDepth != outputBitDepth)
+        {
+            imgOutput.reset(new OCIO::ImageIO());
+            imgOutput->init(*imgInput, outputBitDepth);
+
+            OCIO::ImageDescRcPtr srcImgDesc = imgInput->getImageDesc();
+            OCIO::ImageDescRcPtr dstImgDesc = imgOutput->getImageDesc();
+            cpuProcessor->apply(*srcImgDesc, *dstImgDesc, numThreads);
+        }
+        else
+        {
+            // Perform an in-place conversion.
+            OCIO::ImageDescRcPtr imgDesc = imgInput->getImageDesc();
+            cpuProcessor->apply(*imgDesc, numThreads);
+            imgOutput = std::move(imgInput);
+        }
+
+        if (verbose)
+        {
+            const std::chrono::duration<float, std::milli> duration
+                = std::chrono::high_resolution_clock::now() - processStart;
+
+            std::cout << "Frame " << frame << ": CPU processing took: "
+                      << duration.count() << " ms" << std::endl;
+        }
+
+        setAttributes(*imgOutput);
+
+        // Limit the number of frames waiting to be written.
+        while (writes.size() >= queueSize)
+        {
+            writes.front().get();
+            writes.pop_front();
+        }
+
+        const std::string filename = GetFrameFilename(outputPattern, frame);
+        std::shared_ptr<OCIO::ImageIO> img(std::move(imgOutput));
+        writes.push_back(std::async(std::launch::async, [img, filename, userOutputBitDepth]()
+            {
+                try
+                {
+                    img->write(filename, userOutputBitDepth);
+                }
+                catch (const std::exception & e)
+                {
+                    std::string err("Writing file '");
+                    err += filename + "' failed: " + e.what();
+                    throw OCIO::Exception(err.c_str());
+                }
+            }));
+
+        std::cout << "Writing " << filename << std::endl;
     }
 
-    if (ival)
+    while (!writes.empty())
     {
-        *ival = x;
+        writes.front().get();
+        writes.pop_front();
     }
-    return true;
+
+    const std::chrono::duration<float> duration
+        = std::chrono::high_resolution_clock::now() - start;
+
+    std::cout << std::endl;
+    std::cout << "Converted " << frames.size() << " frames in " << duration.count() << " s ("
+              << (float(frames.size()) / duration.count()) << " frames/s)" << std::endl;
 }
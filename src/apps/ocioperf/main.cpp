@@ -7,10 +7,20 @@
 #include "apputils/argparse.h"
 #include "utils/StringUtils.h"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
 #include <limits>
+#include <locale>
 #include <iostream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -97,6 +107,9 @@ public:
         m_started = false;
     }
 
+    // Total measured time of all the iterations.
+    std::chrono::duration<float, std::milli> getDuration() const { return m_duration; }
+
 private:
     const std::string m_explanations;
     const unsigned m_iterations { 1 };
@@ -167,6 +180,642 @@ void ProcessPixels(CustomMeasure & m,
     m.pause();
 }
 
+OCIO::BitDepth GetBitDepthFromString(const std::string & str)
+{
+    if (str == "ui8")  return OCIO::BIT_DEPTH_UINT8;
+    if (str == "ui10") return OCIO::BIT_DEPTH_UINT10;
+    if (str == "ui12") return OCIO::BIT_DEPTH_UINT12;
+    if (str == "ui16") return OCIO::BIT_DEPTH_UINT16;
+    if (str == "f16")  return OCIO::BIT_DEPTH_F16;
+    if (str == "f32")  return OCIO::BIT_DEPTH_F32;
+
+    std::string err("Unsupported bit-depth: ");
+    err += str;
+    throw OCIO::Exception(err.c_str());
+}
+
+size_t GetChannelSizeInBytes(OCIO::BitDepth bitDepth)
+{
+    switch (bitDepth)
+    {
+        case OCIO::BIT_DEPTH_UINT8:
+            return 1;
+        case OCIO::BIT_DEPTH_UINT10:
+        case OCIO::BIT_DEPTH_UINT12:
+        case OCIO::BIT_DEPTH_UINT16:
+        case OCIO::BIT_DEPTH_F16:
+            return 2;
+        case OCIO::BIT_DEPTH_F32:
+            return 4;
+        default:
+            throw OCIO::Exception("Unsupported bit-depth.");
+    }
+}
+
+// Generate a synthetic RGBA image by emulating a LUT3D identity algorithm that steps through
+// many different colors.  Need to avoid a constant image, simple gradients, or anything that
+// would result in more cache hits than a typical image.  Also, want to step through a wide
+// range of colors, including outside [0,1], in case some algorithms are faster or slower for
+// certain colors.
+std::vector<float> CreateSyntheticImage(size_t numPixels)
+{
+    static constexpr size_t numChannels = 4;
+    static constexpr size_t length      = 201;
+    static constexpr float stepValue    = 1.0f / ((float)length - 1.0f);
+
+    static constexpr float min   = -1.0f;
+    static constexpr float max   =  2.0f;
+    static constexpr float range = max - min;
+
+    // Retrofit value in the range.
+    auto adjustValue = [](float val) -> float
+    {
+        return val * range + min;
+    };
+
+    std::vector<float> img(numPixels * numChannels);
+
+    for (size_t idx = 0; idx < numPixels; ++idx)
+    {
+        img[numChannels * idx + 0] = adjustValue( ((idx / length / length) % length) * stepValue );
+        img[numChannels * idx + 1] = adjustValue( ((idx / length) % length) * stepValue );
+        img[numChannels * idx + 2] = adjustValue( (idx % length) * stepValue );
+
+        img[numChannels * idx + 3] = adjustValue( float(idx) / numPixels );
+    }
+
+    return img;
+}
+
+
+//
+// The benchmark mode sweeps the processing of a corpus of transforms over thread counts,
+// image sizes, tile sizes, bit-depth pairs and image buffer layouts.
+//
+
+// An RGBA image of any bit-depth stored either packed or planar.
+class BenchmarkImage
+{
+public:
+    BenchmarkImage(long width, long height, OCIO::BitDepth bitDepth, bool planar)
+        :   m_width(width)
+        ,   m_height(height)
+        ,   m_bitDepth(bitDepth)
+        ,   m_planar(planar)
+        ,   m_chanSize(GetChannelSizeInBytes(bitDepth))
+        ,   m_buffer(size_t(width) * size_t(height) * 4 * m_chanSize)
+    {
+    }
+
+    // Return the image descriptor of a rectangular region of the image.
+    std::unique_ptr<OCIO::ImageDesc> createDesc(long x, long y, long width, long height)
+    {
+        const size_t offset = (size_t(y) * size_t(m_width) + size_t(x)) * m_chanSize;
+
+        if (m_planar)
+        {
+            const size_t planeSize = size_t(m_width) * size_t(m_height) * m_chanSize;
+            char * data = &m_buffer[0] + offset;
+
+            return std::unique_ptr<OCIO::ImageDesc>(
+                new OCIO::PlanarImageDesc(data, data + planeSize,
+                                          data + 2 * planeSize, data + 3 * planeSize,
+                                          width, height, m_bitDepth,
+                                          m_chanSize, m_width * m_chanSize));
+        }
+
+        return std::unique_ptr<OCIO::ImageDesc>(
+            new OCIO::PackedImageDesc(&m_buffer[0] + 4 * offset, width, height, 4, m_bitDepth,
+                                      m_chanSize, 4 * m_chanSize, 4 * m_width * m_chanSize));
+    }
+
+    // Fill the image with the synthetic image, converted to the image bit-depth.
+    void fill()
+    {
+        std::vector<float> img = CreateSyntheticImage(size_t(m_width) * size_t(m_height));
+        OCIO::PackedImageDesc srcDesc(&img[0], m_width, m_height, 4);
+
+        OCIO::ConstCPUProcessorRcPtr cpu
+            = OCIO::Config::CreateRaw()->getProcessor(OCIO::MatrixTransform::Create())
+                ->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, m_bitDepth,
+                                           OCIO::OPTIMIZATION_DEFAULT);
+
+        std::unique_ptr<OCIO::ImageDesc> dstDesc = createDesc(0, 0, m_width, m_height);
+        cpu->apply(srcDesc, *dstDesc);
+    }
+
+private:
+    const long m_width;
+    const long m_height;
+    const OCIO::BitDepth m_bitDepth;
+    const bool m_planar;
+    const long m_chanSize;
+    std::vector<char> m_buffer;
+};
+
+struct BenchmarkTransform
+{
+    std::string m_name;
+    OCIO::ConstProcessorRcPtr m_processor;
+};
+
+struct BenchmarkSettings
+{
+    std::vector<unsigned> m_threads;
+    std::vector<std::pair<long, long>> m_sizes;
+    std::vector<long> m_tiles;
+    std::vector<std::pair<std::string, std::string>> m_bitDepths;
+    std::vector<bool> m_planar;
+    unsigned m_iterations = 10;
+    OCIO::OptimizationFlags m_optimFlags = OCIO::OPTIMIZATION_DEFAULT;
+    bool m_opStats = false;
+};
+
+struct BenchmarkStage
+{
+    std::string m_name;
+    double m_ms = 0.;  // Per iteration and summed over all the threads.
+    unsigned long long m_numPixels = 0;
+};
+
+struct BenchmarkResult
+{
+    std::string m_transform;
+    long m_width = 0;
+    long m_height = 0;
+    long m_tile = 0;
+    unsigned m_threads = 0;
+    std::string m_inBitDepth, m_outBitDepth;
+    bool m_planar = false;
+    unsigned m_iterations = 0;
+    double m_meanMs = 0.;
+    double m_stddevMs = 0.;
+    double m_minMs = 0.;
+    double m_maxMs = 0.;
+    double m_pixelsPerSecond = 0.;
+    std::vector<BenchmarkStage> m_stages;
+};
+
+std::vector<std::string> SplitList(const std::string & str)
+{
+    std::vector<std::string> list;
+    for (const auto & item : StringUtils::Split(str, ','))
+    {
+        const std::string value = StringUtils::Trim(item);
+        if (!value.empty())
+        {
+            list.push_back(value);
+        }
+    }
+    return list;
+}
+
+long ParsePositiveNumber(const std::string & str, const char * option)
+{
+    char * end = nullptr;
+    const long value = std::strtol(str.c_str(), &end, 10);
+    if (end == str.c_str() || *end != '\0' || value < 0)
+    {
+        std::ostringstream oss;
+        oss << "Invalid value '" << str << "' for " << option << ".";
+        throw OCIO::Exception(oss.str().c_str());
+    }
+    return value;
+}
+
+BenchmarkSettings ParseBenchmarkSettings(const std::string & threads,
+                                         const std::string & sizes,
+                                         const std::string & tiles,
+                                         const std::string & bitDepths,
+                                         const std::string & layouts)
+{
+    BenchmarkSettings settings;
+
+    for (const auto & item : SplitList(threads))
+    {
+        settings.m_threads.push_back((unsigned)ParsePositiveNumber(item, "--threads"));
+    }
+
+    for (const auto & item : SplitList(sizes))
+    {
+        const std::vector<std::string> dims = StringUtils::Split(StringUtils::Lower(item), 'x');
+        if (dims.size() != 2)
+        {
+            std::string err("Invalid image size '");
+            err += item + "', expecting 'widthxheight'.";
+            throw OCIO::Exception(err.c_str());
+        }
+
+        const long width  = ParsePositiveNumber(dims[0], "--sizes");
+        const long height = ParsePositiveNumber(dims[1], "--sizes");
+        if (width == 0 || height == 0)
+        {
+            std::string err("Invalid image size '");
+            err += item + "'.";
+            throw OCIO::Exception(err.c_str());
+        }
+        settings.m_sizes.emplace_back(width, height);
+    }
+
+    for (const auto & item : SplitList(tiles))
+    {
+        settings.m_tiles.push_back(ParsePositiveNumber(item, "--tiles"));
+    }
+
+    for (const auto & item : SplitList(bitDepths))
+    {
+        const std::vector<std::string> pair = StringUtils::Split(item, ':');
+        if (pair.size() != 2)
+        {
+            std::string err("Invalid bit-depth pair '");
+            err += item + "', expecting 'in:out'.";
+            throw OCIO::Exception(err.c_str());
+        }
+
+        // Validate the bit-depths.
+        GetBitDepthFromString(pair[0]);
+        GetBitDepthFromString(pair[1]);
+        settings.m_bitDepths.emplace_back(pair[0], pair[1]);
+    }
+
+    for (const auto & item : SplitList(layouts))
+    {
+        if (item != "packed" && item != "planar")
+        {
+            std::string err("Invalid image layout '");
+            err += item + "', expecting 'packed' or 'planar'.";
+            throw OCIO::Exception(err.c_str());
+        }
+        settings.m_planar.push_back(item == "planar");
+    }
+
+    return settings;
+}
+
+// Process the complete image either at once with the multithreaded apply, or by tiles
+// concurrently processed by numThreads host threads (i.e. the usual host application pattern).
+class BenchmarkRunner
+{
+public:
+    BenchmarkRunner(const OCIO::ConstCPUProcessorRcPtr & cpu,
+                    BenchmarkImage & src, BenchmarkImage & dst,
+                    long width, long height, long tile, unsigned numThreads)
+        :   m_cpu(cpu)
+        ,   m_numThreads(numThreads)
+    {
+        if (tile == 0)
+        {
+            m_srcTiles.push_back(src.createDesc(0, 0, width, height));
+            m_dstTiles.push_back(dst.createDesc(0, 0, width, height));
+            return;
+        }
+
+        for (long y = 0; y < height; y += tile)
+        {
+            for (long x = 0; x < width; x += tile)
+            {
+                const long w = std::min(tile, width - x);
+                const long h = std::min(tile, height - y);
+                m_srcTiles.push_back(src.createDesc(x, y, w, h));
+                m_dstTiles.push_back(dst.createDesc(x, y, w, h));
+            }
+        }
+
+        if (m_numThreads == 0)
+        {
+            m_numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+    }
+
+    void run() const
+    {
+        if (m_srcTiles.size() == 1)
+        {
+            m_cpu->apply(*m_srcTiles[0], *m_dstTiles[0], m_numThreads);
+            return;
+        }
+
+        std::atomic<size_t> nextTile{ 0 };
+
+        auto processTiles = [&]()
+        {
+            for (size_t idx = nextTile++; idx < m_srcTiles.size(); idx = nextTile++)
+            {
+                m_cpu->apply(*m_srcTiles[idx], *m_dstTiles[idx]);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (unsigned idx = 1; idx < m_numThreads; ++idx)
+        {
+            threads.emplace_back(processTiles);
+        }
+
+        processTiles();
+
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+private:
+    OCIO::ConstCPUProcessorRcPtr m_cpu;
+    unsigned m_numThreads;
+    std::vector<std::unique_ptr<OCIO::ImageDesc>> m_srcTiles;
+    std::vector<std::unique_ptr<OCIO::ImageDesc>> m_dstTiles;
+};
+
+BenchmarkResult RunBenchmark(const BenchmarkTransform & transform,
+                             const BenchmarkSettings & settings,
+                             BenchmarkImage & src, BenchmarkImage & dst,
+                             long width, long height, long tile, unsigned numThreads,
+                             const std::pair<std::string, std::string> & bitDepths,
+                             bool planar)
+{
+    BenchmarkResult result;
+    result.m_transform   = transform.m_name;
+    result.m_width       = width;
+    result.m_height      = height;
+    result.m_tile        = tile;
+    result.m_threads     = numThreads;
+    result.m_inBitDepth  = bitDepths.first;
+    result.m_outBitDepth = bitDepths.second;
+    result.m_planar      = planar;
+    result.m_iterations  = settings.m_iterations;
+
+    OCIO::ConstCPUProcessorRcPtr cpu
+        = transform.m_processor->getOptimizedCPUProcessor(GetBitDepthFromString(bitDepths.first),
+                                                          GetBitDepthFromString(bitDepths.second),
+                                                          settings.m_optimFlags);
+
+    const BenchmarkRunner runner(cpu, src, dst, width, height, tile, numThreads);
+
+    // The first run is not measured as it warms up the caches and the processing buffers.
+    runner.run();
+
+    if (settings.m_opStats)
+    {
+        cpu->enableStats(true);
+        cpu->resetStats();
+    }
+
+    std::vector<double> durations;
+    durations.reserve(settings.m_iterations);
+
+    for (unsigned iter = 0; iter < settings.m_iterations; ++iter)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        runner.run();
+        const auto end = std::chrono::steady_clock::now();
+
+        durations.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    if (settings.m_opStats)
+    {
+        cpu->enableStats(false);
+
+        for (int idx = 0; idx < cpu->getNumStatsStages(); ++idx)
+        {
+            const OCIO::CPUProcessorStageStats stats = cpu->getStatsStage(idx);
+
+            BenchmarkStage stage;
+            stage.m_name      = stats.m_name;
+            stage.m_ms        = stats.m_time * 1000. / settings.m_iterations;
+            stage.m_numPixels = stats.m_numPixels;
+            result.m_stages.push_back(stage);
+        }
+    }
+
+    double sum = 0.;
+    for (double duration : durations)
+    {
+        sum += duration;
+    }
+    result.m_meanMs = sum / durations.size();
+
+    double variance = 0.;
+    for (double duration : durations)
+    {
+        variance += (duration - result.m_meanMs) * (duration - result.m_meanMs);
+    }
+    if (durations.size() > 1)
+    {
+        variance /= double(durations.size() - 1);
+    }
+    result.m_stddevMs = std::sqrt(variance);
+
+    result.m_minMs = *std::min_element(durations.begin(), durations.end());
+    result.m_maxMs = *std::max_element(durations.begin(), durations.end());
+
+    result.m_pixelsPerSecond = result.m_meanMs > 0.
+        ? double(width) * double(height) * 1000. / result.m_meanMs
+        : 0.;
+
+    return result;
+}
+
+std::string JsonEscape(const std::string & str)
+{
+    std::ostringstream oss;
+    for (char c : str)
+    {
+        switch (c)
+        {
+            case '"':  oss << "\\\""; break;
+            case '\\': oss << "\\\\"; break;
+            case '\n': oss << "\\n";  break;
+            case '\t': oss << "\\t";  break;
+            default:
+                if ((unsigned char)c < 0x20)
+                {
+                    oss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c)
+                        << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    oss << c;
+                }
+                break;
+        }
+    }
+    return oss.str();
+}
+
+std::string CsvEscape(const std::string & str)
+{
+    if (str.find_first_of(",\"\n") == std::string::npos)
+    {
+        return str;
+    }
+    return "\"" + StringUtils::Replace(str, "\"", "\"\"") + "\"";
+}
+
+void WriteJson(std::ostream & os, const std::vector<BenchmarkResult> & results)
+{
+    os.precision(std::numeric_limits<double>::max_digits10);
+
+    os << "{\n";
+    os << "  \"ocio_version\": \"" << OCIO::GetVersion() << "\",\n";
+    os << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+    os << "  \"results\": [";
+
+    for (size_t idx = 0; idx < results.size(); ++idx)
+    {
+        const BenchmarkResult & r = results[idx];
+
+        os << (idx == 0 ? "\n" : ",\n");
+        os << "    {\n";
+        os << "      \"transform\": \"" << JsonEscape(r.m_transform) << "\",\n";
+        os << "      \"width\": " << r.m_width << ",\n";
+        os << "      \"height\": " << r.m_height << ",\n";
+        os << "      \"tile\": " << r.m_tile << ",\n";
+        os << "      \"threads\": " << r.m_threads << ",\n";
+        os << "      \"in_bitdepth\": \"" << r.m_inBitDepth << "\",\n";
+        os << "      \"out_bitdepth\": \"" << r.m_outBitDepth << "\",\n";
+        os << "      \"layout\": \"" << (r.m_planar ? "planar" : "packed") << "\",\n";
+        os << "      \"iterations\": " << r.m_iterations << ",\n";
+        os << "      \"mean_ms\": " << r.m_meanMs << ",\n";
+        os << "      \"stddev_ms\": " << r.m_stddevMs << ",\n";
+        os << "      \"min_ms\": " << r.m_minMs << ",\n";
+        os << "      \"max_ms\": " << r.m_maxMs << ",\n";
+        os << "      \"pixels_per_second\": " << r.m_pixelsPerSecond << ",\n";
+        os << "      \"ops\": [";
+
+        for (size_t stage = 0; stage < r.m_stages.size(); ++stage)
+        {
+            const BenchmarkStage & s = r.m_stages[stage];
+
+            os << (stage == 0 ? "\n" : ",\n");
+            os << "        { \"name\": \"" << JsonEscape(s.m_name) << "\", "
+               << "\"ms\": " << s.m_ms << ", "
+               << "\"pixels\": " << s.m_numPixels << " }";
+        }
+
+        os << (r.m_stages.empty() ? "]\n" : "\n      ]\n");
+        os << "    }";
+    }
+
+    os << (results.empty() ? "]\n" : "\n  ]\n");
+    os << "}\n";
+}
+
+void WriteCsv(std::ostream & os, const std::vector<BenchmarkResult> & results)
+{
+    os.precision(std::numeric_limits<double>::max_digits10);
+
+    // The per-op timings are in one column as a list of 'name=ms' separated by ';'.
+    os << "transform,width,height,tile,threads,in_bitdepth,out_bitdepth,layout,iterations,"
+          "mean_ms,stddev_ms,min_ms,max_ms,pixels_per_second,ops\n";
+
+    for (const auto & r : results)
+    {
+        std::ostringstream ops;
+        ops.precision(std::numeric_limits<double>::max_digits10);
+        for (size_t stage = 0; stage < r.m_stages.size(); ++stage)
+        {
+            ops << (stage == 0 ? "" : ";") << r.m_stages[stage].m_name << "="
+                << r.m_stages[stage].m_ms;
+        }
+
+        os << CsvEscape(r.m_transform) << ","
+           << r.m_width << ","
+           << r.m_height << ","
+           << r.m_tile << ","
+           << r.m_threads << ","
+           << r.m_inBitDepth << ","
+           << r.m_outBitDepth << ","
+           << (r.m_planar ? "planar" : "packed") << ","
+           << r.m_iterations << ","
+           << r.m_meanMs << ","
+           << r.m_stddevMs << ","
+           << r.m_minMs << ","
+           << r.m_maxMs << ","
+           << r.m_pixelsPerSecond << ","
+           << CsvEscape(ops.str()) << "\n";
+    }
+}
+
+void WriteResults(const std::string & filename,
+                  const std::vector<BenchmarkResult> & results,
+                  void (*writer)(std::ostream &, const std::vector<BenchmarkResult> &))
+{
+    std::ofstream ofs(filename.c_str(), std::ios_base::out | std::ios_base::trunc);
+    if (!ofs)
+    {
+        std::string err("Could not open the output file: ");
+        err += filename;
+        throw OCIO::Exception(err.c_str());
+    }
+
+    writer(ofs, results);
+}
+
+std::vector<BenchmarkResult> RunBenchmarks(const std::vector<BenchmarkTransform> & transforms,
+                                           const BenchmarkSettings & settings,
+                                           bool verbose)
+{
+    std::vector<BenchmarkResult> results;
+
+    for (const auto & size : settings.m_sizes)
+    {
+        const long width  = size.first;
+        const long height = size.second;
+
+        for (const auto & bitDepths : settings.m_bitDepths)
+        {
+            const OCIO::BitDepth inBitDepth  = GetBitDepthFromString(bitDepths.first);
+            const OCIO::BitDepth outBitDepth = GetBitDepthFromString(bitDepths.second);
+
+            for (bool planar : settings.m_planar)
+            {
+                // The images are shared by all the transforms. Note that the source image is
+                // never modified as the processing always uses distinct buffers.
+                BenchmarkImage src(width, height, inBitDepth, planar);
+                src.fill();
+                BenchmarkImage dst(width, height, outBitDepth, planar);
+
+                for (const auto & transform : transforms)
+                {
+                    for (long tile : settings.m_tiles)
+                    {
+                        for (unsigned numThreads : settings.m_threads)
+                        {
+                            results.push_back(RunBenchmark(transform, settings, src, dst,
+                                                           width, height, tile, numThreads,
+                                                           bitDepths, planar));
+
+                            const BenchmarkResult & r = results.back();
+
+                            std::cout << r.m_transform << "  "
+                                      << r.m_width << "x" << r.m_height
+                                      << "  tile " << r.m_tile
+                                      << "  threads " << r.m_threads
+                                      << "  " << r.m_inBitDepth << "->" << r.m_outBitDepth
+                                      << "  " << (r.m_planar ? "planar" : "packed")
+                                      << ":  " << r.m_meanMs << " ms (+/- " << r.m_stddevMs
+                                      << ")  " << (r.m_pixelsPerSecond / 1.0e6)
+                                      << " Mpixels/s" << std::endl;
+
+                            if (verbose)
+                            {
+                                for (const auto & stage : r.m_stages)
+                                {
+                                    std::cout << "    " << stage.m_name << ": "
+                                              << stage.m_ms << " ms" << std::endl;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return results;
+}
+
 int main(int argc, const char **argv)
 {
     bool help = false;
@@ -175,8 +824,13 @@ int main(int argc, const char **argv)
     std::string transformFile;
     std::string inColorSpace, outColorSpace, display, view;
     std::string inBitDepthStr("f32"), outBitDepthStr("f32");
-    unsigned iterations = 50;
-    bool nocache = false, nooptim = false;
+    unsigned iterations = 0;
+    bool nocache = false, nooptim = false, parse = false, write = false;
+
+    // The benchmark mode options.
+    std::string threadsStr, sizesStr, tilesStr, bitDepthPairsStr, layoutsStr;
+    std::string jsonFile, csvFile;
+    bool builtins = false, allColorSpaces = false, opStats = false;
 
     bool useColorspaces = false;
     bool useDisplayview = false;
@@ -188,7 +842,12 @@ int main(int argc, const char **argv)
 
     ArgParse ap;
     ap.options("ocioperf -- apply and measure a color transformation processing\n\n"
-               "usage: ocioperf [options] --transform /path/to/file.clf\n\n",
+               "usage: ocioperf [options] --transform /path/to/file.clf\n"
+               "       ocioperf --builtins --threads 1,4,0 --sizes 1920x1080,3840x2160 "
+               "--json results.json\n\n"
+               "Any of the benchmark options switches to the benchmark mode which sweeps the "
+               "image processing of all the requested transforms over all the combinations of "
+               "the thread counts, image sizes, tile sizes, bit-depth pairs and image layouts.\n\n",
                "--h",                       &help,              
                                             "Display the help and exit",
                "--help",                    &help,              
@@ -211,13 +870,49 @@ int main(int argc, const char **argv)
                                             "Provide the (display, view) pair and output color space to apply on the image",
                "--iconfig %s",              &inputconfig,
                                             "Input .ocio configuration file (default: $OCIO)",
-               "--iter %d",                 &iterations, "Provide the number of iterations on the processing. Default is 50",
+               "--iter %d",                 &iterations, "Provide the number of iterations on the processing. "\
+                                            "Default is 50 (10 in benchmark mode)",
                "--bitdepths %s %s",         &inBitDepthStr, &outBitDepthStr,
                                             "Provide input and output bit-depths (i.e. ui16, f32). Default is f32",
                "--nocache",                 &nocache, 
                                             "Bypass all caches. Default is false",
                "--nooptim",                 &nooptim, 
                                             "Disable the processor optimizations. Default is false",
+               "--parse",                   &parse,
+                                            "Also measure the read throughput (MB/s) of the --transform "\
+                                            "file, all the caches being cleared at each iteration",
+               "--write",                   &write,
+                                            "Also measure the write throughput (MB/s) of the --transform "\
+                                            "processor as a CLF file, with the fast and the stream based "\
+                                            "formatting of the values",
+               "<SEPARATOR>", "\nBenchmark mode:",
+               "--threads %s",              &threadsStr,
+                                            "Comma separated list of thread counts where 0 means all "\
+                                            "the hardware threads. Default is 1",
+               "--sizes %s",                &sizesStr,
+                                            "Comma separated list of image sizes (i.e. 1920x1080). "\
+                                            "Default is 3840x2160",
+               "--tiles %s",                &tilesStr,
+                                            "Comma separated list of square tile sizes where 0 means the "\
+                                            "complete image at once. The tiles are processed concurrently "\
+                                            "by the threads. Default is 0",
+               "--bitdepthpairs %s",        &bitDepthPairsStr,
+                                            "Comma separated list of input:output bit-depths (i.e. "\
+                                            "ui8:f32,f32:f32). Default is the --bitdepths pair",
+               "--layouts %s",              &layoutsStr,
+                                            "Comma separated list of image layouts (i.e. packed,planar). "\
+                                            "Default is packed",
+               "--builtins",                &builtins,
+                                            "Add all the built-in transforms to the processed transforms",
+               "--allcolorspaces",          &allColorSpaces,
+                                            "Add all the pairs of active color spaces of the config to "\
+                                            "the processed transforms",
+               "--opstats",                 &opStats,
+                                            "Collect the processing time of each op",
+               "--json %s",                 &jsonFile,
+                                            "Write the results to a JSON file",
+               "--csv %s",                  &csvFile,
+                                            "Write the results to a CSV file",
                NULL);
 
     if (ap.parse (argc, argv) < 0)
@@ -248,9 +943,157 @@ int main(int argc, const char **argv)
     std::cout << std::endl << std::endl;
     std::cout << "Processing statistics:" << std::endl << std::endl;
 
+    const bool benchmark = !threadsStr.empty() || !sizesStr.empty() || !tilesStr.empty()
+                            || !bitDepthPairsStr.empty() || !layoutsStr.empty() || builtins
+                            || allColorSpaces || opStats || !jsonFile.empty() || !csvFile.empty();
+
+    const OCIO::OptimizationFlags optimFlags
+        = nooptim ? OCIO::OPTIMIZATION_NONE : OCIO::OPTIMIZATION_DEFAULT;
+
     // Process the image.
     try
     {
+        if (benchmark)
+        {
+            // The benchmark mode only measures the image processing of already created processors.
+            if (nocache || parse || write)
+            {
+                throw OCIO::Exception("The --nocache, --parse and --write options are not "
+                                      "supported in the benchmark mode.");
+            }
+
+            BenchmarkSettings settings
+                = ParseBenchmarkSettings(threadsStr.empty() ? "1" : threadsStr,
+                                         sizesStr.empty() ? "3840x2160" : sizesStr,
+                                         tilesStr.empty() ? "0" : tilesStr,
+                                         bitDepthPairsStr.empty() ? inBitDepthStr + ":" + outBitDepthStr
+                                                                  : bitDepthPairsStr,
+                                         layoutsStr.empty() ? "packed" : layoutsStr);
+
+            settings.m_iterations = iterations == 0 ? 10 : iterations;
+            settings.m_optimFlags = optimFlags;
+            settings.m_opStats    = opStats;
+
+            std::vector<BenchmarkTransform> transforms;
+
+            if (!transformFile.empty())
+            {
+                OCIO::FileTransformRcPtr transform = OCIO::FileTransform::Create();
+                transform->setSrc(transformFile.c_str());
+
+                transforms.push_back({ transformFile,
+                                       OCIO::Config::CreateRaw()->getProcessor(transform) });
+            }
+
+            if (!inColorSpace.empty() || !outColorSpace.empty() || allColorSpaces)
+            {
+                if (!inputconfig.empty())
+                {
+                    srcConfig = OCIO::Config::CreateFromFile(inputconfig.c_str());
+                }
+                else if (OCIO::GetEnvVariable("OCIO"))
+                {
+                    srcConfig = OCIO::Config::CreateFromEnv();
+                }
+                else
+                {
+                    throw OCIO::Exception("You must specify an input OCIO configuration (either with --iconfig or $OCIO).\n");
+                }
+            }
+
+            if (!inColorSpace.empty() && !outColorSpace.empty())
+            {
+                transforms.push_back({ inColorSpace + " -> " + outColorSpace,
+                                       srcConfig->getProcessor(inColorSpace.c_str(),
+                                                               outColorSpace.c_str()) });
+            }
+            else if (!display.empty() && !view.empty() && (!inColorSpace.empty() || !outColorSpace.empty()))
+            {
+                const bool forward = !inColorSpace.empty();
+                const std::string & colorSpace = forward ? inColorSpace : outColorSpace;
+                const std::string displayView = "(" + display + ", " + view + ")";
+
+                OCIO::ConstMatrixTransformRcPtr noChannelView;
+                transforms.push_back({ forward ? colorSpace + " -> " + displayView
+                                               : displayView + " -> " + colorSpace,
+                                       OCIO::DisplayViewHelpers::GetProcessor(srcConfig,
+                                                                              colorSpace.c_str(),
+                                                                              display.c_str(),
+                                                                              view.c_str(),
+                                                                              noChannelView,
+                                                                              forward ? OCIO::TRANSFORM_DIR_FORWARD
+                                                                                      : OCIO::TRANSFORM_DIR_INVERSE) });
+            }
+
+            if (builtins)
+            {
+                OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+                OCIO::ConstBuiltinTransformRegistryRcPtr registry = OCIO::BuiltinTransformRegistry::Get();
+
+                for (size_t idx = 0; idx < registry->getNumBuiltins(); ++idx)
+                {
+                    OCIO::BuiltinTransformRcPtr transform = OCIO::BuiltinTransform::Create();
+                    transform->setStyle(registry->getBuiltinStyle(idx));
+
+                    transforms.push_back({ std::string("builtin: ") + registry->getBuiltinStyle(idx),
+                                           config->getProcessor(transform) });
+                }
+            }
+
+            if (allColorSpaces)
+            {
+                const int numColorSpaces = srcConfig->getNumColorSpaces();
+                for (int src = 0; src < numColorSpaces; ++src)
+                {
+                    for (int dst = 0; dst < numColorSpaces; ++dst)
+                    {
+                        if (src == dst) continue;
+
+                        const std::string srcName = srcConfig->getColorSpaceNameByIndex(src);
+                        const std::string dstName = srcConfig->getColorSpaceNameByIndex(dst);
+
+                        // Some pairs could be invalid (e.g. missing LUT files).
+                        try
+                        {
+                            transforms.push_back({ srcName + " -> " + dstName,
+                                                   srcConfig->getProcessor(srcName.c_str(),
+                                                                           dstName.c_str()) });
+                        }
+                        catch (OCIO::Exception & ex)
+                        {
+                            std::cerr << "Skipping '" << srcName << " -> " << dstName
+                                      << "': " << ex.what() << std::endl;
+                        }
+                    }
+                }
+            }
+
+            if (transforms.empty())
+            {
+                throw OCIO::Exception("Missing color transformation description.");
+            }
+
+            const std::vector<BenchmarkResult> results
+                = RunBenchmarks(transforms, settings, verbose);
+
+            if (!jsonFile.empty())
+            {
+                WriteResults(jsonFile, results, WriteJson);
+            }
+
+            if (!csvFile.empty())
+            {
+                WriteResults(csvFile, results, WriteCsv);
+            }
+
+            return 0;
+        }
+
+        if (iterations == 0)
+        {
+            iterations = 50;
+        }
+
         // Load the current config.
 
         OCIO::ConstProcessorRcPtr processor;
@@ -278,6 +1121,74 @@ int main(int argc, const char **argv)
                     m.pause();
                 }
             }
+
+            if (parse)
+            {
+                std::ifstream file(transformFile, std::ios::binary | std::ios::ate);
+                const double fileSizeMB = double(file.tellg()) / (1024.0 * 1024.0);
+
+                OCIO::ConfigRcPtr parseConfig = OCIO::Config::CreateRaw()->createEditableCopy();
+                parseConfig->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+                double seconds = 0.0;
+                {
+                    CustomMeasure m("Read the transform file:\t\t", iterations);
+                    for (unsigned iter = 0; iter < iterations; ++iter)
+                    {
+                        // Force the file to be read and parsed again.
+                        OCIO::ClearAllCaches();
+
+                        m.resume();
+                        parseConfig->getProcessor(transform, OCIO::TRANSFORM_DIR_FORWARD);
+                        m.pause();
+                    }
+                    seconds = m.getDuration().count() / 1000.0;
+                }
+
+                std::cout << "Read throughput:\t\t\t"
+                          << (seconds > 0.0 ? fileSizeMB * iterations / seconds : 0.0)
+                          << " MB/s" << std::endl;
+            }
+
+            if (write)
+            {
+                OCIO::GroupTransformRcPtr group = processor->createGroupTransform();
+
+                auto measureWrite = [&](const std::string & title)
+                {
+                    double fileSizeMB = 0.0;
+                    double seconds = 0.0;
+                    {
+                        CustomMeasure m((title + ":\t\t").c_str(), iterations);
+                        for (unsigned iter = 0; iter < iterations; ++iter)
+                        {
+                            std::ostringstream oss;
+
+                            m.resume();
+                            group->write(config, "Academy/ASC Common LUT Format", oss);
+                            m.pause();
+
+                            fileSizeMB = double(oss.tellp()) / (1024.0 * 1024.0);
+                        }
+                        seconds = m.getDuration().count() / 1000.0;
+                    }
+
+                    std::cout << "Write throughput:\t\t\t"
+                              << (seconds > 0.0 ? fileSizeMB * iterations / seconds : 0.0)
+                              << " MB/s" << std::endl;
+                };
+
+                measureWrite("Write the transform as CLF");
+
+                // The array values are only formatted with a stream when the global locale is not
+                // the classic one. An unnamed copy of the classic locale produces the same output
+                // so the stream based formatting could be compared.
+                const std::locale previous
+                    = std::locale::global(std::locale(std::locale::classic(),
+                                                      new std::numpunct<char>()));
+                measureWrite("Write with stream formatting");
+                std::locale::global(previous);
+            }
         }
         // Checking for an input colorspace or input (display, view) pair.
         else if (!inColorSpace.empty() || (!display.empty() && !view.empty()))
@@ -420,30 +1331,16 @@ int main(int argc, const char **argv)
             throw OCIO::Exception("Missing color transformation description.");
         }
 
-        const OCIO::OptimizationFlags optimFlags
-            = nooptim ? OCIO::OPTIMIZATION_NONE : OCIO::OPTIMIZATION_DEFAULT;
-
-        auto GetBitDepthFromString = [](const std::string & str) -> OCIO::BitDepth 
+        // Only the benchmark mode supports all the bit-depths.
+        for (const auto & str : { inBitDepthStr, outBitDepthStr })
         {
-            OCIO::BitDepth bd = OCIO::BIT_DEPTH_F32;
-    
-            if (str == "f32")
-            {
-                bd = OCIO::BIT_DEPTH_F32;
-            }
-            else if (str == "ui16")
-            {
-                bd = OCIO::BIT_DEPTH_UINT16;
-            }
-            else
+            if (str != "f32" && str != "ui16")
             {
                 std::string err("Unsupported bit-depth: ");
                 err += str;
                 throw OCIO::Exception(err.c_str());
             }
-
-            return bd;
-        };
+        }
 
         const OCIO::BitDepth inBitDepth  = GetBitDepthFromString(inBitDepthStr);
         const OCIO::BitDepth outBitDepth = GetBitDepthFromString(outBitDepthStr);
@@ -525,40 +1422,17 @@ int main(int argc, const char **argv)
         std::vector<float> img_f32_ref;
         std::vector<uint16_t> img_ui16_ref;
 
-        // Generate a synthetic image by emulating a LUT3D identity algorithm that steps through
-        // many different colors.  Need to avoid a constant image, simple gradients, or anything
-        // that would result in more cache hits than a typical image.  Also, want to step through a 
-        // wide range of colors, including outside [0,1], in case some algorithms are faster or
-        // slower for certain colors.
-
-        static constexpr size_t length   = 201;
-        static constexpr float stepValue = 1.0f / ((float)length - 1.0f);
-
         if (inBitDepth == OCIO::BIT_DEPTH_F32)
         {
-            static constexpr float min   = -1.0f;
-            static constexpr float max   =  2.0f;
-            static constexpr float range = max - min;
-
-            img_f32_ref.resize(maxElts * numChannels);
-
-            // Retrofit value in the range.
-            auto adjustValue = [](float val) -> float
-            {
-                return val * range + min;
-            };
-
-            for (size_t idx = 0; idx < maxElts; ++idx)
-            {
-                img_f32_ref[numChannels * idx + 0] = adjustValue( ((idx / length / length) % length) * stepValue );
-                img_f32_ref[numChannels * idx + 1] = adjustValue( ((idx / length) % length) * stepValue );
-                img_f32_ref[numChannels * idx + 2] = adjustValue( (idx % length) * stepValue );
-
-                img_f32_ref[numChannels * idx + 3] = adjustValue( float(idx) / maxElts );
-            }
+            img_f32_ref = CreateSyntheticImage(maxElts);
         }
         else // request an integer image
         {
+            // Use the same synthetic image but in the [0, 1] range.
+
+            static constexpr size_t length   = 201;
+            static constexpr float stepValue = 1.0f / ((float)length - 1.0f);
+
             img_ui16_ref.resize(maxElts * numChannels);
 
             // Retrofit value in the range.
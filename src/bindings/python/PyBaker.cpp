@@ -3,6 +3,8 @@
 
 #include <fstream>
 #include <sstream>
+#include <tuple>
+#include <vector>
 
 #include "PyOpenColorIO.h"
 #include "PyUtils.h"
@@ -138,7 +140,38 @@ Each item is a tuple containing format name and format extension.
                 self->bake(os);
                 return os.str();
             },
-            DOC(Baker, bake));
+            DOC(Baker, bake))
+        .def("bake", [](BakerRcPtr & self, 
+                        const std::vector<std::tuple<std::string, std::string, std::string>> & targets)
+            {
+                std::vector<std::ostringstream> outputs(targets.size());
+
+                std::vector<BakerTarget> bakerTargets(targets.size());
+                for (size_t idx = 0; idx < targets.size(); ++idx)
+                {
+                    bakerTargets[idx].m_display = std::get<0>(targets[idx]);
+                    bakerTargets[idx].m_view    = std::get<1>(targets[idx]);
+                    bakerTargets[idx].m_looks   = std::get<2>(targets[idx]);
+                    bakerTargets[idx].m_output  = &outputs[idx];
+                }
+
+                self->bake(bakerTargets);
+
+                std::vector<std::string> luts;
+                for (const auto & os : outputs)
+                {
+                    luts.push_back(os.str());
+                }
+                return luts;
+            },
+             "targets"_a,
+             R"doc(
+Bake a LUT per (display, view, looks) target tuple, the looks being 
+optional i.e. an empty string. Return the list of the baked LUTs. All 
+the other settings are the ones of this baker, and the targets share its 
+config so the processors are only built once for all the targets.
+
+)doc");
 
     clsFormatIterator
         .def("__len__", [](FormatIterator & /* it */) { return Baker::getNumFormats(); })
@@ -90,6 +90,63 @@ written to the dstImgDesc image, leaving srcImgDesc unchanged.
     pointer. The dedicated packed ``apply*`` methods utilize 
     ``ImageDesc`` on the C++ side so avoid the copy.
 
+)doc")
+        .def("apply", [](CPUProcessorRcPtr & self, PyImageDesc & imgDesc, unsigned numThreads) 
+            {
+                self->apply((*imgDesc.m_img), numThreads);
+            },
+             "imgDesc"_a, "numThreads"_a,
+             py::call_guard<py::gil_scoped_release>(), 
+             R"doc(
+Apply to an image in place using several threads. The image is split 
+into bands of scanlines which are processed concurrently. A 
+numThreads of 0 uses all the hardware threads available.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
+)doc")
+        .def("apply", [](CPUProcessorRcPtr & self, 
+                         PyImageDesc & srcImgDesc, 
+                         PyImageDesc & dstImgDesc,
+                         unsigned numThreads)
+            {
+                self->apply((*srcImgDesc.m_img), (*dstImgDesc.m_img), numThreads);
+            },
+             "srcImgDesc"_a, "dstImgDesc"_a, "numThreads"_a,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+Apply to an image using several threads. Modified srcImgDesc image 
+values are written to the dstImgDesc image, leaving srcImgDesc 
+unchanged. A numThreads of 0 uses all the hardware threads available.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
+)doc")
+        .def("reserveProcessingBuffers", &CPUProcessor::reserveProcessingBuffers,
+             "numThreads"_a,
+             DOC(CPUProcessor, reserveProcessingBuffers))
+        .def("enableStats", &CPUProcessor::enableStats, "enable"_a,
+             DOC(CPUProcessor, enableStats))
+        .def("isStatsEnabled", &CPUProcessor::isStatsEnabled,
+             DOC(CPUProcessor, isStatsEnabled))
+        .def("resetStats", &CPUProcessor::resetStats,
+             DOC(CPUProcessor, resetStats))
+        .def("getNumStatsStages", &CPUProcessor::getNumStatsStages,
+             DOC(CPUProcessor, getNumStatsStages))
+        .def("getStatsStage", [](CPUProcessorRcPtr & self, int index)
+            {
+                const CPUProcessorStageStats stats = self->getStatsStage(index);
+                return py::make_tuple(std::string(stats.m_name), stats.m_time, stats.m_numPixels);
+            },
+             "index"_a,
+             R"doc(
+Return the processing statistics of one stage as a (name, time in 
+seconds, number of pixels) tuple. Throws if the index is out of range.
+
 )doc")
         .def("applyRGB", [](CPUProcessorRcPtr & self, py::buffer & data) 
             {
@@ -965,6 +965,18 @@ void bindPyConfig(py::module & m)
              DOC(Config, setProcessorCacheFlags))
         .def("clearProcessorCache", &Config::clearProcessorCache, 
              DOC(Config, setProcessorCacheFlags))
+        .def("setProcessorCacheCapacity", &Config::setProcessorCacheCapacity, 
+             "maxNumEntries"_a, "maxSizeInBytes"_a,
+             DOC(Config, setProcessorCacheCapacity))
+        .def("getProcessorCacheStatistics", &Config::getProcessorCacheStatistics, 
+             DOC(Config, getProcessorCacheStatistics))
+        .def("setSubProcessorCacheCapacity", &Config::setSubProcessorCacheCapacity, 
+             "maxNumEntries"_a, "maxSizeInBytes"_a,
+             DOC(Config, setSubProcessorCacheCapacity))
+        .def("getOptimizationOptIns", &Config::getOptimizationOptIns, 
+             DOC(Config, getOptimizationOptIns))
+        .def("setOptimizationOptIns", &Config::setOptimizationOptIns, "optIns"_a, 
+             DOC(Config, setOptimizationOptIns))
 
         // Archiving
         .def("isArchivable", &Config::isArchivable, DOC(Config, isArchivable))
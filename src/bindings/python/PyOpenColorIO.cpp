@@ -40,6 +40,10 @@ PYBIND11_MODULE(PyOpenColorIO, m)
     // Global functions
     m.def("ClearAllCaches", &ClearAllCaches,
           DOC(PyOpenColorIO, ClearAllCaches));
+    m.def("SetFileCacheCapacity", &SetFileCacheCapacity, "maxNumEntries"_a, "maxSizeInBytes"_a,
+          DOC(PyOpenColorIO, SetFileCacheCapacity));
+    m.def("GetFileCacheStatistics", &GetFileCacheStatistics,
+          DOC(PyOpenColorIO, GetFileCacheStatistics));
     m.def("GetVersion", &GetVersion,
           DOC(PyOpenColorIO, GetVersion));
     m.def("GetVersionHex", &GetVersionHex,
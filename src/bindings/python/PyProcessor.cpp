@@ -37,6 +37,8 @@ void bindPyProcessor(py::module & m)
              DOC(Processor, hasChannelCrosstalk))
         .def("getCacheID", &Processor::getCacheID,
              DOC(Processor, getCacheID))
+        .def("getSubProcessorCacheStatistics", &Processor::getSubProcessorCacheStatistics,
+             DOC(Processor, getSubProcessorCacheStatistics))
         .def("getProcessorMetadata", &Processor::getProcessorMetadata,
              DOC(Processor, getProcessorMetadata))
         .def("getFormatMetadata", &Processor::getFormatMetadata,
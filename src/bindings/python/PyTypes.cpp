@@ -751,6 +751,11 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_SIMPLIFY_OPS))
         .value("OPTIMIZATION_NO_DYNAMIC_PROPERTIES", OPTIMIZATION_NO_DYNAMIC_PROPERTIES, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_NO_DYNAMIC_PROPERTIES))
+        .value("OPTIMIZATION_BAKE_LUT", OPTIMIZATION_BAKE_LUT, 
+               DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_BAKE_LUT))
+        .value("OPTIMIZATION_FAST_ACES_OUTPUT_TRANSFORM_20", 
+               OPTIMIZATION_FAST_ACES_OUTPUT_TRANSFORM_20, 
+               DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_FAST_ACES_OUTPUT_TRANSFORM_20))
         .value("OPTIMIZATION_ALL", OPTIMIZATION_ALL, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_ALL))
         .value("OPTIMIZATION_LOSSLESS", OPTIMIZATION_LOSSLESS, 
@@ -765,6 +770,17 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_DEFAULT))
         .export_values();
 
+    py::enum_<OptimizationOptIns>(
+        m, "OptimizationOptIns", py::arithmetic(), 
+        DOC(PyOpenColorIO, OptimizationOptIns))
+
+        .value("OPTIMIZATION_OPT_IN_NONE", OPTIMIZATION_OPT_IN_NONE, 
+               DOC(PyOpenColorIO, OptimizationOptIns, OPTIMIZATION_OPT_IN_NONE))
+        .value("OPTIMIZATION_OPT_IN_LUT_INV_FAST_HIGH_RES", 
+               OPTIMIZATION_OPT_IN_LUT_INV_FAST_HIGH_RES, 
+               DOC(PyOpenColorIO, OptimizationOptIns, OPTIMIZATION_OPT_IN_LUT_INV_FAST_HIGH_RES))
+        .export_values();
+
     py::enum_<ProcessorCacheFlags>(
         m, "ProcessorCacheFlags", 
         DOC(PyOpenColorIO, ProcessorCacheFlags))
@@ -779,6 +795,22 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, ProcessorCacheFlags, PROCESSOR_CACHE_DEFAULT))
         .export_values();
 
+    py::class_<CacheStatistics>(
+        m, "CacheStatistics", 
+        DOC(CacheStatistics))
+
+        .def(py::init<>())
+        .def_readonly("numEntries", &CacheStatistics::m_numEntries, 
+                      DOC(CacheStatistics, m_numEntries))
+        .def_readonly("sizeInBytes", &CacheStatistics::m_sizeInBytes, 
+                      DOC(CacheStatistics, m_sizeInBytes))
+        .def_readonly("hits", &CacheStatistics::m_hits, 
+                      DOC(CacheStatistics, m_hits))
+        .def_readonly("misses", &CacheStatistics::m_misses, 
+                      DOC(CacheStatistics, m_misses))
+        .def_readonly("evictions", &CacheStatistics::m_evictions, 
+                      DOC(CacheStatistics, m_evictions));
+
     // Conversion
     m.def("BoolToString", &BoolToString, "value"_a, 
           DOC(PyOpenColorIO, BoolToString));
@@ -866,6 +898,8 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_INACTIVE_COLORSPACES_ENVVAR") = OCIO_INACTIVE_COLORSPACES_ENVVAR;
     m.attr("OCIO_OPTIMIZATION_FLAGS_ENVVAR") = OCIO_OPTIMIZATION_FLAGS_ENVVAR;
     m.attr("OCIO_USER_CATEGORIES_ENVVAR") = OCIO_USER_CATEGORIES_ENVVAR;
+    m.attr("OCIO_LAZY_CONFIG_LOADING_ENVVAR") = OCIO_LAZY_CONFIG_LOADING_ENVVAR;
+    m.attr("OCIO_CPU_PROCESSOR_STATS_ENVVAR") = OCIO_CPU_PROCESSOR_STATS_ENVVAR;
 
     // Roles
     m.attr("ROLE_DEFAULT") = ROLE_DEFAULT;
@@ -896,6 +930,7 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_DISABLE_ALL_CACHES") = OCIO_DISABLE_ALL_CACHES;
     m.attr("OCIO_DISABLE_PROCESSOR_CACHES") = OCIO_DISABLE_PROCESSOR_CACHES;
     m.attr("OCIO_DISABLE_CACHE_FALLBACK") = OCIO_DISABLE_CACHE_FALLBACK;
+    m.attr("OCIO_LUT_CACHE_DIR") = OCIO_LUT_CACHE_DIR;
 
     m.attr("OCIO_CONFIG_DEFAULT_NAME") = OCIO_CONFIG_DEFAULT_NAME;
     m.attr("OCIO_CONFIG_DEFAULT_FILE_EXT") = OCIO_CONFIG_DEFAULT_FILE_EXT;
@@ -26,6 +26,8 @@
 #define really_inline inline __attribute__((always_inline))
 #endif
 
+#include <cfloat>
+#include <cstdint>
 #include <cstdlib>
 #ifdef __APPLE__
 #include <xlocale.h>
@@ -254,6 +256,186 @@ really_inline from_chars_result from_chars(const char *first, const char *last,
     }
 #endif
 }
+
+// Limits of the from_chars_fast() exact conversions.
+template<typename T> struct from_chars_fast_limits;
+
+template<> struct from_chars_fast_limits<float>
+{
+    // All the integers below it are exactly representable.
+    static constexpr uint64_t max_significand = uint64_t(1) << 24;
+
+    // Largest power of ten which is exactly representable.
+    static constexpr int max_pow10 = 10;
+
+    static float pow10(int exponent) noexcept
+    {
+        static constexpr float values[] = {
+            1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+        return values[exponent];
+    }
+};
+
+template<> struct from_chars_fast_limits<double>
+{
+    static constexpr uint64_t max_significand = uint64_t(1) << 53;
+
+    static constexpr int max_pow10 = 22;
+
+    static double pow10(int exponent) noexcept
+    {
+        static constexpr double values[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+        return values[exponent];
+    }
+};
+
+// Clinger's fast path: when the decimal significand and the power of ten are both exactly
+// representable, a single multiplication or division is correctly rounded i.e. the result
+// is identical to from_chars(). That covers most of the values written in the LUT files
+// (e.g. 0.123456 or 1023) without any locale, errno or null terminated string. It returns
+// false if [first, last) is not entirely such a number, then from_chars() is needed.
+template<typename T>
+inline bool from_chars_fast(const char * first, const char * last, T & value) noexcept
+{
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    typedef from_chars_fast_limits<T> limits;
+
+    const char * p = first;
+
+    bool negative = false;
+    if (p != last && (*p == '-' || *p == '+'))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    uint64_t significand = 0;
+    int pendingZeros     = 0; // Zeros not yet added to the significand.
+    int fractionDigits   = 0;
+    bool hasDigits       = false;
+    bool inFraction      = false;
+
+    for (; p != last; ++p)
+    {
+        const char c = *p;
+        if (c >= '0' && c <= '9')
+        {
+            hasDigits = true;
+            if (inFraction)
+            {
+                ++fractionDigits;
+            }
+
+            if (c == '0')
+            {
+                // Leading zeros are not significant and trailing zeros only change the exponent.
+                if (significand != 0)
+                {
+                    ++pendingZeros;
+                }
+                continue;
+            }
+
+            for (; pendingZeros > 0; --pendingZeros)
+            {
+                significand *= 10;
+                if (significand >= limits::max_significand)
+                {
+                    return false;
+                }
+            }
+
+            significand = significand * 10 + uint64_t(c - '0');
+            if (significand >= limits::max_significand)
+            {
+                return false;
+            }
+        }
+        else if (c == '.' && !inFraction)
+        {
+            inFraction = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (!hasDigits)
+    {
+        return false;
+    }
+
+    int exponent = 0;
+    if (p != last && (*p == 'e' || *p == 'E'))
+    {
+        ++p;
+
+        bool negativeExponent = false;
+        if (p != last && (*p == '-' || *p == '+'))
+        {
+            negativeExponent = (*p == '-');
+            ++p;
+        }
+
+        if (p == last || *p < '0' || *p > '9')
+        {
+            return false;
+        }
+
+        for (; p != last && *p >= '0' && *p <= '9'; ++p)
+        {
+            exponent = exponent * 10 + (*p - '0');
+            if (exponent > 1000)
+            {
+                return false;
+            }
+        }
+
+        if (negativeExponent)
+        {
+            exponent = -exponent;
+        }
+    }
+
+    // Leave the partially valid strings to from_chars().
+    if (p != last)
+    {
+        return false;
+    }
+
+    if (significand == 0)
+    {
+        value = negative ? -T(0) : T(0);
+        return true;
+    }
+
+    // Note that the trailing zeros of the fraction are both pending zeros and fraction digits.
+    exponent += pendingZeros - fractionDigits;
+    if (exponent < -limits::max_pow10 || exponent > limits::max_pow10)
+    {
+        return false;
+    }
+
+    const T v = static_cast<T>(significand);
+    value = exponent < 0 ? v / limits::pow10(-exponent) : v * limits::pow10(exponent);
+    if (negative)
+    {
+        value = -value;
+    }
+
+    return true;
+#else
+    // The single rounding of the fast path is not guaranteed.
+    (void)first;
+    (void)last;
+    (void)value;
+    return false;
+#endif
+}
+
 } // namespace NumberUtils
 } // namespace OCIO_NAMESPACE
 #endif // INCLUDED_NUMBERUTILS_H
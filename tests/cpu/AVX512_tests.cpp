@@ -5,7 +5,11 @@
 #include "CPUInfo.h"
 #if OCIO_USE_AVX512
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -13,6 +17,7 @@
 #include "MathUtils.h"
 #include "BitDepthUtils.h"
 #include "AVX512.h"
+#include "SSE.h"
 #include "testutils/UnitTest.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -512,4 +517,93 @@ DEFINE_SIMD_TEST(packed_all_test)
     }
 }
 
+namespace
+{
+
+// The AVX512 math functions use the same approximations as the SSE2 ones.
+template<typename SSEFunc, typename AVX512Func>
+void CheckSameAsSSE(const std::string & operation, const std::vector<float> & values,
+                    SSEFunc sseFunc, AVX512Func avx512Func)
+{
+    std::vector<float> inputs(values);
+    inputs.resize((inputs.size() + 16) / 16 * 16, 1.0f);
+
+    for (size_t idx = 0; idx < inputs.size(); idx += 16)
+    {
+        float expected[16];
+        for (size_t i = 0; i < 16; i += 4)
+        {
+            _mm_storeu_ps(&expected[i], sseFunc(_mm_loadu_ps(&inputs[idx + i])));
+        }
+
+        float actual[16];
+        _mm512_storeu_ps(actual, avx512Func(_mm512_loadu_ps(&inputs[idx])));
+
+        for (size_t i = 0; i < 16; ++i)
+        {
+            std::ostringstream oss;
+            oss << operation << "(" << inputs[idx + i] << "): expected: " << expected[i]
+                << " != actual: " << actual[i];
+
+            if (OCIO::IsNan(expected[i]))
+            {
+                OCIO_CHECK_ASSERT_MESSAGE(OCIO::IsNan(actual[i]), oss.str());
+            }
+            else if (std::isinf(expected[i]))
+            {
+                OCIO_CHECK_ASSERT_MESSAGE(expected[i] == actual[i], oss.str());
+            }
+            else
+            {
+                const float tol = 1e-6f * std::max(1.0f, std::fabs(expected[i]));
+                OCIO_CHECK_ASSERT_MESSAGE(OCIO::EqualWithAbsError(expected[i], actual[i], tol),
+                                          oss.str());
+            }
+        }
+    }
+}
+
+} // anon.
+
+DEFINE_SIMD_TEST(log2_exp2_power_test)
+{
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf  = std::numeric_limits<float>::infinity();
+
+    std::vector<float> values = { 0.0f, -1.0f, 1e-10f, 1e-3f, .1f, .5f, 1.f, 11.f, 112.f,
+                                  2425.f, 2e15f, inf, qnan };
+    for (int i = -100; i <= 100; ++i)
+    {
+        values.push_back(std::pow(1.37f, (float)i));
+    }
+
+    CheckSameAsSSE("log2", values,
+                   [](__m128 x) { return OCIO::sseLog2(x); },
+                   [](__m512 x) { return OCIO::avx512Log2(x); });
+
+    std::vector<float> exponents = { -200.f, -126.5f, -126.f, -10.3f, -1.f, -0.5f, 0.f, 0.3f,
+                                     1.f, 10.7f, 127.9f, 128.f, 200.f, inf, -inf, qnan };
+    for (int i = -100; i <= 100; ++i)
+    {
+        exponents.push_back((float)i * 1.23f);
+    }
+
+    CheckSameAsSSE("exp2", exponents,
+                   [](__m128 x) { return OCIO::sseExp2(x); },
+                   [](__m512 x) { return OCIO::avx512Exp2(x); });
+
+    for (const float exponent : { 1.f / 2.4f, 1.f / 2.2f, 1.8f, 2.2f, 2.4f, 10.f })
+    {
+        std::ostringstream oss;
+        oss << "power(" << exponent << ")";
+
+        CheckSameAsSSE(oss.str(), values,
+                       [exponent](__m128 x) { return OCIO::ssePower(x, _mm_set1_ps(exponent)); },
+                       [exponent](__m512 x)
+                       {
+                           return OCIO::avx512Power(x, _mm512_set1_ps(exponent));
+                       });
+    }
+}
+
 #endif // OCIO_USE_AVX
\ No newline at end of file
@@ -239,6 +239,107 @@ LUT_3D_SIZE 2
     }
 }
 
+OCIO_ADD_TEST(Baker, bake_batch)
+{
+    constexpr auto myProfile = R"(
+        ocio_profile_version: 2
+
+        file_rules:
+          - !<Rule> {name: Default, colorspace: lnh}
+
+        displays:
+          display1:
+            - !<View> {name: view1, colorspace: gamma22}
+            - !<View> {name: view2, looks: satlook, colorspace: gamma22}
+          display2:
+            - !<View> {name: view1, colorspace: lnh}
+
+        looks:
+          - !<Look>
+            name: contrastlook
+            process_space: lnh
+            transform: !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1]}
+          - !<Look>
+            name: satlook
+            process_space: lnh
+            transform: !<CDLTransform> {sat: 2}
+
+        colorspaces:
+          - !<ColorSpace>
+            name: lnh
+
+          - !<ColorSpace>
+            name: gamma22
+            to_reference: !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1]}
+    )";
+
+    std::istringstream is(myProfile);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+    OCIO_REQUIRE_ASSERT(config);
+
+    OCIO::BakerRcPtr bake = OCIO::Baker::Create();
+    bake->setConfig(config);
+    bake->setFormat("resolve_cube");
+    bake->setInputSpace("lnh");
+    bake->setCubeSize(5);
+
+    std::ostringstream os0, os1, os2;
+    const std::vector<OCIO::BakerTarget> targets{ { "display1", "view1", "", &os0 },
+                                                  { "display1", "view2", "", &os1 },
+                                                  { "display2", "view1", "contrastlook", &os2 } };
+
+    OCIO_CHECK_NO_THROW(bake->bake(targets));
+
+    // Each LUT is identical to the one baked alone.
+    for (const auto & target : targets)
+    {
+        OCIO::BakerRcPtr single = OCIO::Baker::Create();
+        single->setConfig(config);
+        single->setFormat("resolve_cube");
+        single->setInputSpace("lnh");
+        single->setCubeSize(5);
+        single->setDisplayView(target.m_display.c_str(), target.m_view.c_str());
+        single->setLooks(target.m_looks.c_str());
+
+        std::ostringstream os;
+        OCIO_CHECK_NO_THROW(single->bake(os));
+        OCIO_CHECK_EQUAL(os.str(), static_cast<std::ostringstream *>(target.m_output)->str());
+    }
+
+    // The settings of the baker are unchanged.
+    OCIO_CHECK_EQUAL(std::string(bake->getDisplay()), "");
+    OCIO_CHECK_EQUAL(std::string(bake->getLooks()), "");
+
+    // The crosstalk of the saturation needs a 3D LUT.
+    OCIO_CHECK_NE(os1.str().find("LUT_3D_SIZE 5"), std::string::npos);
+    OCIO_CHECK_NE(os0.str(), os2.str());
+
+    // No target.
+    OCIO_CHECK_NO_THROW(bake->bake(std::vector<OCIO::BakerTarget>{}));
+
+    // Errors.
+
+    // A null output stream is detected before baking any target.
+    std::ostringstream os3;
+    const std::vector<OCIO::BakerTarget> missingOutput{ { "display1", "view1", "", &os3 },
+                                                        { "display1", "view2", "", nullptr } };
+    OCIO_CHECK_THROW_WHAT(bake->bake(missingOutput),
+                          OCIO::Exception,
+                          "No output stream for the target at index 1.");
+    OCIO_CHECK_ASSERT(os3.str().empty());
+
+    const std::vector<OCIO::BakerTarget> missingDisplay{ { "", "view1", "", &os3 } };
+    OCIO_CHECK_THROW_WHAT(bake->bake(missingDisplay),
+                          OCIO::Exception,
+                          "No display / view or target colorspace has been set.");
+
+    const std::vector<OCIO::BakerTarget> badView{ { "display1", "view3", "", &os3 } };
+    OCIO_CHECK_THROW_WHAT(bake->bake(badView),
+                          OCIO::Exception,
+                          "Could not find view 'view3'.");
+}
+
 OCIO_ADD_TEST(Baker, baking_validation)
 {
     OCIO::BakerRcPtr bake;
@@ -2908,3 +2908,669 @@ OCIO_ADD_TEST(CPUProcessor, optimizations)
                                                                __LINE__);
     }
 }
+
+namespace
+{
+
+OCIO::ConstCPUProcessorRcPtr BuildGammaCPUProcessor(OCIO::BitDepth inBD, OCIO::BitDepth outBD)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.8, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+    matrix->setMatrix(m44);
+
+    OCIO::ExponentWithLinearTransformRcPtr curve = OCIO::ExponentWithLinearTransform::Create();
+    constexpr double gamma[4]  = { 2.4, 2.4, 2.4, 1.0 };
+    constexpr double offset[4] = { 0.055, 0.055, 0.055, 0.0 };
+    curve->setGamma(gamma);
+    curve->setOffset(offset);
+    curve->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    auto transform = OCIO::GroupTransform::Create();
+    transform->appendTransform(matrix);
+    transform->appendTransform(curve);
+
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(transform);
+    return processor->getOptimizedCPUProcessor(inBD, outBD, OCIO::OPTIMIZATION_DEFAULT);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, apply_multithreaded)
+{
+    // The unit test validates that the multithreaded apply produces exactly the same result
+    // than the single-threaded one, for several image layouts and thread counts.
+
+    constexpr long width  = 97;
+    constexpr long height = 211;
+
+    // Packed RGBA F32 processed in place.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor
+            = BuildGammaCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32);
+
+        std::vector<float> inImg(width * height * 4);
+        for (size_t idx = 0; idx < inImg.size(); ++idx)
+        {
+            inImg[idx] = float(idx % 1013) / 1012.0f;
+        }
+
+        std::vector<float> refImg(inImg);
+        OCIO::PackedImageDesc refDesc(&refImg[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(refDesc));
+
+        for (unsigned numThreads : { 0u, 1u, 2u, 3u, 1000u })
+        {
+            std::vector<float> outImg(inImg);
+            OCIO::PackedImageDesc outDesc(&outImg[0], width, height, 4);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(outDesc, numThreads));
+
+            OCIO_CHECK_ASSERT(outImg == refImg);
+        }
+    }
+
+    // Packed RGB uint16 to packed BGRA F32 i.e. no processing optimizations.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor
+            = BuildGammaCPUProcessor(OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_F32);
+
+        std::vector<uint16_t> inImg(width * height * 3);
+        for (size_t idx = 0; idx < inImg.size(); ++idx)
+        {
+            inImg[idx] = uint16_t((idx * 7) % 65536);
+        }
+
+        const OCIO::PackedImageDesc srcDesc(&inImg[0], width, height,
+                                            OCIO::CHANNEL_ORDERING_RGB,
+                                            OCIO::BIT_DEPTH_UINT16,
+                                            OCIO::AutoStride,
+                                            OCIO::AutoStride,
+                                            OCIO::AutoStride);
+
+        std::vector<float> refImg(width * height * 4, -1.0f);
+        OCIO::PackedImageDesc refDesc(&refImg[0], width, height, OCIO::CHANNEL_ORDERING_BGRA);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, refDesc));
+
+        for (unsigned numThreads : { 0u, 2u, 5u })
+        {
+            std::vector<float> outImg(width * height * 4, -1.0f);
+            OCIO::PackedImageDesc outDesc(&outImg[0], width, height, OCIO::CHANNEL_ORDERING_BGRA);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, outDesc, numThreads));
+
+            OCIO_CHECK_ASSERT(outImg == refImg);
+        }
+    }
+
+    // Planar RGB F32 processed in place.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor
+            = BuildGammaCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32);
+
+        std::vector<float> inR(width * height), inG(width * height), inB(width * height);
+        for (size_t idx = 0; idx < inR.size(); ++idx)
+        {
+            inR[idx] = float(idx % 101) / 100.0f;
+            inG[idx] = float(idx % 211) / 210.0f;
+            inB[idx] = float(idx % 307) / 306.0f;
+        }
+
+        std::vector<float> refR(inR), refG(inG), refB(inB);
+        OCIO::PlanarImageDesc refDesc(&refR[0], &refG[0], &refB[0], nullptr, width, height);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(refDesc));
+
+        std::vector<float> outR(inR), outG(inG), outB(inB);
+        OCIO::PlanarImageDesc outDesc(&outR[0], &outG[0], &outB[0], nullptr, width, height);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(outDesc, 4));
+
+        OCIO_CHECK_ASSERT(outR == refR);
+        OCIO_CHECK_ASSERT(outG == refG);
+        OCIO_CHECK_ASSERT(outB == refB);
+    }
+
+    // Errors from the worker threads are reported to the caller.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor
+            = BuildGammaCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32);
+
+        std::vector<float> inImg(width * height * 4, 0.5f);
+        std::vector<float> outImg(width * (height - 1) * 4);
+
+        const OCIO::PackedImageDesc srcDesc(&inImg[0], width, height, 4);
+        OCIO::PackedImageDesc dstDesc(&outImg[0], width, height - 1, 4);
+
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(srcDesc, dstDesc, 4),
+                              OCIO::Exception,
+                              "Dimension inconsistency between source and destination image "
+                              "buffers.");
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, apply_by_blocks)
+{
+    // The scanlines are processed by blocks of pixels. The unit test validates that images wider
+    // than a block (including a partial last block) produce the same result than processing each
+    // pixel individually. Note that the block size depends on the L1 data cache size, but the
+    // width is larger than the largest block.
+
+    constexpr long width  = 5000;
+    constexpr long height = 3;
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor
+        = BuildGammaCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32);
+
+    std::vector<float> inImg(width * height * 4);
+    for (size_t idx = 0; idx < inImg.size(); ++idx)
+    {
+        inImg[idx] = float(idx % 1013) / 1012.0f;
+    }
+
+    std::vector<float> refImg(inImg);
+    for (long idx = 0; idx < width * height; ++idx)
+    {
+        cpuProcessor->applyRGBA(&refImg[4 * idx]);
+    }
+
+    // Packed RGBA F32 processed in place.
+    {
+        std::vector<float> outImg(inImg);
+        OCIO::PackedImageDesc outDesc(&outImg[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(outDesc));
+
+        for (size_t idx = 0; idx < outImg.size(); ++idx)
+        {
+            OCIO_CHECK_CLOSE(outImg[idx], refImg[idx], 1e-5f);
+        }
+    }
+
+    // Planar RGBA F32 to packed RGBA uint16.
+    {
+        std::vector<float> inR(width * height), inG(width * height);
+        std::vector<float> inB(width * height), inA(width * height);
+        for (long idx = 0; idx < width * height; ++idx)
+        {
+            inR[idx] = inImg[4 * idx + 0];
+            inG[idx] = inImg[4 * idx + 1];
+            inB[idx] = inImg[4 * idx + 2];
+            inA[idx] = inImg[4 * idx + 3];
+        }
+
+        OCIO::ConstCPUProcessorRcPtr cpuProcessorU16
+            = BuildGammaCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT16);
+
+        const OCIO::PlanarImageDesc srcDesc(&inR[0], &inG[0], &inB[0], &inA[0], width, height);
+
+        std::vector<uint16_t> outImg(width * height * 4, 0);
+        OCIO::PackedImageDesc dstDesc(&outImg[0], width, height,
+                                      OCIO::CHANNEL_ORDERING_RGBA,
+                                      OCIO::BIT_DEPTH_UINT16,
+                                      OCIO::AutoStride,
+                                      OCIO::AutoStride,
+                                      OCIO::AutoStride);
+
+        OCIO_CHECK_NO_THROW(cpuProcessorU16->apply(srcDesc, dstDesc));
+
+        for (size_t idx = 0; idx < outImg.size(); ++idx)
+        {
+            const float ref = std::min(std::max(refImg[idx], 0.0f), 1.0f) * 65535.0f;
+            OCIO_CHECK_CLOSE(float(outImg[idx]), ref, 1.0f);
+        }
+    }
+}
+
+namespace
+{
+
+OCIO::ConstCPUProcessorRcPtr BuildRGBCPUProcessor(OCIO::Interpolation lut3dInterp,
+                                                  bool halfDomainLut1d)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    auto transform = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.8, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+    constexpr double offset4[4] = { 0.01, 0.02, 0.03, 0.0 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset4);
+    transform->appendTransform(matrix);
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.0);
+    range->setMaxInValue(1.0);
+    range->setMinOutValue(0.001);
+    range->setMaxOutValue(1.1);
+    transform->appendTransform(range);
+
+    OCIO::LogTransformRcPtr log = OCIO::LogTransform::Create();
+    log->setBase(2.0);
+    transform->appendTransform(log);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double value[4] = { 1.1, 1.2, 1.3, 1.0 };
+    exponent->setValue(value);
+    exponent->setNegativeStyle(OCIO::NEGATIVE_MIRROR);
+    transform->appendTransform(exponent);
+
+    OCIO::ExponentWithLinearTransformRcPtr curve = OCIO::ExponentWithLinearTransform::Create();
+    constexpr double gamma[4]  = { 2.4, 2.4, 2.4, 1.0 };
+    constexpr double offset[4] = { 0.055, 0.055, 0.055, 0.0 };
+    curve->setGamma(gamma);
+    curve->setOffset(offset);
+    transform->appendTransform(curve);
+
+    OCIO::Lut1DTransformRcPtr lut1d
+        = OCIO::Lut1DTransform::Create(halfDomainLut1d ? 65536 : 1024, halfDomainLut1d);
+    for (unsigned long idx = 0; idx < lut1d->getLength(); ++idx)
+    {
+        float r = 0.0f, g = 0.0f, b = 0.0f;
+        lut1d->getValue(idx, r, g, b);
+        lut1d->setValue(idx, r * 0.9f + 0.05f, g * 0.8f, b * b);
+    }
+    transform->appendTransform(lut1d);
+
+    constexpr unsigned long gridSize = 17;
+    OCIO::Lut3DTransformRcPtr lut3d = OCIO::Lut3DTransform::Create(gridSize);
+    for (unsigned long r = 0; r < gridSize; ++r)
+    {
+        for (unsigned long g = 0; g < gridSize; ++g)
+        {
+            for (unsigned long b = 0; b < gridSize; ++b)
+            {
+                const float fr = float(r) / (gridSize - 1);
+                const float fg = float(g) / (gridSize - 1);
+                const float fb = float(b) / (gridSize - 1);
+                lut3d->setValue(r, g, b, 0.7f * fr + 0.3f * fg * fb, fg * fg, 0.5f * (fb + fr));
+            }
+        }
+    }
+    lut3d->setInterpolation(lut3dInterp);
+    transform->appendTransform(lut3d);
+
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(transform);
+    return processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                               OCIO::OPTIMIZATION_NONE);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, apply_packed_rgb)
+{
+    // Packed RGB F32 images are directly processed by the ops i.e. without the intermediate
+    // RGBA F32 buffer. The unit test validates that the result is identical to the one of the
+    // RGBA processing (with a zero alpha, like the RGB to RGBA packing does).
+
+    constexpr long width  = 1000;
+    constexpr long height = 3;
+
+    std::vector<float> inRGBA(width * height * 4);
+    std::vector<float> inRGB(width * height * 3);
+    for (long idx = 0; idx < width * height; ++idx)
+    {
+        for (long c = 0; c < 3; ++c)
+        {
+            const float val = float((idx * 3 + c) % 1013) / 1012.0f * 1.2f - 0.1f;
+            inRGBA[4 * idx + c] = val;
+            inRGB[3 * idx + c]  = val;
+        }
+        inRGBA[4 * idx + 3] = 0.0f;
+    }
+
+    for (OCIO::Interpolation interp : { OCIO::INTERP_TETRAHEDRAL, OCIO::INTERP_LINEAR })
+    {
+        for (bool halfDomain : { false, true })
+        {
+            OCIO::ConstCPUProcessorRcPtr cpuProcessor = BuildRGBCPUProcessor(interp, halfDomain);
+
+            std::vector<float> refImg(inRGBA);
+            OCIO::PackedImageDesc refDesc(&refImg[0], width, height, 4);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(refDesc));
+
+            // Processed in place.
+            {
+                std::vector<float> outImg(inRGB);
+                OCIO::PackedImageDesc outDesc(&outImg[0], width, height, 3);
+                OCIO_CHECK_NO_THROW(cpuProcessor->apply(outDesc));
+
+                for (long idx = 0; idx < width * height; ++idx)
+                {
+                    OCIO_CHECK_EQUAL(outImg[3 * idx + 0], refImg[4 * idx + 0]);
+                    OCIO_CHECK_EQUAL(outImg[3 * idx + 1], refImg[4 * idx + 1]);
+                    OCIO_CHECK_EQUAL(outImg[3 * idx + 2], refImg[4 * idx + 2]);
+                }
+            }
+
+            // From the source to the destination image, with several threads.
+            {
+                const OCIO::PackedImageDesc srcDesc(&inRGB[0], width, height, 3);
+
+                std::vector<float> outImg(width * height * 3, -1.0f);
+                OCIO::PackedImageDesc dstDesc(&outImg[0], width, height, 3);
+                OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, dstDesc, 2));
+
+                for (long idx = 0; idx < width * height; ++idx)
+                {
+                    OCIO_CHECK_EQUAL(outImg[3 * idx + 0], refImg[4 * idx + 0]);
+                    OCIO_CHECK_EQUAL(outImg[3 * idx + 1], refImg[4 * idx + 1]);
+                    OCIO_CHECK_EQUAL(outImg[3 * idx + 2], refImg[4 * idx + 2]);
+                }
+            }
+        }
+    }
+}
+
+namespace
+{
+
+OCIO::ConstCPUProcessorRcPtr BuildPlanarCPUProcessor(bool halfDomainLut1d, bool fastPower)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    auto transform = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.8, 0.0,
+                                 0.1, 0.0, 0.0, 0.9 };
+    constexpr double offset4[4] = { 0.01, 0.02, 0.03, 0.04 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset4);
+    transform->appendTransform(matrix);
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.0);
+    range->setMaxInValue(1.0);
+    range->setMinOutValue(0.001);
+    range->setMaxOutValue(1.1);
+    transform->appendTransform(range);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double value[4] = { 1.1, 1.2, 1.3, 1.4 };
+    exponent->setValue(value);
+    exponent->setNegativeStyle(OCIO::NEGATIVE_MIRROR);
+    transform->appendTransform(exponent);
+
+    OCIO::MatrixTransformRcPtr scale = OCIO::MatrixTransform::Create();
+    constexpr double s44[16] = { 0.5, 0.0, 0.0, 0.0,
+                                 0.0, 0.6, 0.0, 0.0,
+                                 0.0, 0.0, 0.7, 0.0,
+                                 0.0, 0.0, 0.0, 0.8 };
+    scale->setMatrix(s44);
+    transform->appendTransform(scale);
+
+    OCIO::Lut1DTransformRcPtr lut1d
+        = OCIO::Lut1DTransform::Create(halfDomainLut1d ? 65536 : 1024, halfDomainLut1d);
+    for (unsigned long idx = 0; idx < lut1d->getLength(); ++idx)
+    {
+        float r = 0.0f, g = 0.0f, b = 0.0f;
+        lut1d->getValue(idx, r, g, b);
+        lut1d->setValue(idx, r * 0.9f + 0.05f, g * 0.8f, b * b);
+    }
+    transform->appendTransform(lut1d);
+
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(transform);
+    return processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                               fastPower ? OCIO::OPTIMIZATION_FAST_LOG_EXP_POW
+                                                         : OCIO::OPTIMIZATION_NONE);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, apply_planar)
+{
+    // Planar F32 images are directly processed by the ops i.e. without the intermediate RGBA
+    // F32 buffer. The unit test validates that the result is identical to the one of the RGBA
+    // processing (with a zero alpha for images without alpha channel).
+
+    constexpr long width  = 1001;
+    constexpr long height = 3;
+    constexpr long numPixels = width * height;
+
+    std::vector<float> inRGBA(numPixels * 4);
+    std::vector<float> inPlanes(numPixels * 4);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (long c = 0; c < 4; ++c)
+        {
+            const float val = float((idx * 4 + c) % 1013) / 1012.0f * 1.2f - 0.1f;
+            inRGBA[4 * idx + c] = val;
+            inPlanes[c * numPixels + idx] = val;
+        }
+    }
+
+    std::vector<float> inRGB0(inRGBA);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        inRGB0[4 * idx + 3] = 0.0f;
+    }
+
+    for (bool halfDomain : { false, true })
+    {
+        for (bool fastPower : { false, true })
+        {
+            OCIO::ConstCPUProcessorRcPtr cpuProcessor
+                = BuildPlanarCPUProcessor(halfDomain, fastPower);
+
+            std::vector<float> refImg(inRGBA);
+            OCIO::PackedImageDesc refDesc(&refImg[0], width, height, 4);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(refDesc));
+
+            std::vector<float> refImg0(inRGB0);
+            OCIO::PackedImageDesc refDesc0(&refImg0[0], width, height, 4);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(refDesc0));
+
+            // RGBA planes processed in place.
+            {
+                std::vector<float> outImg(inPlanes);
+                OCIO::PlanarImageDesc outDesc(&outImg[0],
+                                              &outImg[numPixels],
+                                              &outImg[2 * numPixels],
+                                              &outImg[3 * numPixels],
+                                              width, height);
+                OCIO_CHECK_NO_THROW(cpuProcessor->apply(outDesc));
+
+                for (long idx = 0; idx < numPixels; ++idx)
+                {
+                    for (long c = 0; c < 4; ++c)
+                    {
+                        OCIO_CHECK_EQUAL(outImg[c * numPixels + idx], refImg[4 * idx + c]);
+                    }
+                }
+            }
+
+            // RGB planes from the source to the destination image, with several threads.
+            {
+                const OCIO::PlanarImageDesc srcDesc(&inPlanes[0],
+                                                    &inPlanes[numPixels],
+                                                    &inPlanes[2 * numPixels],
+                                                    nullptr,
+                                                    width, height);
+
+                std::vector<float> outImg(numPixels * 3, -1.0f);
+                OCIO::PlanarImageDesc dstDesc(&outImg[0],
+                                              &outImg[numPixels],
+                                              &outImg[2 * numPixels],
+                                              nullptr,
+                                              width, height);
+                OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, dstDesc, 2));
+
+                for (long idx = 0; idx < numPixels; ++idx)
+                {
+                    for (long c = 0; c < 3; ++c)
+                    {
+                        OCIO_CHECK_EQUAL(outImg[c * numPixels + idx], refImg0[4 * idx + c]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, reuse_processing_buffers)
+{
+    // The processing buffers are pooled by the CPU processor and reused across the apply calls.
+    // The unit test validates that reusing them for images of various sizes (including after a
+    // processing error) gives the same result than a new CPU processor.
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor
+        = BuildGammaCPUProcessor(OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_F32);
+
+    OCIO_CHECK_NO_THROW(cpuProcessor->reserveProcessingBuffers(2));
+    OCIO_CHECK_NO_THROW(cpuProcessor->reserveProcessingBuffers(0));
+
+    for (long width : { 300L, 1L, 7L, 1000L, 3L })
+    {
+        constexpr long height = 5;
+
+        std::vector<uint16_t> inImg(width * height * 3);
+        for (size_t idx = 0; idx < inImg.size(); ++idx)
+        {
+            inImg[idx] = uint16_t((idx * 7 + width) % 65536);
+        }
+
+        const OCIO::PackedImageDesc srcDesc(&inImg[0], width, height,
+                                            OCIO::CHANNEL_ORDERING_RGB,
+                                            OCIO::BIT_DEPTH_UINT16,
+                                            OCIO::AutoStride,
+                                            OCIO::AutoStride,
+                                            OCIO::AutoStride);
+
+        OCIO::ConstCPUProcessorRcPtr refProcessor
+            = BuildGammaCPUProcessor(OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_F32);
+
+        std::vector<float> refImg(width * height * 4, -1.0f);
+        OCIO::PackedImageDesc refDesc(&refImg[0], width, height, OCIO::CHANNEL_ORDERING_BGRA);
+        OCIO_CHECK_NO_THROW(refProcessor->apply(srcDesc, refDesc));
+
+        for (unsigned numThreads : { 1u, 2u })
+        {
+            std::vector<float> outImg(width * height * 4, -1.0f);
+            OCIO::PackedImageDesc outDesc(&outImg[0], width, height, OCIO::CHANNEL_ORDERING_BGRA);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, outDesc, numThreads));
+
+            OCIO_CHECK_ASSERT(outImg == refImg);
+        }
+
+        // A processing error does not corrupt the pooled buffers.
+        std::vector<float> badImg(width * (height - 1) * 4);
+        OCIO::PackedImageDesc badDesc(&badImg[0], width, height - 1, 4);
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(srcDesc, badDesc),
+                              OCIO::Exception,
+                              "Dimension inconsistency between source and destination image "
+                              "buffers.");
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, processing_stats)
+{
+    // The CPU processor accumulates the processing time and the number of pixels of each stage
+    // only when the statistics are enabled.
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor
+        = BuildGammaCPUProcessor(OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_F32);
+
+    OCIO_CHECK_ASSERT(!cpuProcessor->isStatsEnabled());
+
+    OCIO_REQUIRE_EQUAL(cpuProcessor->getNumStatsStages(), 3);
+    OCIO_CHECK_EQUAL(std::string(cpuProcessor->getStatsStage(0).m_name),
+                     "<BitDepthCast 16ui to 32f>");
+    OCIO_CHECK_EQUAL(std::string(cpuProcessor->getStatsStage(1).m_name), "<MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(cpuProcessor->getStatsStage(2).m_name), "<GammaOp>");
+
+    OCIO_CHECK_THROW_WHAT(cpuProcessor->getStatsStage(3),
+                          OCIO::Exception,
+                          "Invalid index of processing statistics stage: 3.");
+    OCIO_CHECK_THROW_WHAT(cpuProcessor->getStatsStage(-1),
+                          OCIO::Exception,
+                          "Invalid index of processing statistics stage: -1.");
+
+    constexpr long width  = 64;
+    constexpr long height = 32;
+
+    std::vector<uint16_t> inImg(width * height * 4);
+    for (size_t idx = 0; idx < inImg.size(); ++idx)
+    {
+        inImg[idx] = uint16_t((idx * 37) % 65536);
+    }
+
+    const OCIO::PackedImageDesc srcDesc(&inImg[0], width, height, 4,
+                                        OCIO::BIT_DEPTH_UINT16,
+                                        OCIO::AutoStride,
+                                        OCIO::AutoStride,
+                                        OCIO::AutoStride);
+
+    std::vector<float> refImg(width * height * 4);
+    OCIO::PackedImageDesc refDesc(&refImg[0], width, height, 4);
+    OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, refDesc));
+
+    // Nothing is collected by default.
+    for (int idx = 0; idx < cpuProcessor->getNumStatsStages(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpuProcessor->getStatsStage(idx).m_numPixels, 0);
+        OCIO_CHECK_EQUAL(cpuProcessor->getStatsStage(idx).m_time, 0.);
+    }
+
+    cpuProcessor->enableStats(true);
+    OCIO_CHECK_ASSERT(cpuProcessor->isStatsEnabled());
+
+    for (unsigned numThreads : { 1u, 2u })
+    {
+        std::vector<float> outImg(width * height * 4);
+        OCIO::PackedImageDesc outDesc(&outImg[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, outDesc, numThreads));
+
+        // The instrumentation does not change the processing.
+        OCIO_CHECK_ASSERT(outImg == refImg);
+    }
+
+    // The generic path unpacks and packs the scanlines with the input and output bit-depth
+    // ops (i.e. the bit-depth cast and the gamma).
+    const unsigned long long numPixels = 2 * width * height;
+    for (int idx = 0; idx < cpuProcessor->getNumStatsStages(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpuProcessor->getStatsStage(idx).m_numPixels, numPixels);
+    }
+    OCIO_CHECK_ASSERT(cpuProcessor->getStatsStage(0).m_time > 0.);
+    OCIO_CHECK_ASSERT(cpuProcessor->getStatsStage(2).m_time > 0.);
+
+    // The single pixel apply is never accounted for.
+    float pixel[4] = { 0.1f, 0.2f, 0.3f, 1.0f };
+    OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBA(pixel));
+    OCIO_CHECK_EQUAL(cpuProcessor->getStatsStage(1).m_numPixels, numPixels);
+
+    cpuProcessor->resetStats();
+    for (int idx = 0; idx < cpuProcessor->getNumStatsStages(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpuProcessor->getStatsStage(idx).m_numPixels, 0);
+        OCIO_CHECK_EQUAL(cpuProcessor->getStatsStage(idx).m_time, 0.);
+    }
+
+    // A packed RGB F32 image is directly processed by all the ops.
+    OCIO::ConstCPUProcessorRcPtr rgbProcessor
+        = BuildGammaCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32);
+    rgbProcessor->enableStats(true);
+
+    OCIO_REQUIRE_EQUAL(rgbProcessor->getNumStatsStages(), 2);
+    OCIO_CHECK_EQUAL(std::string(rgbProcessor->getStatsStage(0).m_name), "<MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(rgbProcessor->getStatsStage(1).m_name), "<GammaOp>");
+
+    std::vector<float> rgbImg(width * height * 3, 0.5f);
+    OCIO::PackedImageDesc rgbDesc(&rgbImg[0], width, height, 3);
+    OCIO_CHECK_NO_THROW(rgbProcessor->apply(rgbDesc));
+
+    for (int idx = 0; idx < rgbProcessor->getNumStatsStages(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(rgbProcessor->getStatsStage(idx).m_numPixels, width * height);
+    }
+
+    rgbProcessor->enableStats(false);
+    OCIO_CHECK_NO_THROW(rgbProcessor->apply(rgbDesc));
+    OCIO_CHECK_EQUAL(rgbProcessor->getStatsStage(0).m_numPixels, width * height);
+}
@@ -2,6 +2,9 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <condition_variable>
+#include <thread>
+
 #include "Caching.cpp"
 
 #include "testutils/UnitTest.h"
@@ -244,4 +247,349 @@ OCIO_ADD_TEST(Caching, processor_cache)
             OCIO_CHECK_EQUAL(procA, procB); 
         }
     }
-}
\ No newline at end of file
+}
+
+OCIO_ADD_TEST(Caching, generic_cache_capacity)
+{
+    // A unit test to check the eviction of the least recently used entries. Note that the
+    // capacity & statistics methods lock the cache by themselves.
+
+    OCIO::GenericCache<std::string, DataRcPtr> cache;
+
+    DataRcPtr entry1 = std::make_shared<Data>();
+    DataRcPtr entry2 = std::make_shared<Data>();
+    DataRcPtr entry3 = std::make_shared<Data>();
+
+    // The cache is unbounded by default.
+    {
+        OCIO::AutoMutex m(cache.lock());
+        cache["entry1"] = entry1;
+        cache["entry2"] = entry2;
+        cache["entry3"] = entry3;
+    }
+
+    OCIO::CacheStatistics stats = cache.getStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 3);
+    OCIO_CHECK_EQUAL(stats.m_hits, 0);
+    OCIO_CHECK_EQUAL(stats.m_misses, 3);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 0);
+
+    // Use 'entry1' so 'entry2' becomes the least recently used one.
+    {
+        OCIO::AutoMutex m(cache.lock());
+        OCIO_CHECK_EQUAL(cache["entry1"], entry1);
+    }
+
+    // Limit the number of entries.
+    cache.setCapacity(2, 0);
+    {
+        OCIO::AutoMutex m(cache.lock());
+        OCIO_CHECK_ASSERT(cache.exists("entry1"));
+        OCIO_CHECK_ASSERT(!cache.exists("entry2"));
+        OCIO_CHECK_ASSERT(cache.exists("entry3"));
+    }
+
+    stats = cache.getStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 2);
+    OCIO_CHECK_EQUAL(stats.m_hits, 1);
+    OCIO_CHECK_EQUAL(stats.m_misses, 3);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 1);
+
+    // Adding an entry evicts the least recently used one i.e. 'entry3'.
+    {
+        OCIO::AutoMutex m(cache.lock());
+        cache["entry2"] = entry2;
+        OCIO_CHECK_ASSERT(cache.exists("entry1"));
+        OCIO_CHECK_ASSERT(cache.exists("entry2"));
+        OCIO_CHECK_ASSERT(!cache.exists("entry3"));
+    }
+
+    // Limit the memory size.
+    cache.setCapacity(0, 100);
+
+    {
+        OCIO::AutoMutex m(cache.lock());
+        cache.setEntrySize("entry1", entry1, 60);
+    }
+    OCIO_CHECK_EQUAL(cache.getStatistics().m_sizeInBytes, 60);
+
+    // The size of an entry replaced by another instance is ignored.
+    {
+        OCIO::AutoMutex m(cache.lock());
+        cache.setEntrySize("entry2", entry1, 60);
+        OCIO_CHECK_ASSERT(cache.exists("entry2"));
+    }
+    OCIO_CHECK_EQUAL(cache.getStatistics().m_sizeInBytes, 60);
+
+    // 'entry1' is the least recently used one so it is evicted to respect the memory size.
+    {
+        OCIO::AutoMutex m(cache.lock());
+        cache.setEntrySize("entry2", entry2, 50);
+        OCIO_CHECK_ASSERT(cache.exists("entry2"));
+        OCIO_CHECK_ASSERT(!cache.exists("entry1"));
+    }
+
+    stats = cache.getStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_sizeInBytes, 50);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 3);
+
+    // The most recently used entry is kept even if too big.
+    {
+        OCIO::AutoMutex m(cache.lock());
+        cache.setEntrySize("entry2", entry2, 200);
+        OCIO_CHECK_ASSERT(cache.exists("entry2"));
+    }
+    OCIO_CHECK_EQUAL(cache.getStatistics().m_sizeInBytes, 200);
+
+    // Clearing the cache does not reset the counters.
+    cache.clear();
+
+    stats = cache.getStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 0);
+    OCIO_CHECK_EQUAL(stats.m_sizeInBytes, 0);
+    OCIO_CHECK_EQUAL(stats.m_hits, 1);
+    OCIO_CHECK_EQUAL(stats.m_misses, 4);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 3);
+}
+
+OCIO_ADD_TEST(Caching, config_and_file_cache_capacity)
+{
+    // A unit test to check the capacity of the processor cache of a config instance and of the
+    // file cache.
+
+    static const std::string CONFIG = 
+        "ocio_profile_version: 2\n"
+        "\n"
+        "search_path: " + OCIO::GetTestFilesDir() + "\n"
+        "\n"
+        "roles:\n"
+        "  default: cs1\n"
+        "\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs1\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs2\n"
+        "    from_scene_reference: !<FileTransform> {src: lut1d_1.spi1d}\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs3\n"
+        "    from_scene_reference: !<FileTransform> {src: lut1d_2.spi1d}\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs4\n"
+        "    from_scene_reference: !<FileTransform> {src: lut1d_3.spi1d}\n";
+
+    std::istringstream iss;
+    iss.str(CONFIG);
+
+    OCIO::ConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss)->createEditableCopy());
+
+    OCIO::ClearAllCaches();
+    OCIO::SetFileCacheCapacity(2, 0);
+
+    const OCIO::CacheStatistics fileStats = OCIO::GetFileCacheStatistics();
+    OCIO_CHECK_EQUAL(fileStats.m_numEntries, 0);
+
+    config->setProcessorCacheCapacity(2, 0);
+
+    OCIO::ConstProcessorRcPtr proc2 = config->getProcessor("cs1", "cs2");
+    OCIO::ConstProcessorRcPtr proc3 = config->getProcessor("cs1", "cs3");
+    OCIO_CHECK_EQUAL(proc2, config->getProcessor("cs1", "cs2"));
+
+    OCIO::CacheStatistics stats = config->getProcessorCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 2);
+    OCIO_CHECK_EQUAL(stats.m_hits, 1);
+    OCIO_CHECK_EQUAL(stats.m_misses, 2);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 0);
+    OCIO_CHECK_ASSERT(stats.m_sizeInBytes > 0);
+
+    // The least recently used processor (i.e. 'proc3') is evicted.
+    OCIO::ConstProcessorRcPtr proc4 = config->getProcessor("cs1", "cs4");
+    OCIO_CHECK_EQUAL(proc2, config->getProcessor("cs1", "cs2"));
+    OCIO_CHECK_NE(proc3, config->getProcessor("cs1", "cs3"));
+
+    stats = config->getProcessorCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 2);
+    OCIO_CHECK_EQUAL(stats.m_hits, 2);
+    OCIO_CHECK_EQUAL(stats.m_misses, 4);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 2);
+
+    // The file cache is also limited to two LUT files.
+    const OCIO::CacheStatistics newFileStats = OCIO::GetFileCacheStatistics();
+    OCIO_CHECK_EQUAL(newFileStats.m_numEntries, 2);
+    OCIO_CHECK_ASSERT(newFileStats.m_misses - fileStats.m_misses >= 3);
+    OCIO_CHECK_ASSERT(newFileStats.m_evictions > fileStats.m_evictions);
+    OCIO_CHECK_ASSERT(newFileStats.m_sizeInBytes > 0);
+
+    // Restore the default unbounded file cache.
+    OCIO::SetFileCacheCapacity(0, 0);
+    OCIO::ClearAllCaches();
+}
+
+OCIO_ADD_TEST(Caching, sub_processor_cache_capacity)
+{
+    // A unit test to check the capacity of the optimized, CPU and GPU processor caches of a
+    // processor instance.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setSubProcessorCacheCapacity(1, 0);
+
+    OCIO::ExponentTransformRcPtr exp = OCIO::ExponentTransform::Create();
+    exp->setValue({ 2.2, 2.2, 2.2, 1. });
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(exp);
+
+    OCIO::ConstCPUProcessorRcPtr cpu1 = proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE);
+    OCIO_CHECK_EQUAL(cpu1, proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE));
+
+    // The least recently used CPU processor (i.e. 'cpu1') is evicted.
+    OCIO::ConstCPUProcessorRcPtr cpu2
+        = proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_LOSSLESS);
+    OCIO_CHECK_NE(cpu1, proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE));
+
+    OCIO::CacheStatistics stats = proc->getSubProcessorCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_hits, 1);
+    OCIO_CHECK_EQUAL(stats.m_misses, 3);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 2);
+
+    // The optimized, CPU and GPU processor caches are limited independently.
+    OCIO::ConstGPUProcessorRcPtr gpu = proc->getDefaultGPUProcessor();
+    OCIO_CHECK_EQUAL(gpu, proc->getDefaultGPUProcessor());
+    OCIO::ConstProcessorRcPtr opt = proc->getOptimizedProcessor(OCIO::OPTIMIZATION_DEFAULT);
+    OCIO_CHECK_EQUAL(opt, proc->getOptimizedProcessor(OCIO::OPTIMIZATION_DEFAULT));
+
+    stats = proc->getSubProcessorCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 3);
+    OCIO_CHECK_EQUAL(stats.m_hits, 3);
+    OCIO_CHECK_EQUAL(stats.m_misses, 5);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 2);
+
+    // The memory size of the cached processors is mostly the size of their LUTs.
+    config->setSubProcessorCacheCapacity(0, 1);
+
+    OCIO::Lut1DTransformRcPtr lut = OCIO::Lut1DTransform::Create(1024, false);
+    proc = config->getProcessor(lut);
+
+    proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE);
+    proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_LOSSLESS);
+
+    stats = proc->getSubProcessorCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 1);
+    OCIO_CHECK_ASSERT(stats.m_sizeInBytes >= 1024 * 3 * sizeof(float));
+}
+
+OCIO_ADD_TEST(Caching, config_cache_pending_entry)
+{
+    // A unit test to check that a processor being created is not evicted from a processor cache
+    // limited to one entry, so that a concurrent request for it would not create it again.
+
+    // The proxy blocks the LUT file loading until released.
+    class BlockingProxy : public OCIO::ConfigIOProxy
+    {
+    public:
+        std::string getConfigData() const override { return ""; }
+
+        std::vector<uint8_t> getLutData(const char * /*filepath*/) const override
+        {
+            notifyStarted();
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_released; });
+
+            static const std::string lut = "Version 1\nFrom 0.0 1.0\nLength 2\nComponents 1\n"
+                                           "{\n0.0\n0.5\n}\n";
+            return std::vector<uint8_t>(lut.begin(), lut.end());
+        }
+
+        std::string getFastLutFileHash(const char * filepath) const override
+        {
+            return filepath;
+        }
+
+        void notifyStarted() const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_started = true;
+            m_condition.notify_all();
+        }
+
+        void waitStarted() const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_started; });
+        }
+
+        void release()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_released = true;
+            m_condition.notify_all();
+        }
+
+    private:
+        mutable std::mutex m_mutex;
+        mutable std::condition_variable m_condition;
+        mutable bool m_started = false;
+        bool m_released = false;
+    };
+
+    OCIO::ClearAllCaches();
+
+    auto proxy = std::make_shared<BlockingProxy>();
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setConfigIOProxy(proxy);
+    config->setProcessorCacheCapacity(1, 0);
+
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc("pending_lut.spi1d");
+    file->setInterpolation(OCIO::INTERP_LINEAR);
+
+    OCIO::ConstProcessorRcPtr fileProc;
+    std::thread thread([&config, &file, &fileProc, &proxy]()
+    {
+        try
+        {
+            fileProc = config->getProcessor(file);
+        }
+        catch (...)
+        {
+        }
+
+        // Do not wait forever if the LUT file is not loaded through the proxy.
+        proxy->notifyStarted();
+    });
+
+    proxy->waitStarted();
+
+    // Requesting another processor does not evict the pending one i.e. the capacity is
+    // temporarily exceeded.
+    OCIO::ExponentTransformRcPtr exp = OCIO::ExponentTransform::Create();
+    exp->setValue({ 2.2, 2.2, 2.2, 1. });
+    OCIO::ConstProcessorRcPtr expProc = config->getProcessor(exp);
+
+    OCIO::CacheStatistics stats = config->getProcessorCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 2);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 0);
+
+    proxy->release();
+    thread.join();
+
+    OCIO_REQUIRE_ASSERT(fileProc);
+    OCIO_CHECK_ASSERT(!fileProc->isNoOp());
+
+    // Once created, the least recently used processor is evicted.
+    stats = config->getProcessorCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_misses, 2);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 1);
+    OCIO_CHECK_EQUAL(expProc, config->getProcessor(exp));
+
+    OCIO::ClearAllCaches();
+}
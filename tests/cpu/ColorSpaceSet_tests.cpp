@@ -314,3 +314,60 @@ OCIO_ADD_TEST(ColorSpaceSet, operations_on_set)
 
     OCIO_CHECK_EQUAL(css4->getNumColorSpaces(), 0);
 }
+
+OCIO_ADD_TEST(ColorSpaceSet, name_and_alias_lookup)
+{
+    OCIO::ColorSpaceSetRcPtr css = OCIO::ColorSpaceSet::Create();
+
+    for (int idx = 0; idx < 500; ++idx)
+    {
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        const std::string name = "Color Space " + std::to_string(idx);
+        cs->setName(name.c_str());
+        cs->addAlias(("alias" + std::to_string(idx)).c_str());
+        OCIO_CHECK_NO_THROW(css->addColorSpace(cs));
+    }
+    OCIO_REQUIRE_EQUAL(css->getNumColorSpaces(), 500);
+
+    // The names and the aliases are case insensitive.
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("color space 42"), 42);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("COLOR SPACE 499"), 499);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("Alias7"), 7);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("Color Space 500"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("Color Space"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex(""), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex(nullptr), -1);
+
+    // Removing a color space updates the indices.
+    OCIO_CHECK_NO_THROW(css->removeColorSpace("color space 10"));
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("Color Space 10"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias10"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("Color Space 11"), 10);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias499"), 498);
+
+    // Aliases are not removed.
+    OCIO_CHECK_NO_THROW(css->removeColorSpace("alias11"));
+    OCIO_CHECK_EQUAL(css->getNumColorSpaces(), 499);
+
+    // Replacing a color space updates its aliases.
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("color space 20");
+    cs->addAlias("new alias");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs));
+    OCIO_CHECK_EQUAL(css->getNumColorSpaces(), 499);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias20"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("New Alias"), 19);
+    OCIO_CHECK_EQUAL(std::string(css->getColorSpaceNameByIndex(19)), "color space 20");
+
+    // A copy has its own index.
+    OCIO::ColorSpaceSetRcPtr copy = css->createEditableCopy();
+    OCIO_CHECK_NO_THROW(css->clearColorSpaces());
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("new alias"), -1);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("new alias"), 19);
+
+    // An existing alias cannot be used.
+    cs = OCIO::ColorSpace::Create();
+    cs->setName("ALIAS30");
+    OCIO_CHECK_THROW_WHAT(copy->addColorSpace(cs), OCIO::Exception,
+                          "existing color space, 'Color Space 30' is using this name as an alias");
+}
@@ -3,6 +3,7 @@
 
 
 #include <sys/stat.h>
+#include <thread>
 
 #include <pystring.h>
 
@@ -6212,6 +6213,217 @@ OCIO_ADD_TEST(Config, is_inactive)
     }
 }
 
+OCIO_ADD_TEST(Config, create_builtin_config_copies)
+{
+    // The built-in configs are only parsed once but each call returns a distinct config.
+
+    const std::string studioConfigName = "studio-config-v1.0.0_aces-v1.3_ocio-v2.1";
+
+    OCIO::ConstConfigRcPtr config1;
+    OCIO::ConstConfigRcPtr config2;
+    OCIO_CHECK_NO_THROW(config1 = OCIO::Config::CreateFromBuiltinConfig(studioConfigName.c_str()));
+    OCIO_CHECK_NO_THROW(config2 = OCIO::Config::CreateFromBuiltinConfig(studioConfigName.c_str()));
+    OCIO_REQUIRE_ASSERT(config1 && config2);
+    OCIO_CHECK_NE(config1.get(), config2.get());
+
+    std::ostringstream oss1;
+    std::ostringstream oss2;
+    OCIO_CHECK_NO_THROW(config1->serialize(oss1));
+    OCIO_CHECK_NO_THROW(config2->serialize(oss2));
+    OCIO_CHECK_EQUAL(oss1.str(), oss2.str());
+    OCIO_CHECK_EQUAL(std::string(config1->getCacheID()), std::string(config2->getCacheID()));
+
+    // The env. variables are read for each config, as if the config was parsed.
+
+    auto parseBuiltinConfig = [&studioConfigName]()
+    {
+        std::istringstream iss;
+        iss.str(OCIO::BuiltinConfigRegistry::Get().getBuiltinConfigByName(studioConfigName.c_str()));
+        return OCIO::Config::CreateFromStream(iss);
+    };
+
+    const std::string csName = config1->getColorSpaceNameByIndex(0);
+
+    {
+        OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_INACTIVE_COLORSPACES_ENVVAR, csName);
+
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromBuiltinConfig(studioConfigName.c_str()));
+        OCIO_REQUIRE_ASSERT(config);
+        OCIO_CHECK_NE(config->getNumColorSpaces(), config1->getNumColorSpaces());
+
+        OCIO::ConstConfigRcPtr parsedConfig = parseBuiltinConfig();
+        OCIO_CHECK_EQUAL(config->getNumColorSpaces(), parsedConfig->getNumColorSpaces());
+        OCIO_CHECK_EQUAL(config->isInactiveColorSpace(csName.c_str()),
+                         parsedConfig->isInactiveColorSpace(csName.c_str()));
+    }
+
+    OCIO_REQUIRE_ASSERT(config1->getNumDisplays() > 1);
+    const std::string displayName = config1->getDisplay(1);
+
+    {
+        OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_ACTIVE_DISPLAYS_ENVVAR, displayName);
+
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromBuiltinConfig(studioConfigName.c_str()));
+        OCIO_REQUIRE_ASSERT(config);
+        OCIO_REQUIRE_EQUAL(config->getNumDisplays(), 1);
+        OCIO_CHECK_EQUAL(std::string(config->getDisplay(0)), displayName);
+    }
+
+    OCIO::ConstConfigRcPtr config3;
+    OCIO_CHECK_NO_THROW(config3 = OCIO::Config::CreateFromBuiltinConfig(studioConfigName.c_str()));
+    OCIO_CHECK_EQUAL(config3->getNumDisplays(), config1->getNumDisplays());
+    OCIO_CHECK_EQUAL(config3->getNumColorSpaces(), config1->getNumColorSpaces());
+
+    // An unknown name is never cached i.e. it always throws.
+    for (int idx = 0; idx < 2; ++idx)
+    {
+        OCIO_CHECK_THROW_WHAT(OCIO::Config::CreateFromBuiltinConfig("unknown-config"),
+                              OCIO::Exception,
+                              "Could not find 'unknown-config' in the built-in configurations.");
+    }
+
+    // The lazy loading mode is part of the cache key i.e. the config is parsed again with it.
+    {
+        OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_LAZY_CONFIG_LOADING_ENVVAR, "1");
+
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromBuiltinConfig(studioConfigName.c_str()));
+        OCIO_REQUIRE_ASSERT(config);
+        OCIO_CHECK_EQUAL(config->getNumColorSpaces(), config1->getNumColorSpaces());
+        OCIO_CHECK_NO_THROW(config->validate());
+    }
+}
+
+OCIO_ADD_TEST(Config, lazy_loading)
+{
+    static constexpr char CONFIG[]{ R"(ocio_profile_version: 2
+
+environment: {}
+search_path: ""
+roles:
+  default: raw
+  scene_linear: lin
+
+displays:
+  sRGB:
+    - !<View> {name: Raw, colorspace: raw}
+
+colorspaces:
+  - !<ColorSpace>
+    name: raw
+
+  - !<ColorSpace>
+    name: lin
+    aliases: [linear]
+    categories: [working-space]
+    to_scene_reference: !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}
+
+  - !<ColorSpace>
+    name: bad
+    family: broken
+    from_scene_reference: !<ExponentTransform> {value: [1, 2]}
+)" };
+
+    // The invalid transform makes the config fail to load.
+    {
+        std::istringstream is(CONFIG);
+        OCIO_CHECK_THROW_WHAT(OCIO::Config::CreateFromStream(is), OCIO::Exception,
+                              "'value' values must be 4 floats. Found '2'.");
+    }
+
+    OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_LAZY_CONFIG_LOADING_ENVVAR, "1");
+
+    std::istringstream is(CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+    OCIO_REQUIRE_ASSERT(config);
+
+    // The names, aliases, families and categories are available without building any transform.
+    OCIO_CHECK_EQUAL(config->getNumColorSpaces(), 3);
+    OCIO_CHECK_EQUAL(config->getIndexForColorSpace("linear"), 1);
+    OCIO_CHECK_EQUAL(std::string(config->getCanonicalName("bad")), "bad");
+    OCIO_CHECK_EQUAL(config->getColorSpaces("working-space")->getNumColorSpaces(), 1);
+
+    // A copy keeps the deferred transforms.
+    OCIO::ConfigRcPtr copy = config->createEditableCopy();
+
+    // Checking the usage of a color space does not throw, the color space failing to load is
+    // only logged.
+    {
+        OCIO::ConstConfigRcPtr other = config->createEditableCopy();
+
+        OCIO::LogGuard logGuard;
+        bool used = true;
+        OCIO_CHECK_NO_THROW(used = other->isColorSpaceUsed("bad"));
+        OCIO_CHECK_ASSERT(!used);
+        OCIO_CHECK_NE(logGuard.output().find(
+                          "Loading the transforms of the color space 'bad' failed. "),
+                      std::string::npos);
+
+        OCIO_CHECK_ASSERT(other->isColorSpaceUsed("lin"));
+        OCIO_CHECK_ASSERT(!other->isColorSpaceUsed("unknown"));
+    }
+
+    // The transforms are built on first use.
+    OCIO::ConstColorSpaceRcPtr cs;
+    OCIO_CHECK_NO_THROW(cs = config->getColorSpace("scene_linear"));
+    OCIO_REQUIRE_ASSERT(cs);
+    OCIO::ConstTransformRcPtr tr = cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE);
+    OCIO_REQUIRE_ASSERT(tr);
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::MatrixTransform>(tr));
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor("lin", "raw"));
+    OCIO_REQUIRE_ASSERT(proc);
+    float pixel[3]{ 0.f, 0.f, 0.f };
+    proc->getDefaultCPUProcessor()->applyRGB(pixel);
+    OCIO_CHECK_EQUAL(pixel[0], 0.1f);
+    OCIO_CHECK_EQUAL(pixel[1], 0.2f);
+    OCIO_CHECK_EQUAL(pixel[2], 0.3f);
+
+    // The errors are reported when the color space is used.
+    OCIO_CHECK_THROW_WHAT(config->getColorSpace("bad"), OCIO::Exception,
+                          "Loading the transforms of the color space 'bad' failed. ");
+    OCIO_CHECK_THROW_WHAT(config->getProcessor("lin", "bad"), OCIO::Exception,
+                          "'value' values must be 4 floats. Found '2'.");
+    OCIO_CHECK_THROW_WHAT(config->validate(), OCIO::Exception,
+                          "'value' values must be 4 floats. Found '2'.");
+
+    // The copy builds its own transforms.
+    OCIO_CHECK_NO_THROW(cs = copy->getColorSpace("lin"));
+    OCIO_REQUIRE_ASSERT(cs);
+    OCIO_CHECK_ASSERT(cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE));
+
+    // Replacing the faulty color space discards its deferred transforms.
+    OCIO::ColorSpaceRcPtr fixed = OCIO::ColorSpace::Create();
+    fixed->setName("bad");
+    OCIO_CHECK_NO_THROW(copy->addColorSpace(fixed));
+    OCIO_CHECK_NO_THROW(copy->validate());
+
+    // The same version checks apply when the transforms are built.
+    static constexpr char CONFIG_V1[]{ R"(ocio_profile_version: 1
+
+roles:
+  default: raw
+
+displays:
+  sRGB:
+    - !<View> {name: Raw, colorspace: raw}
+
+colorspaces:
+  - !<ColorSpace>
+    name: raw
+    to_reference: !<RangeTransform> {min_in_value: 0, max_in_value: 1, min_out_value: 0, max_out_value: 1}
+)" };
+
+    std::istringstream isV1(CONFIG_V1);
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(isV1));
+    OCIO_CHECK_THROW_WHAT(config->getColorSpace("raw"), OCIO::Exception,
+                          "Only config version 2 (or higher) can have RangeTransform.");
+}
+
 OCIO_ADD_TEST(Config, inactive_color_space_precedence)
 {
     // The test demonstrates that an API request supersedes the env. variable and the
@@ -7983,6 +8195,110 @@ colorspaces:
     }
 }
 
+OCIO_ADD_TEST(Config, processor_cache_multithreaded)
+{
+    // Validation of the processor cache of the Config class when several threads concurrently
+    // request processors.
+
+    constexpr const char * CONFIG_CUSTOM {
+R"(ocio_profile_version: 2
+
+search_path: ""
+strictparsing: true
+luma: [0.2126, 0.7152, 0.0722]
+
+roles:
+  default: ref
+
+file_rules:
+  - !<Rule> {name: Default, colorspace: default}
+
+displays:
+  Disp1:
+    - !<View> {name: View1, colorspace: cs1}
+
+colorspaces:
+  - !<ColorSpace>
+    name: ref
+
+  - !<ColorSpace>
+    name: cs1
+    from_scene_reference: !<BuiltinTransform> {style: ACEScct_to_ACES2065-1}
+
+  - !<ColorSpace>
+    name: cs2
+    from_scene_reference: !<ColorSpaceTransform> {src: ref, dst: cs1}
+
+  - !<ColorSpace>
+    name: cs3
+    from_scene_reference: !<ExponentTransform> {value: 2.2}
+
+  - !<ColorSpace>
+    name: cs4
+    from_scene_reference: !<FileTransform> {src: missing_file.clf}
+)"};
+
+    std::istringstream iss;
+    iss.str(CONFIG_CUSTOM);
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+
+    static constexpr size_t NumThreads = 8;
+    static const char * dstNames[] = { "cs1", "cs2", "cs3", "cs4" };
+
+    std::vector<OCIO::ConstProcessorRcPtr> processors(NumThreads * 4);
+    std::vector<int> failures(NumThreads * 4, 0);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        threads.emplace_back([&config, &processors, &failures, t]()
+        {
+            // Each thread requests the processors in a different order.
+            for (size_t idx = 0; idx < 4; ++idx)
+            {
+                const size_t dst = (idx + t) % 4;
+                try
+                {
+                    processors[t * 4 + dst] = config->getProcessor("ref", dstNames[dst]);
+                }
+                catch (const OCIO::Exception &)
+                {
+                    ++failures[t * 4 + dst];
+                }
+            }
+        });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        // All the threads get the same cached instances.
+        OCIO_REQUIRE_ASSERT(processors[t * 4 + 0]);
+        OCIO_CHECK_EQUAL(processors[t * 4 + 0].get(), processors[0].get());
+        OCIO_REQUIRE_ASSERT(processors[t * 4 + 2]);
+        OCIO_CHECK_EQUAL(processors[t * 4 + 2].get(), processors[2].get());
+
+        // Keys are different but processors are identical so it returns the same instance.
+        OCIO_CHECK_EQUAL(processors[t * 4 + 1].get(), processors[0].get());
+
+        // A failing creation is not cached, every request fails.
+        OCIO_CHECK_ASSERT(!processors[t * 4 + 3]);
+        OCIO_CHECK_EQUAL(failures[t * 4 + 3], 1);
+    }
+
+    OCIO_CHECK_NE(processors[0].get(), processors[2].get());
+
+    // The cache is still working after the concurrent accesses.
+    OCIO_CHECK_EQUAL(config->getProcessor("ref", "cs3").get(), processors[2].get());
+    OCIO_CHECK_THROW(config->getProcessor("ref", "cs4"), OCIO::Exception);
+}
+
 OCIO_ADD_TEST(Config, context_variables_typical_use_cases)
 {
     // Case 1 - No context variables used in the config.
@@ -1400,6 +1400,197 @@ OCIO_ADD_TEST(OpOptimizers, gamma_prefix)
     OCIO_CHECK_EQUAL(o2->data()->getType(), OCIO::OpData::GammaType);
 }
 
+OCIO_ADD_TEST(OpOptimizers, bake_lut)
+{
+    // A separable chain of log & gamma ops is baked into a half-domain 1D LUT.
+
+    OCIO::OpRcPtrVec originalOps;
+
+    const double base = 10.0;
+    const double logSlope[3]  = { 0.18, 0.18, 0.18 };
+    const double linSlope[3]  = { 2.0, 2.0, 2.0 };
+    const double linOffset[3] = { 0.1, 0.1, 0.1 };
+    const double logOffset[3] = { 1.0, 1.0, 1.0 };
+
+    OCIO_CHECK_NO_THROW(OCIO::CreateLogOp(originalOps, base, logSlope, logOffset, linSlope,
+                                          linOffset, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO::GammaOpData::Params params = { 2.2 };
+    OCIO::GammaOpData::Params paramsA = { 1. };
+    OCIO::GammaOpDataRcPtr gamma
+        = std::make_shared<OCIO::GammaOpData>(OCIO::GammaOpData::BASIC_FWD,
+                                              params, params, params, paramsA);
+    OCIO_CHECK_NO_THROW(OCIO::CreateGammaOp(originalOps, gamma, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(originalOps.size(), 2);
+    OCIO_CHECK_NO_THROW(originalOps.finalize());
+
+    OCIO::OpRcPtrVec optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32,
+                                                         OCIO::BIT_DEPTH_F32,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT));
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 1);
+
+    OCIO::ConstOpRcPtr o = optimizedOps[0];
+    OCIO::ConstLut1DOpDataRcPtr lut1D = OCIO::DynamicPtrCast<const OCIO::Lut1DOpData>(o->data());
+    OCIO_REQUIRE_ASSERT(lut1D);
+    OCIO_CHECK_ASSERT(lut1D->isInputHalfDomain());
+
+    // The measured error is recorded in the metadata.
+    OCIO_REQUIRE_EQUAL(lut1D->getFormatMetadata().getNumChildrenElements(), 1);
+    const std::string desc{ lut1D->getFormatMetadata().getChildElement(0).getElementValue() };
+    OCIO_CHECK_NE(desc.find("measured max error"), std::string::npos);
+
+    CompareRender(originalOps, optimizedOps, __LINE__, 1e-3f, true);
+
+    // With an integer input bit-depth, the separable prefix optimization is used instead.
+
+    optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10,
+                                                         OCIO::BIT_DEPTH_F32,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT));
+    OCIO_CHECK_EQUAL(optimizedOps.size(), 2);
+
+    // A CDL with a saturation has channel crosstalk so it is baked into a 3D LUT, the trailing
+    // gamma & range ops being baked into a half-domain 1D LUT. The leading clamp is not baked
+    // and, as it keeps the input in the [0, 1] range, no shaper is needed.
+
+    OCIO::CDLOpDataRcPtr cdl
+        = std::make_shared<OCIO::CDLOpData>(OCIO::CDLOpData::CDL_NO_CLAMP_FWD,
+                                            OCIO::CDLOpData::ChannelParams(1.1, 0.9, 1.05),
+                                            OCIO::CDLOpData::ChannelParams(0.0),
+                                            OCIO::CDLOpData::ChannelParams(1.2, 1.1, 0.95),
+                                            0.8);
+
+    originalOps.clear();
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(originalOps, 0., 1., 0., 1.,
+                                            OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateCDLOp(originalOps, cdl, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateGammaOp(originalOps, gamma, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(originalOps, 0., 1., 0., 1.,
+                                            OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(originalOps.finalize());
+
+    optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32,
+                                                         OCIO::BIT_DEPTH_F32,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT));
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 3);
+    o = optimizedOps[0];
+    OCIO_CHECK_EQUAL(o->data()->getType(), OCIO::OpData::RangeType);
+    o = optimizedOps[1];
+    OCIO_CHECK_EQUAL(o->data()->getType(), OCIO::OpData::Lut3DType);
+    o = optimizedOps[2];
+    OCIO_CHECK_EQUAL(o->data()->getType(), OCIO::OpData::Lut1DType);
+
+    CompareRender(originalOps, optimizedOps, __LINE__, 1e-3f, true);
+
+    // The negative and very large values are clamped before reaching the 3D LUT.
+    {
+        std::vector<float> img1 = {
+            -1.f,    0.5f,   2000.f, 1.f,
+            -0.01f, -100.f,  0.18f,  1.f,
+             5000.f, 1.f,    0.2f,   1.f };
+        std::vector<float> img2 = img1;
+
+        for (const auto & op : originalOps)
+        {
+            op->apply(img1.data(), img1.data(), 3);
+        }
+        for (const auto & op : optimizedOps)
+        {
+            op->apply(img2.data(), img2.data(), 3);
+        }
+        for (size_t idx = 0; idx < img1.size(); ++idx)
+        {
+            OCIO_CHECK_CLOSE(img1[idx], img2[idx], 1e-3f);
+        }
+    }
+
+    // Without the leading clamp, the negative and above 1024 values leave the shaper domain
+    // so the CDL is not baked.
+
+    originalOps.erase(originalOps.begin());
+
+    optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32,
+                                                         OCIO::BIT_DEPTH_F32,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT));
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 3);
+    o = optimizedOps[0];
+    OCIO_CHECK_EQUAL(o->data()->getType(), OCIO::OpData::CDLType);
+
+    // That is not the case with an integer input bit-depth, the input being in the [0, 1] range.
+
+    optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10,
+                                                         OCIO::BIT_DEPTH_F32,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT));
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 2);
+    o = optimizedOps[0];
+    OCIO_CHECK_EQUAL(o->data()->getType(), OCIO::OpData::Lut3DType);
+
+    // The hue discontinuity of the RGB to HSV conversion cannot be baked, so the op is kept.
+
+    originalOps.clear();
+    OCIO_CHECK_NO_THROW(OCIO::CreateFixedFunctionOp(originalOps,
+                                                    OCIO::FixedFunctionOpData::RGB_TO_HSV, {}));
+    OCIO_CHECK_NO_THROW(originalOps.finalize());
+
+    optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32,
+                                                         OCIO::BIT_DEPTH_F32,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT));
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 1);
+    o = optimizedOps[0];
+    OCIO_CHECK_EQUAL(o->data()->getType(), OCIO::OpData::FixedFunctionType);
+}
+
+OCIO_ADD_TEST(OpOptimizers, lut3d_inverse_fast_resolution)
+{
+    // The resolution of the fast inverse Lut3D only increases when explicitly requested.
+
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(33);
+    for (auto & val : lut->getArray().getValues())
+    {
+        val *= val;
+    }
+
+    OCIO::OpRcPtrVec originalOps;
+    OCIO_CHECK_NO_THROW(OCIO::CreateLut3DOp(originalOps, lut, OCIO::TRANSFORM_DIR_INVERSE));
+    OCIO_CHECK_NO_THROW(originalOps.finalize());
+
+    const OCIO::OptimizationFlags presets[] = { OCIO::OPTIMIZATION_VERY_GOOD,
+                                                OCIO::OPTIMIZATION_GOOD,
+                                                OCIO::OPTIMIZATION_DRAFT,
+                                                OCIO::OPTIMIZATION_ALL,
+                                                OCIO::OPTIMIZATION_DEFAULT };
+
+    for (const auto preset : presets)
+    {
+        const struct
+        {
+            OCIO::OptimizationOptIns m_optIns;
+            unsigned long m_gridSize;
+        } tests[] = {
+            { OCIO::OPTIMIZATION_OPT_IN_NONE,                  48 },
+            { OCIO::OPTIMIZATION_OPT_IN_LUT_INV_FAST_HIGH_RES, 65 },
+        };
+
+        for (const auto & test : tests)
+        {
+            OCIO::OpRcPtrVec optimizedOps = originalOps.clone();
+            OCIO_CHECK_NO_THROW(optimizedOps.optimize(preset, test.m_optIns));
+            OCIO_REQUIRE_EQUAL(optimizedOps.size(), 1);
+
+            OCIO::ConstOpRcPtr o = optimizedOps[0];
+            auto lutData = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(o->data());
+            OCIO_REQUIRE_ASSERT(lutData);
+            OCIO_CHECK_EQUAL(lutData->getDirection(), OCIO::TRANSFORM_DIR_FORWARD);
+            OCIO_CHECK_EQUAL(static_cast<unsigned long>(lutData->getGridSize()), test.m_gridSize);
+        }
+    }
+}
+
 OCIO_ADD_TEST(OpOptimizers, multi_op_prefix)
 {
     // Test prefix optimization of a complex transform.
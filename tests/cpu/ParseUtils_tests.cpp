@@ -527,3 +527,40 @@ OCIO_ADD_TEST(ParseUtils, intersect_string_vecs_case_ignore)
     OCIO_CHECK_EQUAL("test", resInter[3]);
 }
 
+
+OCIO_ADD_TEST(ParseUtils, memory_istream)
+{
+    const std::string buffer("line 1\r\n\n  \nline 2\n3.5 4");
+
+    OCIO::MemoryIStream stream(buffer.data(), buffer.size());
+
+    std::string line;
+    OCIO_CHECK_ASSERT(OCIO::nextline(stream, line));
+    OCIO_CHECK_EQUAL(line, "line 1");
+    OCIO_CHECK_ASSERT(OCIO::nextline(stream, line));
+    OCIO_CHECK_EQUAL(line, "line 2");
+
+    float a = 0.f;
+    int b = 0;
+    stream >> a >> b;
+    OCIO_CHECK_EQUAL(a, 3.5f);
+    OCIO_CHECK_EQUAL(b, 4);
+    OCIO_CHECK_ASSERT(stream.eof());
+
+    // The stream is seekable.
+    stream.clear();
+    stream.seekg(0, std::ios_base::end);
+    OCIO_CHECK_EQUAL(stream.tellg(), std::streampos(buffer.size()));
+    stream.seekg(5);
+    OCIO_CHECK_ASSERT(OCIO::nextline(stream, line));
+    OCIO_CHECK_EQUAL(line, "1");
+
+    stream.seekg(-5, std::ios_base::end);
+    OCIO_CHECK_ASSERT(OCIO::nextline(stream, line));
+    OCIO_CHECK_EQUAL(line, "3.5 4");
+
+    // Seeking out of the buffer fails.
+    stream.clear();
+    stream.seekg(100);
+    OCIO_CHECK_ASSERT(stream.fail());
+}
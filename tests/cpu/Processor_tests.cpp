@@ -299,6 +299,49 @@ OCIO_ADD_TEST(Processor, optimization_env_override_basic)
     OCIO_CHECK_EQUAL(OCIO::OPTIMIZATION_GOOD, OCIO::EnvironmentOverride(testFlag));
 }
 
+OCIO_ADD_TEST(Processor, optimization_opt_ins)
+{
+    // The finer grid of the fast inverse Lut3D is only used when the config opts in.
+
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(33);
+    for (unsigned long r = 0; r < 33; ++r)
+    {
+        for (unsigned long g = 0; g < 33; ++g)
+        {
+            for (unsigned long b = 0; b < 33; ++b)
+            {
+                const float rv = r / 32.f, gv = g / 32.f, bv = b / 32.f;
+                lut->setValue(r, g, b, rv * rv, gv * gv, bv * bv);
+            }
+        }
+    }
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    OCIO_CHECK_EQUAL(config->getOptimizationOptIns(), OCIO::OPTIMIZATION_OPT_IN_NONE);
+
+    auto getGridSize = [&config, &lut]()
+    {
+        OCIO::ConstProcessorRcPtr proc = config->getProcessor(lut);
+        OCIO::GroupTransformRcPtr group
+            = proc->getOptimizedProcessor(OCIO::OPTIMIZATION_ALL)->createGroupTransform();
+        OCIO_REQUIRE_EQUAL(group->getNumTransforms(), 1);
+        auto fastLut = OCIO::DynamicPtrCast<const OCIO::Lut3DTransform>(group->getTransform(0));
+        OCIO_REQUIRE_ASSERT(fastLut);
+        OCIO_CHECK_EQUAL(fastLut->getDirection(), OCIO::TRANSFORM_DIR_FORWARD);
+        return fastLut->getGridSize();
+    };
+
+    OCIO_CHECK_EQUAL(getGridSize(), 48ul);
+
+    // Changing the opt-ins clears the processor cache.
+    config->setOptimizationOptIns(OCIO::OPTIMIZATION_OPT_IN_LUT_INV_FAST_HIGH_RES);
+    OCIO_CHECK_EQUAL(getGridSize(), 65ul);
+
+    config->setOptimizationOptIns(OCIO::OPTIMIZATION_OPT_IN_NONE);
+    OCIO_CHECK_EQUAL(getGridSize(), 48ul);
+}
+
 OCIO_ADD_TEST(Processor, cache_optimized_processors)
 {
     // Test the cache for the optimized processors.
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "ThreadingUtils.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(ThreadingUtils, get_num_threads)
+{
+    OCIO_CHECK_GE(OCIO::GetNumThreads(0), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(1), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(7), 7u);
+}
+
+OCIO_ADD_TEST(ThreadingUtils, parallel_for)
+{
+    // Each item must be processed once and only once, whatever the number of threads.
+
+    constexpr long numItems = 1001;
+
+    for (unsigned numThreads : { 0u, 1u, 2u, 3u, 64u })
+    {
+        std::vector<std::atomic<int>> counts(numItems);
+        for (auto & count : counts)
+        {
+            count = 0;
+        }
+
+        std::atomic<bool> validThreadIndex{ true };
+
+        OCIO_CHECK_NO_THROW(OCIO::ParallelFor(numItems, 10, numThreads,
+            [&](unsigned threadIndex, long begin, long end)
+            {
+                if (threadIndex >= OCIO::GetNumThreads(numThreads) || (end - begin) > 10)
+                {
+                    validThreadIndex = false;
+                }
+
+                for (long idx = begin; idx < end; ++idx)
+                {
+                    ++counts[idx];
+                }
+            }));
+
+        OCIO_CHECK_ASSERT(validThreadIndex);
+
+        for (long idx = 0; idx < numItems; ++idx)
+        {
+            OCIO_REQUIRE_EQUAL(counts[idx].load(), 1);
+        }
+    }
+
+    // Nothing to process.
+
+    bool called = false;
+    OCIO_CHECK_NO_THROW(OCIO::ParallelFor(0, 10, 4, [&](unsigned, long, long) { called = true; }));
+    OCIO_CHECK_ASSERT(!called);
+}
+
+OCIO_ADD_TEST(ThreadingUtils, parallel_for_exception)
+{
+    // An exception thrown by a worker thread is rethrown in the calling thread.
+
+    for (unsigned numThreads : { 1u, 4u })
+    {
+        OCIO_CHECK_THROW_WHAT(OCIO::ParallelFor(100, 1, numThreads,
+            [](unsigned, long begin, long)
+            {
+                if (begin == 42)
+                {
+                    throw OCIO::Exception("Chunk 42 failed.");
+                }
+            }),
+            OCIO::Exception,
+            "Chunk 42 failed.");
+    }
+}
@@ -4,6 +4,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CPUInfo.h"
 #include "Logging.h"
 #include "OpBuilders.h"
 #include "UnitTestUtils.h"
@@ -71,6 +72,125 @@ ConstProcessorRcPtr GetFileTransformProcessor(const std::string & fileName)
     return config->getProcessor(fileTransform);
 }
 
+WideVectorGuard::WideVectorGuard()
+    : m_flags(CPUInfo::instance().flags)
+{
+    CPUInfo::instance().flags &= ~(X86_CPU_FLAG_AVX2 | X86_CPU_FLAG_AVX512);
+}
+
+WideVectorGuard::~WideVectorGuard()
+{
+    CPUInfo::instance().flags = m_flags;
+}
+
+namespace
+{
+
+bool CheckImages(const std::vector<float> & values,
+                 const std::vector<float> & expected,
+                 float errorThreshold)
+{
+    for (size_t idx = 0; idx < values.size(); ++idx)
+    {
+        if (!EqualWithSafeRelError(values[idx], expected[idx], errorThreshold, 1.0f))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anon.
+
+bool CheckWideRenderer(const ConstOpCPURcPtr & renderer,
+                       const ConstOpCPURcPtr & reference,
+                       const std::vector<float> & rgbaImg,
+                       float errorThreshold)
+{
+    const long numPixels = static_cast<long>(rgbaImg.size() / 4);
+
+    std::vector<float> expected(rgbaImg.size()), values(rgbaImg.size());
+    reference->apply(rgbaImg.data(), expected.data(), numPixels);
+    renderer->apply(rgbaImg.data(), values.data(), numPixels);
+
+    if (!CheckImages(values, expected, errorThreshold))
+    {
+        return false;
+    }
+
+    // The expected values of the layouts without alpha.
+    std::vector<float> rgb0Img(rgbaImg), expected0(rgbaImg.size());
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        rgb0Img[idx * 4 + 3] = 0.0f;
+    }
+    reference->apply(rgb0Img.data(), expected0.data(), numPixels);
+
+    if (renderer->hasRGBSupport())
+    {
+        std::vector<float> rgbImg(numPixels * 3), rgbValues(numPixels * 3);
+        std::vector<float> rgbExpected(numPixels * 3);
+        for (long idx = 0; idx < numPixels * 3; ++idx)
+        {
+            rgbImg[idx]      = rgbaImg[(idx / 3) * 4 + idx % 3];
+            rgbExpected[idx] = expected0[(idx / 3) * 4 + idx % 3];
+        }
+        renderer->applyRGB(rgbImg.data(), rgbValues.data(), numPixels);
+
+        if (!CheckImages(rgbValues, rgbExpected, errorThreshold))
+        {
+            return false;
+        }
+    }
+
+    if (renderer->hasPlanarSupport())
+    {
+        std::vector<float> inPlanes[4], outPlanes[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            inPlanes[c].resize(numPixels);
+            outPlanes[c].resize(numPixels);
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                inPlanes[c][idx] = rgbaImg[idx * 4 + c];
+            }
+        }
+
+        const float * in[4] = { inPlanes[0].data(), inPlanes[1].data(),
+                                inPlanes[2].data(), inPlanes[3].data() };
+        float * out[4] = { outPlanes[0].data(), outPlanes[1].data(),
+                           outPlanes[2].data(), outPlanes[3].data() };
+
+        // Process with and without the alpha plane.
+        for (const bool hasAlpha : { true, false })
+        {
+            if (!hasAlpha)
+            {
+                in[3]  = nullptr;
+                out[3] = nullptr;
+            }
+            renderer->applyPlanar(in, out, numPixels);
+
+            const std::vector<float> & ref = hasAlpha ? expected : expected0;
+            for (long idx = 0; idx < numPixels * 4; ++idx)
+            {
+                const int c = static_cast<int>(idx % 4);
+                if (!hasAlpha && c == 3)
+                {
+                    continue;
+                }
+                if (!EqualWithSafeRelError(outPlanes[c][idx / 4], ref[idx],
+                                           errorThreshold, 1.0f))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 namespace
 {
     constexpr const char* TempDirMagicPrefix = "OCIOTestTemp_";
@@ -135,6 +135,24 @@ struct EnvironmentVariableGuard
     const std::string m_name;
 };
 
+// Disable the wide vector (i.e. AVX2 & AVX-512) CPU features while the guard exists so the
+// renderers created in the meantime only use the SSE2 ones e.g. to compute the expected values.
+struct WideVectorGuard
+{
+    WideVectorGuard();
+    ~WideVectorGuard();
+
+    const unsigned int m_flags;
+};
+
+// Check that the renderer processes the RGBA, RGB and planar (with and without alpha) layouts
+// of the RGBA input image like the reference renderer processes the RGBA image, the alpha being
+// zero for the layouts without alpha.
+bool CheckWideRenderer(const ConstOpCPURcPtr & renderer,
+                       const ConstOpCPURcPtr & reference,
+                       const std::vector<float> & rgbaImg,
+                       float errorThreshold);
+
 /**
  * \brief Create a Temporary Directory
  * 
@@ -1006,6 +1006,131 @@ OCIO::LocalCachedFileRcPtr ParseString(const std::string & str)
 }
 }
 
+OCIO_ADD_TEST(FileFormatCTF, lut1d_read_by_blocks)
+{
+    // The array is much larger than the blocks fed to the XML parser so values and lines
+    // are spread over several blocks.
+    static constexpr unsigned long Length = 65536;
+
+    std::ostringstream header;
+    header << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+           << "<ProcessList compCLFversion=\"3\" id=\"blocks\">\n"
+           << "    <LUT1D inBitDepth=\"32f\" outBitDepth=\"32f\">\n"
+           << "        <Array dim=\"" << Length << " 3\">\n";
+
+    std::ostringstream values;
+    std::vector<float> expected;
+    for (unsigned long idx = 0; idx < Length; ++idx)
+    {
+        std::ostringstream oss;
+        oss.precision(9);
+        oss << (double(idx) / double(Length - 1));
+        const std::string value = oss.str();
+
+        double val = 0.;
+        OCIO::NumberUtils::from_chars(value.data(), value.data() + value.size(), val);
+        expected.push_back(float(val));
+
+        // Mix the delimiters.
+        values << value << " " << value << (idx % 2 ? "," : "\t") << value << "\n";
+    }
+
+    const std::string footer = "        </Array>\n    </LUT1D>\n</ProcessList>";
+
+    OCIO::LocalCachedFileRcPtr cachedFile;
+    OCIO_CHECK_NO_THROW(cachedFile = ParseString(header.str() + values.str() + footer));
+    OCIO_REQUIRE_ASSERT(cachedFile);
+
+    const OCIO::ConstOpDataVec & opList = cachedFile->m_transform->getOps();
+    OCIO_REQUIRE_EQUAL(opList.size(), 1);
+    auto pLut = std::dynamic_pointer_cast<const OCIO::Lut1DOpData>(opList[0]);
+    OCIO_REQUIRE_ASSERT(pLut);
+
+    const OCIO::Array::Values & lutValues = pLut->getArray().getValues();
+    OCIO_REQUIRE_EQUAL(lutValues.size(), 3 * Length);
+
+    unsigned long numMismatches = 0;
+    for (unsigned long idx = 0; idx < Length; ++idx)
+    {
+        for (unsigned long c = 0; c < 3; ++c)
+        {
+            if (lutValues[idx * 3 + c] != expected[idx]) ++numMismatches;
+        }
+    }
+    OCIO_CHECK_EQUAL(numMismatches, 0);
+
+    // The line number of an error is still reported.
+    const std::string badFooter = "        </Array>\n    </LUT1Dx>\n</ProcessList>\n";
+    std::ostringstream error;
+    error << "At line (" << (Length + 6) << ")";
+    OCIO_CHECK_THROW_WHAT(ParseString(header.str() + values.str() + badFooter),
+                          OCIO::Exception,
+                          error.str());
+}
+
+OCIO_ADD_TEST(FileFormatCTF, lut1d_read_single_line)
+{
+    // The whole file is a single line much larger than the blocks fed to the XML parser, so
+    // the blocks are delimited by the end of the tags and the array is read at once.
+    static constexpr unsigned long Length = 65536;
+
+    std::ostringstream header;
+    header << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+           << "<ProcessList compCLFversion=\"3\" id=\"single_line\">"
+           << "<Description>" << std::string(300 * 1024, 'a') << "</Description>"
+           << "<LUT1D inBitDepth=\"32f\" outBitDepth=\"32f\">"
+           << "<Array dim=\"" << Length << " 3\">";
+
+    std::ostringstream values;
+    std::vector<float> expected;
+    for (unsigned long idx = 0; idx < Length; ++idx)
+    {
+        std::ostringstream oss;
+        oss.precision(9);
+        oss << (double(idx) / double(Length - 1));
+        const std::string value = oss.str();
+
+        double val = 0.;
+        OCIO::NumberUtils::from_chars(value.data(), value.data() + value.size(), val);
+        expected.push_back(float(val));
+
+        values << value << " " << value << " " << value << " ";
+    }
+
+    const std::string footer = "</Array></LUT1D></ProcessList>";
+
+    OCIO::LocalCachedFileRcPtr cachedFile;
+    OCIO_CHECK_NO_THROW(cachedFile = ParseString(header.str() + values.str() + footer));
+    OCIO_REQUIRE_ASSERT(cachedFile);
+
+    const OCIO::ConstOpDataVec & opList = cachedFile->m_transform->getOps();
+    OCIO_REQUIRE_EQUAL(opList.size(), 1);
+    auto pLut = std::dynamic_pointer_cast<const OCIO::Lut1DOpData>(opList[0]);
+    OCIO_REQUIRE_ASSERT(pLut);
+
+    const OCIO::Array::Values & lutValues = pLut->getArray().getValues();
+    OCIO_REQUIRE_EQUAL(lutValues.size(), 3 * Length);
+
+    unsigned long numMismatches = 0;
+    for (unsigned long idx = 0; idx < Length; ++idx)
+    {
+        for (unsigned long c = 0; c < 3; ++c)
+        {
+            if (lutValues[idx * 3 + c] != expected[idx]) ++numMismatches;
+        }
+    }
+    OCIO_CHECK_EQUAL(numMismatches, 0);
+
+    OCIO_REQUIRE_EQUAL(cachedFile->m_transform->getDescriptions().size(), 1);
+    OCIO_CHECK_EQUAL(cachedFile->m_transform->getDescriptions()[0].size(), 300 * 1024);
+
+    // The line number of an error is still reported.
+    const std::string badFooter = "</Array></LUT1Dx></ProcessList>";
+    OCIO_CHECK_THROW_WHAT(ParseString(header.str() + values.str() + badFooter),
+                          OCIO::Exception,
+                          "At line (1)");
+}
+
 OCIO_ADD_TEST(FileFormatCTF, invlut1d_clf)
 {
     const std::string clf{ R"(<?xml version="1.0" encoding="UTF-8"?>
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cstring>
+#include <sstream>
+
+#include "fileformats/TextLutScanner.cpp"
+
+#include "ParseUtils.h"
+#include "testutils/UnitTest.h"
+#include "utils/NumberUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+bool ParseFloatStr(const std::string & str, float & value)
+{
+    return OCIO::ParseFloat(str.data(), str.data() + str.size(), value);
+}
+
+bool ParseIntStr(const std::string & str, int & value)
+{
+    return OCIO::ParseInt(str.data(), str.data() + str.size(), value);
+}
+
+bool SameBits(float a, float b)
+{
+    return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(TextLutScanner, parse_float)
+{
+    const char * values[] = {
+        "0", "-0", "+0", "0.0", "1", "-1", "1.", ".5", "-.5", "0.5", "1023", "65535",
+        "0.123456", "0.1234567", "0.000001", "0.0000001", "1e-5", "1E+5", "2.5e-3",
+        "-3.75e2", "1e10", "1e-10", "0.100000", "100.000", "16777215", "16777216",
+        "16777217", "123456789", "0.999999999", "1e11", "1e-11", "3.4028235e38",
+        "1.17549435e-38", "0.333333333333333333", "00012.5000"
+    };
+
+    for (const char * str : values)
+    {
+        float expected = 0.0f;
+        const auto res = OCIO::NumberUtils::from_chars(str, str + strlen(str), expected);
+        OCIO_REQUIRE_ASSERT(res.ec == std::errc());
+
+        float value = -1.0f;
+        OCIO_CHECK_ASSERT(ParseFloatStr(str, value));
+        OCIO_CHECK_ASSERT(SameBits(value, expected));
+    }
+
+    // Results must be identical to the slow path on the usual LUT values.
+    for (int i = 0; i <= 100000; ++i)
+    {
+        std::ostringstream oss;
+        oss.precision(6);
+        oss << std::fixed << (i / 100000.0);
+        const std::string str = oss.str();
+
+        float expected = 0.0f;
+        OCIO::NumberUtils::from_chars(str.data(), str.data() + str.size(), expected);
+
+        float value = -1.0f;
+        OCIO_CHECK_ASSERT(ParseFloatStr(str, value));
+        OCIO_CHECK_ASSERT(SameBits(value, expected));
+    }
+
+    float value = 0.0f;
+    OCIO_CHECK_ASSERT(!ParseFloatStr("", value));
+    OCIO_CHECK_ASSERT(!ParseFloatStr("abc", value));
+    OCIO_CHECK_ASSERT(!ParseFloatStr("-", value));
+    OCIO_CHECK_ASSERT(!ParseFloatStr(".", value));
+    OCIO_CHECK_ASSERT(!ParseFloatStr(std::string(80, '1'), value));
+
+    // As from_chars(), the characters following a number are ignored.
+    OCIO_CHECK_ASSERT(ParseFloatStr("1.5x", value));
+    OCIO_CHECK_EQUAL(value, 1.5f);
+    OCIO_CHECK_ASSERT(ParseFloatStr("2e", value));
+    OCIO_CHECK_EQUAL(value, 2.0f);
+}
+
+OCIO_ADD_TEST(TextLutScanner, parse_int)
+{
+    int value = 0;
+    OCIO_CHECK_ASSERT(ParseIntStr("0", value));
+    OCIO_CHECK_EQUAL(value, 0);
+    OCIO_CHECK_ASSERT(ParseIntStr("1023", value));
+    OCIO_CHECK_EQUAL(value, 1023);
+    OCIO_CHECK_ASSERT(ParseIntStr("-17", value));
+    OCIO_CHECK_EQUAL(value, -17);
+    OCIO_CHECK_ASSERT(ParseIntStr("+4", value));
+    OCIO_CHECK_EQUAL(value, 4);
+    OCIO_CHECK_ASSERT(ParseIntStr("2147483647", value));
+    OCIO_CHECK_EQUAL(value, 2147483647);
+    OCIO_CHECK_ASSERT(ParseIntStr("-2147483648", value));
+    OCIO_CHECK_EQUAL(value, -2147483647 - 1);
+
+    value = 5;
+    OCIO_CHECK_ASSERT(!ParseIntStr("", value));
+    OCIO_CHECK_ASSERT(!ParseIntStr("-", value));
+    OCIO_CHECK_ASSERT(!ParseIntStr("1.0", value));
+    OCIO_CHECK_ASSERT(!ParseIntStr("12a", value));
+    OCIO_CHECK_ASSERT(!ParseIntStr("2147483648", value));
+    OCIO_CHECK_ASSERT(!ParseIntStr("99999999999999999999", value));
+    OCIO_CHECK_EQUAL(value, 5);
+}
+
+OCIO_ADD_TEST(TextLutScanner, parse_values)
+{
+    const std::string line = " 0.5\t1  -2e-1 ";
+    const char * begin = line.data();
+    const char * end   = line.data() + line.size();
+
+    OCIO_CHECK_EQUAL(OCIO::CountTokens(begin, end), 3);
+
+    float rgb[3];
+    OCIO_CHECK_ASSERT(OCIO::ParseFloats(begin, end, rgb, 3));
+    OCIO_CHECK_EQUAL(rgb[0], 0.5f);
+    OCIO_CHECK_EQUAL(rgb[1], 1.0f);
+    OCIO_CHECK_EQUAL(rgb[2], -0.2f);
+
+    // Not exactly the number of values.
+    float rg[2];
+    OCIO_CHECK_ASSERT(!OCIO::ParseFloats(begin, end, rg, 2));
+    float rgba[4];
+    OCIO_CHECK_ASSERT(!OCIO::ParseFloats(begin, end, rgba, 4));
+
+    const std::string bad = "0.5 a 1";
+    OCIO_CHECK_ASSERT(!OCIO::ParseFloats(bad.data(), bad.data() + bad.size(), rgb, 3));
+
+    std::vector<int> ints;
+    const std::string intLine = "0 64 128  1023";
+    OCIO_CHECK_ASSERT(OCIO::ParseInts(intLine.data(), intLine.data() + intLine.size(), ints));
+    OCIO_REQUIRE_EQUAL(ints.size(), 4);
+    OCIO_CHECK_EQUAL(ints[0], 0);
+    OCIO_CHECK_EQUAL(ints[3], 1023);
+
+    const std::string floatLine = "0 64 128.5";
+    OCIO_CHECK_ASSERT(!OCIO::ParseInts(floatLine.data(), floatLine.data() + floatLine.size(),
+                                       ints));
+
+    OCIO_CHECK_EQUAL(OCIO::CountTokens(begin, begin), 0);
+}
+
+OCIO_ADD_TEST(TextLutScanner, scan_lines)
+{
+    const std::string content = "# comment\r\n\n  \t \n0 0.5 1\r\n   2 3 4   \n\n5 6";
+
+    auto checkLines = [](std::istream & istream)
+    {
+        OCIO::TextLutScanner scanner(istream);
+
+        OCIO_REQUIRE_ASSERT(scanner.nextLine());
+        OCIO_CHECK_ASSERT(scanner.lineStartsWith('#'));
+        OCIO_CHECK_EQUAL(scanner.getLine(), "# comment");
+        OCIO_CHECK_EQUAL(scanner.getLineNumber(), 1);
+
+        OCIO_REQUIRE_ASSERT(scanner.nextLine());
+        OCIO_CHECK_EQUAL(std::string(scanner.lineBegin(), scanner.lineEnd()), "0 0.5 1");
+        OCIO_CHECK_EQUAL(scanner.getLineNumber(), 4);
+
+        OCIO_REQUIRE_ASSERT(scanner.nextLine());
+        OCIO_CHECK_EQUAL(std::string(scanner.lineBegin(), scanner.lineEnd()), "2 3 4");
+        OCIO_CHECK_EQUAL(scanner.getLine(), "   2 3 4   ");
+        OCIO_CHECK_EQUAL(scanner.getLineNumber(), 5);
+
+        OCIO_REQUIRE_ASSERT(scanner.nextLine());
+        OCIO_CHECK_ASSERT(!scanner.lineStartsWith('#'));
+        float rgb[3];
+        OCIO_CHECK_ASSERT(!OCIO::ParseFloats(scanner.lineBegin(), scanner.lineEnd(), rgb, 3));
+        OCIO_CHECK_EQUAL(OCIO::CountTokens(scanner.lineBegin(), scanner.lineEnd()), 2);
+        OCIO_CHECK_EQUAL(scanner.getLineNumber(), 7);
+
+        OCIO_CHECK_ASSERT(!scanner.nextLine());
+        OCIO_CHECK_EQUAL(scanner.getLine(), "");
+        OCIO_CHECK_ASSERT(!scanner.nextLine());
+    };
+
+    // Scanned in place.
+    {
+        OCIO::MemoryIStream istream(content.data(), content.size());
+        checkLines(istream);
+    }
+
+    // Copied from any other stream.
+    {
+        std::istringstream istream(content);
+        checkLines(istream);
+    }
+
+    // The scan starts at the current position of the stream.
+    {
+        const std::string withHeader = "LUT_3D_SIZE 2\n" + content;
+        OCIO::MemoryIStream istream(withHeader.data(), withHeader.size());
+
+        std::string header;
+        std::getline(istream, header);
+        OCIO_CHECK_EQUAL(header, "LUT_3D_SIZE 2");
+
+        checkLines(istream);
+    }
+}
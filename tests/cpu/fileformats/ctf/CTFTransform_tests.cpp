@@ -209,3 +209,182 @@ OCIO_ADD_TEST(CTFReaderTransform, accessors)
         OCIO_CHECK_EQUAL(ct.getDescriptions()[1], "Two");
     }
 }
+
+namespace
+{
+
+// The stream based implementation the fast formatting must be identical to.
+template<typename T>
+std::string WriteValuesWithStream(const std::vector<T> & values,
+                                  unsigned valuesPerLine,
+                                  std::streamsize width,
+                                  std::streamsize precision,
+                                  bool floatValues)
+{
+    std::ostringstream xml;
+    std::ostringstream oss;
+    oss.width(width);
+    oss.precision(precision);
+
+    for (size_t idx = 0; idx < values.size(); ++idx)
+    {
+        oss.str("");
+        if (floatValues)
+        {
+            OCIO::WriteValue(values[idx], oss);
+        }
+        else
+        {
+            oss << values[idx];
+        }
+
+        const std::string value = oss.str();
+        if (value.length() > (size_t)oss.width())
+        {
+            oss.width(value.length());
+        }
+
+        xml << value << (idx % valuesPerLine == valuesPerLine - 1 ? "\n" : " ");
+    }
+
+    return xml.str();
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CTFTransform, format_double)
+{
+    std::vector<double> values = {
+        0., -0., 1., -1., 0.5, 0.1, 0.3f, 1023., 4095., 65535., 1e-4, 1e-5, 0.00012345,
+        9.9999999, 99999995., 999999.5, 0.99999999999999, 123456789., 1e15, 1e21, 1e-20,
+        3.4028235e38, 1.17549435e-38, 0.7071067811865476, 81.9, 2.5, 3.5, 0.125 };
+
+    // Pseudo random values over a large range of magnitudes.
+    uint32_t seed = 1;
+    for (int idx = 0; idx < 200000; ++idx)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const double mantissa = double(seed >> 8) / double(1u << 24);
+        const int exponent = int(seed % 24) - 12;
+        const double value = mantissa * std::pow(10., exponent);
+        values.push_back(idx % 2 ? value : double(float(-value)));
+    }
+
+    for (unsigned precision : { 5u, 6u, 8u, 15u })
+    {
+        size_t numFallbacks = 0;
+        for (double value : values)
+        {
+            std::ostringstream oss;
+            oss.precision(precision);
+            oss << value;
+
+            char buffer[64];
+            const unsigned length = OCIO::FormatDouble(value, precision, buffer);
+            if (length == 0)
+            {
+                ++numFallbacks;
+            }
+            else
+            {
+                OCIO_CHECK_EQUAL(std::string(buffer, length), oss.str());
+            }
+        }
+
+        // The stream is rarely needed for the precisions of the LUT values (the double
+        // precision is only used by the few parameters of the matrices and ranges).
+        if (precision <= 8)
+        {
+            OCIO_CHECK_LT(numFallbacks, values.size() / 100);
+        }
+    }
+
+    char buffer[64];
+    OCIO_CHECK_EQUAL(OCIO::FormatDouble(std::numeric_limits<double>::quiet_NaN(), 8, buffer), 0);
+    OCIO_CHECK_EQUAL(OCIO::FormatDouble(std::numeric_limits<double>::infinity(), 8, buffer), 0);
+    OCIO_CHECK_EQUAL(OCIO::FormatDouble(1e-30, 8, buffer), 0);
+    OCIO_CHECK_EQUAL(OCIO::FormatDouble(0.5, 17, buffer), 0);
+}
+
+OCIO_ADD_TEST(CTFTransform, write_values)
+{
+    // The output must be identical to the stream based implementation, including the
+    // alignment of the values.
+    const std::vector<float> values = {
+        0.f, 0.25f, 1.f, -0.5f, 1e-6f, 123456.789f, 0.1f, -0.f, 3.f,
+        std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(),
+        -std::numeric_limits<float>::infinity(), 0.333333343f, 1e10f, 1.5f, 0.f, 1.f, 2.f };
+
+    {
+        std::ostringstream oss;
+        OCIO::XmlFormatter formatter(oss);
+        OCIO::WriteValues(formatter, values.begin(), values.end(), 3, OCIO::BIT_DEPTH_F32, 1, 1.0f);
+        OCIO_CHECK_EQUAL(oss.str(), WriteValuesWithStream(values, 3, 11, 8, true));
+    }
+
+    {
+        std::ostringstream oss;
+        OCIO::XmlFormatter formatter(oss);
+        OCIO::WriteValues(formatter, values.begin(), values.end(), 3, OCIO::BIT_DEPTH_F16, 1, 1.0f);
+        OCIO_CHECK_EQUAL(oss.str(), WriteValuesWithStream(values, 3, 11, 5, true));
+    }
+
+    {
+        std::vector<float> scaled;
+        for (float value : values)
+        {
+            scaled.push_back(value * 1023.0f);
+        }
+
+        std::ostringstream oss;
+        OCIO::XmlFormatter formatter(oss);
+        OCIO::WriteValues(formatter, values.begin(), values.end(), 3, OCIO::BIT_DEPTH_UINT10, 1, 1023.0f);
+        OCIO_CHECK_EQUAL(oss.str(), WriteValuesWithStream(scaled, 3, 4, 6, false));
+    }
+
+    {
+        const std::vector<double> matrix = { 1., 0.1, -0.2, 1e-20, 0.7071067811865476, 81.9,
+                                             0., 0., 1. };
+
+        std::ostringstream oss;
+        OCIO::XmlFormatter formatter(oss);
+        OCIO::WriteValues(formatter, matrix.begin(), matrix.end(), 3, OCIO::BIT_DEPTH_F32, 1, 1.0);
+        OCIO_CHECK_EQUAL(oss.str(), WriteValuesWithStream(matrix, 3, 19, 15, true));
+    }
+}
+
+namespace
+{
+
+// A locale using a comma as the decimal point.
+class CommaNumPunct : public std::numpunct<char>
+{
+protected:
+    char do_decimal_point() const override { return ','; }
+};
+
+} // anon.
+
+OCIO_ADD_TEST(CTFTransform, write_values_global_locale)
+{
+    // As with the stream based implementation, the values follow the global locale.
+
+    const std::vector<float> values = { 0.f, 0.25f, 1.f, -0.5f, 1e-6f, 123456.789f };
+
+    const std::locale previous
+        = std::locale::global(std::locale(std::locale::classic(), new CommaNumPunct));
+
+    std::string written, expected;
+    {
+        std::ostringstream oss;
+        OCIO::XmlFormatter formatter(oss);
+        OCIO::WriteValues(formatter, values.begin(), values.end(), 3, OCIO::BIT_DEPTH_F32, 1, 1.0f);
+        written = oss.str();
+        expected = WriteValuesWithStream(values, 3, 11, 8, true);
+    }
+
+    std::locale::global(previous);
+
+    OCIO_CHECK_EQUAL(written, expected);
+    OCIO_CHECK_NE(written.find("0,25"), std::string::npos);
+}
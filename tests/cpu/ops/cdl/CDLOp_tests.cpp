@@ -608,6 +608,51 @@ OCIO_ADD_TEST(CDLOp, apply_noclamp_fwd_3)
 #endif
 }
 
+OCIO_ADD_TEST(CDLOp, apply_wide_vector)
+{
+    // The renderers use the AVX2 or AVX-512 kernels when the CPU supports them so compare them
+    // with the SSE2 renderers. The number of pixels is not a multiple of the vector sizes to
+    // also validate the remaining pixels processing.
+
+    constexpr long numPixels = 37;
+
+    std::vector<float> input(numPixels * 4);
+    for (size_t idx = 0; idx < input.size(); ++idx)
+    {
+        input[idx] = -0.5f + 2.0f * float(idx) / float(input.size());
+    }
+
+    for (const auto style : { OCIO::CDLOpData::CDL_V1_2_FWD,
+                              OCIO::CDLOpData::CDL_V1_2_REV,
+                              OCIO::CDLOpData::CDL_NO_CLAMP_FWD,
+                              OCIO::CDLOpData::CDL_NO_CLAMP_REV })
+    {
+        OCIO::CDLOpDataRcPtr data
+            = std::make_shared<OCIO::CDLOpData>(style,
+                                                OCIO::CDLOpData::ChannelParams(CDL_DATA_1::slope[0],
+                                                                               CDL_DATA_1::slope[1],
+                                                                               CDL_DATA_1::slope[2]),
+                                                OCIO::CDLOpData::ChannelParams(CDL_DATA_1::offset[0],
+                                                                               CDL_DATA_1::offset[1],
+                                                                               CDL_DATA_1::offset[2]),
+                                                OCIO::CDLOpData::ChannelParams(CDL_DATA_1::power[0],
+                                                                               CDL_DATA_1::power[1],
+                                                                               CDL_DATA_1::power[2]),
+                                                CDL_DATA_1::saturation);
+        OCIO::CDLOp cdlOp(data);
+        OCIO_CHECK_NO_THROW(cdlOp.validate());
+
+        OCIO::ConstOpCPURcPtr reference;
+        {
+            OCIO::WideVectorGuard guard;
+            reference = cdlOp.getCPUOp(true);
+        }
+
+        OCIO::ConstOpCPURcPtr renderer = cdlOp.getCPUOp(true);
+        OCIO_CHECK_ASSERT(OCIO::CheckWideRenderer(renderer, reference, input, 1e-7f));
+    }
+}
+
 OCIO_ADD_TEST(CDLOp, create_transform)
 {
     const OCIO::CDLOpData::ChannelParams sp(CDL_DATA_1::slope[0],
@@ -5,6 +5,7 @@
 #include "ops/exposurecontrast/ExposureContrastOpCPU.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -430,3 +431,46 @@ OCIO_ADD_TEST(ExposureContrastRenderer, log_params)
     TestLogParamForStyle(OCIO::ExposureContrastOpData::STYLE_LOGARITHMIC_REV, true);
 }
 
+OCIO_ADD_TEST(ExposureContrastRenderer, wide_vector)
+{
+    // The renderers use the AVX2 or AVX-512 kernels when the CPU supports them so compare them
+    // with the SSE2 renderers. The number of pixels is not a multiple of the vector sizes to
+    // also validate the remaining pixels processing.
+
+    constexpr long numPixels = 37;
+
+    std::vector<float> input(numPixels * 4);
+    for (size_t idx = 0; idx < input.size(); ++idx)
+    {
+        input[idx] = -0.5f + 2.0f * float(idx) / float(input.size());
+    }
+
+    for (const auto style : { OCIO::ExposureContrastOpData::STYLE_VIDEO,
+                              OCIO::ExposureContrastOpData::STYLE_VIDEO_REV,
+                              OCIO::ExposureContrastOpData::STYLE_LINEAR,
+                              OCIO::ExposureContrastOpData::STYLE_LINEAR_REV,
+                              OCIO::ExposureContrastOpData::STYLE_LOGARITHMIC,
+                              OCIO::ExposureContrastOpData::STYLE_LOGARITHMIC_REV })
+    {
+        // A contrast of 1 only scales the pixels.
+        for (const double contrast : { 1.0, 1.3 })
+        {
+            OCIO::ExposureContrastOpDataRcPtr ec
+                = std::make_shared<OCIO::ExposureContrastOpData>(style);
+            ec->setExposure(0.8);
+            ec->setContrast(contrast);
+            ec->setPivot(0.3);
+
+            OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
+
+            OCIO::ConstOpCPURcPtr reference;
+            {
+                OCIO::WideVectorGuard guard;
+                reference = OCIO::GetExposureContrastCPURenderer(const_ec);
+            }
+
+            OCIO::ConstOpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+            OCIO_CHECK_ASSERT(OCIO::CheckWideRenderer(renderer, reference, input, 1e-7f));
+        }
+    }
+}
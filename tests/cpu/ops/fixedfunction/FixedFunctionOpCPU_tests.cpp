@@ -21,11 +21,14 @@ void ApplyFixedFunction(float * input_32f,
                         OCIO::ConstFixedFunctionOpDataRcPtr & fnData, 
                         float errorThreshold,
                         int lineNo,
-                        bool fastLogExpPow = false
+                        bool fastLogExpPow = false,
+                        bool fastOutputTransform = false
 )
 {
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW_FROM(op = OCIO::GetFixedFunctionCPURenderer(fnData, fastLogExpPow), lineNo);
+    OCIO_CHECK_NO_THROW_FROM(op = OCIO::GetFixedFunctionCPURenderer(fnData,
+                                                                    fastLogExpPow,
+                                                                    fastOutputTransform), lineNo);
     OCIO_CHECK_NO_THROW_FROM(op->apply(input_32f, input_32f, numSamples), lineNo);
 
     for(unsigned idx=0; idx<(numSamples*4); ++idx)
@@ -662,6 +665,54 @@ OCIO_ADD_TEST(FixedFunctionOpCPU, aces_ot_20_p3d65_1000n_rt)
                        __LINE__);
 }
 
+OCIO_ADD_TEST(FixedFunctionOpCPU, aces_ot_20_fast_power)
+{
+    // Compare the four pixels at once version of the forward direction (used with the fast
+    // power approximation, refer to OPTIMIZATION_FAST_ACES_OUTPUT_TRANSFORM_20) against the
+    // reference per pixel version. The number of samples
+    // is not a multiple of four to also process the remaining pixels.
+    const int lut_size = 9;
+    const int num_channels = 4;
+    const int num_samples = lut_size * lut_size * lut_size + 2;
+    std::vector<float> input_32f(num_samples * num_channels, 0.f);
+    std::vector<float> expected_32f(num_samples * num_channels, 0.f);
+
+    GenerateIdentityLut3D(input_32f.data(), lut_size, num_channels, OCIO::LUT3DORDER_FAST_RED);
+
+    for (int i = 0; i < lut_size * lut_size * lut_size * num_channels; ++i)
+    {
+        // Cover a wide range of scene linear values, keeping zero.
+        input_32f[i] = (i % num_channels == 3) ? 0.5f : 20.f * input_32f[i] * input_32f[i];
+    }
+
+    // Add an out of gamut pixel and a black pixel.
+    const float extra[8] = { -0.1f, 0.2f, 0.3f, 1.f,
+                              0.0f, 0.0f, 0.0f, 1.f };
+    std::memcpy(&input_32f[lut_size * lut_size * lut_size * num_channels], extra, sizeof(extra));
+
+    OCIO::FixedFunctionOpData::Params params = {
+        // Peak luminance
+        1000.f,
+        // P3D65 gamut
+        0.680, 0.320, 0.265, 0.690, 0.150, 0.060, 0.3127, 0.3290
+    };
+
+    OCIO::ConstFixedFunctionOpDataRcPtr funcData
+        = std::make_shared<OCIO::FixedFunctionOpData>(OCIO::FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD,
+                                                      params);
+
+    OCIO::ConstOpCPURcPtr op;
+    OCIO_CHECK_NO_THROW(op = OCIO::GetFixedFunctionCPURenderer(funcData, false, false));
+    OCIO_CHECK_NO_THROW(op->apply(&input_32f[0], &expected_32f[0], num_samples));
+
+    ApplyFixedFunction(&input_32f[0], &expected_32f[0], num_samples,
+                       funcData,
+                       1e-3f,
+                       __LINE__,
+                       true,
+                       true);
+}
+
 OCIO_ADD_TEST(FixedFunctionOpCPU, aces_rgb_to_jmh_20)
 {
     const unsigned num_samples = 27;
@@ -760,3 +760,65 @@ OCIO_ADD_TEST(GammaOpCPU, apply_moncurve_mirror_style_rev)
     ApplyGamma(ops[0], input_32f, expected_32f, numPixels, __LINE__, errorThreshold);
 }
 
+
+OCIO_ADD_TEST(GammaOpCPU, wide_vector)
+{
+    // The renderers use the AVX2 or AVX-512 kernels when the CPU supports them so compare them
+    // with the SSE2 renderers. The number of pixels is not a multiple of the vector sizes to
+    // also validate the remaining pixels processing.
+
+    constexpr long numPixels = 37;
+
+    std::vector<float> input(numPixels * 4);
+    for (size_t idx = 0; idx < input.size(); ++idx)
+    {
+        input[idx] = -0.5f + 2.0f * float(idx) / float(input.size());
+    }
+    input[0] = qnan;
+    input[1] = inf;
+    input[2] = -inf;
+
+    const OCIO::GammaOpData::Style basicStyles[] = {
+        OCIO::GammaOpData::BASIC_FWD,
+        OCIO::GammaOpData::BASIC_REV,
+        OCIO::GammaOpData::BASIC_MIRROR_FWD,
+        OCIO::GammaOpData::BASIC_MIRROR_REV,
+        OCIO::GammaOpData::BASIC_PASS_THRU_FWD,
+        OCIO::GammaOpData::BASIC_PASS_THRU_REV };
+
+    const OCIO::GammaOpData::Style moncurveStyles[] = {
+        OCIO::GammaOpData::MONCURVE_FWD,
+        OCIO::GammaOpData::MONCURVE_REV,
+        OCIO::GammaOpData::MONCURVE_MIRROR_FWD,
+        OCIO::GammaOpData::MONCURVE_MIRROR_REV };
+
+    std::vector<OCIO::ConstGammaOpDataRcPtr> gammaOps;
+    for (const auto style : basicStyles)
+    {
+        gammaOps.push_back(std::make_shared<OCIO::GammaOpData>(style,
+                                                               OCIO::GammaOpData::Params{ 2.4 },
+                                                               OCIO::GammaOpData::Params{ 2.2 },
+                                                               OCIO::GammaOpData::Params{ 1.8 },
+                                                               OCIO::GammaOpData::Params{ 1.2 }));
+    }
+    for (const auto style : moncurveStyles)
+    {
+        gammaOps.push_back(std::make_shared<OCIO::GammaOpData>(style,
+                                                               OCIO::GammaOpData::Params{ 2.4, 0.1 },
+                                                               OCIO::GammaOpData::Params{ 2.2, 0.2 },
+                                                               OCIO::GammaOpData::Params{ 2.0, 0.4 },
+                                                               OCIO::GammaOpData::Params{ 1.8, 0.6 }));
+    }
+
+    for (auto & gammaData : gammaOps)
+    {
+        OCIO::ConstOpCPURcPtr reference;
+        {
+            OCIO::WideVectorGuard guard;
+            reference = OCIO::GetGammaRenderer(gammaData, true);
+        }
+
+        OCIO::ConstOpCPURcPtr renderer = OCIO::GetGammaRenderer(gammaData, true);
+        OCIO_CHECK_ASSERT(OCIO::CheckWideRenderer(renderer, reference, input, 1e-7f));
+    }
+}
@@ -5,6 +5,7 @@
 #include "ops/gradingprimary/GradingPrimaryOpCPU.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
 #include "utils/StringUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -405,3 +406,91 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, video)
     OCIO_CHECK_NO_THROW(op->apply(TS3::expected_wbpivot_32f, res, TS3::num_samples));
     ValidateImage(TS3::input_32f, res, TS3::num_samples, __LINE__);
 }
+
+OCIO_ADD_TEST(GradingPrimaryOpCPU, wide_vector)
+{
+    // The renderers use the AVX2 or AVX-512 kernels when the CPU supports them so compare them
+    // with the SSE2 renderers. The number of pixels is not a multiple of the vector sizes to
+    // also validate the remaining pixels processing.
+
+    constexpr long numPixels = 37;
+
+    std::vector<float> input(numPixels * 4);
+    for (size_t idx = 0; idx < input.size(); ++idx)
+    {
+        input[idx] = -0.5f + 2.0f * float(idx) / float(input.size());
+    }
+
+    OCIO::GradingPrimary logValues(OCIO::GRADING_LOG);
+    logValues.m_brightness = TS1::brightness;
+    logValues.m_contrast   = TS1::contrast;
+    logValues.m_gamma      = TS1::gamma;
+    logValues.m_pivot      = TS1::pivot;
+    logValues.m_saturation = TS1::saturation;
+    logValues.m_clampBlack = TS1::clampBlack;
+    logValues.m_clampWhite = TS1::clampWhite;
+    logValues.m_pivotBlack = TS1::pivotBlack;
+    logValues.m_pivotWhite = TS1::pivotWhite;
+
+    OCIO::GradingPrimary linValues(OCIO::GRADING_LIN);
+    linValues.m_exposure   = TS2::exposure;
+    linValues.m_offset     = TS2::offset;
+    linValues.m_contrast   = TS2::contrast;
+    linValues.m_pivot      = TS2::pivot;
+    linValues.m_saturation = TS2::saturation;
+    linValues.m_clampBlack = TS2::clampBlack;
+    linValues.m_clampWhite = TS2::clampWhite;
+
+    OCIO::GradingPrimary videoValues(OCIO::GRADING_VIDEO);
+    videoValues.m_lift       = TS3::lift;
+    videoValues.m_gamma      = TS3::gamma;
+    videoValues.m_gain       = TS3::gain;
+    videoValues.m_offset     = TS3::offset;
+    videoValues.m_saturation = TS3::saturation;
+    videoValues.m_clampBlack = TS3::clampBlack;
+    videoValues.m_clampWhite = TS3::clampWhite;
+    videoValues.m_pivotBlack = TS3::pivotBlack;
+    videoValues.m_pivotWhite = TS3::pivotWhite;
+
+    const std::pair<OCIO::GradingStyle, OCIO::GradingPrimary> tests[] = {
+        { OCIO::GRADING_LOG, logValues },
+        { OCIO::GRADING_LIN, linValues },
+        { OCIO::GRADING_VIDEO, videoValues } };
+
+    for (const auto & test : tests)
+    {
+        const OCIO::GradingStyle style = test.first;
+
+        // Also validate without the saturation, without the power (i.e. gamma or contrast) and
+        // the local bypass (i.e. identity values).
+        OCIO::GradingPrimary noSatValues(test.second);
+        noSatValues.m_saturation = 1.;
+
+        OCIO::GradingPrimary noPowerValues(test.second);
+        noPowerValues.m_gamma    = OCIO::GradingRGBM(1., 1., 1., 1.);
+        noPowerValues.m_contrast = OCIO::GradingRGBM(1., 1., 1., 1.);
+
+        const OCIO::GradingPrimary identityValues(style);
+
+        for (const auto dir : { OCIO::TRANSFORM_DIR_FORWARD, OCIO::TRANSFORM_DIR_INVERSE })
+        {
+            for (const auto & values : { test.second, noSatValues, noPowerValues, identityValues })
+            {
+                auto gd = std::make_shared<OCIO::GradingPrimaryOpData>(style);
+                gd->setDirection(dir);
+                gd->setValue(values);
+
+                OCIO::ConstGradingPrimaryOpDataRcPtr gdc = gd;
+
+                OCIO::ConstOpCPURcPtr reference;
+                {
+                    OCIO::WideVectorGuard guard;
+                    reference = OCIO::GetGradingPrimaryCPURenderer(gdc);
+                }
+
+                OCIO::ConstOpCPURcPtr renderer = OCIO::GetGradingPrimaryCPURenderer(gdc);
+                OCIO_CHECK_ASSERT(OCIO::CheckWideRenderer(renderer, reference, input, 1e-7f));
+            }
+        }
+    }
+}
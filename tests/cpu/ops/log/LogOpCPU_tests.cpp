@@ -620,3 +620,68 @@ OCIO_ADD_TEST(LogOpCPU, cameralog2lin_test)
     OCIO_CHECK_ASSERT(OCIO::IsNan(rgba[10]));
 }
 
+
+OCIO_ADD_TEST(LogOpCPU, wide_vector)
+{
+    // The renderers use the AVX2 or AVX-512 kernels when the CPU supports them so compare them
+    // with the SSE2 renderers. The number of pixels is not a multiple of the vector sizes to
+    // also validate the remaining pixels processing.
+
+    constexpr long numPixels = 37;
+
+    std::vector<float> input(numPixels * 4);
+    for (size_t idx = 0; idx < input.size(); ++idx)
+    {
+        input[idx] = -0.25f + 1.5f * float(idx) / float(input.size());
+    }
+
+    std::vector<OCIO::ConstLogOpDataRcPtr> logOps;
+    logOps.push_back(std::make_shared<OCIO::LogOpData>(10.0, OCIO::TRANSFORM_DIR_FORWARD));
+    logOps.push_back(std::make_shared<OCIO::LogOpData>(2.0, OCIO::TRANSFORM_DIR_INVERSE));
+
+    OCIO::LogUtil::CTFParams params;
+    for (auto channel : { OCIO::LogUtil::CTFParams::red,
+                          OCIO::LogUtil::CTFParams::green,
+                          OCIO::LogUtil::CTFParams::blue })
+    {
+        auto & param = params.get(channel);
+        param[OCIO::LogUtil::CTFParams::gamma]     = 0.6;
+        param[OCIO::LogUtil::CTFParams::refWhite]  = 685. - channel;
+        param[OCIO::LogUtil::CTFParams::refBlack]  = 95.;
+        param[OCIO::LogUtil::CTFParams::highlight] = 1.0;
+        param[OCIO::LogUtil::CTFParams::shadow]    = 0.0005;
+    }
+
+    for (auto style : { OCIO::LogUtil::LIN_TO_LOG, OCIO::LogUtil::LOG_TO_LIN })
+    {
+        params.m_style = style;
+
+        OCIO::LogOpData::Params paramsR, paramsG, paramsB;
+        double base = 1.0;
+        OCIO::LogUtil::ConvertLogParameters(params, base, paramsR, paramsG, paramsB);
+
+        logOps.push_back(std::make_shared<OCIO::LogOpData>(base, paramsR, paramsG, paramsB,
+                                                           OCIO::LogUtil::GetLogDirection(style)));
+    }
+
+    // The camera styles i.e. with a linear segment.
+    const OCIO::LogOpData::Params cameraR{ 0.2, 0.6, 1.1, 0.05, 0.1, 1.2 };
+    const OCIO::LogOpData::Params cameraG{ 0.25, 0.5, 1.2, 0.04, 0.12, 1.1 };
+    const OCIO::LogOpData::Params cameraB{ 0.3, 0.4, 1.3, 0.03, 0.14, 1.3 };
+    for (auto dir : { OCIO::TRANSFORM_DIR_FORWARD, OCIO::TRANSFORM_DIR_INVERSE })
+    {
+        logOps.push_back(std::make_shared<OCIO::LogOpData>(2.0, cameraR, cameraG, cameraB, dir));
+    }
+
+    for (auto & logOp : logOps)
+    {
+        OCIO::ConstOpCPURcPtr reference;
+        {
+            OCIO::WideVectorGuard guard;
+            reference = OCIO::GetLogRenderer(logOp, true);
+        }
+
+        OCIO::ConstOpCPURcPtr renderer = OCIO::GetLogRenderer(logOp, true);
+        OCIO_CHECK_ASSERT(OCIO::CheckWideRenderer(renderer, reference, input, 1e-7f));
+    }
+}
@@ -55,3 +55,36 @@ OCIO_ADD_TEST(Lut3DRenderer, nan_tetra_test)
     Lut3DRendererNaNTest(OCIO::INTERP_TETRAHEDRAL);
 }
 
+OCIO_ADD_TEST(Lut3DRenderer, shared_opt_lut)
+{
+    // Identical LUTs share the same optimized LUT, whatever the interpolation.
+    OCIO::Lut3DOpDataRcPtr lut1 = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_LINEAR, 17);
+    OCIO::Lut3DOpDataRcPtr lut2 = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, 17);
+    lut1->getArray()[10] = 0.5f;
+    lut2->getArray()[10] = 0.5f;
+    OCIO_CHECK_ASSERT(!lut1->getArray().sharesValues(lut2->getArray()));
+
+    OCIO::ConstLut3DOpDataRcPtr constLut1 = lut1;
+    OCIO::ConstLut3DOpDataRcPtr constLut2 = lut2;
+
+    OCIO::OptLutRcPtr optLut1 = OCIO::GetOptLut(constLut1, 4);
+    OCIO::OptLutRcPtr optLut2 = OCIO::GetOptLut(constLut2, 4);
+    OCIO_CHECK_EQUAL(optLut1.get(), optLut2.get());
+
+    // Another LUT has its own optimized LUT.
+    lut2->getArray()[10] = 0.25f;
+    OCIO::OptLutRcPtr optLut4 = OCIO::GetOptLut(constLut2, 4);
+    OCIO_CHECK_NE(optLut1.get(), optLut4.get());
+    OCIO_CHECK_EQUAL(optLut1.get()[4 * 3 + 1], 0.5f);
+    OCIO_CHECK_EQUAL(optLut4.get()[4 * 3 + 1], 0.25f);
+
+    // The renderers are not affected by the shared optimized LUTs.
+    OCIO::ConstOpCPURcPtr renderer1 = OCIO::GetLut3DRenderer(constLut1);
+    OCIO::ConstOpCPURcPtr renderer2 = OCIO::GetLut3DRenderer(constLut2);
+
+    float pixel1[4] = { 0.f, 0.f, 3.f / 16.f, 1.f };
+    float pixel2[4] = { 0.f, 0.f, 3.f / 16.f, 1.f };
+    renderer1->apply(pixel1, pixel1, 1);
+    renderer2->apply(pixel2, pixel2, 1);
+    OCIO_CHECK_NE(pixel1[1], pixel2[1]);
+}
@@ -4,6 +4,8 @@
 
 #include "ops/lut3d/Lut3DOpData.cpp"
 
+#include "ops/lut3d/Lut3DOpCPU.h"
+
 #include "testutils/UnitTest.h"
 #include "UnitTestUtils.h"
 
@@ -63,6 +65,45 @@ OCIO_ADD_TEST(Lut3DOpData, clone)
     OCIO_CHECK_ASSERT(!pClone->isIdentity());
     OCIO_CHECK_NO_THROW(pClone->validate());
     OCIO_CHECK_ASSERT(pClone->getArray()==ref.getArray());
+
+    // The clone shares the values until one of them is modified.
+    OCIO_CHECK_ASSERT(pClone->getArray().sharesValues(ref.getArray()));
+    OCIO_CHECK_ASSERT(pClone->inverse()->getArray().sharesValues(ref.getArray()));
+
+    pClone->getArray()[1] = 0.2f;
+    OCIO_CHECK_ASSERT(!pClone->getArray().sharesValues(ref.getArray()));
+    OCIO_CHECK_EQUAL(ref.getArray()[1], 0.1f);
+    OCIO_CHECK_EQUAL(pClone->getArray()[1], 0.2f);
+    OCIO_CHECK_ASSERT(!(pClone->getArray() == ref.getArray()));
+}
+
+OCIO_ADD_TEST(Lut3DOpData, cache_id)
+{
+    OCIO::Lut3DOpData ref(33);
+    const std::string refCacheID = ref.getCacheID();
+    OCIO_CHECK_ASSERT(!refCacheID.empty());
+    OCIO_CHECK_EQUAL(ref.getCacheID(), refCacheID);
+
+    // Modifying the values invalidates the hash of the values.
+    ref.getArray()[1] = 0.1f;
+    const std::string modifiedCacheID = ref.getCacheID();
+    OCIO_CHECK_NE(modifiedCacheID, refCacheID);
+
+    OCIO::Lut3DOpDataRcPtr pClone = ref.clone();
+    OCIO_CHECK_EQUAL(pClone->getCacheID(), modifiedCacheID);
+
+    pClone->getArray().getValues()[1] = 0.f;
+    OCIO_CHECK_EQUAL(pClone->getCacheID(), refCacheID);
+    OCIO_CHECK_EQUAL(ref.getCacheID(), modifiedCacheID);
+
+    pClone->getArray().setDoubleValue(1, 0.1);
+    OCIO_CHECK_EQUAL(pClone->getCacheID(), modifiedCacheID);
+
+    pClone->scale(2.f);
+    OCIO_CHECK_NE(pClone->getCacheID(), modifiedCacheID);
+
+    pClone->getArray().resize(17, 3);
+    OCIO_CHECK_NE(pClone->getCacheID(), modifiedCacheID);
 }
 
 OCIO_ADD_TEST(Lut3DOpData, not_supported_length)
@@ -310,6 +351,62 @@ OCIO_ADD_TEST(Lut3DOpData, inv_lut3d_lut_size)
     OCIO_CHECK_EQUAL(invFastLutData->getFileOutputBitDepth(), OCIO::BIT_DEPTH_UINT12);
 
     OCIO_CHECK_EQUAL(invFastLutData->getArray().getLength(), 48);
+
+    // The high resolution grid is never smaller than the default one.
+    invFastLutData = MakeFastLut3DFromInverse(invLutData, true);
+    OCIO_CHECK_EQUAL(invFastLutData->getArray().getLength(), 48);
+}
+
+OCIO_ADD_TEST(Lut3DOpData, inv_lut3d_high_res)
+{
+    // Square the values of a 33 entries LUT, so that the inverse (i.e. square root) is strongly
+    // non-linear in between the forward LUT entries.
+    OCIO::Lut3DOpDataRcPtr fwdLutData = std::make_shared<OCIO::Lut3DOpData>(33);
+    fwdLutData->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+    for (auto & val : fwdLutData->getArray().getValues())
+    {
+        val *= val;
+    }
+
+    OCIO::ConstLut3DOpDataRcPtr invLutData = fwdLutData->inverse();
+
+    OCIO::Lut3DOpDataRcPtr invFastLutData = MakeFastLut3DFromInverse(invLutData);
+    OCIO_CHECK_EQUAL(invFastLutData->getArray().getLength(), 48);
+
+    OCIO::Lut3DOpDataRcPtr invHighResLutData = MakeFastLut3DFromInverse(invLutData, true);
+    OCIO_CHECK_EQUAL(invHighResLutData->getArray().getLength(), 65);
+    OCIO_CHECK_EQUAL(invHighResLutData->getDirection(), OCIO::TRANSFORM_DIR_FORWARD);
+
+    // Compare both approximations to the exact inverse.
+    constexpr long numPixels = 1000;
+    std::vector<float> inImg(numPixels * 4);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        inImg[4 * idx + 0] = float(idx % 10) / 9.f;
+        inImg[4 * idx + 1] = float((idx / 10) % 10) / 9.f * 0.1f;
+        inImg[4 * idx + 2] = float(idx / 100) / 9.f * 0.01f;
+        inImg[4 * idx + 3] = 1.f;
+    }
+
+    OCIO::ConstLut3DOpDataRcPtr constInvFastLutData = invFastLutData;
+    OCIO::ConstLut3DOpDataRcPtr constInvHighResLutData = invHighResLutData;
+
+    std::vector<float> exactImg(inImg), fastImg(inImg), highResImg(inImg);
+    OCIO::GetLut3DRenderer(invLutData)->apply(inImg.data(), exactImg.data(), numPixels);
+    OCIO::GetLut3DRenderer(constInvFastLutData)->apply(inImg.data(), fastImg.data(), numPixels);
+    OCIO::GetLut3DRenderer(constInvHighResLutData)->apply(inImg.data(), highResImg.data(),
+                                                          numPixels);
+
+    float fastError = 0.f;
+    float highResError = 0.f;
+    for (size_t idx = 0; idx < inImg.size(); ++idx)
+    {
+        fastError += std::abs(fastImg[idx] - exactImg[idx]);
+        highResError += std::abs(highResImg[idx] - exactImg[idx]);
+    }
+
+    // The total error is reduced by more than 20%.
+    OCIO_CHECK_ASSERT(highResError < fastError * 0.8f);
 }
 
 OCIO_ADD_TEST(Lut3DOpData, compose_inverse_luts)
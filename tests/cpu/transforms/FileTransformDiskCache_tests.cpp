@@ -0,0 +1,283 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <fstream>
+
+#include "transforms/FileTransformDiskCache.cpp"
+
+#include "OpBuilders.h"
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+OCIO::OpRcPtrVec BuildFileOps(const OCIO::ConstConfigRcPtr & config,
+                              const std::string & fileName,
+                              OCIO::TransformDirection dir)
+{
+    OCIO::FileTransformRcPtr fileTransform = OCIO::FileTransform::Create();
+    fileTransform->setSrc(fileName.c_str());
+
+    OCIO::OpRcPtrVec ops;
+    OCIO::BuildFileTransformOps(ops, *config, config->getCurrentContext(), *fileTransform, dir);
+    return ops;
+}
+
+OCIO::ConstConfigRcPtr CreateTestConfig()
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setSearchPath(OCIO::GetTestFilesDir().c_str());
+    return config;
+}
+
+void CheckEqualOps(const OCIO::OpRcPtrVec & ops1, const OCIO::OpRcPtrVec & ops2, unsigned line)
+{
+    OCIO_REQUIRE_EQUAL_FROM(ops1.size(), ops2.size(), line);
+    OCIO_CHECK_ASSERT_FROM(ops1.getFormatMetadata() == ops2.getFormatMetadata(), line);
+
+    for (size_t idx = 0; idx < ops1.size(); ++idx)
+    {
+        OCIO::ConstOpRcPtr op1 = ops1[idx];
+        OCIO::ConstOpRcPtr op2 = ops2[idx];
+        OCIO_CHECK_EQUAL_FROM(op1->getCacheID(), op2->getCacheID(), line);
+        OCIO_CHECK_ASSERT_FROM(op1->data()->equals(*op2->data()), line);
+        OCIO_CHECK_ASSERT_FROM(op1->data()->getFormatMetadata() == op2->data()->getFormatMetadata(),
+                               line);
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(FileTransformDiskCache, serialize_ops)
+{
+    OCIO::ConstConfigRcPtr config = CreateTestConfig();
+
+    for (const auto & fileName : { "clf/lut1d_half_domain_raw_half_set.clf",
+                                   "clf/lut3d_17x17x17_10i_12i.clf",
+                                   "clf/matrix_3x4_example.clf",
+                                   "clf/range.clf",
+                                   "lut1d_1.spi1d",
+                                   "iridas_3d.cube" })
+    {
+        for (const auto dir : { OCIO::TRANSFORM_DIR_FORWARD, OCIO::TRANSFORM_DIR_INVERSE })
+        {
+            const OCIO::OpRcPtrVec ops = BuildFileOps(config, fileName, dir);
+
+            // The first op is the file no-op which is not persisted.
+            OCIO_REQUIRE_ASSERT(ops.size() > 1);
+
+            std::ostringstream oss;
+            OCIO_REQUIRE_ASSERT(OCIO::SerializeFileTransformOps(oss, "key", ops, 1,
+                                                                OCIO::FormatMetadataImpl()));
+
+            const std::string entry = oss.str();
+
+            OCIO::OpRcPtrVec loadedOps;
+            OCIO_CHECK_NO_THROW(OCIO::DeserializeFileTransformOps(loadedOps, "key",
+                                                                  entry.data(), entry.size()));
+
+            OCIO::OpRcPtrVec expectedOps = ops;
+            expectedOps.erase(expectedOps.begin());
+            CheckEqualOps(expectedOps, loadedOps, __LINE__);
+
+            // The entry belongs to another key.
+            OCIO::OpRcPtrVec otherOps;
+            OCIO_CHECK_THROW_WHAT(OCIO::DeserializeFileTransformOps(otherOps, "other key",
+                                                                    entry.data(), entry.size()),
+                                  OCIO::Exception,
+                                  "The file cache entry belongs to another file.");
+
+            // Truncated entries are rejected.
+            OCIO_CHECK_THROW_WHAT(OCIO::DeserializeFileTransformOps(otherOps, "key",
+                                                                    entry.data(), entry.size() / 2),
+                                  OCIO::Exception,
+                                  "Truncated entry.");
+            OCIO_CHECK_EQUAL(otherOps.size(), 0);
+        }
+    }
+
+    // Ops other than LUTs, matrices and ranges are not persisted.
+    const OCIO::OpRcPtrVec ops
+        = BuildFileOps(config, "clf/exponent_all_styles.clf", OCIO::TRANSFORM_DIR_FORWARD);
+    std::ostringstream oss;
+    OCIO_CHECK_ASSERT(!OCIO::SerializeFileTransformOps(oss, "key", ops, 1, OCIO::FormatMetadataImpl()));
+}
+
+OCIO_ADD_TEST(FileTransformDiskCache, corrupted_entries)
+{
+    // Create an entry holding a single 3D LUT header.
+    auto createEntry = [](uint32_t interpolation, uint32_t direction, uint32_t gridSize)
+    {
+        std::ostringstream oss;
+        oss.write(OCIO::CACHE_ENTRY_MAGIC, sizeof(OCIO::CACHE_ENTRY_MAGIC));
+        OCIO::WriteUInt(oss, OCIO::CACHE_ENTRY_VERSION);
+        OCIO::WriteUInt(oss, OCIO::CACHE_ENTRY_BYTE_ORDER);
+        OCIO::WriteString(oss, "key");
+        OCIO::WriteMetadata(oss, OCIO::FormatMetadataImpl());
+
+        OCIO::WriteUInt(oss, 1);
+        OCIO::WriteUInt(oss, OCIO::OpData::Lut3DType);
+        OCIO::WriteMetadata(oss, OCIO::FormatMetadataImpl());
+        OCIO::WriteUInt(oss, interpolation);
+        OCIO::WriteUInt(oss, direction);
+        OCIO::WriteUInt(oss, OCIO::BIT_DEPTH_F32);
+        OCIO::WriteUInt(oss, gridSize);
+        return oss.str();
+    };
+
+    OCIO::OpRcPtrVec ops;
+
+    const std::string badInterp = createEntry(17, OCIO::TRANSFORM_DIR_FORWARD, 2);
+    OCIO_CHECK_THROW_WHAT(OCIO::DeserializeFileTransformOps(ops, "key",
+                                                            badInterp.data(), badInterp.size()),
+                          OCIO::Exception,
+                          "Invalid enumeration value.");
+
+    const std::string badDir = createEntry(OCIO::INTERP_LINEAR, 2, 2);
+    OCIO_CHECK_THROW_WHAT(OCIO::DeserializeFileTransformOps(ops, "key",
+                                                            badDir.data(), badDir.size()),
+                          OCIO::Exception,
+                          "Invalid enumeration value.");
+
+    // The grid size is checked before computing the number of values, which would overflow.
+    const std::string badGridSize
+        = createEntry(OCIO::INTERP_LINEAR, OCIO::TRANSFORM_DIR_FORWARD, 0x80000000);
+    OCIO_CHECK_THROW_WHAT(OCIO::DeserializeFileTransformOps(ops, "key",
+                                                            badGridSize.data(), badGridSize.size()),
+                          OCIO::Exception,
+                          "Unsupported 3D LUT grid size.");
+
+    // The values are missing.
+    const std::string truncated = createEntry(OCIO::INTERP_LINEAR, OCIO::TRANSFORM_DIR_FORWARD, 2);
+    OCIO_CHECK_THROW_WHAT(OCIO::DeserializeFileTransformOps(ops, "key",
+                                                            truncated.data(), truncated.size()),
+                          OCIO::Exception,
+                          "Truncated entry.");
+
+    OCIO_CHECK_EQUAL(ops.size(), 0);
+}
+
+OCIO_ADD_TEST(FileTransformDiskCache, key_follows_the_content)
+{
+    const std::string tmpDir = OCIO::CreateTemporaryDirectory("FileTransformDiskCacheKey");
+    const std::string filePath = pystring::os::path::join(tmpDir, "lut.spi1d");
+
+    OCIO::ConstConfigRcPtr config = CreateTestConfig();
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+    OCIO::FileTransformRcPtr fileTransform = OCIO::FileTransform::Create();
+
+    auto writeFile = [&filePath](const char * content)
+    {
+        std::ofstream file(filePath, std::ios_base::out | std::ios_base::binary);
+        file << content;
+    };
+
+    writeFile("0.25");
+    const std::string key1 = OCIO::CreateFileTransformDiskCacheKey(filePath, *context, *config,
+                                                                   *fileTransform,
+                                                                   OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_ASSERT(!key1.empty());
+
+    // An in-place edit changing the size.
+    writeFile("0.5");
+    const std::string key2 = OCIO::CreateFileTransformDiskCacheKey(filePath, *context, *config,
+                                                                   *fileTransform,
+                                                                   OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_ASSERT(!key2.empty());
+    OCIO_CHECK_NE(key1, key2);
+
+    // The path is normalized.
+    const std::string otherPath = pystring::os::path::join(tmpDir, "./lut.spi1d");
+    OCIO_CHECK_EQUAL(OCIO::CreateFileTransformDiskCacheKey(otherPath, *context, *config, *fileTransform,
+                                                           OCIO::TRANSFORM_DIR_FORWARD),
+                     key2);
+
+    OCIO_CHECK_EQUAL(OCIO::CreateFileTransformDiskCacheKey(filePath + ".missing", *context, *config,
+                                                           *fileTransform,
+                                                           OCIO::TRANSFORM_DIR_FORWARD),
+                     "");
+
+    OCIO::RemoveTemporaryDirectory(tmpDir);
+}
+
+OCIO_ADD_TEST(FileTransformDiskCache, load_from_cache_directory)
+{
+    const std::string cacheDir = OCIO::CreateTemporaryDirectory("FileTransformDiskCache");
+    OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_LUT_CACHE_DIR, cacheDir);
+
+    OCIO_CHECK_EQUAL(OCIO::GetFileTransformDiskCacheDir(), cacheDir);
+
+    OCIO::ConstConfigRcPtr config = CreateTestConfig();
+
+    const std::string fileName{ "clf/lut3d_17x17x17_10i_12i.clf" };
+
+    OCIO::FileTransformRcPtr fileTransform = OCIO::FileTransform::Create();
+    fileTransform->setSrc(fileName.c_str());
+    const std::string filePath = config->getCurrentContext()->resolveFileLocation(fileName.c_str());
+    const std::string key = OCIO::CreateFileTransformDiskCacheKey(filePath,
+                                                                  *config->getCurrentContext(),
+                                                                  *config, *fileTransform,
+                                                                  OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_REQUIRE_ASSERT(!key.empty());
+    const std::string entryPath = OCIO::GetEntryPath(cacheDir, key);
+
+    // Note that the statistics of the in-memory file cache count the parsed files.
+    const size_t initialMisses = OCIO::GetFileCacheStatistics().m_misses;
+
+    // The first build parses the file and creates the cache entry.
+    OCIO::ClearAllCaches();
+    const OCIO::OpRcPtrVec ops = BuildFileOps(config, fileName, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_EQUAL(OCIO::GetFileCacheStatistics().m_misses, initialMisses + 1);
+    OCIO_CHECK_ASSERT(std::ifstream(entryPath).good());
+
+    // The next build (e.g. by another process) does not parse the file.
+    OCIO::ClearAllCaches();
+    const OCIO::OpRcPtrVec cachedOps = BuildFileOps(config, fileName, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_EQUAL(OCIO::GetFileCacheStatistics().m_misses, initialMisses + 1);
+    CheckEqualOps(ops, cachedOps, __LINE__);
+
+    // The ops loaded from the entry are kept in memory i.e. the entry is not read again.
+    {
+        const std::string movedPath = entryPath + ".moved";
+        OCIO_REQUIRE_EQUAL(std::rename(entryPath.c_str(), movedPath.c_str()), 0);
+
+        const OCIO::OpRcPtrVec memOps = BuildFileOps(config, fileName, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_EQUAL(OCIO::GetFileCacheStatistics().m_misses, initialMisses + 1);
+        CheckEqualOps(ops, memOps, __LINE__);
+
+        // The ops are cloned.
+        OCIO_CHECK_NE(memOps[1].get(), cachedOps[1].get());
+
+        OCIO_REQUIRE_EQUAL(std::rename(movedPath.c_str(), entryPath.c_str()), 0);
+    }
+
+    // Another direction is another cache entry.
+    const OCIO::OpRcPtrVec invOps = BuildFileOps(config, fileName, OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO_CHECK_EQUAL(OCIO::GetFileCacheStatistics().m_misses, initialMisses + 2);
+    OCIO_CHECK_NE(invOps[1]->getCacheID(), ops[1]->getCacheID());
+
+    // An invalid entry is ignored and the file is parsed again.
+    {
+        std::ofstream entry(entryPath, std::ios_base::out | std::ios_base::binary);
+        entry << "OCIOLUTC not a valid entry";
+    }
+
+    OCIO::ClearAllCaches();
+    const OCIO::OpRcPtrVec parsedOps = BuildFileOps(config, fileName, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_EQUAL(OCIO::GetFileCacheStatistics().m_misses, initialMisses + 3);
+    CheckEqualOps(ops, parsedOps, __LINE__);
+
+    // The persistent cache follows the in-memory cache settings.
+    {
+        OCIO::EnvironmentVariableGuard disableGuard(OCIO::OCIO_DISABLE_ALL_CACHES, "1");
+        OCIO_CHECK_EQUAL(OCIO::GetFileTransformDiskCacheDir(), "");
+    }
+
+    OCIO::ClearAllCaches();
+    OCIO::RemoveTemporaryDirectory(cacheDir);
+}
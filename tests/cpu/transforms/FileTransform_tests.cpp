@@ -290,6 +290,103 @@ OCIO_ADD_TEST(FileTransform, format_by_index)
     ValidateFormatByIndex(formatRegistry, OCIO::FORMAT_CAPABILITY_READ);
 }
 
+namespace
+{
+OCIO::FileFormat::ProbeResult Probe(const std::string & formatName, const std::string & content)
+{
+    OCIO::FileFormat * format = OCIO::FormatRegistry::GetInstance().getFileFormatByName(formatName);
+    OCIO_REQUIRE_ASSERT(format);
+    return format->probe(content.data(), content.size());
+}
+}
+
+OCIO_ADD_TEST(FileTransform, probe_formats)
+{
+    const std::string resolve("# Comment\nLUT_1D_SIZE 2\nLUT_3D_SIZE 2\n0 0 0\n");
+    const std::string iridas("TITLE \"test\"\nDOMAIN_MIN 0 0 0\nLUT_3D_SIZE 2\n0 0 0\n");
+    const std::string cube("LUT_3D_SIZE 2\n0 0 0\n");
+
+    OCIO_CHECK_EQUAL(Probe("resolve_cube", resolve), OCIO::FileFormat::PROBE_YES);
+    OCIO_CHECK_EQUAL(Probe("iridas_cube", resolve), OCIO::FileFormat::PROBE_NO);
+    OCIO_CHECK_EQUAL(Probe("resolve_cube", iridas), OCIO::FileFormat::PROBE_NO);
+    OCIO_CHECK_EQUAL(Probe("iridas_cube", iridas), OCIO::FileFormat::PROBE_YES);
+    OCIO_CHECK_EQUAL(Probe("resolve_cube", cube), OCIO::FileFormat::PROBE_MAYBE);
+    OCIO_CHECK_EQUAL(Probe("iridas_cube", cube), OCIO::FileFormat::PROBE_MAYBE);
+
+    OCIO_CHECK_EQUAL(Probe("cinespace", "\r\n  CSPLUTV100\r\n3D\r\n"), OCIO::FileFormat::PROBE_YES);
+    OCIO_CHECK_EQUAL(Probe("cinespace", cube), OCIO::FileFormat::PROBE_NO);
+    OCIO_CHECK_EQUAL(Probe("spi3d", "SPILUT 1.0\n3 3\n"), OCIO::FileFormat::PROBE_YES);
+    OCIO_CHECK_EQUAL(Probe("spi3d", "\nSPILUT 1.0\n3 3\n"), OCIO::FileFormat::PROBE_NO);
+    OCIO_CHECK_EQUAL(Probe("spi1d", "Version 1\nFrom 0 1\nLength 2\n{\n"),
+                     OCIO::FileFormat::PROBE_YES);
+    OCIO_CHECK_EQUAL(Probe("spi1d", "From 0 1\nLength 2\n{\n"), OCIO::FileFormat::PROBE_NO);
+    OCIO_CHECK_EQUAL(Probe("spi1d", cube), OCIO::FileFormat::PROBE_MAYBE);
+    OCIO_CHECK_EQUAL(Probe("truelight", "# Truelight Cube v2.0\n"), OCIO::FileFormat::PROBE_YES);
+    OCIO_CHECK_EQUAL(Probe("nukevf", "#Inventor V2.1 ascii\n"), OCIO::FileFormat::PROBE_YES);
+    OCIO_CHECK_EQUAL(Probe("nukevf", cube), OCIO::FileFormat::PROBE_NO);
+    OCIO_CHECK_EQUAL(Probe("International Color Consortium profile", cube),
+                     OCIO::FileFormat::PROBE_NO);
+
+    // XML based formats.
+    const std::string ctf("\xEF\xBB\xBF<?xml version=\"1.0\"?>\n<ProcessList id=\"1\">\n");
+    const std::string cc("  <ColorCorrection id=\"cc\">\n");
+    const std::string ccc("<ColorCorrectionCollection>\n<ColorCorrection id=\"cc\">\n");
+
+    OCIO_CHECK_EQUAL(Probe(OCIO::FILEFORMAT_CLF, ctf), OCIO::FileFormat::PROBE_YES);
+    OCIO_CHECK_EQUAL(Probe(OCIO::FILEFORMAT_CLF, cc), OCIO::FileFormat::PROBE_NO);
+    OCIO_CHECK_EQUAL(Probe("ColorCorrection", cc), OCIO::FileFormat::PROBE_YES);
+    OCIO_CHECK_EQUAL(Probe("ColorCorrection", ccc), OCIO::FileFormat::PROBE_MAYBE);
+    OCIO_CHECK_EQUAL(Probe("ColorCorrection", ctf), OCIO::FileFormat::PROBE_MAYBE);
+    OCIO_CHECK_EQUAL(Probe("ColorCorrection", cube), OCIO::FileFormat::PROBE_NO);
+    OCIO_CHECK_EQUAL(Probe("ColorCorrectionCollection", ccc), OCIO::FileFormat::PROBE_YES);
+    OCIO_CHECK_EQUAL(Probe("ColorDecisionList", ccc), OCIO::FileFormat::PROBE_MAYBE);
+    OCIO_CHECK_EQUAL(Probe("iridas_look", cube), OCIO::FileFormat::PROBE_NO);
+
+    // Formats without a signature.
+    OCIO_CHECK_EQUAL(Probe("flame", cube), OCIO::FileFormat::PROBE_MAYBE);
+}
+
+OCIO_ADD_TEST(FileTransform, load_file_probing)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::FileFormat * format = nullptr;
+    OCIO::CachedFileRcPtr cachedFile;
+    size_t size = 0;
+
+    {
+        // The Resolve reader goes first, the Iridas one is not even tried.
+        OCIO::LogGuard logGuard;
+        const std::string filePath(OCIO::GetTestFilesDir() + "/resolve_1d3d.cube");
+        OCIO_CHECK_NO_THROW(OCIO::LoadFileUncached(format, cachedFile, size, filePath,
+                                                   OCIO::INTERP_DEFAULT, *config));
+        OCIO_REQUIRE_ASSERT(format);
+        OCIO_CHECK_EQUAL(format->getName(), "resolve_cube");
+        OCIO_CHECK_ASSERT(size > 0);
+        OCIO_CHECK_EQUAL(logGuard.output().find("Failed primary format"), std::string::npos);
+    }
+
+    {
+        // The formats not recognizing the content are skipped.
+        OCIO::LogGuard logGuard;
+        const std::string filePath(OCIO::GetTestFilesDir() + "/error_unknown_format.txt");
+        OCIO_CHECK_THROW_WHAT(OCIO::LoadFileUncached(format, cachedFile, size, filePath,
+                                                     OCIO::INTERP_DEFAULT, *config),
+                              OCIO::Exception, "All formats have been tried");
+        OCIO_CHECK_NE(logGuard.output().find("Skipped alt format cinespace"), std::string::npos);
+        OCIO_CHECK_NE(logGuard.output().find("Skipped alt format " + std::string(OCIO::FILEFORMAT_CLF)),
+                      std::string::npos);
+        OCIO_CHECK_NE(logGuard.output().find("Failed alt format flame"), std::string::npos);
+    }
+
+    {
+        const std::string filePath(OCIO::GetTestFilesDir() + "/missing.file");
+        OCIO_CHECK_THROW_WHAT(OCIO::LoadFileUncached(format, cachedFile, size, filePath,
+                                                     OCIO::INTERP_DEFAULT, *config),
+                              OCIO::Exception, "could not be opened");
+    }
+}
+
 OCIO_ADD_TEST(FileTransform, is_format_extension_supported)
 {
     OCIO::FormatRegistry & formatRegistry = OCIO::FormatRegistry::GetInstance();
@@ -157,3 +157,31 @@ END METADATA
         self.assertEqual(len(fmts), 12)
         self.assertEqual("cinespace", fmts[4][0])
         self.assertEqual("3dl", fmts[1][1])
+
+    def test_bake_targets(self):
+        """
+        Test baking a list of display / view targets.
+        """
+        cfg = OCIO.Config().CreateFromStream(self.SIMPLE_PROFILE)
+
+        bake = OCIO.Baker()
+        bake.setConfig(cfg)
+        bake.setFormat("cinespace")
+        bake.setInputSpace("lnh")
+        bake.setShaperSize(4)
+        bake.setCubeSize(2)
+
+        luts = bake.bake([("TestDisplay", "TestView", ""), ("TestDisplay", "TestView", "")])
+        self.assertEqual(len(luts), 2)
+        for lut in luts:
+            self.assert_lut_match(lut, self.EXPECTED_LUT)
+
+        # The settings of the baker are unchanged.
+        self.assertEqual("", bake.getDisplay())
+
+        self.assertEqual(bake.bake([]), [])
+
+        with self.assertRaises(OCIO.Exception):
+            bake.bake([("", "TestView", "")])
+        with self.assertRaises(OCIO.Exception):
+            bake.bake([("TestDisplay", "UnknownView", "")])
@@ -69,4 +69,62 @@ colorspaces:
       # Confirm that the processor is the same.
       procE = cfg.getProcessor("cs3", "disp1", "view1", OCIO.TRANSFORM_DIR_FORWARD)
 
-      self.assertEqual(procD, procE)
\ No newline at end of file
+      self.assertEqual(procD, procE)
+
+      # Test the capacity and the statistics of the Processor cache.
+
+      cfg.clearProcessorCache()
+      cfg.setProcessorCacheCapacity(1, 0)
+
+      procF = cfg.getProcessor("cs1", "cs2")
+      self.assertEqual(procF, cfg.getProcessor("cs1", "cs2"))
+
+      # The least recently used processor is evicted.
+      procG = cfg.getProcessor("cs1", "cs3")
+      self.assertNotEqual(procF, cfg.getProcessor("cs1", "cs2"))
+
+      stats = cfg.getProcessorCacheStatistics()
+      self.assertEqual(stats.numEntries, 1)
+      self.assertGreater(stats.sizeInBytes, 0)
+      self.assertGreaterEqual(stats.hits, 1)
+      self.assertGreaterEqual(stats.misses, 3)
+      self.assertGreaterEqual(stats.evictions, 2)
+
+      # Test the capacity of the optimized, CPU and GPU processor caches of a Processor.
+
+      cfg.setSubProcessorCacheCapacity(1, 0)
+      cfg.clearProcessorCache()
+
+      procH = cfg.getProcessor("cs1", "cs2")
+      procH.getOptimizedCPUProcessor(OCIO.OPTIMIZATION_NONE)
+      procH.getOptimizedCPUProcessor(OCIO.OPTIMIZATION_LOSSLESS)
+
+      stats = procH.getSubProcessorCacheStatistics()
+      self.assertEqual(stats.numEntries, 1)
+      self.assertEqual(stats.misses, 2)
+      self.assertEqual(stats.evictions, 1)
+
+      # Changing the optimization opt-ins clears the processor cache.
+
+      self.assertEqual(cfg.getOptimizationOptIns(), OCIO.OPTIMIZATION_OPT_IN_NONE)
+      cfg.setOptimizationOptIns(OCIO.OPTIMIZATION_OPT_IN_LUT_INV_FAST_HIGH_RES)
+      self.assertEqual(cfg.getOptimizationOptIns(),
+                       OCIO.OPTIMIZATION_OPT_IN_LUT_INV_FAST_HIGH_RES)
+      self.assertEqual(cfg.getProcessorCacheStatistics().numEntries, 0)
+
+    def test_file_cache(self):
+      OCIO.ClearAllCaches()
+      OCIO.SetFileCacheCapacity(1, 0)
+
+      cfg = OCIO.Config.CreateRaw()
+      cfg.setSearchPath(TEST_DATAFILES_DIR)
+      cfg.getProcessor(OCIO.FileTransform(src="lut1d_1.spi1d"))
+      cfg.getProcessor(OCIO.FileTransform(src="lut1d_2.spi1d"))
+
+      stats = OCIO.GetFileCacheStatistics()
+      self.assertEqual(stats.numEntries, 1)
+      self.assertGreater(stats.sizeInBytes, 0)
+      self.assertGreaterEqual(stats.evictions, 1)
+
+      OCIO.SetFileCacheCapacity(0, 0)
+      OCIO.ClearAllCaches()
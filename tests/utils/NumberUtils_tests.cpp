@@ -5,6 +5,7 @@
 #include "testutils/UnitTest.h"
 #include "utils/NumberUtils.h"
 
+#include <cmath>
 #include <limits>
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -81,3 +82,58 @@ OCIO_ADD_TEST(NumberUtils, from_chars_float_failures)
 
 #undef TEST_FROM_CHARS
 }
+
+OCIO_ADD_TEST(NumberUtils, from_chars_fast)
+{
+    // The fast path results are identical to from_chars().
+    const char * values[] = {
+        "0", "-0", "+0", "1", "-7", "1.5", "-.75", "11.", "0.123456", "0.1234567",
+        "0.000001", "1e3", "50e-2", "-1.5e2", "1E+22", "1e-22", "0.100000", "100.000",
+        "16777215", "16777217", "9007199254740991", "0.7071067811865476", "00012.5000"
+    };
+
+    for (const char * text : values)
+    {
+        const std::string str(text);
+
+        float expectedFloat = 7.5f;
+        OCIO::NumberUtils::from_chars(str.data(), str.data() + str.size(), expectedFloat);
+        float valFloat = 0.0f;
+        if (OCIO::NumberUtils::from_chars_fast(str.data(), str.data() + str.size(), valFloat))
+        {
+            OCIO_CHECK_EQUAL(valFloat, expectedFloat);
+            OCIO_CHECK_EQUAL(std::signbit(valFloat), std::signbit(expectedFloat));
+        }
+
+        double expectedDouble = 7.5;
+        OCIO::NumberUtils::from_chars(str.data(), str.data() + str.size(), expectedDouble);
+        double valDouble = 0.0;
+        OCIO_CHECK_ASSERT(
+            OCIO::NumberUtils::from_chars_fast(str.data(), str.data() + str.size(), valDouble));
+        OCIO_CHECK_EQUAL(valDouble, expectedDouble);
+        OCIO_CHECK_EQUAL(std::signbit(valDouble), std::signbit(expectedDouble));
+    }
+
+    std::string str;
+    float val = 7.5f;
+
+#define TEST_FROM_CHARS_FAST(text) \
+    str = text; \
+    OCIO_CHECK_ASSERT(!OCIO::NumberUtils::from_chars_fast(str.data(), str.data() + str.size(), val)); \
+    OCIO_CHECK_EQUAL(val, 7.5f)
+
+    // Not handled by the fast path i.e. from_chars() is needed.
+    TEST_FROM_CHARS_FAST("");
+    TEST_FROM_CHARS_FAST("+.");
+    TEST_FROM_CHARS_FAST("e3");
+    TEST_FROM_CHARS_FAST("1e");
+    TEST_FROM_CHARS_FAST("-7.5ab");
+    TEST_FROM_CHARS_FAST("  1.5");
+    TEST_FROM_CHARS_FAST("nan");
+    TEST_FROM_CHARS_FAST("0x42");
+    TEST_FROM_CHARS_FAST("1e11");
+    TEST_FROM_CHARS_FAST("123456789");
+    TEST_FROM_CHARS_FAST("0.333333333333333333");
+
+#undef TEST_FROM_CHARS_FAST
+}